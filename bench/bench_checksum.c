@@ -0,0 +1,127 @@
+// ============================================================================
+// 체크섬 마이크로벤치마크
+//   기존 루프 (LogRemote XOR-회전, 설정 덧셈-회전) vs 비트 단위 CRC vs Checksum 모듈 (slicing-by-4)
+//   크기: 18B (상태 변경 패킷), 원격 프레임 1개, 저널 레코드 최대 크기
+// 출력의 cycles_per_byte는 x86 TSC 기준 (다른 호스트에서는 ns_per_byte만 비교)
+// ============================================================================
+
+#include "bench_common.h"
+#include "Checksum.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAS_TSC 1
+#else
+#define BENCH_HAS_TSC 0
+#endif
+
+#define BENCH_BYTES_PER_RUN     (256 * 1024)
+
+static uint8_t g_data[2048];
+static volatile uint32_t g_sink;
+
+// 예전 LogRemote_CalculateChecksum (XOR 후 좌 회전)
+static uint16_t _legacy_xor_rotate(const uint8_t* data, size_t len)
+{
+    uint16_t checksum = 0;
+    for (size_t i = 0; i < len; i++) {
+        checksum ^= data[i];
+        checksum = (uint16_t)((checksum << 1) | (checksum >> 15));
+    }
+    return checksum;
+}
+
+// 예전 _calculate_config_crc (덧셈 후 좌 회전)
+static uint32_t _legacy_add_rotate(const uint8_t* data, size_t len)
+{
+    uint32_t crc = 0;
+    for (size_t i = 0; i < len; i++) {
+        crc += data[i];
+        crc = (crc << 1) | (crc >> 31);
+    }
+    return crc;
+}
+
+typedef struct {
+    const char* name;
+    uint32_t (*fn)(const uint8_t* data, size_t len);
+} ChecksumCase;
+
+static uint32_t _case_xor_rotate(const uint8_t* d, size_t n) { return _legacy_xor_rotate(d, n); }
+static uint32_t _case_add_rotate(const uint8_t* d, size_t n) { return _legacy_add_rotate(d, n); }
+static uint32_t _case_crc16_bitwise(const uint8_t* d, size_t n) { return Checksum_Crc16Bitwise(d, n); }
+static uint32_t _case_crc32_bitwise(const uint8_t* d, size_t n) { return Checksum_Crc32Bitwise(d, n); }
+static uint32_t _case_crc16(const uint8_t* d, size_t n) { return Checksum_Crc16(d, n); }
+static uint32_t _case_crc32(const uint8_t* d, size_t n) { return Checksum_Crc32(d, n); }
+
+typedef struct {
+    const ChecksumCase* c;
+    size_t len;
+    uint32_t calls;
+} BenchCtx;
+
+static void _run(void* ctx)
+{
+    BenchCtx* b = (BenchCtx*)ctx;
+    uint32_t acc = 0;
+    for (uint32_t i = 0; i < b->calls; i++) {
+        acc ^= b->c->fn(g_data, b->len);
+    }
+    g_sink = acc;
+}
+
+static double _cycles_per_byte(BenchCtx* b)
+{
+#if BENCH_HAS_TSC
+    double best = -1.0;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        uint64_t start = __rdtsc();
+        _run(b);
+        double cpb = (double)(__rdtsc() - start) / ((double)b->calls * (double)b->len);
+        if (best < 0.0 || cpb < best) {
+            best = cpb;
+        }
+    }
+    return best;
+#else
+    (void)b;
+    return 0.0;
+#endif
+}
+
+int main(void)
+{
+    static const ChecksumCase cases[] = {
+        { "legacy_xor_rotate", _case_xor_rotate },
+        { "legacy_add_rotate", _case_add_rotate },
+        { "crc16_bitwise", _case_crc16_bitwise },
+        { "crc32_bitwise", _case_crc32_bitwise },
+        { "crc16_slice4", _case_crc16 },
+        { "crc32_slice4", _case_crc32 },
+    };
+    static const size_t sizes[] = { 18, 512, 1040 };
+
+    srand(1);
+    for (size_t i = 0; i < sizeof(g_data); i++) {
+        g_data[i] = (uint8_t)rand();
+    }
+    Checksum_Init();
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+            BenchCtx ctx = { &cases[c], sizes[s], (uint32_t)(BENCH_BYTES_PER_RUN / sizes[s]) };
+            double ns_per_run = bench_measure(_run, &ctx, 20);
+            double ns_per_byte = ns_per_run / ((double)ctx.calls * (double)ctx.len);
+
+            char name[64];
+            char extra[128];
+            snprintf(name, sizeof(name), "%s_%zu", cases[c].name, sizes[s]);
+            snprintf(extra, sizeof(extra), ",\"ns_per_byte\":%.3f,\"cycles_per_byte\":%.2f",
+                     ns_per_byte, _cycles_per_byte(&ctx));
+            bench_emit("checksum", name, ctx.calls, ns_per_run / ctx.calls, (double)sizes[s], extra);
+        }
+    }
+    return 0;
+}
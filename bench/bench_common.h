@@ -0,0 +1,64 @@
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+// ============================================================================
+// 호스트 마이크로벤치마크 공통 유틸리티
+// 결과는 한 줄에 하나씩 JSON 객체로 출력 (커밋 간 비교용)
+// ============================================================================
+
+#ifndef BENCH_GIT_REV
+#define BENCH_GIT_REV "unknown"
+#endif
+
+// 같은 측정을 반복해 가장 빠른 값을 사용 (스케줄러 노이즈 제거)
+#define BENCH_REPEATS  5
+
+typedef void (*BenchFn)(void* ctx);
+
+static inline uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// fn을 iterations번 호출하는 측정을 BENCH_REPEATS회 반복, 최소 ns/op 반환
+static inline double bench_measure(BenchFn fn, void* ctx, uint32_t iterations)
+{
+    double best = -1.0;
+
+    // 워밍업 (캐시/분기 예측)
+    for (uint32_t i = 0; i < iterations / 10 + 1; i++) {
+        fn(ctx);
+    }
+
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        uint64_t start = bench_now_ns();
+        for (uint32_t i = 0; i < iterations; i++) {
+            fn(ctx);
+        }
+        double ns_per_op = (double)(bench_now_ns() - start) / (double)iterations;
+        if (best < 0.0 || ns_per_op < best) {
+            best = ns_per_op;
+        }
+    }
+
+    return best;
+}
+
+// 결과 한 줄 출력: extra_json은 ',"key":value' 형태의 추가 필드 (없으면 "")
+static inline void bench_emit(const char* suite, const char* name, uint32_t iterations,
+                              double ns_per_op, double bytes_per_op, const char* extra_json)
+{
+    printf("{\"suite\":\"%s\",\"case\":\"%s\",\"rev\":\"%s\",\"iterations\":%u,"
+           "\"ns_per_op\":%.1f,\"bytes_per_op\":%.1f%s}\n",
+           suite, name, BENCH_GIT_REV, iterations, ns_per_op, bytes_per_op,
+           extra_json ? extra_json : "");
+    fflush(stdout);
+}
+
+#endif // BENCH_COMMON_H
@@ -0,0 +1,227 @@
+// ============================================================================
+// SD 로그 압축(LogCompress) 벤치마크
+// 압축률, 압축/복원 ns/byte, cycles/byte(x86 rdtsc) 측정
+//   ./bench_compress [캡처한 로그 파일]   (인자가 없으면 합성 로그 사용)
+// ============================================================================
+
+#include "bench_common.h"
+#include "LogCompress.h"
+#include "system_config.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAS_TSC 1
+#endif
+
+#define SYNTHETIC_LOG_SIZE  (256 * 1024)
+#define FLUSH_RAW_BYTES     SD_COMPRESS_FLUSH_RAW_BYTES
+
+typedef struct {
+    const uint8_t* input;
+    size_t input_len;
+    uint8_t* stream;
+    size_t stream_len;
+    uint8_t* restored;
+    size_t restored_len;
+} CompressCtx;
+
+static LogCompressor g_compressor;
+static LogDecompressor g_decompressor;
+
+// ----------------------------------------------------------------------------
+// 입력 준비
+// ----------------------------------------------------------------------------
+
+// 실제 로그 포맷을 흉내낸 합성 로그 (캡처 로그가 없을 때)
+static size_t _make_synthetic_log(uint8_t* out, size_t max_len)
+{
+    static const char* messages[] = {
+        "[INFO] [LoRa] Sending: AT+SEND=2:%08X",
+        "[INFO] [LoRa] RX: +EVT:SEND_CONFIRMED_OK",
+        "[DEBUG] [LoRa] RX: +EVT:RX_1:-%d:%d:UNICAST:2:%08X",
+        "[INFO] [LoRa] State: SEND_PERIODIC -> WAIT_SEND_RESPONSE",
+        "[WARN] [LoRa] Send timeout, retry %d/3",
+        "[INFO] [SD_TASK] SD card status OK, log size: %d bytes",
+        "[DEBUG] [Network] Sent %d bytes",
+        "[ERROR] [LoRa] RX: +EVT:SEND_CONFIRMED_FAILED(%d)",
+    };
+    const size_t message_count = sizeof(messages) / sizeof(messages[0]);
+
+    uint32_t seed = 0x1234ABCD;
+    uint32_t second = 0;
+    size_t len = 0;
+    char line[192];
+    char body[128];
+
+    while (len + sizeof(line) < max_len) {
+        seed = seed * 1103515245U + 12345U;
+        uint32_t pick = (seed >> 16) % message_count;
+        snprintf(body, sizeof(body), messages[pick], seed >> 8, (int)(seed % 120), (int)(seed % 12), seed);
+        second += (seed >> 28) & 1;
+        int n = snprintf(line, sizeof(line), "[2025-08-01 %02u:%02u:%02u KST] %s\r\n",
+                         (second / 3600) % 24, (second / 60) % 60, second % 60, body);
+        memcpy(&out[len], line, (size_t)n);
+        len += (size_t)n;
+    }
+    return len;
+}
+
+static uint8_t* _load_file(const char* path, size_t* len)
+{
+    FILE* fp = fopen(path, "rb");
+    if (fp == NULL) {
+        return NULL;
+    }
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    uint8_t* data = (size > 0) ? malloc((size_t)size) : NULL;
+    if (data != NULL && fread(data, 1, (size_t)size, fp) != (size_t)size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(fp);
+    *len = (data != NULL) ? (size_t)size : 0;
+    return data;
+}
+
+// ----------------------------------------------------------------------------
+// 측정 대상: SDStorage와 같이 줄 단위로 넣고 임계값마다 블록 flush
+// ----------------------------------------------------------------------------
+
+static void _append_block(CompressCtx* ctx)
+{
+    const uint8_t* block = NULL;
+    size_t size = LogCompress_Flush(&g_compressor, &block);
+    memcpy(&ctx->stream[ctx->stream_len], block, size);
+    ctx->stream_len += size;
+}
+
+static void _bench_compress(void* arg)
+{
+    CompressCtx* ctx = (CompressCtx*)arg;
+    const uint8_t* p = ctx->input;
+    const uint8_t* end = ctx->input + ctx->input_len;
+
+    LogCompress_Init(&g_compressor);
+    ctx->stream_len = 0;
+
+    while (p < end) {
+        const uint8_t* nl = memchr(p, '\n', (size_t)(end - p));
+        size_t line_len = (nl != NULL) ? (size_t)(nl - p) + 1 : (size_t)(end - p);
+        if (line_len > 1024) {
+            line_len = 1024;
+        }
+        if (!LogCompress_HasRoom(&g_compressor, line_len)) {
+            _append_block(ctx);
+        }
+        LogCompress_Write(&g_compressor, p, line_len);
+        if (LogCompress_PendingRaw(&g_compressor) >= FLUSH_RAW_BYTES) {
+            _append_block(ctx);
+        }
+        p += line_len;
+    }
+    if (LogCompress_PendingRaw(&g_compressor) > 0) {
+        _append_block(ctx);
+    }
+}
+
+static void _bench_decompress(void* arg)
+{
+    CompressCtx* ctx = (CompressCtx*)arg;
+    size_t pos = 0;
+
+    LogDecompress_Init(&g_decompressor);
+    ctx->restored_len = 0;
+
+    while (pos < ctx->stream_len) {
+        size_t consumed = 0;
+        size_t out_len = 0;
+        if (LogDecompress_Block(&g_decompressor, &ctx->stream[pos], ctx->stream_len - pos, &consumed,
+                                &ctx->restored[ctx->restored_len], ctx->input_len - ctx->restored_len,
+                                &out_len) != LOG_COMPRESS_OK) {
+            break;
+        }
+        pos += consumed;
+        ctx->restored_len += out_len;
+    }
+}
+
+// 1회 실행의 TSC 사이클 (최소값)
+static double _measure_cycles(BenchFn fn, void* ctx)
+{
+#ifdef BENCH_HAS_TSC
+    double best = -1.0;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        uint64_t start = __rdtsc();
+        fn(ctx);
+        double cycles = (double)(__rdtsc() - start);
+        if (best < 0.0 || cycles < best) {
+            best = cycles;
+        }
+    }
+    return best;
+#else
+    (void)fn;
+    (void)ctx;
+    return -1.0;
+#endif
+}
+
+int main(int argc, char** argv)
+{
+    CompressCtx ctx = {0};
+    uint8_t* input = NULL;
+    const char* corpus = "synthetic";
+
+    if (argc > 1) {
+        input = _load_file(argv[1], &ctx.input_len);
+        if (input == NULL) {
+            fprintf(stderr, "bench_compress: cannot read %s\n", argv[1]);
+            return 1;
+        }
+        corpus = "captured";
+    } else {
+        input = malloc(SYNTHETIC_LOG_SIZE);
+        ctx.input_len = _make_synthetic_log(input, SYNTHETIC_LOG_SIZE);
+    }
+
+    ctx.input = input;
+    // 최악의 경우 블록 오버헤드를 감안한 크기
+    ctx.stream = malloc(ctx.input_len + ctx.input_len / 64 + LOG_COMPRESS_BLOCK_SIZE);
+    ctx.restored = malloc(ctx.input_len);
+
+    uint32_t iterations = (uint32_t)(32 * 1024 * 1024 / (ctx.input_len + 1)) + 1;
+    char extra[192];
+    char name[64];
+
+    double compress_ns = bench_measure(_bench_compress, &ctx, iterations);
+    double compress_cycles = _measure_cycles(_bench_compress, &ctx);
+    double ratio = (double)ctx.stream_len / (double)ctx.input_len;
+
+    double decompress_ns = bench_measure(_bench_decompress, &ctx, iterations);
+    double decompress_cycles = _measure_cycles(_bench_decompress, &ctx);
+    int roundtrip_ok = (ctx.restored_len == ctx.input_len) &&
+                       (memcmp(ctx.restored, ctx.input, ctx.input_len) == 0);
+
+    snprintf(name, sizeof(name), "compress_%s", corpus);
+    snprintf(extra, sizeof(extra),
+             ",\"input_bytes\":%zu,\"output_bytes\":%zu,\"ratio\":%.3f,\"ns_per_byte\":%.2f,\"cycles_per_byte\":%.2f",
+             ctx.input_len, ctx.stream_len, ratio, compress_ns / (double)ctx.input_len,
+             compress_cycles / (double)ctx.input_len);
+    bench_emit("log_compress", name, iterations, compress_ns, (double)ctx.stream_len, extra);
+
+    snprintf(name, sizeof(name), "decompress_%s", corpus);
+    snprintf(extra, sizeof(extra),
+             ",\"input_bytes\":%zu,\"ns_per_byte\":%.2f,\"cycles_per_byte\":%.2f,\"roundtrip_ok\":%s",
+             ctx.stream_len, decompress_ns / (double)ctx.input_len,
+             decompress_cycles / (double)ctx.input_len, roundtrip_ok ? "true" : "false");
+    bench_emit("log_compress", name, iterations, decompress_ns, (double)ctx.restored_len, extra);
+
+    free(ctx.restored);
+    free(ctx.stream);
+    free(input);
+    return roundtrip_ok ? 0 : 1;
+}
@@ -0,0 +1,209 @@
+// ============================================================================
+// LOGGER_SendFormatted 마이크로벤치마크
+// 타겟 logger.c를 호스트에서 빌드하고 출력 경로(터미널/SD)를 계측 스텁으로 대체
+// ============================================================================
+
+#include "bench_common.h"
+#include "logger.h"
+#include "SDService.h"
+#include <string.h>
+
+#define BENCH_ITERATIONS  200000
+
+// ----------------------------------------------------------------------------
+// 계측 스텁
+// ----------------------------------------------------------------------------
+
+static uint64_t g_terminal_calls;
+static uint64_t g_terminal_bytes;
+static uint64_t g_sd_calls;
+static uint64_t g_sd_bytes;
+static uint64_t g_bin_calls;
+static uint64_t g_bin_bytes;
+static volatile uint8_t g_sink;  // 컴파일러가 출력을 제거하지 못하도록
+
+LoggerStatus LOGGER_Platform_Send(const char* message)
+{
+    size_t len = strlen(message);
+    g_terminal_calls++;
+    g_terminal_bytes += len + 2;  // 실제 플랫폼은 "\r\n"을 덧붙임
+    g_sink ^= (uint8_t)message[len / 2];
+    return LOGGER_STATUS_OK;
+}
+
+LoggerStatus LOGGER_Platform_Connect(const char* server_ip, int port)
+{
+    (void)server_ip;
+    (void)port;
+    return LOGGER_STATUS_OK;
+}
+
+LoggerStatus LOGGER_Platform_Disconnect(void)
+{
+    return LOGGER_STATUS_OK;
+}
+
+ResultCode SDService_Append(const void* data, size_t size)
+{
+    g_sd_calls++;
+    g_sd_bytes += size + 2;  // SD 태스크의 SDStorage가 "\r\n"을 덧붙임
+    g_sink ^= ((const uint8_t*)data)[size / 2];
+    return SDSTORAGE_OK;
+}
+
+// SD 바이너리 싱크 기본 writer가 넣는 요청 (SD 태스크가 저널 BINARY 레코드로 기록)
+ResultCode SDService_AppendBinary(const void* data, size_t size)
+{
+    g_bin_calls++;
+    g_bin_bytes += size;
+    g_sink ^= ((const uint8_t*)data)[size / 2];
+    return SDSTORAGE_OK;
+}
+
+bool SDService_IsReady(void)
+{
+    return true;
+}
+
+uint32_t TIME_Platform_GetCurrentMs(void)
+{
+    return (uint32_t)(bench_now_ns() / 1000000ULL);
+}
+
+void TIME_Platform_DelayMs(uint32_t ms)
+{
+    (void)ms;
+}
+
+uint64_t TIME_Platform_GetMonotonicMs(void)
+{
+    return bench_now_ns() / 1000000ULL;
+}
+
+uint64_t TIME_Platform_GetMonotonicUs(void)
+{
+    return bench_now_ns() / 1000ULL;
+}
+
+static void _reset_counters(void)
+{
+    g_terminal_calls = 0;
+    g_terminal_bytes = 0;
+    g_sd_calls = 0;
+    g_sd_bytes = 0;
+    g_bin_calls = 0;
+    g_bin_bytes = 0;
+}
+
+// ----------------------------------------------------------------------------
+// 벤치마크 케이스
+// ----------------------------------------------------------------------------
+
+typedef struct {
+    LogLevel level;
+    int arg_count;
+} LogCase;
+
+static void _log_once(void* ctx)
+{
+    const LogCase* c = (const LogCase*)ctx;
+
+    switch (c->arg_count) {
+        case 0:
+            LOGGER_SendFormatted(c->level, "[LoRa] Periodic send completed");
+            break;
+        case 1:
+            LOGGER_SendFormatted(c->level, "[LoRa] Periodic send completed (count=%d)", 1234);
+            break;
+        case 4:
+            LOGGER_SendFormatted(c->level, "[LoRa] send=%d err=%d state=%s rssi=%d",
+                                 1234, 2, "SEND_PERIODIC", -87);
+            break;
+        default:
+            LOGGER_SendFormatted(c->level, "[LoRa] send=%d err=%d state=%s rssi=%d snr=%d dr=%d port=%u msg=%s",
+                                 1234, 2, "SEND_PERIODIC", -87, 7, 5, 2u, "TEST");
+            break;
+    }
+}
+
+// 벤치마크 출력 구성: LoggerMode 3종 + 터미널 텍스트/SD 바이너리 조합
+typedef enum {
+    BENCH_OUT_TERMINAL = LOGGER_MODE_TERMINAL_ONLY,
+    BENCH_OUT_SD = LOGGER_MODE_SD_ONLY,
+    BENCH_OUT_DUAL = LOGGER_MODE_DUAL,
+    BENCH_OUT_TERMINAL_SD_BINARY
+} BenchOutput;
+
+static const char* _mode_name(BenchOutput mode)
+{
+    switch (mode) {
+        case BENCH_OUT_TERMINAL_SD_BINARY: return "terminal_sdbin";
+        case LOGGER_MODE_TERMINAL_ONLY: return "terminal";
+        case LOGGER_MODE_SD_ONLY:       return "sd";
+        case LOGGER_MODE_DUAL:          return "dual";
+        default:                        return "unknown";
+    }
+}
+
+static void _run_case(BenchOutput mode, LogLevel level, bool time_base, int arg_count)
+{
+    LogCase c = { level, arg_count };
+    char name[96];
+    char extra[224];
+
+    // SD 바이너리 조합은 터미널 텍스트 + SD 바이너리 싱크
+    bool sd_binary = (mode == BENCH_OUT_TERMINAL_SD_BINARY);
+    LOGGER_SetMode(sd_binary ? LOGGER_MODE_TERMINAL_ONLY : (LoggerMode_t)mode);
+    LOGGER_EnableSink(LOG_SINK_SD_BINARY, sd_binary);
+    LOGGER_SetFilterLevel(LOG_LEVEL_INFO);   // DEBUG는 필터링 경로
+    LOGGER_SetSDFilterLevel(LOG_LEVEL_INFO);
+    LOGGER_EnableSDLogging(true);
+
+    // 출력량 측정 (한 번의 패스)
+    _reset_counters();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i++) {
+        _log_once(&c);
+    }
+    double bytes_per_op = (double)(g_terminal_bytes + g_sd_bytes + g_bin_bytes) / BENCH_ITERATIONS;
+    double terminal_calls = (double)g_terminal_calls / BENCH_ITERATIONS;
+    double sd_calls = (double)(g_sd_calls + g_bin_calls) / BENCH_ITERATIONS;
+
+    double ns_per_op = bench_measure(_log_once, &c, BENCH_ITERATIONS);
+
+    bool filtered = (level < LOG_LEVEL_INFO);
+    snprintf(name, sizeof(name), "%s_%s_%s_args%d",
+             _mode_name(mode), filtered ? "filtered" : "emitted",
+             time_base ? "time" : "notime", arg_count);
+    snprintf(extra, sizeof(extra),
+             ",\"mode\":\"%s\",\"filtered\":%s,\"time_base\":%s,\"args\":%d,"
+             "\"terminal_calls_per_op\":%.2f,\"sd_calls_per_op\":%.2f",
+             _mode_name(mode), filtered ? "true" : "false", time_base ? "true" : "false",
+             arg_count, terminal_calls, sd_calls);
+
+    bench_emit("logger", name, BENCH_ITERATIONS, ns_per_op, bytes_per_op, extra);
+}
+
+int main(void)
+{
+    static const BenchOutput modes[] = {
+        BENCH_OUT_TERMINAL, BENCH_OUT_SD, BENCH_OUT_DUAL, BENCH_OUT_TERMINAL_SD_BINARY
+    };
+    static const int arg_counts[] = { 0, 1, 4, 8 };
+
+    // 시간 동기화 전 측정 후 시간 기준을 설정하고 다시 측정
+    for (int t = 0; t < 2; t++) {
+        bool time_base = (t == 1);
+        if (time_base) {
+            LOGGER_SetTimeBase(1735689600UL);  // 2025-01-01 00:00:00 UTC
+        }
+
+        for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+            _run_case(modes[m], LOG_LEVEL_DEBUG, time_base, 1);
+            for (size_t a = 0; a < sizeof(arg_counts) / sizeof(arg_counts[0]); a++) {
+                _run_case(modes[m], LOG_LEVEL_INFO, time_base, arg_counts[a]);
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,212 @@
+// ============================================================================
+// 원격 로그 상태 변경 인코딩 마이크로벤치마크
+//   v1: StateChangePacket 20B + CRC16 (LOG_FRAME_VERSION 프레임)
+//   v2: LogDelta 차이/varint 레코드 (LOG_FRAME_VERSION_DELTA 프레임)
+// 입력은 LoraStarter 주기를 흉내 낸 전이 목록 (JOIN 후 SEND_PERIODIC 반복, 가끔 에러/재시도)
+// bytes_per_op는 프레임 헤더/CRC를 포함한 전이당 전송 바이트
+// ============================================================================
+
+#include "bench_common.h"
+#include "LogFrame.h"
+#include "LogDelta.h"
+#include "Checksum.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TRANSITIONS         4096
+#define STREAM_MAX          (TRANSITIONS * 24 + 64 * LOG_FRAME_MAX_SIZE)
+
+// v1 패킷 (LogRemote.h의 StateChangePacket과 같은 배치, LoraStarter.h 의존을 피하려고 따로 정의)
+#pragma pack(push, 1)
+typedef struct {
+    uint8_t packet_type;
+    uint32_t timestamp;
+    uint8_t device_id;
+    uint8_t old_state;
+    uint8_t new_state;
+    uint32_t state_duration;
+    uint16_t error_count;
+    uint16_t send_count;
+    uint8_t error_code;
+    uint8_t reserved;
+    uint16_t checksum;
+} V1Packet;
+#pragma pack(pop)
+
+static LogDeltaRecord g_trace[TRANSITIONS];
+static uint8_t g_stream[STREAM_MAX];
+static size_t g_stream_len;
+static LogFrame g_frame;
+static LogDeltaCodec g_codec;
+static volatile uint32_t g_sink;
+
+static int _collect(const void* data, size_t size)
+{
+    if (g_stream_len + size <= sizeof(g_stream)) {
+        memcpy(&g_stream[g_stream_len], data, size);
+        g_stream_len += size;
+    }
+    return 0;
+}
+
+// LoraStarter 상태 번호 (LoraStarter.h 순서)
+enum { S_INIT, S_SEND_CMD, S_WAIT_OK, S_SEND_JOIN, S_WAIT_JOIN_OK, S_SEND_TIMEREQ, S_WAIT_TIMEREQ_OK,
+       S_SEND_LTIME, S_WAIT_LTIME, S_SEND_PERIODIC, S_WAIT_SEND_RESPONSE, S_WAIT_SEND_INTERVAL,
+       S_JOIN_RETRY, S_DONE, S_ERROR };
+
+static void _build_trace(void)
+{
+    static const uint8_t join[][2] = {
+        { S_INIT, S_SEND_CMD }, { S_SEND_CMD, S_WAIT_OK }, { S_WAIT_OK, S_SEND_JOIN },
+        { S_SEND_JOIN, S_WAIT_JOIN_OK }, { S_WAIT_JOIN_OK, S_SEND_TIMEREQ },
+        { S_SEND_TIMEREQ, S_WAIT_TIMEREQ_OK }, { S_WAIT_TIMEREQ_OK, S_SEND_PERIODIC },
+    };
+    uint32_t now = 1000;
+    uint32_t last = 0;
+    uint16_t sends = 0;
+    uint16_t errors = 0;
+    size_t n = 0;
+
+    srand(1);
+    for (size_t j = 0; j < sizeof(join) / sizeof(join[0]); j++) {
+        now += 50 + (uint32_t)(rand() % 3000);
+        g_trace[n++] = (LogDeltaRecord){ now, 0x01, join[j][0], join[j][1], last ? now - last : 0,
+                                         errors, sends, 0, NULL, 0 };
+        last = now;
+    }
+    while (n < TRANSITIONS) {
+        uint8_t from = S_SEND_PERIODIC;
+        uint8_t to = S_WAIT_SEND_RESPONSE;
+        int step = (int)(n % 3);
+        if (step == 0) {
+            sends++;
+            now += 20 + (uint32_t)(rand() % 80);
+        } else if (step == 1) {
+            from = S_WAIT_SEND_RESPONSE;
+            to = S_WAIT_SEND_INTERVAL;
+            now += 1500 + (uint32_t)(rand() % 2500);
+            if (rand() % 20 == 0) {
+                errors++;
+            }
+        } else {
+            from = S_WAIT_SEND_INTERVAL;
+            to = S_SEND_PERIODIC;
+            now += 55000 + (uint32_t)(rand() % 2000);
+        }
+        g_trace[n++] = (LogDeltaRecord){ now, 0x01, from, to, now - last, errors, sends, 0, NULL, 0 };
+        last = now;
+    }
+}
+
+static void _encode_v1(void* ctx)
+{
+    (void)ctx;
+    g_stream_len = 0;
+    LogFrame_Init(&g_frame, _collect, LOG_FRAME_MAX_SIZE, 0);
+    for (size_t i = 0; i < TRANSITIONS; i++) {
+        const LogDeltaRecord* r = &g_trace[i];
+        V1Packet* p = LogFrame_Reserve(&g_frame, sizeof(V1Packet), r->timestamp_ms, NULL);
+        p->packet_type = 0x01;
+        p->timestamp = r->timestamp_ms;
+        p->device_id = r->device_id;
+        p->old_state = r->old_state;
+        p->new_state = r->new_state;
+        p->state_duration = r->state_duration;
+        p->error_count = r->error_count;
+        p->send_count = r->send_count;
+        p->error_code = r->error_code;
+        p->reserved = 0;
+        p->checksum = Checksum_Crc16(p, offsetof(V1Packet, checksum));
+        LogFrame_Commit(&g_frame);
+    }
+    LogFrame_Flush(&g_frame);
+}
+
+static void _encode_v2(void* ctx)
+{
+    (void)ctx;
+    g_stream_len = 0;
+    LogFrame_Init(&g_frame, _collect, LOG_FRAME_MAX_SIZE, 0);
+    LogFrame_SetVersion(&g_frame, LOG_FRAME_VERSION_DELTA);
+    for (size_t i = 0; i < TRANSITIONS; i++) {
+        const LogDeltaRecord* r = &g_trace[i];
+        uint8_t* slot = LogFrame_Reserve(&g_frame, LOG_DELTA_MAX_RECORD, r->timestamp_ms, NULL);
+        if (LogFrame_IsEmpty(&g_frame)) {
+            LogDelta_Begin(&g_codec, r->timestamp_ms);
+        }
+        LogFrame_CommitSize(&g_frame, LogDelta_Encode(&g_codec, r, slot, LOG_DELTA_MAX_RECORD));
+    }
+    LogFrame_Flush(&g_frame);
+}
+
+// 프레임 검사 + 레코드 복원, 복원한 레코드 수 반환
+static uint32_t _decode_stream(void)
+{
+    uint32_t records = 0;
+    uint32_t acc = 0;
+    size_t pos = 0;
+    while (pos < g_stream_len) {
+        LogFrameHeader header;
+        int size = LogFrame_Decode(&g_stream[pos], g_stream_len - pos, &header);
+        if (size <= 0) {
+            break;
+        }
+        size_t offset = 0;
+        if (header.version == LOG_FRAME_VERSION_DELTA) {
+            LogDeltaRecord r;
+            while (LogDelta_NextRecord(&header, &g_codec, &offset, &r)) {
+                acc += r.timestamp_ms + r.send_count;
+                records++;
+            }
+        } else {
+            const uint8_t* rec;
+            size_t len;
+            while (LogFrame_NextRecord(&header, &offset, &rec, &len)) {
+                V1Packet p;
+                memcpy(&p, rec, sizeof(p));
+                if (Checksum_Crc16(&p, offsetof(V1Packet, checksum)) == p.checksum) {
+                    acc += p.timestamp + p.send_count;
+                    records++;
+                }
+            }
+        }
+        pos += (size_t)size;
+    }
+    g_sink = acc;
+    return records;
+}
+
+static void _decode(void* ctx)
+{
+    (void)ctx;
+    _decode_stream();
+}
+
+static void _run_case(const char* name, BenchFn encode)
+{
+    char case_name[32];
+    char extra[128];
+
+    double encode_ns = bench_measure(encode, NULL, 20);
+    double bytes_per_transition = (double)g_stream_len / TRANSITIONS;
+    uint32_t decoded = _decode_stream();
+    snprintf(extra, sizeof(extra), ",\"stream_bytes\":%zu,\"transitions\":%u,\"decoded\":%u",
+             g_stream_len, (unsigned)TRANSITIONS, decoded);
+    snprintf(case_name, sizeof(case_name), "%s_encode", name);
+    bench_emit("logremote", case_name, TRANSITIONS, encode_ns / TRANSITIONS, bytes_per_transition, extra);
+
+    double decode_ns = bench_measure(_decode, NULL, 20);
+    snprintf(case_name, sizeof(case_name), "%s_decode", name);
+    bench_emit("logremote", case_name, TRANSITIONS, decode_ns / TRANSITIONS, bytes_per_transition, extra);
+}
+
+int main(void)
+{
+    Checksum_Init();
+    _build_trace();
+
+    _run_case("v1", _encode_v1);
+    _run_case("v2_delta", _encode_v2);
+    return 0;
+}
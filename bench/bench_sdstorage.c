@@ -0,0 +1,211 @@
+// ============================================================================
+// SDStorage + FatFs 처리량/지연 벤치마크
+// 타겟 SDStorage.c를 SDSTORAGE_HOST_FATFS로 빌드해 디스크 이미지 위에서 실행
+// 카드 지연은 가상 시간으로 주입 (실제 대기 없이 카드 busy 시간을 측정값에 더함)
+//   append 지연 = 호스트 CPU 시간 + 그 append 동안 주입된 카드 시간
+// 동기화 정책(바이트 임계값)별로 지속 MB/s와 append 지연 분포를 출력
+// ============================================================================
+
+#include "bench_common.h"
+#include "SDStorage.h"
+#include "SDService.h"
+#include "logger.h"
+#include "system_config.h"
+#include "sd_diskio_image.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_IMAGE_SECTORS     (64UL * 1024 * 1024 / SD_IMAGE_SECTOR_SIZE)   // 64MB
+#define BENCH_LINES             20000
+
+// 카드 모델 (SDMMC 4비트, class 10 카드 수준): 명령당 고정 지연 + 섹터당 전송 시간
+#define BENCH_CARD_WRITE_CALL_US    250
+#define BENCH_CARD_WRITE_SECTOR_US  25
+#define BENCH_CARD_READ_CALL_US     100
+#define BENCH_CARD_READ_SECTOR_US   10
+// 느린 카드: f_sync(CTRL_SYNC)마다 내부 GC로 멈춤
+#define BENCH_SLOW_SYNC_US          80000
+
+// ----------------------------------------------------------------------------
+// 스텁 (로그 출력 경로는 사용하지 않음)
+// ----------------------------------------------------------------------------
+
+LoggerStatus LOGGER_Platform_Send(const char* message)
+{
+    (void)message;
+    return LOGGER_STATUS_OK;
+}
+
+LoggerStatus LOGGER_Platform_Connect(const char* server_ip, int port)
+{
+    (void)server_ip;
+    (void)port;
+    return LOGGER_STATUS_OK;
+}
+
+LoggerStatus LOGGER_Platform_Disconnect(void)
+{
+    return LOGGER_STATUS_OK;
+}
+
+ResultCode SDService_Append(const void* data, size_t size)
+{
+    (void)data;
+    (void)size;
+    return SDSTORAGE_OK;
+}
+
+ResultCode SDService_AppendBinary(const void* data, size_t size)
+{
+    (void)data;
+    (void)size;
+    return SDSTORAGE_OK;
+}
+
+bool SDService_IsReady(void)
+{
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// 가상 시간: 실제 경과 시간 + 주입된 카드 지연
+// ----------------------------------------------------------------------------
+
+static uint64_t g_card_us;
+
+static void _card_delay(uint32_t us)
+{
+    g_card_us += us;
+}
+
+static uint64_t _virtual_now_us(void)
+{
+    return bench_now_ns() / 1000ULL + g_card_us;
+}
+
+uint32_t TIME_Platform_GetCurrentMs(void)
+{
+    return (uint32_t)(_virtual_now_us() / 1000ULL);
+}
+
+void TIME_Platform_DelayMs(uint32_t ms)
+{
+    g_card_us += (uint64_t)ms * 1000ULL;
+}
+
+uint64_t TIME_Platform_GetMonotonicMs(void)
+{
+    return _virtual_now_us() / 1000ULL;
+}
+
+uint64_t TIME_Platform_GetMonotonicUs(void)
+{
+    return _virtual_now_us();
+}
+
+// ----------------------------------------------------------------------------
+// 벤치마크 케이스
+// ----------------------------------------------------------------------------
+
+typedef struct {
+    const char* name;
+    uint32_t sync_bytes_threshold;  // 적응형이면 상한
+    bool journal;
+    bool adaptive;
+    uint32_t sync_stall_us;
+} SyncCase;
+
+static int _compare_u32(const void* a, const void* b)
+{
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+static void _run_policy(const SyncCase* policy)
+{
+    static uint32_t latency_us[BENCH_LINES];
+    char line[96];
+
+    RuntimeSDCardConfig* config = SystemConfig_GetSDCard();
+    config->sync_bytes_threshold = policy->sync_bytes_threshold;
+    config->journal_enabled = policy->journal;
+    config->compression_enabled = false;
+    config->adaptive_sync_enabled = policy->adaptive;
+
+    if (SDImage_Open(NULL, BENCH_IMAGE_SECTORS) != SD_IMAGE_OK) {
+        fprintf(stderr, "bench_sdstorage: image open failed\n");
+        exit(1);
+    }
+    SDImage_SetDelayFn(_card_delay);
+    SDImage_SetLatency(SD_IMAGE_OP_WRITE, BENCH_CARD_WRITE_CALL_US, BENCH_CARD_WRITE_SECTOR_US);
+    SDImage_SetLatency(SD_IMAGE_OP_READ, BENCH_CARD_READ_CALL_US, BENCH_CARD_READ_SECTOR_US);
+    SDImage_SetLatency(SD_IMAGE_OP_SYNC, policy->sync_stall_us, 0);
+    if (SDStorage_Init() != SDSTORAGE_OK) {
+        fprintf(stderr, "bench_sdstorage: SDStorage_Init failed\n");
+        exit(1);
+    }
+
+    // 파일 생성/사전 할당은 측정에서 제외
+    SDStorage_WriteLog("[INFO] bench start", 18);
+    SDStorage_Flush();
+    SDStorageStats before;
+    SDStorage_GetStats(&before);
+
+    uint64_t bytes = 0;
+    uint64_t start_us = _virtual_now_us();
+    for (uint32_t i = 0; i < BENCH_LINES; i++) {
+        int len = snprintf(line, sizeof(line),
+                           "[%08lu][INFO] Uplink #%lu sent, RSSI -%lu dBm, SNR %lu.%lu dB",
+                           (unsigned long)(i * 37), (unsigned long)i, (unsigned long)(60 + i % 60),
+                           (unsigned long)(i % 12), (unsigned long)(i % 10));
+        uint64_t t0 = _virtual_now_us();
+        SDStorage_WriteLog(line, (size_t)len);
+        SDStorage_RotateIfNeeded(); // SD 태스크 주기 점검과 같은 경로
+        SDStorage_FlushIfDue();
+        latency_us[i] = (uint32_t)(_virtual_now_us() - t0);
+        bytes += (uint64_t)len;
+    }
+    SDStorage_Flush();
+    uint64_t elapsed_us = _virtual_now_us() - start_us;
+
+    SDStorageStats after;
+    SDStorage_GetStats(&after);
+    SDStorage_Disconnect();
+    SDImage_Close();
+
+    qsort(latency_us, BENCH_LINES, sizeof(latency_us[0]), _compare_u32);
+    double mb_per_s = (double)bytes / (double)elapsed_us;   // bytes/us == MB/s
+
+    char extra[320];
+    snprintf(extra, sizeof(extra),
+             ",\"sync_bytes\":%u,\"journal\":%s,\"adaptive\":%s,\"sync_stall_us\":%u,"
+             "\"mb_per_s\":%.2f,\"p50_us\":%u,\"p99_us\":%u,"
+             "\"max_us\":%u,\"write_calls\":%u,\"sync_calls\":%u,\"sync_target\":%u",
+             policy->sync_bytes_threshold, policy->journal ? "true" : "false",
+             policy->adaptive ? "true" : "false", policy->sync_stall_us, mb_per_s,
+             latency_us[BENCH_LINES / 2], latency_us[BENCH_LINES * 99 / 100], latency_us[BENCH_LINES - 1],
+             after.write_calls - before.write_calls, after.sync_calls - before.sync_calls,
+             after.sync_bytes_target);
+    bench_emit("sdstorage", policy->name, BENCH_LINES, (double)elapsed_us * 1000.0 / BENCH_LINES,
+               (double)bytes / BENCH_LINES, extra);
+}
+
+int main(void)
+{
+    static const SyncCase policies[] = {
+        { "sync_every_line", 1, true, false, 0 },
+        { "sync_4k", 4096, true, false, 0 },
+        { "sync_16k", SD_SYNC_BYTES_THRESHOLD, true, false, 0 },
+        { "sync_64k", 65536, true, false, 0 },
+        { "sync_16k_txt", SD_SYNC_BYTES_THRESHOLD, false, false, 0 },
+        { "adaptive", SD_SYNC_BYTES_THRESHOLD, true, true, 0 },
+        { "sync_4k_slow", 4096, true, false, BENCH_SLOW_SYNC_US },
+        { "adaptive_slow", SD_SYNC_BYTES_THRESHOLD, true, true, BENCH_SLOW_SYNC_US },
+    };
+
+    for (size_t i = 0; i < sizeof(policies) / sizeof(policies[0]); i++) {
+        _run_policy(&policies[i]);
+    }
+    return 0;
+}
@@ -28,6 +28,7 @@ typedef ResultCode LoggerStatus;
 #define LOGGER_STATUS_OK       RESULT_SUCCESS
 #define LOGGER_STATUS_ERROR    RESULT_ERROR_LOGGER_SEND_FAILED
 #define LOGGER_STATUS_TIMEOUT  RESULT_ERROR_TIMEOUT
+#define LOGGER_STATUS_BUFFER_FULL  RESULT_ERROR_LOGGER_BUFFER_FULL
 
 // 로깅 설정
 typedef struct {
@@ -67,9 +68,93 @@ void LOGGER_SetMode(LoggerMode_t mode);
 LoggerMode_t LOGGER_GetMode(void);
 void LOGGER_SendFormatted(LogLevel level, const char* format, ...);
 
+// 타임스탬프 기준 설정 (LTIME 동기화 시 UTC epoch 초를 전달, 이후 tick 경과로 계산)
+void LOGGER_SetTimeBase(uint32_t utc_epoch_sec);
+bool LOGGER_HasTimeBase(void);
+
+// 현재 UTC epoch 초 반환 (바이너리 로그용, 미동기화 시 0)
+uint32_t LOGGER_GetTimestamp(void);
+
 // 비동기 SD 로깅 함수 (메인 태스크 블로킹 방지)
 int LOGGER_SendToSDAsync(const char* message, size_t length);
 
+// ============================================================================
+// 로그 싱크 레지스트리
+// 레코드는 인코더별로 최대 한 번만 포맷되고, 각 싱크는 자신의 레벨/인코더/
+// backpressure 정책에 따라 전달받음
+// ============================================================================
+
+// 싱크 ID (고정 슬롯)
+typedef enum {
+    LOG_SINK_TERMINAL = 0,   // UART1 터미널 (텍스트)
+    LOG_SINK_SD_TEXT,        // SD 카드 텍스트 로그
+    LOG_SINK_SD_BINARY,      // SD 카드 바이너리 로그 (저널 파일의 BINARY 레코드, journal_enabled 필요)
+    LOG_SINK_CRASH_RING,     // RAM 크래시 링 (텍스트, 오래된 로그 덮어씀)
+    LOG_SINK_COUNT
+} LogSinkId;
+
+// 싱크가 받는 데이터 형식
+typedef enum {
+    LOG_ENCODER_TEXT = 0,    // "[시간] [LEVEL] 메시지" (null 종료)
+    LOG_ENCODER_BINARY,      // LogBinaryHeader + 메시지
+    LOG_ENCODER_RECORD,      // 인코딩 없음, LogRecord만 전달 (싱크가 직접 패킷 구성)
+    LOG_ENCODER_COUNT
+} LogEncoder;
+
+// 싱크가 받아들이지 못할 때의 처리
+typedef enum {
+    LOG_BACKPRESSURE_DROP_NEWEST = 0,  // 새 레코드를 버리고 카운트
+    LOG_BACKPRESSURE_DROP_OLDEST,      // 오래된 데이터를 덮어씀 (싱크 내부 처리)
+    LOG_BACKPRESSURE_BLOCK             // 제한 시간까지 재시도 (인터럽트 컨텍스트에서는 DROP)
+} LogBackpressure;
+
+// 포맷 전 로그 레코드
+typedef struct {
+    LogLevel level;
+    uint32_t timestamp;      // UTC epoch 초 (시간 동기화 전에는 0)
+    uint32_t tick_ms;        // TIME_GetCurrentMs()
+    const char* message;     // 레벨/시간 prefix 없는 본문
+    size_t message_len;
+} LogRecord;
+
+// 바이너리 인코더 헤더 (리틀엔디안, 뒤에 message_len 바이트 본문)
+#define LOGGER_BINARY_MAGIC  0xB1
+typedef struct __attribute__((packed)) {
+    uint8_t  magic;
+    uint8_t  level;
+    uint16_t message_len;
+    uint32_t timestamp;
+    uint32_t tick_ms;
+} LogBinaryHeader;
+
+// 싱크 출력 함수: TEXT/BINARY는 data/len, RECORD는 data=NULL, len=0
+typedef LoggerStatus (*LogSinkWriteFn)(const LogRecord* record, const uint8_t* data, size_t len);
+
+typedef struct {
+    bool enabled;
+    LogLevel min_level;
+    LogEncoder encoder;
+    LogBackpressure backpressure;
+    LogSinkWriteFn write;    // NULL이면 비활성
+} LogSinkConfig;
+
+typedef struct {
+    uint32_t written;        // 전달 성공
+    uint32_t dropped;        // backpressure로 버림
+    uint32_t skipped;        // 싱크 미준비 (SD 미마운트 등)
+    uint32_t errors;         // 쓰기 실패
+} LogSinkStats;
+
+LoggerStatus LOGGER_ConfigureSink(LogSinkId id, const LogSinkConfig* config);
+LoggerStatus LOGGER_GetSinkConfig(LogSinkId id, LogSinkConfig* config);
+LoggerStatus LOGGER_SetSinkWriter(LogSinkId id, LogSinkWriteFn write);
+void LOGGER_EnableSink(LogSinkId id, bool enable);
+void LOGGER_SetSinkLevel(LogSinkId id, LogLevel min_level);
+void LOGGER_GetSinkStats(LogSinkId id, LogSinkStats* stats);
+
+// 크래시 링 내용을 오래된 순서로 복사 (복사된 바이트 수 반환)
+size_t LOGGER_CrashRing_Snapshot(char* out, size_t max_len);
+
 // 편의 매크로들
 #define LOG_DEBUG(fmt, ...) \
     LOGGER_SendFormatted(LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
@@ -3,9 +3,26 @@
 
 #include "logger.h"
 
+// UART1 TX 링 버퍼 통계
+typedef struct {
+    uint32_t dropped_lines;    // 링 공간 부족으로 버린 줄 수
+    uint32_t dropped_bytes;    // 버린 바이트 수 (CRLF 포함)
+    uint32_t high_watermark;   // 링 최대 사용량 (바이트)
+    uint32_t dma_errors;       // DMA 시작 실패/전송 에러 횟수
+} LoggerTxStats;
+
 LoggerStatus LOGGER_Platform_Connect(const char* server_ip, int port);
 LoggerStatus LOGGER_Platform_Disconnect(void);
 LoggerStatus LOGGER_Platform_Send(const char* message);
 LoggerStatus LOGGER_Platform_Configure(const LoggerConfig* config);
 
-#endif // LOGGER_PLATFORM_H 
\ No newline at end of file
+// 링에 남은 데이터가 모두 전송될 때까지 대기 (리셋/슬립 진입 전)
+LoggerStatus LOGGER_Platform_Flush(uint32_t timeout_ms);
+void LOGGER_Platform_GetTxStats(LoggerTxStats* stats);
+
+// UART1 TX DMA 완료/에러 콜백에서 호출 (인터럽트 컨텍스트)
+void LOGGER_Platform_TxCpltCallback(void);
+void LOGGER_Platform_TxErrorCallback(void);
+void LOGGER_Platform_TxAbortCpltCallback(void);
+
+#endif // LOGGER_PLATFORM_H
\ No newline at end of file
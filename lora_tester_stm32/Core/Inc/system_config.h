@@ -68,9 +68,74 @@
 /** SD 카드 TRANSFER 상태 체크 간격 (밀리초) */
 #define SD_TRANSFER_CHECK_INTERVAL_MS   100
 
-/** 로그 파일 최대 크기 (바이트) */
+/** 로그 파일 최대 크기 (바이트) - 도달 시 SD 태스크가 다음 파일로 회전 */
 #define SD_LOG_FILE_MAX_SIZE            1000000
 
+/** 로그 파일 시간 기반 회전 주기 (밀리초, 0: 비활성화) */
+#define SD_LOG_ROTATE_INTERVAL_MS       (24UL * 60 * 60 * 1000)
+
+/** 새 로그 파일 사전 할당 여유분 (최대 크기 + 여유분만큼 연속 클러스터 할당) */
+#define SD_LOG_PREALLOC_HEADROOM        (64 * 1024)
+
+/** SD 로그 압축 기본 활성화 여부 (압축 파일은 .LZL 확장자) */
+#define SD_COMPRESSION_ENABLED          false
+
+/**
+ * SD 로그를 CRC32 레코드 저널(.LJR)로 기록 (선택 사항, 켜면 압축 설정보다 우선 - 둘 다 켜면 경고)
+ * 마운트 시 이전 파일을 앞에서부터 검사해 찢어진 꼬리를 잘라내므로
+ * 사전 할당 파일에서는 f_sync 없이 f_write된 레코드도 복구됨
+ */
+#define SD_JOURNAL_ENABLED              false
+
+/** 압축 블록을 SD에 내려쓰는 원본 바이트 임계값 */
+#define SD_COMPRESS_FLUSH_RAW_BYTES     2048
+
+/** write-behind 버퍼 크기 (섹터 512B의 배수, 가득 찰 때마다 섹터 단위 f_write) */
+#define SD_WRITE_BEHIND_SIZE            4096
+
+/**
+ * f_sync 주기 (밀리초) / f_sync 바이트 임계값
+ * 전원 차단 시 최대 손실: 마지막 f_sync 이후 데이터
+ *   = min(SD_SYNC_INTERVAL_MS + SD 태스크 점검 주기(약 1초), SD_SYNC_BYTES_THRESHOLD 바이트)
+ */
+#define SD_SYNC_INTERVAL_MS             2000
+#define SD_SYNC_BYTES_THRESHOLD         16384
+
+/**
+ * 적응형 f_sync 정책 (FlushPolicy): 위 두 값을 상한으로, 아래 최소값 사이에서 조절
+ * 카드 stall(f_write/f_sync >= SD_ADAPTIVE_STALL_US) 또는 밀린 요청 >= SD_ADAPTIVE_BACKLOG_HIGH면 2배,
+ * 한가하고 빠르면 3/4로 축소
+ */
+#define SD_ADAPTIVE_SYNC_ENABLED        true
+#define SD_SYNC_BYTES_MIN               4096
+#define SD_SYNC_INTERVAL_MIN_MS         500
+#define SD_ADAPTIVE_STALL_US            50000
+#define SD_ADAPTIVE_BACKLOG_HIGH        8
+
+/**
+ * 시간 인덱스(LORA####.IDX) 항목 간격 (로그 바이트, 0: 인덱스 없음)
+ * 항목 16B이므로 1MB 파일당 약 256B, 시각으로 찾을 때 최대 이만큼만 읽으면 됨
+ */
+#define SD_TIME_INDEX_INTERVAL          (64 * 1024)
+
+/** 다른 태스크가 SD 쓰기/회전 중일 때 로그 쓰기 대기 시간 (밀리초) */
+#define SD_WRITE_LOCK_WAIT_MS           50
+
+/** SD 서비스 요청 큐 깊이 (요청당 약 SD_SERVICE_APPEND_MAX + 24 바이트 힙 사용) */
+#define SD_SERVICE_QUEUE_DEPTH          16
+
+/** SD 서비스 append 요청 1건의 최대 페이로드 (바이트) */
+#define SD_SERVICE_APPEND_MAX           256
+
+/** SD 서비스 append 한 줄 최대 길이 (요청 슬롯보다 긴 줄은 연속 요청으로 나눠 넣고 SD 태스크가 이어 기록) */
+#define SD_SERVICE_LINE_MAX             LOGGER_MAX_MESSAGE_SIZE
+
+/** 한 번에 묶어서 기록하는 연속 append 요청 최대 개수 */
+#define SD_SERVICE_BATCH_MAX            8
+
+/** 다른 태스크가 SD 서비스 준비(마운트)를 기다리는 최대 시간 (밀리초) */
+#define SD_SERVICE_READY_WAIT_MS        15000
+
 // =============================================================================
 // 로거 설정
 // =============================================================================
@@ -84,6 +149,24 @@
 /** SD 로그 큐 크기 */
 #define LOGGER_SD_QUEUE_SIZE            10
 
+/** RAM 크래시 링 크기 (최근 텍스트 로그 보관, 바이트) */
+#define LOGGER_CRASH_RING_SIZE          2048
+
+/** BLOCK 정책 싱크의 최대 재시도 시간 (밀리초) */
+#define LOGGER_SINK_BLOCK_TIMEOUT_MS    20
+
+/** UART1 로그 TX 링 버퍼 크기 (바이트, 115200bps 기준 약 0.35초 분량) */
+#define LOGGER_UART_TX_RING_SIZE        4096
+
+/** UART1 로그 DMA 1회 전송 최대 길이 (바이트) */
+#define LOGGER_UART_TX_MAX_CHUNK        1024
+
+/** 로그 타임스탬프 시간대 오프셋 (초, KST = UTC+9) */
+#define LOGGER_TIMEZONE_OFFSET_SEC      (9 * 3600)
+
+/** 로그 타임스탬프 시간대 표기 */
+#define LOGGER_TIMEZONE_LABEL           "KST"
+
 // =============================================================================
 // 시스템 설정
 // =============================================================================
@@ -164,6 +247,8 @@ ResultCode SystemConfig_Apply(const GlobalSystemConfig* config);
 #define GET_LORA_RETRY_COUNT()          (SystemConfig_GetLoRa()->max_retry_count)
 #define GET_UART_BAUDRATE()             (SystemConfig_GetUart()->baudrate)
 #define GET_SD_LOG_FILE_MAX_SIZE()      (SystemConfig_GetSDCard()->log_file_max_size)
+#define GET_SD_COMPRESSION_ENABLED()    (SystemConfig_GetSDCard()->compression_enabled)
+#define GET_SD_JOURNAL_ENABLED()        (SystemConfig_GetSDCard()->journal_enabled)
 #define GET_LOGGER_MAX_MESSAGE_SIZE()   (SystemConfig_GetLogger()->max_message_size)
 
 /**
@@ -54,10 +54,18 @@ typedef struct {
     uint8_t transfer_wait_max_count;    // TRANSFER 상태 대기 최대 횟수
     uint32_t transfer_check_interval_ms; // TRANSFER 상태 체크 간격
     uint32_t log_file_max_size;         // 로그 파일 최대 크기
+    uint32_t log_rotate_interval_ms;    // 시간 기반 회전 주기 (0: 비활성화)
     char log_directory[64];             // 로그 디렉토리 경로
     char log_file_prefix[32];           // 로그 파일 접두사
     bool auto_format_enabled;           // 자동 포맷 활성화
     bool compression_enabled;           // 압축 활성화
+    bool journal_enabled;               // 바이너리 저널(.LJR) 기록 (압축보다 우선)
+    uint32_t sync_interval_ms;          // f_sync 주기 (최대 손실 시간)
+    uint32_t sync_bytes_threshold;      // f_sync 바이트 임계값 (최대 손실 바이트)
+    bool adaptive_sync_enabled;         // f_write/f_sync 지연과 밀린 요청에 따라 임계값/주기 조절
+    uint32_t sync_bytes_min;            // 적응형 바이트 임계값 하한 (상한: sync_bytes_threshold)
+    uint32_t sync_interval_min_ms;      // 적응형 주기 하한 (상한: sync_interval_ms)
+    uint32_t index_interval_bytes;      // 시간 인덱스(.IDX) 항목 간격 (0: 인덱스 없음)
 } RuntimeSDCardConfig;
 
 // ============================================================================
@@ -27,6 +27,48 @@ uint32_t TIME_CalculateElapsed(uint32_t start_time);
 // 시작 시간부터 남은 시간을 계산
 uint32_t TIME_CalculateRemaining(uint32_t start_time, uint32_t timeout_ms);
 
+// ============================================================================
+// 64비트 단조 시간 / 마감 시각
+// ============================================================================
+
+// TIME_GetCurrentMs는 32비트라 49.7일마다 wrap됨
+// 오래 유지하는 기준 시각이나 타이머는 부팅 후 경과 시간인 64비트 단조 시간을 사용 (wrap 없음)
+uint64_t TIME_GetMonotonicMs(void);
+uint64_t TIME_GetMonotonicUs(void);
+
+// 마감 시각 (단조 ms)
+typedef uint64_t TIME_Deadline;
+#define TIME_DEADLINE_NEVER     UINT64_MAX      // 만료되지 않음
+
+// 지금부터 timeout_ms 뒤의 마감 시각
+TIME_Deadline TIME_DeadlineAfter(uint64_t timeout_ms);
+
+// 마감 시각이 지났는지 확인 (마감 시각과 같으면 만료)
+bool TIME_DeadlineExpired(TIME_Deadline deadline);
+
+// 마감 시각까지 남은 시간 (지났으면 0)
+uint64_t TIME_DeadlineRemainingMs(TIME_Deadline deadline);
+
+// ============================================================================
+// 달력 변환 함수 (UTC epoch 초 <-> 날짜/시각)
+// ============================================================================
+
+// 날짜/시각 (연도는 4자리, 1970~2105 범위)
+typedef struct {
+    uint16_t year;
+    uint8_t  month;   // 1~12
+    uint8_t  day;     // 1~31
+    uint8_t  hour;    // 0~23
+    uint8_t  minute;  // 0~59
+    uint8_t  second;  // 0~59
+} TIME_DateTime;
+
+// 날짜/시각을 1970-01-01 00:00:00 기준 epoch 초로 변환
+uint32_t TIME_DateTimeToEpoch(const TIME_DateTime* dt);
+
+// epoch 초를 날짜/시각으로 변환
+void TIME_EpochToDateTime(uint32_t epoch_sec, TIME_DateTime* dt);
+
 // ============================================================================
 // Mock 함수 (테스트용)
 // ============================================================================
@@ -50,4 +92,8 @@ uint32_t TIME_Platform_GetCurrentMs(void);
 // 플랫폼별 지연 함수
 void TIME_Platform_DelayMs(uint32_t ms);
 
+// 플랫폼별 64비트 단조 시간 (부팅 후 경과)
+uint64_t TIME_Platform_GetMonotonicMs(void);
+uint64_t TIME_Platform_GetMonotonicUs(void);
+
 #endif // TIME_H 
\ No newline at end of file
@@ -0,0 +1,33 @@
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 공용 CRC 모듈
+//   CRC-16/CCITT-FALSE: 다항식 0x1021, 초기값 0xFFFF (LogRemote 패킷, LogFrame 프레임)
+//   CRC-32/MPEG-2:      다항식 0x04C11DB7, 초기값 0xFFFFFFFF (LogJournal 레코드, 런타임 설정)
+// 둘 다 MSB 우선, 입력/출력 반사 및 최종 XOR 없음 - STM32 CRC 주변장치와 같은 비트 순서.
+//
+// 타겟: CRC 주변장치 (MX_CRC_Init). 다항식 길이/초기값을 호출마다 레지스터로 바꾸므로
+//   여러 태스크가 공유해도 됨 (뮤텍스로 직렬화). CHECKSUM_DMA_MIN_BYTES 이상은
+//   DMA2_Stream0 메모리->CRC 전송으로 넣고 완료까지 태스크는 대기 (CPU 양보).
+// 호스트: slicing-by-4 테이블 (4바이트씩 테이블 4개 조회)
+
+#define CHECKSUM_DMA_MIN_BYTES      256     // 이보다 짧으면 CPU가 직접 DR에 기록
+
+#define CHECKSUM_CRC16_CHECK        0x29B1U         // "123456789"의 CRC-16/CCITT-FALSE
+#define CHECKSUM_CRC32_CHECK        0x0376E6E7UL    // "123456789"의 CRC-32/MPEG-2
+
+// 타겟: 뮤텍스/DMA 완료 신호 생성 (MX_CRC_Init, MX_CRC_DMA_Init 이후), 호스트: 테이블 생성
+// 호출 전에도 동작함 (타겟은 CPU 기록, 호스트는 첫 호출 시 테이블 생성)
+void Checksum_Init(void);
+
+uint16_t Checksum_Crc16(const void* data, size_t len);
+uint32_t Checksum_Crc32(const void* data, size_t len);
+
+// 비트 단위 참조 구현 (테스트/벤치마크 비교용)
+uint16_t Checksum_Crc16Bitwise(const void* data, size_t len);
+uint32_t Checksum_Crc32Bitwise(const void* data, size_t len);
+
+#endif // CHECKSUM_H
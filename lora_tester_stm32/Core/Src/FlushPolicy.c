@@ -0,0 +1,83 @@
+#include "FlushPolicy.h"
+#include <stddef.h>
+
+static uint32_t _clamp(uint32_t value, uint32_t min, uint32_t max)
+{
+    if (value > max) {
+        value = max;
+    }
+    return (value < min) ? min : value;
+}
+
+static uint32_t _grow(uint32_t value, uint32_t min, uint32_t max)
+{
+    return _clamp((value > max / 2) ? max : value * 2, min, max);
+}
+
+static uint32_t _shrink(uint32_t value, uint32_t min, uint32_t max)
+{
+    return _clamp(value - value / 4, min, max);
+}
+
+void FlushPolicy_Init(FlushPolicy* policy, const FlushPolicyConfig* config)
+{
+    if (policy == NULL || config == NULL) {
+        return;
+    }
+    policy->bytes = config->bytes_min;
+    policy->interval_ms = config->interval_min_ms;
+    policy->sync_ewma_us = 0;
+    policy->backlog = 0;
+    policy->grows = 0;
+    policy->shrinks = 0;
+}
+
+void FlushPolicy_SetBacklog(FlushPolicy* policy, uint32_t backlog)
+{
+    if (policy != NULL) {
+        policy->backlog = backlog;
+    }
+}
+
+FlushPolicyAction FlushPolicy_OnSync(FlushPolicy* policy, const FlushPolicyConfig* config,
+                                     uint32_t max_write_us, uint32_t sync_us)
+{
+    if (policy == NULL || config == NULL) {
+        return FLUSH_POLICY_HOLD;
+    }
+
+    // 이동 평균: ewma += (sample - ewma) / 8
+    if (sync_us >= policy->sync_ewma_us) {
+        policy->sync_ewma_us += (sync_us - policy->sync_ewma_us) / 8;
+    } else {
+        policy->sync_ewma_us -= (policy->sync_ewma_us - sync_us) / 8;
+    }
+
+    uint32_t bytes = _clamp(policy->bytes, config->bytes_min, config->bytes_max);
+    uint32_t interval = _clamp(policy->interval_ms, config->interval_min_ms, config->interval_max_ms);
+    bool stall = sync_us >= config->stall_us || max_write_us >= config->stall_us;
+    FlushPolicyAction action = FLUSH_POLICY_HOLD;
+
+    if (stall || policy->backlog >= config->backlog_high) {
+        bytes = _grow(bytes, config->bytes_min, config->bytes_max);
+        interval = _grow(interval, config->interval_min_ms, config->interval_max_ms);
+        action = FLUSH_POLICY_GROW;
+    } else if (policy->backlog == 0 && policy->sync_ewma_us < config->stall_us / 4) {
+        bytes = _shrink(bytes, config->bytes_min, config->bytes_max);
+        interval = _shrink(interval, config->interval_min_ms, config->interval_max_ms);
+        action = FLUSH_POLICY_SHRINK;
+    }
+
+    bool changed = bytes != policy->bytes || interval != policy->interval_ms;
+    policy->bytes = bytes;
+    policy->interval_ms = interval;
+    if (!changed) {
+        return FLUSH_POLICY_HOLD;   // 이미 한계값
+    }
+    if (action == FLUSH_POLICY_GROW) {
+        policy->grows++;
+    } else if (action == FLUSH_POLICY_SHRINK) {
+        policy->shrinks++;
+    }
+    return action;
+}
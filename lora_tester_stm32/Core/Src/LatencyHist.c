@@ -0,0 +1,139 @@
+#include "LatencyHist.h"
+#include <string.h>
+#include <stdio.h>
+
+void LatencyHist_Reset(LatencyHist* hist)
+{
+    if (hist == NULL) {
+        return;
+    }
+    memset(hist, 0, sizeof(*hist));
+}
+
+uint32_t LatencyHist_Bucket(uint32_t us)
+{
+    uint32_t bucket = 0;
+    while (us > 1 && bucket < LATENCY_HIST_BUCKETS - 1) {
+        us >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+uint32_t LatencyHist_BucketUpperUs(uint32_t bucket)
+{
+    if (bucket >= LATENCY_HIST_BUCKETS - 1) {
+        return UINT32_MAX;
+    }
+    return (2U << bucket) - 1;
+}
+
+void LatencyHist_Record(LatencyHist* hist, uint32_t us)
+{
+    if (hist == NULL) {
+        return;
+    }
+    if (hist->count == 0 || us < hist->min_us) {
+        hist->min_us = us;
+    }
+    if (us > hist->max_us) {
+        hist->max_us = us;
+    }
+    hist->buckets[LatencyHist_Bucket(us)]++;
+    hist->count++;
+    hist->total_us += us;
+}
+
+void LatencyHist_Merge(LatencyHist* dst, const LatencyHist* src)
+{
+    if (dst == NULL || src == NULL || src->count == 0) {
+        return;
+    }
+    if (dst->count == 0 || src->min_us < dst->min_us) {
+        dst->min_us = src->min_us;
+    }
+    if (src->max_us > dst->max_us) {
+        dst->max_us = src->max_us;
+    }
+    for (uint32_t i = 0; i < LATENCY_HIST_BUCKETS; i++) {
+        dst->buckets[i] += src->buckets[i];
+    }
+    dst->count += src->count;
+    dst->total_us += src->total_us;
+}
+
+uint32_t LatencyHist_Percentile(const LatencyHist* hist, uint32_t permille)
+{
+    if (hist == NULL || hist->count == 0) {
+        return 0;
+    }
+    if (permille > 1000) {
+        permille = 1000;
+    }
+
+    // 순위 = ceil(count * permille / 1000), 최소 1
+    uint64_t rank = ((uint64_t)hist->count * permille + 999) / 1000;
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < LATENCY_HIST_BUCKETS; i++) {
+        seen += hist->buckets[i];
+        if (seen >= rank) {
+            uint32_t upper = LatencyHist_BucketUpperUs(i);
+            return (upper < hist->max_us) ? upper : hist->max_us;
+        }
+    }
+    return hist->max_us;
+}
+
+uint32_t LatencyHist_AverageUs(const LatencyHist* hist)
+{
+    if (hist == NULL || hist->count == 0) {
+        return 0;
+    }
+    return (uint32_t)(hist->total_us / hist->count);
+}
+
+int LatencyHist_FormatSummary(const LatencyHist* hist, const char* name, char* buf, size_t size)
+{
+    if (hist == NULL || name == NULL || buf == NULL || size == 0) {
+        return LATENCY_HIST_ERROR;
+    }
+
+    int len = snprintf(buf, size, "%s n=%lu avg=%lu p50=%lu p99=%lu max=%lu", name,
+                       (unsigned long)hist->count, (unsigned long)LatencyHist_AverageUs(hist),
+                       (unsigned long)LatencyHist_Percentile(hist, 500),
+                       (unsigned long)LatencyHist_Percentile(hist, 990), (unsigned long)hist->max_us);
+    if (len < 0 || (size_t)len >= size) {
+        return LATENCY_HIST_ERROR;
+    }
+    return len;
+}
+
+int LatencyHist_FormatBuckets(const LatencyHist* hist, const char* name, char* buf, size_t size)
+{
+    if (hist == NULL || name == NULL || buf == NULL || size == 0) {
+        return LATENCY_HIST_ERROR;
+    }
+
+    int len = snprintf(buf, size, "%s", name);
+    if (len < 0 || (size_t)len >= size) {
+        return LATENCY_HIST_ERROR;
+    }
+    size_t used = (size_t)len;
+
+    for (uint32_t i = 0; i < LATENCY_HIST_BUCKETS; i++) {
+        if (hist->buckets[i] == 0) {
+            continue;
+        }
+        len = snprintf(buf + used, size - used, " b%lu:%lu", (unsigned long)i,
+                       (unsigned long)hist->buckets[i]);
+        if (len < 0 || (size_t)len >= size - used) {
+            return LATENCY_HIST_ERROR;
+        }
+        used += (size_t)len;
+    }
+    return (int)used;
+}
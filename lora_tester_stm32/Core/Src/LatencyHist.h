@@ -0,0 +1,53 @@
+#ifndef LATENCYHIST_H
+#define LATENCYHIST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// 지연 시간 히스토그램 (us 단위, log2 버킷, 정적 메모리)
+//
+// 버킷 0: 0~1us, 버킷 i (i>=1): [2^i, 2^(i+1)) us
+// 마지막 버킷은 그 이상 전부 (2^23us = 약 8.4초 이상)
+// 백분위는 버킷 상한으로 근사 (최대 2배 오차, 카드 stall 비교에는 충분)
+
+#define LATENCY_HIST_BUCKETS    24
+
+// 결과 코드
+#define LATENCY_HIST_OK          0
+#define LATENCY_HIST_ERROR      -1
+
+typedef struct {
+    uint32_t buckets[LATENCY_HIST_BUCKETS];
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;
+} LatencyHist;
+
+void LatencyHist_Reset(LatencyHist* hist);
+
+// 측정값 하나 기록
+void LatencyHist_Record(LatencyHist* hist, uint32_t us);
+
+// src를 dst에 합산 (주기 요약 누적, 카드/정책별 집계용)
+void LatencyHist_Merge(LatencyHist* dst, const LatencyHist* src);
+
+// 값이 들어갈 버킷 번호와 버킷 상한 (us, 마지막 버킷은 UINT32_MAX)
+uint32_t LatencyHist_Bucket(uint32_t us);
+uint32_t LatencyHist_BucketUpperUs(uint32_t bucket);
+
+// 백분위 근사 (permille: 500 = p50, 990 = p99), 상한은 max_us로 제한
+// 기록이 없으면 0
+uint32_t LatencyHist_Percentile(const LatencyHist* hist, uint32_t permille);
+
+uint32_t LatencyHist_AverageUs(const LatencyHist* hist);
+
+// 한 줄 요약: "<name> n=12 avg=340 p50=512 p99=8192 max=301234"
+// 반환: 기록한 길이 (잘리면 LATENCY_HIST_ERROR)
+int LatencyHist_FormatSummary(const LatencyHist* hist, const char* name, char* buf, size_t size);
+
+// 버킷 덤프 (0이 아닌 버킷만): "<name> b<i>:<count> ..." (i는 log2 버킷 번호)
+int LatencyHist_FormatBuckets(const LatencyHist* hist, const char* name, char* buf, size_t size);
+
+#endif // LATENCYHIST_H
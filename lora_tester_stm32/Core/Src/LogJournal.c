@@ -0,0 +1,168 @@
+#include "LogJournal.h"
+#include "Checksum.h"
+#include <string.h>
+
+static void _put_u16(uint8_t* p, uint16_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void _put_u32(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint16_t _get_u16(const uint8_t* p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t _get_u32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+uint32_t LogJournal_Crc32(const uint8_t* data, size_t len)
+{
+    return Checksum_Crc32(data, len);
+}
+
+void LogJournal_InitWriter(LogJournalWriter* w, LogJournalCrcFn crc, uint16_t file_tag)
+{
+    if (w == NULL) {
+        return;
+    }
+    w->crc = (crc != NULL) ? crc : LogJournal_Crc32;
+    w->file_tag = file_tag;
+    w->next_seq = 0;
+}
+
+int LogJournal_EncodeFileHeader(LogJournalWriter* w, uint32_t timestamp_ms, uint16_t file_number,
+                                uint8_t* out, size_t out_max)
+{
+    uint8_t payload[LOG_JOURNAL_FILE_HEADER_PAYLOAD] = { 'L', 'J', 'R', LOG_JOURNAL_VERSION };
+    _put_u16(&payload[4], file_number);
+    return LogJournal_Encode(w, LOG_JOURNAL_TYPE_FILE_HEADER, timestamp_ms, payload, sizeof(payload),
+                             out, out_max);
+}
+
+int LogJournal_Encode(LogJournalWriter* w, uint8_t type, uint32_t timestamp_ms,
+                      const void* payload, size_t len, uint8_t* out, size_t out_max)
+{
+    if (w == NULL || out == NULL || (payload == NULL && len > 0) || len > LOG_JOURNAL_MAX_PAYLOAD) {
+        return LOG_JOURNAL_ERROR;
+    }
+    size_t total = LOG_JOURNAL_OVERHEAD + len;
+    if (out_max < total) {
+        return LOG_JOURNAL_NO_ROOM;
+    }
+
+    out[0] = LOG_JOURNAL_MAGIC;
+    out[1] = type;
+    _put_u16(&out[2], (uint16_t)len);
+    _put_u32(&out[4], timestamp_ms);
+    _put_u16(&out[8], w->next_seq);
+    _put_u16(&out[10], w->file_tag);
+    if (len > 0 && payload != &out[LOG_JOURNAL_HEADER_SIZE]) {
+        memcpy(&out[LOG_JOURNAL_HEADER_SIZE], payload, len);
+    }
+    _put_u32(&out[LOG_JOURNAL_HEADER_SIZE + len], w->crc(out, LOG_JOURNAL_HEADER_SIZE + len));
+
+    w->next_seq++;
+    return (int)total;
+}
+
+int LogJournal_Decode(LogJournalCrcFn crc, const uint8_t* in, size_t in_len, LogJournalRecord* rec)
+{
+    if (in == NULL || rec == NULL) {
+        return LOG_JOURNAL_ERROR;
+    }
+    if (in_len < 1) {
+        return LOG_JOURNAL_TRUNCATED;
+    }
+    if (in[0] != LOG_JOURNAL_MAGIC) {
+        return LOG_JOURNAL_CORRUPT;
+    }
+    if (in_len < LOG_JOURNAL_HEADER_SIZE) {
+        return LOG_JOURNAL_TRUNCATED;
+    }
+
+    uint16_t length = _get_u16(&in[2]);
+    if (length > LOG_JOURNAL_MAX_PAYLOAD) {
+        return LOG_JOURNAL_CORRUPT;
+    }
+    size_t total = LOG_JOURNAL_OVERHEAD + length;
+    if (in_len < total) {
+        return LOG_JOURNAL_TRUNCATED;
+    }
+
+    if (crc == NULL) {
+        crc = LogJournal_Crc32;
+    }
+    if (crc(in, LOG_JOURNAL_HEADER_SIZE + length) != _get_u32(&in[LOG_JOURNAL_HEADER_SIZE + length])) {
+        return LOG_JOURNAL_CORRUPT;
+    }
+
+    rec->type = in[1];
+    rec->length = length;
+    rec->timestamp_ms = _get_u32(&in[4]);
+    rec->seq = _get_u16(&in[8]);
+    rec->file_tag = _get_u16(&in[10]);
+    rec->payload = &in[LOG_JOURNAL_HEADER_SIZE];
+    return (int)total;
+}
+
+int LogJournal_Scan(LogJournalCrcFn crc, LogJournalReadFn read, void* ctx,
+                    uint8_t* buf, size_t buf_size, LogJournalScanResult* result)
+{
+    if (read == NULL || buf == NULL || result == NULL || buf_size < LOG_JOURNAL_MAX_RECORD) {
+        return LOG_JOURNAL_ERROR;
+    }
+    memset(result, 0, sizeof(*result));
+
+    uint32_t offset = 0;        // 다음 레코드 시작 위치
+    uint32_t buf_start = 0;     // buf[0]의 파일 위치
+    size_t buf_len = 0;
+    bool at_eof = false;
+
+    for (;;) {
+        size_t pos = offset - buf_start;
+        LogJournalRecord rec;
+        int size = LogJournal_Decode(crc, &buf[pos], buf_len - pos, &rec);
+
+        if (size == LOG_JOURNAL_TRUNCATED && !at_eof) {
+            // 버퍼 끝에 걸친 레코드: 현재 위치부터 다시 읽음 (buf_size >= 최대 레코드)
+            buf_start = offset;
+            buf_len = read(ctx, offset, buf, buf_size);
+            at_eof = buf_len < buf_size;
+            continue;
+        }
+        if (size < 0) {
+            break;  // 파일 끝, 잘린 레코드 또는 손상 - 여기까지가 유효 구간
+        }
+
+        // 파일 헤더로 시작하고 같은 file_tag, 연속된 seq여야 이 파일의 레코드
+        if (result->records == 0) {
+            if (rec.type != LOG_JOURNAL_TYPE_FILE_HEADER || rec.seq != 0 ||
+                rec.length < LOG_JOURNAL_FILE_HEADER_PAYLOAD || memcmp(rec.payload, "LJR", 3) != 0) {
+                break;
+            }
+            result->file_tag = rec.file_tag;
+            result->file_number = _get_u16(&rec.payload[4]);
+        } else if (rec.file_tag != result->file_tag || rec.seq != result->next_seq) {
+            break;
+        }
+
+        result->records++;
+        result->next_seq = (uint16_t)(rec.seq + 1);
+        result->last_timestamp_ms = rec.timestamp_ms;
+        offset += (uint32_t)size;
+        result->valid_end = offset;
+    }
+
+    return LOG_JOURNAL_OK;
+}
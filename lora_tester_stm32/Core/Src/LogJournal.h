@@ -0,0 +1,95 @@
+#ifndef LOGJOURNAL_H
+#define LOGJOURNAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// SD 로그용 충돌 안전 바이너리 저널 (.LJR)
+//
+// 파일은 레코드의 연속이며 첫 레코드는 항상 파일 헤더(seq 0):
+//   [0xA5][type][length u16 LE][timestamp_ms u32 LE][seq u16 LE][file_tag u16 LE]
+//   [payload (length 바이트)][crc32 u32 LE]
+// CRC는 헤더+payload에 대해 CRC-32/MPEG-2 (다항식 0x04C11DB7, 초기값 0xFFFFFFFF,
+// 반사/최종 XOR 없음) - STM32 CRC 주변장치 기본 설정과 동일.
+//
+// 복구: 파일 앞에서부터 레코드를 검사해 처음으로 어긋나는 지점(잘린 레코드, CRC 불일치,
+// 다른 파일의 잔여 데이터)에서 멈추고 그 위치까지를 유효 구간으로 봄.
+// seq는 파일마다 0부터 1씩 증가하고 file_tag는 파일마다 다르므로, 사전 할당 영역에
+// 남아 있던 예전 레코드는 CRC가 맞더라도 유효 구간에 포함되지 않음.
+
+#define LOG_JOURNAL_MAGIC           0xA5
+#define LOG_JOURNAL_HEADER_SIZE     12
+#define LOG_JOURNAL_CRC_SIZE        4
+#define LOG_JOURNAL_OVERHEAD        (LOG_JOURNAL_HEADER_SIZE + LOG_JOURNAL_CRC_SIZE)
+#define LOG_JOURNAL_MAX_PAYLOAD     1024
+#define LOG_JOURNAL_MAX_RECORD      (LOG_JOURNAL_OVERHEAD + LOG_JOURNAL_MAX_PAYLOAD)
+#define LOG_JOURNAL_VERSION         1
+
+// 레코드 종류
+#define LOG_JOURNAL_TYPE_FILE_HEADER    0x01    // payload: "LJR" + version + file_number u16
+#define LOG_JOURNAL_TYPE_TEXT           0x02    // 로그 한 줄 (줄바꿈 없음)
+#define LOG_JOURNAL_TYPE_BINARY         0x03    // 바이너리 로그
+
+#define LOG_JOURNAL_FILE_HEADER_PAYLOAD 6
+
+// 결과 코드
+#define LOG_JOURNAL_OK               0
+#define LOG_JOURNAL_ERROR           -1
+#define LOG_JOURNAL_NO_ROOM         -2   // 출력 버퍼 부족
+#define LOG_JOURNAL_CORRUPT         -3   // 잘못된 헤더 또는 CRC 불일치
+#define LOG_JOURNAL_TRUNCATED       -4   // 레코드가 중간에 잘림 (데이터 더 필요)
+
+// CRC 계산 함수 (기본값 LogJournal_Crc32)
+typedef uint32_t (*LogJournalCrcFn)(const uint8_t* data, size_t len);
+
+typedef struct {
+    LogJournalCrcFn crc;
+    uint16_t file_tag;
+    uint16_t next_seq;
+} LogJournalWriter;
+
+typedef struct {
+    uint8_t type;
+    uint16_t length;
+    uint32_t timestamp_ms;
+    uint16_t seq;
+    uint16_t file_tag;
+    const uint8_t* payload;     // 입력 버퍼 내부를 가리킴
+} LogJournalRecord;
+
+// 파일 읽기 콜백: offset부터 최대 len 바이트를 읽어 읽은 바이트 수 반환 (끝이면 0)
+typedef size_t (*LogJournalReadFn)(void* ctx, uint32_t offset, uint8_t* buf, size_t len);
+
+typedef struct {
+    uint32_t valid_end;         // 마지막 유효 레코드 끝 위치 (잘라낼 위치)
+    uint32_t records;           // 파일 헤더 포함 유효 레코드 수
+    uint16_t file_tag;
+    uint16_t next_seq;          // 이어쓰기 시 다음 seq
+    uint32_t last_timestamp_ms;
+    uint16_t file_number;       // 파일 헤더의 번호 (헤더가 없으면 0)
+} LogJournalScanResult;
+
+// CRC-32/MPEG-2 (Checksum_Crc32: 타겟은 CRC 주변장치, 호스트는 테이블)
+uint32_t LogJournal_Crc32(const uint8_t* data, size_t len);
+
+// 새 파일용 writer 초기화 (seq 0부터)
+void LogJournal_InitWriter(LogJournalWriter* w, LogJournalCrcFn crc, uint16_t file_tag);
+
+// 파일 헤더 레코드 인코딩 (파일의 첫 레코드), 성공 시 레코드 크기
+int LogJournal_EncodeFileHeader(LogJournalWriter* w, uint32_t timestamp_ms, uint16_t file_number,
+                                uint8_t* out, size_t out_max);
+
+// 레코드 인코딩, 성공 시 레코드 크기 (음수: 결과 코드)
+// payload가 out + LOG_JOURNAL_HEADER_SIZE이면 복사하지 않음 (데이터를 먼저 채우고 제자리 인코딩)
+int LogJournal_Encode(LogJournalWriter* w, uint8_t type, uint32_t timestamp_ms,
+                      const void* payload, size_t len, uint8_t* out, size_t out_max);
+
+// 레코드 1개 디코딩 및 CRC 검증, 성공 시 레코드 크기 (음수: 결과 코드)
+int LogJournal_Decode(LogJournalCrcFn crc, const uint8_t* in, size_t in_len, LogJournalRecord* rec);
+
+// 파일 앞에서부터 유효 구간 탐색 (buf_size >= LOG_JOURNAL_MAX_RECORD)
+int LogJournal_Scan(LogJournalCrcFn crc, LogJournalReadFn read, void* ctx,
+                    uint8_t* buf, size_t buf_size, LogJournalScanResult* result);
+
+#endif // LOGJOURNAL_H
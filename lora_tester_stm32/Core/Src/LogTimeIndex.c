@@ -0,0 +1,93 @@
+#include "LogTimeIndex.h"
+
+static void _put_u32(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t _get_u32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint32_t _check(const LogTimeIndexEntry* entry)
+{
+    return LOG_TIME_INDEX_MAGIC ^ entry->epoch_sec ^ entry->uptime_ms ^ entry->offset;
+}
+
+void LogTimeIndex_Encode(const LogTimeIndexEntry* entry, uint8_t out[LOG_TIME_INDEX_ENTRY_SIZE])
+{
+    _put_u32(&out[0], entry->epoch_sec);
+    _put_u32(&out[4], entry->uptime_ms);
+    _put_u32(&out[8], entry->offset);
+    _put_u32(&out[12], _check(entry));
+}
+
+bool LogTimeIndex_Decode(const uint8_t in[LOG_TIME_INDEX_ENTRY_SIZE], LogTimeIndexEntry* entry)
+{
+    LogTimeIndexEntry decoded;
+    decoded.epoch_sec = _get_u32(&in[0]);
+    decoded.uptime_ms = _get_u32(&in[4]);
+    decoded.offset = _get_u32(&in[8]);
+    if (_get_u32(&in[12]) != _check(&decoded)) {
+        return false;
+    }
+    *entry = decoded;
+    return true;
+}
+
+size_t LogTimeIndex_Parse(const uint8_t* data, size_t len, LogTimeIndexEntry* entries, size_t max_entries)
+{
+    size_t count = 0;
+    while (count < max_entries && (count + 1) * LOG_TIME_INDEX_ENTRY_SIZE <= len) {
+        LogTimeIndexEntry entry;
+        if (!LogTimeIndex_Decode(&data[count * LOG_TIME_INDEX_ENTRY_SIZE], &entry)) {
+            break;
+        }
+        if (count > 0 && entry.offset <= entries[count - 1].offset) {
+            break;
+        }
+        entries[count++] = entry;
+    }
+    return count;
+}
+
+// epoch가 target보다 큰(inclusive면 target 이상인) 첫 항목 위치 (없으면 count)
+static size_t _search(const LogTimeIndexEntry* entries, size_t count, uint32_t target, bool inclusive)
+{
+    size_t lo = 0;
+    size_t hi = count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (inclusive ? entries[mid].epoch_sec < target : entries[mid].epoch_sec <= target) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+void LogTimeIndex_FindRange(const LogTimeIndexEntry* entries, size_t count,
+                            uint32_t from_epoch, uint32_t to_epoch,
+                            uint32_t* start_offset, uint32_t* end_offset)
+{
+    // 같은 초의 줄이 항목 앞에도 있을 수 있으므로 from보다 이른 항목부터 시작
+    size_t first = _search(entries, count, from_epoch, true);
+    *start_offset = (first > 0) ? entries[first - 1].offset : 0;
+
+    size_t last = _search(entries, count, to_epoch, false);
+    *end_offset = (last < count) ? entries[last].offset : LOG_TIME_INDEX_END;
+}
+
+const LogTimeIndexEntry* LogTimeIndex_Anchor(const LogTimeIndexEntry* entries, size_t count, uint32_t offset)
+{
+    const LogTimeIndexEntry* anchor = NULL;
+    for (size_t i = 0; i < count && entries[i].offset <= offset; i++) {
+        anchor = &entries[i];
+    }
+    return anchor;
+}
@@ -152,12 +152,12 @@ void LoraStarter_Process(LoraStarterContext* ctx, const char* uart_rx)
             if (uart_rx && is_response_ok(uart_rx)) {
                 LOG_INFO("[LoRa] ✅ Time synchronization enabled");
                 ctx->state = LORA_STATE_WAIT_TIME_SYNC;
-                ctx->last_retry_time = TIME_GetCurrentMs(); // 5초 지연 시작 시점 기록
+                ctx->last_retry_time = TIME_GetMonotonicMs(); // 5초 지연 시작 시점 기록
             }
             break;
         case LORA_STATE_WAIT_TIME_SYNC:
             {
-                uint32_t current_time = TIME_GetCurrentMs();
+                uint64_t current_time = TIME_GetMonotonicMs();
                 const uint32_t TIME_SYNC_DELAY_MS = LORA_TIME_SYNC_DELAY_MS;
                 
                 if (ctx->last_retry_time == 0) {
@@ -244,7 +244,7 @@ void LoraStarter_Process(LoraStarterContext* ctx, const char* uart_rx)
                         ctx->state = LORA_STATE_WAIT_SEND_INTERVAL;
                         ctx->error_count = 0; // 성공 시 에러 카운터 리셋
                         ctx->retry_delay_ms = LORA_RETRY_DELAY_MS; // 재시도 지연 시간 리셋
-                        ctx->last_send_time = TIME_GetCurrentMs(); // 송신 완료 시간 저장
+                        ctx->last_send_time = TIME_GetMonotonicMs(); // 송신 완료 시간 저장
                         LOG_INFO("[LoRa] SEND successful, waiting for next interval...");
                         break;
                     case RESPONSE_TIMEOUT:
@@ -252,7 +252,7 @@ void LoraStarter_Process(LoraStarterContext* ctx, const char* uart_rx)
                         ctx->state = LORA_STATE_WAIT_SEND_INTERVAL; // 타임아웃 시 대기 상태로 전환
                         ctx->error_count = 0; 
                         ctx->retry_delay_ms = 1000;
-                        ctx->last_send_time = TIME_GetCurrentMs(); // 타임아웃 시간 저장
+                        ctx->last_send_time = TIME_GetMonotonicMs(); // 타임아웃 시간 저장
                         break;
                     case RESPONSE_ERROR:
                         LORA_LOG_SEND_FAILED("Network error");
@@ -276,7 +276,7 @@ void LoraStarter_Process(LoraStarterContext* ctx, const char* uart_rx)
             break;
         case LORA_STATE_WAIT_SEND_INTERVAL:
             {
-                uint32_t current_time = TIME_GetCurrentMs();
+                uint64_t current_time = TIME_GetMonotonicMs();
                 uint32_t interval_ms = (ctx->send_interval_ms > 0) ? ctx->send_interval_ms : 30000; // 기본값 30초
                 
                 if ((current_time - ctx->last_send_time) >= interval_ms) {
@@ -285,14 +285,14 @@ void LoraStarter_Process(LoraStarterContext* ctx, const char* uart_rx)
                     ctx->state = LORA_STATE_SEND_LTIME;
                 } else {
                     // 아직 대기 시간이 남았으므로 상태 유지
-                    uint32_t remaining_ms = interval_ms - (current_time - ctx->last_send_time);
+                    uint32_t remaining_ms = (uint32_t)(interval_ms - (current_time - ctx->last_send_time));
                     LOG_DEBUG("[LoRa] Waiting for send interval (%u ms remaining)", remaining_ms);
                 }
             }
             break;
         case LORA_STATE_JOIN_RETRY:
             {
-                uint32_t current_time = TIME_GetCurrentMs();
+                uint64_t current_time = TIME_GetMonotonicMs();
                 
                 if (ctx->last_retry_time == 0) {
                     // 첫 재시도: 바로 SEND_JOIN
@@ -307,7 +307,7 @@ void LoraStarter_Process(LoraStarterContext* ctx, const char* uart_rx)
                 } else {
                     // 아직 지연 시간이 지나지 않았다면 상태 유지
                     LOG_DEBUG("[LoRa] Waiting for retry delay (%lu ms remaining)", 
-                             ctx->retry_delay_ms - (current_time - ctx->last_retry_time));
+                             (unsigned long)(ctx->retry_delay_ms - (current_time - ctx->last_retry_time)));
                     // 아무것도 하지 않음
                 }
             }
@@ -0,0 +1,83 @@
+#ifndef NETFANOUT_H
+#define NETFANOUT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "Network.h"
+
+// 패킷 하나를 여러 전송 대상(Network 백엔드)에 나눠 보냄 (fan-out)
+//
+// 패킷은 버퍼 풀에 한 번만 복사하고, 대상마다 버퍼 번호만 큐에 넣음 (참조 카운트)
+// 모든 대상이 보내거나 버리면 버퍼 반환
+// 대상마다 큐/통계/실패 처리가 따로라서 한 대상이 느리거나 끊겨도 다른 대상은 계속 보냄:
+//   sink가 NET_FANOUT_RETRY를 돌려주면 그 패킷부터 다음 Drain에서 다시 시도
+//   sink가 음수를 돌려주면 그 패킷만 버림 (errors)
+//   풀이 가득 차면 가장 많이 밀린 대상의 가장 오래된 패킷부터 버림 (dropped)
+//     -> 느린 SD가 버퍼를 다 잡고 있어도 새 패킷은 항상 들어감
+// Drain의 budget으로 한 번에 보내는 패킷 수를 제한 (느린 대상이 호출자를 오래 잡지 않도록)
+// 동기화 없음 - Network와 같은 태스크에서만 호출
+
+#define NET_FANOUT_MAX_TARGETS      2U
+#define NET_FANOUT_POOL_SIZE        16U     // 버퍼 수 (대상별 큐 깊이도 같음)
+#define NET_FANOUT_BUF_SIZE         512U    // 버퍼 크기 (LogFrame 프레임 1개)
+
+// 결과 코드 (sink 반환값도 같은 규칙)
+#define NET_FANOUT_OK               0
+#define NET_FANOUT_RETRY            1       // sink: 일시적 실패, 나중에 다시 시도
+#define NET_FANOUT_ERROR           -1
+#define NET_FANOUT_INVALID_PARAM   -4
+
+typedef int (*NetFanoutSink)(const void* data, size_t size);
+
+typedef struct {
+    uint32_t submitted;         // 큐에 넣은 패킷
+    uint32_t sent;              // sink가 받은 패킷
+    uint32_t dropped;           // 풀이 모자라 버린 패킷
+    uint32_t errors;            // sink 실패로 버린 패킷
+    uint32_t retries;           // NET_FANOUT_RETRY로 미룬 횟수
+    uint32_t queued;            // 현재 큐 길이
+    uint32_t queue_peak;
+} NetFanoutStats;
+
+typedef struct {
+    uint16_t size;
+    uint8_t refs;               // 이 버퍼를 큐에 가진 대상 수
+    uint8_t data[NET_FANOUT_BUF_SIZE];
+} NetFanoutBuf;
+
+typedef struct {
+    NetFanoutSink sink;
+    uint8_t queue[NET_FANOUT_POOL_SIZE];    // 버퍼 번호 링
+    uint8_t head;
+    uint8_t count;
+    NetFanoutStats stats;
+} NetFanoutTarget;
+
+typedef struct {
+    NetFanoutBuf pool[NET_FANOUT_POOL_SIZE];
+    NetFanoutTarget targets[NET_FANOUT_MAX_TARGETS];
+} NetFanout;
+
+void NetFanout_Init(NetFanout* fanout);
+
+// 대상 index의 sink 설정 (NULL이면 대상 제거, 남은 큐는 버림)
+int NetFanout_SetTarget(NetFanout* fanout, uint8_t index, NetFanoutSink sink);
+
+// target_mask(bit = 대상 index)의 대상 큐에 패킷 추가 (size <= NET_FANOUT_BUF_SIZE)
+// 한 대상에도 못 넣으면 NET_FANOUT_ERROR
+int NetFanout_Submit(NetFanout* fanout, const void* data, size_t size, uint32_t target_mask);
+
+// 조각들을 버퍼 하나에 이어 붙여 추가 (복사는 이 한 번뿐)
+int NetFanout_SubmitV(NetFanout* fanout, const NetworkChunk* chunks, size_t count, uint32_t target_mask);
+
+// 대상 index의 큐를 오래된 순서로 sink 호출 최대 budget번(0이면 전부) 전송, 보낸 패킷 수 반환
+int NetFanout_Drain(NetFanout* fanout, uint8_t index, uint32_t budget);
+
+// 대상 index의 큐를 버림 (연결 해제)
+void NetFanout_Clear(NetFanout* fanout, uint8_t index);
+
+uint32_t NetFanout_Pending(const NetFanout* fanout, uint8_t index);
+void NetFanout_GetStats(const NetFanout* fanout, uint8_t index, NetFanoutStats* stats);
+
+#endif // NETFANOUT_H
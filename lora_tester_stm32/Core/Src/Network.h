@@ -12,24 +12,118 @@
 // 백엔드 타입 정의
 typedef enum {
     NETWORK_BACKEND_SOCKET,    // 네트워크 소켓 통신 (기본값)
-    NETWORK_BACKEND_SD_CARD    // SD카드 로컬 저장
+    NETWORK_BACKEND_SD_CARD,   // SD카드 로컬 저장
+    NETWORK_BACKEND_COUNT
 } NetworkBackend_t;
 
-// 백엔드 선택 설정
+// 소켓 백엔드 전송 방식
+typedef enum {
+    NETWORK_TRANSPORT_TCP,     // 스트림 (기본값)
+    NETWORK_TRANSPORT_UDP      // 데이터그램 (메시지 경계 유지)
+} NetworkTransport_t;
+
+// 전송 조각 - 헤더/본문/꼬리를 따로 가진 호출자가 한 버퍼로 모으지 않고 한 패킷으로 보냄
+// (SDStorageChunk와 같은 배치)
+typedef struct {
+    const void* data;
+    size_t size;
+} NetworkChunk;
+
+#define NETWORK_MAX_CHUNKS      8
+
+// 조각 합계 바이트 (조각 수가 0이거나 NETWORK_MAX_CHUNKS 초과, data 없는 조각이 있으면 0)
+static inline size_t Network_ChunksSize(const NetworkChunk* chunks, size_t count) {
+    size_t size = 0;
+    if (chunks == NULL || count == 0 || count > NETWORK_MAX_CHUNKS) {
+        return 0;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (chunks[i].data == NULL && chunks[i].size > 0) {
+            return 0;
+        }
+        size += chunks[i].size;
+    }
+    return size;
+}
+
+// 소켓 백엔드 전송 통계 (호스트 소켓 구현에서만 채워짐)
+typedef struct {
+    uint32_t bytes_sent;            // 소켓에 넘긴 바이트
+    uint32_t messages_queued;       // 받은 메시지 (링이 비어 바로 보낸 것 포함)
+    uint32_t messages_dropped;      // 링이 가득 차 거부한 메시지
+    uint32_t bytes_dropped;
+    uint32_t queue_bytes;           // 현재 링에 남은 바이트
+    uint32_t queue_peak_bytes;      // 링 사용량 최대치
+    uint32_t send_calls;            // sendmsg 호출 수 (묶음 효과 = bytes_sent / send_calls)
+    uint32_t connects;              // 연결 성공 수 (재연결 = connects - 1)
+    uint32_t connect_failures;      // connect 실패 + 연결 끊김
+    uint32_t backoff_ms;            // 다음 재연결 대기 시간
+    uint32_t bytes_per_sec;         // 직전 NET_SOCKET_RATE_WINDOW_MS 구간 전송 속도
+    bool link_up;
+    // store-and-forward (송신 큐가 가득 찼을 때 RAM 링 -> SD spill 파일에 보관)
+    uint32_t stored_packets;        // 보관한 패킷
+    uint32_t spilled_packets;       // RAM 링에서 SD spill 파일로 옮긴 패킷
+    uint32_t replayed_packets;      // 연결 후 재전송한 패킷
+    uint32_t dropped_packets;       // 보관할 곳이 없어 버린 패킷
+    uint32_t backlog_bytes;         // 재전송 대기 바이트 (RAM 링 + spill 파일)
+} NetworkSocketStats;
+
+// 백엔드별 fan-out 큐 통계 (백엔드를 2개 이상 켰을 때만 채워짐)
+typedef struct {
+    uint32_t submitted;             // 큐에 넣은 패킷
+    uint32_t sent;                  // 백엔드에 넘긴 패킷
+    uint32_t dropped;               // 버퍼가 모자라 버린 패킷 (가장 밀린 백엔드부터)
+    uint32_t errors;                // 백엔드 전송 실패로 버린 패킷
+    uint32_t retries;               // 백엔드가 막혀 다음 Poll로 미룬 횟수
+    uint32_t queued;                // 현재 대기 패킷
+    uint32_t queue_peak;
+} NetworkBackendStats;
+
+// 백엔드 선택 설정 (그 백엔드 하나만 사용, 다른 백엔드는 해제)
 int Network_SetBackend(NetworkBackend_t backend);
 
-// 현재 백엔드 확인
+// 현재 백엔드 확인 (여러 개를 켰으면 SetBackend로 고른 기본 백엔드)
 NetworkBackend_t Network_GetBackend(void);
 
+// 백엔드 추가/제거 - 2개 이상이면 Network_SendBinary가 패킷을 모든 연결된 백엔드로 보냄 (fan-out)
+// 패킷은 공유 버퍼에 한 번만 복사 (참조 카운트), 백엔드마다 큐가 따로라 SD가 느려도 소켓 전송은 밀리지 않음
+// 각 백엔드는 따로 초기화 (소켓: Network_Init, SD: Network_InitSD)
+int Network_EnableBackend(NetworkBackend_t backend, bool enable);
+bool Network_IsBackendEnabled(NetworkBackend_t backend);
+
+// 소켓 전송 방식 선택 (다음 Network_Init부터 적용)
+int Network_SetTransport(NetworkTransport_t transport);
+
 // 네트워크 초기화 (소켓 백엔드용)
+// 호스트에서는 non-blocking 연결만 시작하고 바로 반환 (서버가 늦게 떠도 재연결)
 int Network_Init(const char* server_ip, uint16_t port);
 
 // SD카드 백엔드 초기화
 int Network_InitSD(void);
 
-// 바이너리 데이터 전송
+// 바이너리 데이터 전송 (소켓 백엔드는 송신 큐에 넣고 바로 반환)
+// 송신 큐가 가득 차면(연결 끊김이 길어짐) store-and-forward로 보관 - 보관도 못 하면 NETWORK_QUEUE_FULL
+// fan-out이면 size <= NET_FANOUT_BUF_SIZE(512), 연결된 백엔드 중 하나라도 있으면 NETWORK_OK
 int Network_SendBinary(const void* data, size_t size);
 
+// 조각들을 이어 한 패킷으로 전송 (Network_SendBinary는 조각 1개짜리 래퍼)
+// 소켓: 송신 링이 비어 있으면 조각 그대로 sendmsg, SD: 조각을 write-behind 버퍼/SD 요청에 바로 복사
+// fan-out: 공유 버퍼에 한 번 모음
+int Network_SendBinaryV(const NetworkChunk* chunks, size_t count);
+
+// 송신 큐 전송/재연결/보관 패킷 재전송 처리 (주기 호출)
+// 재전송은 속도 제한(STORE_FORWARD_DRAIN_BPS) - 실시간 패킷이 먼저 나감
+// fan-out SD 큐는 Poll마다 NETWORK_FANOUT_SD_BUDGET개씩 기록
+int Network_Poll(void);
+
+// fan-out 큐를 모두 보내고 송신 큐가 빌 때까지 최대 timeout_ms 대기
+int Network_Flush(uint32_t timeout_ms);
+
+int Network_GetBackendStats(NetworkBackend_t backend, NetworkBackendStats* stats);
+
+// 소켓 전송 통계 (소켓 구현이 없는 빌드에서는 0)
+int Network_GetSocketStats(NetworkSocketStats* stats);
+
 // 연결 상태 확인
 bool Network_IsConnected(void);
 
@@ -42,5 +136,8 @@ void Network_Disconnect(void);
 #define NETWORK_NOT_CONNECTED  -2
 #define NETWORK_TIMEOUT        -3
 #define NETWORK_INVALID_PARAM  -4
+#define NETWORK_QUEUE_FULL     -5   // 송신 큐 가득 참 (메시지 버림)
+
+#define NETWORK_FANOUT_SD_BUDGET    4       // Network_Poll 한 번에 SD에 기록할 fan-out 패킷 수
 
 #endif // NETWORK_H
\ No newline at end of file
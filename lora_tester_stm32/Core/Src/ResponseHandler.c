@@ -1,6 +1,8 @@
 #include "ResponseHandler.h"
 #include "logger.h"
 #include "CommandSender.h"
+#include "system_config.h"
+#include "time.h"
 #include <string.h>
 #include <stdio.h>
 
@@ -116,42 +118,42 @@ bool ResponseHandler_IsTimeResponse(const char* response)
     return (strstr(response, "LTIME:") != NULL || strstr(response, "LTIME=") != NULL);
 }
 
-// 한국 시간대(UTC+9) 보정 함수
-static void ConvertUTCToKST(char* time_str) {
+// LTIME 문자열("01h51m37s on 07/29/2025", UTC)을 epoch 초로 변환
+static bool ParseUTCToEpoch(const char* time_str, uint32_t* epoch) {
     int hour, min, sec, month, day, year;
     
-    // "01h51m37s on 07/29/2025" 형식에서 시간 추출
     if (sscanf(time_str, "%dh%dm%ds on %d/%d/%d", 
-               &hour, &min, &sec, &month, &day, &year) == 6) {
-        
-        // 한국 시간대로 보정 (UTC+9)
-        hour += 9;
-        
-        // 날짜 넘어가는 경우 처리
-        if (hour >= 24) {
-            hour -= 24;
-            day += 1;
-            
-            // 월말 처리 (간단한 버전)
-            int days_in_month[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-            if (year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)) {
-                days_in_month[1] = 29; // 윤년
-            }
-            
-            if (day > days_in_month[month - 1]) {
-                day = 1;
-                month += 1;
-                if (month > 12) {
-                    month = 1;
-                    year += 1;
-                }
-            }
-        }
-        
-        // 한국 시간으로 수정된 시간 문자열 재구성
-        snprintf(time_str, 64, "%02dh%02dm%02ds on %02d/%02d/%d (KST)", 
-                 hour, min, sec, month, day, year);
+               &hour, &min, &sec, &month, &day, &year) != 6) {
+        return false;
+    }
+    
+    // 모듈이 2자리 연도("01/01/19")를 보내는 경우 보정
+    if (year < 100) {
+        year += 2000;
     }
+    
+    if (month < 1 || month > 12 || day < 1 || day > 31 ||
+        hour < 0 || hour > 23 || min < 0 || min > 59 || sec < 0 || sec > 59 ||
+        year < 1970) {
+        return false;
+    }
+    
+    TIME_DateTime dt = {
+        .year = (uint16_t)year, .month = (uint8_t)month, .day = (uint8_t)day,
+        .hour = (uint8_t)hour, .minute = (uint8_t)min, .second = (uint8_t)sec
+    };
+    *epoch = TIME_DateTimeToEpoch(&dt);
+    return true;
+}
+
+// 한국 시간대(UTC+9) 보정 함수
+static void ConvertUTCToKST(char* time_str, uint32_t utc_epoch) {
+    TIME_DateTime dt;
+    TIME_EpochToDateTime(utc_epoch + LOGGER_TIMEZONE_OFFSET_SEC, &dt);
+    
+    // 한국 시간으로 수정된 시간 문자열 재구성
+    snprintf(time_str, 64, "%02dh%02dm%02ds on %02d/%02d/%d (" LOGGER_TIMEZONE_LABEL ")", 
+             dt.hour, dt.minute, dt.second, dt.month, dt.day, dt.year);
 }
 
 // 시간 응답 파싱 및 저장 함수
@@ -193,8 +195,12 @@ void ResponseHandler_ParseTimeResponse(const char* response)
         newline = strchr(g_network_time, '\n');
         if (newline) *newline = '\0';
         
-        // 한국 시간대로 보정
-        ConvertUTCToKST(g_network_time);
+        // 한국 시간대로 보정 + 로거 타임스탬프 기준 갱신
+        uint32_t utc_epoch;
+        if (ParseUTCToEpoch(g_network_time, &utc_epoch)) {
+            ConvertUTCToKST(g_network_time, utc_epoch);
+            LOGGER_SetTimeBase(utc_epoch);
+        }
         
         g_time_synchronized = true;
         
@@ -0,0 +1,398 @@
+#include "SDService.h"
+#include "system_config.h"
+#include "cmsis_os.h"
+#include "stm32f7xx_hal.h"
+#include <string.h>
+
+// 큐에 들어가는 요청 (append 페이로드는 요청 안에 복사)
+typedef struct {
+    SDServiceRequestType type;
+    uint16_t length;
+    uint32_t enqueue_tick;
+    SDServiceCallback callback;
+    void* ctx;
+    bool more;                      // 같은 줄의 다음 조각이 바로 뒤따름 (긴 줄 분할)
+    uint8_t data[SD_SERVICE_APPEND_MAX];
+} SDServiceRequest;
+
+// 한 줄이 차지하는 최대 요청 수
+#define SD_SERVICE_LINE_PIECES  ((SD_SERVICE_LINE_MAX + SD_SERVICE_APPEND_MAX - 1) / SD_SERVICE_APPEND_MAX)
+
+// 묶음 한 번에 꺼내는 최대 요청 수 (마지막 줄의 조각은 묶음 한도를 넘어도 끝까지 함께 꺼냄)
+#define SD_SERVICE_BATCH_PIECES (SD_SERVICE_BATCH_MAX + SD_SERVICE_LINE_PIECES - 1)
+
+static osMailQId g_queue = NULL;
+static SDServiceStats g_stats;
+
+static const char* const g_request_names[SDSERVICE_REQ_COUNT] = {
+    "APPEND", "FLUSH", "ROTATE", "STAT", "LATENCY_DUMP", "APPEND_BINARY"
+};
+
+static void _count_rejected(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    g_stats.rejected++;
+    __set_PRIMASK(primask);
+}
+
+// 요청 슬롯 할당 후 큐에 넣음 (ISR/모든 태스크에서 호출 가능, 대기 없음)
+// append 페이로드는 조각을 요청 슬롯에 바로 이어 붙임 (size = 조각 합계, 호출자가 검사)
+// 슬롯보다 긴 줄은 SD_SERVICE_APPEND_MAX 단위 연속 요청으로 나눔 - 슬롯을 모두 확보한
+// 뒤에만 넣으므로 큐가 가득 차도 줄의 일부만 들어가지 않음 (완료 콜백은 마지막 요청에만)
+// 조각들은 임계 구역 안에서 연달아 넣어 다른 태스크/ISR의 요청이 사이에 끼지 않고,
+// SD 태스크가 more 표시로 다시 이어 한 줄로 기록
+static ResultCode _enqueue(SDServiceRequestType type, const SDStorageChunk* chunks, size_t count,
+                           size_t size, SDServiceCallback callback, void* ctx) {
+    if (g_queue == NULL) {
+        return RESULT_ERROR_NOT_INITIALIZED;
+    }
+
+    size_t pieces = (size == 0) ? 1 : (size + SD_SERVICE_APPEND_MAX - 1) / SD_SERVICE_APPEND_MAX;
+    SDServiceRequest* reqs[SD_SERVICE_LINE_PIECES];
+    for (size_t i = 0; i < pieces; i++) {
+        reqs[i] = (SDServiceRequest*)osMailAlloc(g_queue, 0);
+        if (reqs[i] == NULL) {
+            while (i > 0) {
+                osMailFree(g_queue, reqs[--i]);
+            }
+            _count_rejected();
+            return RESULT_ERROR_BUSY;
+        }
+    }
+
+    uint32_t now = HAL_GetTick();
+    size_t chunk_index = 0;
+    size_t chunk_offset = 0;
+    for (size_t i = 0; i < pieces; i++) {
+        SDServiceRequest* req = reqs[i];
+        size_t length = size - i * SD_SERVICE_APPEND_MAX;
+        if (length > SD_SERVICE_APPEND_MAX) {
+            length = SD_SERVICE_APPEND_MAX;
+        }
+        bool last = (i + 1 == pieces);
+
+        req->type = type;
+        req->length = (uint16_t)length;
+        req->enqueue_tick = now;
+        req->callback = last ? callback : NULL;
+        req->ctx = last ? ctx : NULL;
+        req->more = !last;
+
+        size_t offset = 0;
+        while (offset < length && chunk_index < count) {
+            const SDStorageChunk* chunk = &chunks[chunk_index];
+            size_t copy = chunk->size - chunk_offset;
+            if (copy > length - offset) {
+                copy = length - offset;
+            }
+            memcpy(&req->data[offset], (const uint8_t*)chunk->data + chunk_offset, copy);
+            offset += copy;
+            chunk_offset += copy;
+            if (chunk_offset == chunk->size) {
+                chunk_index++;
+                chunk_offset = 0;
+            }
+        }
+    }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    for (size_t i = 0; i < pieces; i++) {
+        if (osMailPut(g_queue, reqs[i]) != osOK) {
+            // 풀과 큐 깊이가 같아 할당된 슬롯은 항상 들어가야 함 - 그래도 실패하면
+            // 이미 넣은 조각에서 줄을 끝냄 (SD 태스크는 아직 못 꺼냄, 다음 줄과 이어지지 않음)
+            if (i > 0) {
+                reqs[i - 1]->more = false;
+            }
+            for (size_t j = i; j < pieces; j++) {
+                osMailFree(g_queue, reqs[j]);
+            }
+            __set_PRIMASK(primask);
+            _count_rejected();
+            return RESULT_ERROR_BUSY;
+        }
+    }
+    __set_PRIMASK(primask);
+    return RESULT_SUCCESS;
+}
+
+static void _complete(SDServiceRequest* req, ResultCode result, const SDStorageStats* stats) {
+    uint32_t latency_ms = HAL_GetTick() - req->enqueue_tick;
+
+    SDServiceLatency* latency = &g_stats.latency[req->type];
+    latency->count++;
+    latency->total_ms += latency_ms;
+    if (latency_ms > latency->max_ms) {
+        latency->max_ms = latency_ms;
+    }
+    if (result != RESULT_SUCCESS) {
+        latency->failed++;
+    }
+
+    if (req->callback != NULL) {
+        SDServiceCompletion completion = { req->type, result, latency_ms, stats };
+        req->callback(&completion, req->ctx);
+    }
+    osMailFree(g_queue, req);
+}
+
+// 연속된 append 요청을 한 번의 SDStorage_WriteLogBatch로 기록
+// 여러 조각으로 나뉜 줄은 SDStorage_WriteLogV 한 번에 조각을 이어 한 줄(저널이면 한 레코드)로 기록
+static void _execute_appends(SDServiceRequest** batch, size_t count) {
+    SDStorageChunk chunks[SD_SERVICE_BATCH_PIECES];
+    ResultCode result = RESULT_SUCCESS;
+    size_t i = 0;
+
+    while (i < count) {
+        size_t start = i;
+        size_t parts = 0;
+        size_t written = 0;     // 이번 기록에서 성공한 요청 수
+        bool split_line = batch[i]->more;
+        // 분할된 줄이면 그 줄의 조각만, 아니면 뒤따르는 한 조각짜리 줄들을 모음
+        while (i < count && batch[i]->more == split_line) {
+            chunks[parts].data = batch[i]->data;
+            chunks[parts].size = batch[i]->length;
+            parts++;
+            i++;
+        }
+        if (split_line && i < count) {
+            chunks[parts].data = batch[i]->data;    // 마지막 조각 (more 없음)
+            chunks[parts].size = batch[i]->length;
+            parts++;
+            i++;
+        }
+
+        // 실패한 줄부터는 모두 실패로 보고 (순서 보장을 위해 뒤의 줄도 기록하지 않음)
+        if (result == RESULT_SUCCESS) {
+            if (split_line) {
+                result = SDStorage_WriteLogV(chunks, parts);
+                written = (result == RESULT_SUCCESS) ? parts : 0;
+            } else {
+                result = SDStorage_WriteLogBatch(chunks, parts, &written);
+            }
+            g_stats.batches++;
+        }
+        for (size_t j = 0; j < parts; j++) {
+            _complete(batch[start + j], j < written ? RESULT_SUCCESS : result, NULL);
+        }
+    }
+    g_stats.batched_appends += count;
+}
+
+// 바이너리 레코드 하나를 기록 (묶지 않음) - 분할된 레코드는 바로 뒤에 있는 조각을 마저 꺼내 이어 붙임
+// 처리한 요청 수 반환
+static size_t _execute_binary(SDServiceRequest* req) {
+    SDServiceRequest* pieces[SD_SERVICE_LINE_PIECES];
+    SDStorageChunk chunks[SD_SERVICE_LINE_PIECES];
+    size_t count = 0;
+    pieces[count++] = req;
+    while (pieces[count - 1]->more && count < SD_SERVICE_LINE_PIECES) {
+        osEvent event = osMailGet(g_queue, 0);
+        if (event.status != osEventMail) {
+            break;
+        }
+        pieces[count++] = (SDServiceRequest*)event.value.p;
+    }
+    for (size_t i = 0; i < count; i++) {
+        chunks[i].data = pieces[i]->data;
+        chunks[i].size = pieces[i]->length;
+    }
+
+    ResultCode result = SDStorage_WriteBinaryV(chunks, count);
+    for (size_t i = 0; i < count; i++) {
+        _complete(pieces[i], result, NULL);
+    }
+    return count;
+}
+
+// 제어/바이너리 요청 하나 처리, 처리한 요청 수 반환
+static size_t _execute(SDServiceRequest* req) {
+    SDStorageStats stats;
+    ResultCode result = RESULT_SUCCESS;
+
+    switch (req->type) {
+        case SDSERVICE_REQ_APPEND_BINARY:
+            return _execute_binary(req);
+        case SDSERVICE_REQ_FLUSH:
+            result = SDStorage_Flush();
+            break;
+        case SDSERVICE_REQ_ROTATE:
+            result = SDStorage_RotateIfNeeded();
+            break;
+        case SDSERVICE_REQ_STAT:
+            SDStorage_GetStats(&stats);
+            _complete(req, RESULT_SUCCESS, &stats);
+            return 1;
+        case SDSERVICE_REQ_LATENCY_DUMP:
+            SDStorage_DumpLatency();
+            break;
+        default:
+            result = RESULT_ERROR_INVALID_PARAM;
+            break;
+    }
+    _complete(req, result, NULL);
+    return 1;
+}
+
+ResultCode SDService_Init(void)
+{
+    if (g_queue != NULL) {
+        return RESULT_ERROR_ALREADY_INITIALIZED;
+    }
+
+    osMailQDef(sdServiceQueue, SD_SERVICE_QUEUE_DEPTH, SDServiceRequest);
+    g_queue = osMailCreate(osMailQ(sdServiceQueue), NULL);
+    if (g_queue == NULL) {
+        return RESULT_ERROR_MEMORY_ALLOC;
+    }
+
+    memset(&g_stats, 0, sizeof(g_stats));
+    return RESULT_SUCCESS;
+}
+
+ResultCode SDService_Append(const void* data, size_t size)
+{
+    return SDService_AppendWithCallback(data, size, NULL, NULL);
+}
+
+ResultCode SDService_AppendWithCallback(const void* data, size_t size,
+                                        SDServiceCallback callback, void* ctx)
+{
+    if (data == NULL || size == 0 || size > SD_SERVICE_LINE_MAX) {
+        return RESULT_ERROR_INVALID_PARAM;
+    }
+    if (!SDStorage_IsReady()) {
+        return SDSTORAGE_NOT_READY;
+    }
+    SDStorageChunk chunk = { data, size };
+    return _enqueue(SDSERVICE_REQ_APPEND, &chunk, 1, size, callback, ctx);
+}
+
+ResultCode SDService_AppendV(const SDStorageChunk* chunks, size_t count)
+{
+    if (chunks == NULL) {
+        return RESULT_ERROR_INVALID_PARAM;
+    }
+    size_t size = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (chunks[i].data == NULL && chunks[i].size > 0) {
+            return RESULT_ERROR_INVALID_PARAM;
+        }
+        size += chunks[i].size;
+    }
+    if (size == 0 || size > SD_SERVICE_LINE_MAX) {
+        return RESULT_ERROR_INVALID_PARAM;
+    }
+    if (!SDStorage_IsReady()) {
+        return SDSTORAGE_NOT_READY;
+    }
+    return _enqueue(SDSERVICE_REQ_APPEND, chunks, count, size, NULL, NULL);
+}
+
+ResultCode SDService_AppendBinary(const void* data, size_t size)
+{
+    if (data == NULL || size == 0 || size > SD_SERVICE_LINE_MAX) {
+        return RESULT_ERROR_INVALID_PARAM;
+    }
+    if (!SDStorage_IsReady()) {
+        return SDSTORAGE_NOT_READY;
+    }
+    SDStorageChunk chunk = { data, size };
+    return _enqueue(SDSERVICE_REQ_APPEND_BINARY, &chunk, 1, size, NULL, NULL);
+}
+
+ResultCode SDService_Submit(SDServiceRequestType type, SDServiceCallback callback, void* ctx)
+{
+    if (type == SDSERVICE_REQ_APPEND || type == SDSERVICE_REQ_APPEND_BINARY || type >= SDSERVICE_REQ_COUNT) {
+        return RESULT_ERROR_INVALID_PARAM;
+    }
+    return _enqueue(type, NULL, 0, 0, callback, ctx);
+}
+
+void SDService_Process(uint32_t timeout_ms)
+{
+    if (g_queue == NULL) {
+        osDelay(timeout_ms);
+        return;
+    }
+
+    osEvent event = osMailGet(g_queue, timeout_ms);
+
+    // 한 번 호출에 최대 큐 깊이만큼만 처리 (주기 작업이 밀리지 않도록)
+    uint32_t handled = 0;
+    SDServiceRequest* pending = (event.status == osEventMail) ? (SDServiceRequest*)event.value.p : NULL;
+    while (pending != NULL && handled < SD_SERVICE_QUEUE_DEPTH) {
+        SDServiceRequest* req = pending;
+        pending = NULL;
+
+        if (req->type != SDSERVICE_REQ_APPEND) {
+            handled += _execute(req);
+        } else {
+            // 뒤따르는 append를 모아 같은 파일에 한 번에 기록 (분할된 줄은 끝 조각까지)
+            SDServiceRequest* batch[SD_SERVICE_BATCH_PIECES];
+            size_t count = 0;
+            batch[count++] = req;
+            while (count < SD_SERVICE_BATCH_MAX || batch[count - 1]->more) {
+                event = osMailGet(g_queue, 0);
+                if (event.status != osEventMail) {
+                    break;
+                }
+                SDServiceRequest* next = (SDServiceRequest*)event.value.p;
+                if (next->type != SDSERVICE_REQ_APPEND) {
+                    pending = next;  // 묶음 기록 후 순서대로 처리
+                    break;
+                }
+                batch[count++] = next;
+            }
+            // 이번 호출에서 꺼낸 요청 수 = 깨어났을 때 밀려 있던 양 (적응형 동기화 입력)
+            SDStorage_SetBacklog((uint32_t)(handled + count));
+            _execute_appends(batch, count);
+            handled += count;
+        }
+
+        if (pending == NULL && handled < SD_SERVICE_QUEUE_DEPTH) {
+            event = osMailGet(g_queue, 0);
+            if (event.status == osEventMail) {
+                pending = (SDServiceRequest*)event.value.p;
+            }
+        }
+    }
+    if (pending != NULL) {
+        _execute(pending);  // 한도에 걸린 제어 요청은 바로 처리 (큐에 되돌릴 수 없음)
+    }
+
+    // 주기 작업: 회전(사전 할당 포함)과 시간/바이트 기준 동기화
+    if (SDStorage_IsReady()) {
+        SDStorage_RotateIfNeeded();
+        SDStorage_FlushIfDue();
+    }
+}
+
+bool SDService_IsReady(void)
+{
+    return g_queue != NULL && SDStorage_IsReady();
+}
+
+bool SDService_WaitReady(uint32_t timeout_ms)
+{
+    uint32_t start = HAL_GetTick();
+    while (!SDService_IsReady()) {
+        if (HAL_GetTick() - start >= timeout_ms) {
+            return false;
+        }
+        osDelay(100);
+    }
+    return true;
+}
+
+void SDService_GetStats(SDServiceStats* stats)
+{
+    if (stats != NULL) {
+        *stats = g_stats;
+    }
+}
+
+const char* SDService_RequestName(SDServiceRequestType type)
+{
+    return (type < SDSERVICE_REQ_COUNT) ? g_request_names[type] : "UNKNOWN";
+}
@@ -0,0 +1,88 @@
+#ifndef SDSERVICE_H
+#define SDSERVICE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "error_codes.h"
+#include "SDStorage.h"
+
+// SD 서비스: FatFs 볼륨은 SD 태스크 하나만 소유하고 (_FS_REENTRANT 0)
+// 다른 태스크(로거, Network, LoRa)는 요청 큐를 통해서만 SD에 접근
+// SDStorage_* 직접 호출은 SD 태스크(SDService_Process 호출자)에서만 허용
+
+// 요청 종류
+typedef enum {
+    SDSERVICE_REQ_APPEND = 0,   // 로그 한 줄 추가 (연속 append는 묶어서 기록)
+    SDSERVICE_REQ_FLUSH,        // write-behind 버퍼/압축 블록 기록 후 f_sync
+    SDSERVICE_REQ_ROTATE,       // 크기/시간 조건을 확인해 다음 로그 파일로 회전
+    SDSERVICE_REQ_STAT,         // SDStorage 쓰기 통계 조회
+    SDSERVICE_REQ_LATENCY_DUMP, // f_write/f_sync/마운트/회전 지연 히스토그램 전체를 로그로 출력
+    SDSERVICE_REQ_APPEND_BINARY,// 바이너리 로그 레코드 추가 (저널 파일의 BINARY 레코드, 묶지 않음)
+    SDSERVICE_REQ_COUNT
+} SDServiceRequestType;
+
+// 요청 완료 정보
+typedef struct {
+    SDServiceRequestType type;
+    ResultCode result;
+    uint32_t latency_ms;            // 큐 대기 + 처리 시간
+    const SDStorageStats* stats;    // STAT 요청일 때만 유효 (콜백 안에서만 사용)
+} SDServiceCompletion;
+
+// 완료 콜백 (SD 태스크 컨텍스트에서 호출되므로 짧게 처리하고 SD 요청을 기다리지 말 것)
+typedef void (*SDServiceCallback)(const SDServiceCompletion* completion, void* ctx);
+
+// 요청 종류별 지연 시간 통계
+typedef struct {
+    uint32_t count;       // 완료된 요청 수
+    uint32_t failed;      // 실패한 요청 수
+    uint32_t total_ms;    // 누적 지연 시간 (큐 대기 + 처리)
+    uint32_t max_ms;      // 최대 지연 시간
+} SDServiceLatency;
+
+typedef struct {
+    SDServiceLatency latency[SDSERVICE_REQ_COUNT];
+    uint32_t batches;           // append 묶음 기록 횟수
+    uint32_t batched_appends;   // 묶음으로 기록된 append 수
+    uint32_t rejected;          // 큐가 가득 차서 거절된 요청 수
+} SDServiceStats;
+
+// 요청 큐 생성 (스케줄러 시작 전, RTOS_QUEUES 섹션에서 호출)
+ResultCode SDService_Init(void);
+
+// 로그 한 줄 추가 요청 (대기 없음, 큐가 가득 차면 RESULT_ERROR_BUSY)
+// SD_SERVICE_APPEND_MAX보다 긴 줄(<= SD_SERVICE_LINE_MAX)은 요청 여러 개에 나눠 담기지만 한 줄로 기록됨
+ResultCode SDService_Append(const void* data, size_t size);
+
+// 조각 여러 개를 이어 한 줄로 append (조각은 요청 슬롯에 바로 복사, 합계 <= SD_SERVICE_LINE_MAX)
+ResultCode SDService_AppendV(const SDStorageChunk* chunks, size_t count);
+
+// 바이너리 레코드 하나 추가 요청 (LOG_SINK_SD_BINARY용, 크기 <= SD_SERVICE_LINE_MAX)
+// 저널 파일(journal_enabled)에만 기록되고, 텍스트/압축 파일이면 SD 태스크에서 RESULT_ERROR_NOT_SUPPORTED로 완료
+ResultCode SDService_AppendBinary(const void* data, size_t size);
+
+// 완료 콜백을 받는 append 요청
+ResultCode SDService_AppendWithCallback(const void* data, size_t size,
+                                        SDServiceCallback callback, void* ctx);
+
+// FLUSH/ROTATE/STAT 요청 (callback은 NULL 허용)
+ResultCode SDService_Submit(SDServiceRequestType type, SDServiceCallback callback, void* ctx);
+
+// 요청 처리 (SD 태스크 전용): timeout_ms 동안 요청을 기다린 뒤 큐를 비우고
+// 주기 작업(회전 확인, 동기화 임계값 확인)을 수행
+void SDService_Process(uint32_t timeout_ms);
+
+// 요청 큐가 있고 SD 카드가 마운트된 상태인지
+bool SDService_IsReady(void);
+
+// SD 태스크가 마운트를 마칠 때까지 최대 timeout_ms 대기
+bool SDService_WaitReady(uint32_t timeout_ms);
+
+// 서비스 통계 조회
+void SDService_GetStats(SDServiceStats* stats);
+
+// 요청 종류 이름 (로그 출력용)
+const char* SDService_RequestName(SDServiceRequestType type);
+
+#endif // SDSERVICE_H
@@ -5,6 +5,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include "error_codes.h"
+#include "LatencyHist.h"
 
 // SD카드 기반 로그 저장 모듈
 // FatFs 라이브러리를 사용하여 LoRa 통신 로그를 SD카드에 저장
@@ -15,6 +16,69 @@ ResultCode SDStorage_Init(void);
 // 바이너리 데이터를 SD카드에 저장
 ResultCode SDStorage_WriteLog(const void* data, size_t size);
 
+// 일괄 기록용 로그 조각 (각 조각이 한 줄, 줄바꿈은 저장 시 추가)
+typedef struct {
+    const void* data;
+    size_t size;
+} SDStorageChunk;
+
+// 조각 여러 개를 이어 붙여 한 줄로 기록 (헤더/본문/꼬리를 미리 한 버퍼에 모으지 않아도 됨)
+// 일반 파일은 조각을 write-behind 버퍼/압축 스트림에 바로 복사, 저널 파일은 레코드 버퍼에 한 번 모음
+ResultCode SDStorage_WriteLogV(const SDStorageChunk* chunks, size_t count);
+
+// 조각 여러 개를 이어 바이너리 레코드 하나로 기록 (저널 파일의 LOG_JOURNAL_TYPE_BINARY 레코드)
+// 텍스트/압축 로그 파일이 열려 있으면 RESULT_ERROR_NOT_SUPPORTED (SD_JOURNAL_ENABLED/journal_enabled 필요)
+ResultCode SDStorage_WriteBinaryV(const SDStorageChunk* chunks, size_t count);
+
+// 여러 줄을 같은 파일에 연속 기록하고 동기화 조건은 마지막에 한 번만 확인
+// 실패 시 기록된 줄 수를 *written에 반환 (NULL 허용)
+ResultCode SDStorage_WriteLogBatch(const SDStorageChunk* chunks, size_t count, size_t* written);
+
+// SD 쓰기 통계 (처리량/SD 점유 시간 측정용)
+typedef struct {
+    uint32_t lines;          // 기록 요청된 로그 줄 수
+    uint32_t bytes;          // 기록 요청된 바이트 수 (CRLF/저널 헤더 포함, 압축 전)
+    uint32_t write_calls;    // f_write 호출 수
+    uint32_t sync_calls;     // f_sync 호출 수
+    uint32_t busy_ms;        // f_write/f_sync에 소요된 누적 시간
+    uint32_t sync_bytes_target;         // 현재 f_sync 바이트 임계값 (적응형 정책 결과)
+    uint32_t sync_interval_target_ms;   // 현재 f_sync 주기
+    uint32_t policy_grows;              // 적응형 정책이 묶음을 키운 횟수
+    uint32_t policy_shrinks;            // 적응형 정책이 묶음을 줄인 횟수
+} SDStorageStats;
+
+// 버퍼링된 로그(write-behind 버퍼, 압축 블록)를 기록하고 f_sync
+ResultCode SDStorage_Flush(void);
+
+// 동기화 임계값(시간/바이트)에 도달한 경우에만 flush (SD 태스크 주기 호출용)
+ResultCode SDStorage_FlushIfDue(void);
+
+// 크기/시간 기준에 도달하면 다음 LORA####.TXT로 회전 (SD 태스크에서 주기 호출)
+ResultCode SDStorage_RotateIfNeeded(void);
+
+// SD 쓰기 통계 조회
+void SDStorage_GetStats(SDStorageStats* stats);
+
+// 처리 대기 중인 요청 수 보고 (SD 서비스가 묶음 기록 전에 호출, 적응형 동기화 입력)
+void SDStorage_SetBacklog(uint32_t pending_requests);
+
+// SD 동작별 지연 시간 (us, LatencyHist log2 버킷, 부팅 이후 누적)
+typedef enum {
+    SDSTORAGE_LAT_WRITE = 0,    // f_write (write-behind 버퍼 기록)
+    SDSTORAGE_LAT_SYNC,         // f_sync
+    SDSTORAGE_LAT_MOUNT,        // 하드웨어 초기화 + 마운트 (재시도 포함, 실패도 기록)
+    SDSTORAGE_LAT_ROTATE,       // 로그 회전 (현재 파일 마무리 + 새 파일 열기/사전 할당)
+    SDSTORAGE_LAT_COUNT
+} SDStorageLatencyOp;
+
+// 히스토그램 복사본 조회 (SD 태스크에서 호출)
+void SDStorage_GetLatency(SDStorageLatencyOp op, LatencyHist* hist);
+const char* SDStorage_LatencyOpName(SDStorageLatencyOp op);
+void SDStorage_ResetLatency(void);
+
+// 동작별 요약과 전체 버킷을 로그로 출력 (기록이 없는 동작은 생략)
+void SDStorage_DumpLatency(void);
+
 // SD카드 준비 상태 확인
 bool SDStorage_IsReady(void);
 
@@ -27,6 +91,16 @@ ResultCode SDStorage_CreateNewLogFile(void);
 // 현재 로그 파일 크기 확인
 size_t SDStorage_GetCurrentLogSize(void);
 
+// 전송 대기 패킷 spill 파일 (store-and-forward, 로그 파일과 별개인 SDSTORAGE_SPILL_FILE)
+// 위치는 호출자(StoreForward)가 관리 - offset에 쓰고/읽고, 다 보냈으면 Clear로 삭제
+// FatFs를 직접 쓰므로 타겟에서는 SD 태스크 문맥에서만 호출
+// SetSpillFile: 파일 이름 변경 (NULL이면 SDSTORAGE_SPILL_FILE) - FatFs 없는 호스트 빌드에서는
+// 작업 디렉토리 기준 경로이므로 테스트는 임시 경로를 지정하고 끝나면 SpillClear
+void SDStorage_SetSpillFile(const char* name);
+ResultCode SDStorage_SpillWrite(uint32_t offset, const void* data, size_t size);
+ResultCode SDStorage_SpillRead(uint32_t offset, void* buf, size_t size, size_t* read_len);
+ResultCode SDStorage_SpillClear(void);
+
 // 호환성을 위한 기존 에러 코드 매핑 (deprecated)
 #define SDSTORAGE_OK              RESULT_SUCCESS
 #define SDSTORAGE_ERROR          RESULT_ERROR_SD_FILE_ERROR
@@ -40,5 +114,6 @@ size_t SDStorage_GetCurrentLogSize(void);
 #define SDSTORAGE_LOG_DIR        "lora_logs"
 #define SDSTORAGE_LOG_PREFIX     "lora_log_"
 #define SDSTORAGE_LOG_EXTENSION  ".bin"
+#define SDSTORAGE_SPILL_FILE     "SPILL.BIN"
 
 #endif // SDSTORAGE_H
\ No newline at end of file
@@ -7,17 +7,20 @@
 
 
 #include "logger.h"
-#include "../SDStorage.h"
-#include "../../Inc/ResponseHandler.h"
+#include "../SDService.h"
 #include "../../Inc/system_config.h"
+#include "time.h"
 #include <string.h>
 #include <stdio.h>
 #include <stdarg.h>
 
+#ifdef STM32F746xx
+#include "stm32f7xx_hal.h"
+#endif
+
 static bool logger_connected = false;
 static LoggerMode_t current_mode = LOGGER_MODE_TERMINAL_ONLY;
 static LogLevel filter_level = LOG_LEVEL_DEBUG;  // 기본적으로 모든 레벨 허용
-static LogLevel sd_filter_level = LOG_LEVEL_WARN;  // SD 카드는 WARN 이상만 저장
 static bool sd_logging_enabled = false;  // JOIN 시도 전까지는 SD 로깅 비활성화
 static LoggerConfig current_config = {
     .level = LOG_LEVEL_INFO,
@@ -27,6 +30,259 @@ static LoggerConfig current_config = {
     .server_port = 0
 };
 
+// 타임스탬프 기준 (LTIME 동기화 시점의 epoch 초와 tick)
+static bool time_base_valid = false;
+static uint32_t time_base_epoch = 0;
+static uint32_t time_base_tick = 0;
+
+// 초 단위 타임스탬프 prefix 캐시 (같은 초 안에서는 재포맷하지 않음)
+// 여러 태스크가 로그를 남기므로 캐시/시간 기준은 임계 구역 안에서만 읽고 씀
+#define LOGGER_TIME_PREFIX_MAX  48
+static uint32_t prefix_cache_epoch = 0;
+static size_t prefix_cache_len = 0;
+static char prefix_cache[LOGGER_TIME_PREFIX_MAX];
+
+// 레벨 문자열 (뒤 공백 포함)
+static const char* const level_prefix[] = {"[DEBUG] ", "[INFO] ", "[WARN] ", "[ERROR] "};
+static const size_t level_prefix_len[] = {8, 7, 7, 8};
+
+// 본문 앞 여유 공간: 텍스트 prefix(시간 + 레벨) 또는 바이너리 헤더가 들어갈 자리
+#define LOGGER_PREFIX_HEADROOM  64
+
+// 공유 상태 보호 (logger_platform.c의 TX 링과 같은 방식: PRIMASK로 짧게 인터럽트 차단)
+static inline uint32_t _enter_critical(void) {
+#ifdef STM32F746xx
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+#else
+    return 0;
+#endif
+}
+
+static inline void _exit_critical(uint32_t primask) {
+#ifdef STM32F746xx
+    __set_PRIMASK(primask);
+#else
+    (void)primask;
+#endif
+}
+
+// ============================================================================
+// 기본 싱크 구현
+// ============================================================================
+
+static LoggerStatus _terminal_write(const LogRecord* record, const uint8_t* data, size_t len);
+static LoggerStatus _sd_text_write(const LogRecord* record, const uint8_t* data, size_t len);
+static LoggerStatus _sd_binary_write(const LogRecord* record, const uint8_t* data, size_t len);
+static LoggerStatus _crash_ring_write(const LogRecord* record, const uint8_t* data, size_t len);
+
+typedef struct {
+    LogSinkConfig config;
+    LogSinkStats stats;
+} LogSinkSlot;
+
+static LogSinkSlot sinks[LOG_SINK_COUNT] = {
+    [LOG_SINK_TERMINAL]   = { { true,  LOG_LEVEL_DEBUG, LOG_ENCODER_TEXT,   LOG_BACKPRESSURE_DROP_NEWEST, _terminal_write },   {0} },
+    [LOG_SINK_SD_TEXT]    = { { false, LOG_LEVEL_WARN,  LOG_ENCODER_TEXT,   LOG_BACKPRESSURE_DROP_NEWEST, _sd_text_write },    {0} },
+    [LOG_SINK_SD_BINARY]  = { { false, LOG_LEVEL_WARN,  LOG_ENCODER_BINARY, LOG_BACKPRESSURE_DROP_NEWEST, _sd_binary_write },  {0} },
+    [LOG_SINK_CRASH_RING] = { { true,  LOG_LEVEL_DEBUG, LOG_ENCODER_TEXT,   LOG_BACKPRESSURE_DROP_OLDEST, _crash_ring_write }, {0} },
+};
+
+// RAM 크래시 링 (가장 오래된 바이트부터 덮어씀)
+static char crash_ring[LOGGER_CRASH_RING_SIZE];
+static size_t crash_ring_head = 0;
+static bool crash_ring_wrapped = false;
+
+static LoggerStatus _terminal_write(const LogRecord* record, const uint8_t* data, size_t len) {
+    (void)record; (void)len;
+    return LOGGER_Platform_Send((const char*)data);
+}
+
+static LoggerStatus _sd_text_write(const LogRecord* record, const uint8_t* data, size_t len) {
+    if (!SDService_IsReady()) {
+        return RESULT_ERROR_NOT_READY;
+    }
+
+    // FatFs는 SD 태스크 전용 - 여기서는 append 요청만 넣고 바로 반환
+    // (요청 슬롯보다 긴 줄은 SD 서비스가 여러 요청으로 나눠 넣음)
+    ResultCode sd_result = SDService_Append(data, len);
+    if (sd_result == RESULT_ERROR_BUSY) {
+        // 큐 가득 참은 backpressure - 싱크 정책(DROP/BLOCK)에 맡기고 에러 출력 안 함
+        return LOGGER_STATUS_BUFFER_FULL;
+    }
+    if (sd_result != SDSTORAGE_OK && record->level >= LOG_LEVEL_WARN &&
+        sinks[LOG_SINK_TERMINAL].config.enabled) {
+        // SD 쓰기 실패 시 터미널에 에러 출력
+        char error_msg[128];
+        snprintf(error_msg, sizeof(error_msg), "[SD_ERROR] Write failed: %ld (%s)",
+                 (long)sd_result, ErrorCode_ToString(sd_result));
+        LOGGER_Platform_Send(error_msg);
+    }
+    return sd_result;
+}
+
+static LoggerStatus _sd_binary_write(const LogRecord* record, const uint8_t* data, size_t len) {
+    (void)record;
+    if (!SDService_IsReady()) {
+        return RESULT_ERROR_NOT_READY;
+    }
+
+    // LogBinaryHeader + 본문을 저널 BINARY 레코드 하나로 (텍스트/압축 파일이면 SD 태스크에서 실패 처리)
+    ResultCode sd_result = SDService_AppendBinary(data, len);
+    if (sd_result == RESULT_ERROR_BUSY) {
+        return LOGGER_STATUS_BUFFER_FULL;
+    }
+    return sd_result;
+}
+
+static void _crash_ring_put(const void* data, size_t len) {
+    size_t first = LOGGER_CRASH_RING_SIZE - crash_ring_head;
+    if (first > len) {
+        first = len;
+    }
+    memcpy(&crash_ring[crash_ring_head], data, first);
+    memcpy(&crash_ring[0], (const char*)data + first, len - first);
+
+    crash_ring_head += len;
+    if (crash_ring_head >= LOGGER_CRASH_RING_SIZE) {
+        crash_ring_head -= LOGGER_CRASH_RING_SIZE;
+        crash_ring_wrapped = true;
+    }
+}
+
+static LoggerStatus _crash_ring_write(const LogRecord* record, const uint8_t* data, size_t len) {
+    (void)record;
+    // 링보다 긴 줄은 뒷부분만 보관
+    if (len >= LOGGER_CRASH_RING_SIZE) {
+        data += len - (LOGGER_CRASH_RING_SIZE - 1);
+        len = LOGGER_CRASH_RING_SIZE - 1;
+    }
+    // 여러 태스크/인터럽트에서 기록하므로 head/wrapped 갱신은 한 임계 구역에서
+    uint32_t primask = _enter_critical();
+    _crash_ring_put(data, len);
+    _crash_ring_put("\n", 1);
+    _exit_critical(primask);
+    return LOGGER_STATUS_OK;
+}
+
+size_t LOGGER_CrashRing_Snapshot(char* out, size_t max_len) {
+    if (out == NULL || max_len == 0) return 0;
+
+    uint32_t primask = _enter_critical();
+    size_t start = crash_ring_wrapped ? crash_ring_head : 0;
+    size_t used = crash_ring_wrapped ? LOGGER_CRASH_RING_SIZE : crash_ring_head;
+    size_t copy = (used < max_len - 1) ? used : max_len - 1;
+
+    // 공간이 부족하면 최신 로그 우선
+    start = (start + (used - copy)) % LOGGER_CRASH_RING_SIZE;
+    for (size_t i = 0; i < copy; i++) {
+        out[i] = crash_ring[(start + i) % LOGGER_CRASH_RING_SIZE];
+    }
+    _exit_critical(primask);
+    out[copy] = '\0';
+    return copy;
+}
+
+// ============================================================================
+// 싱크 레지스트리
+// ============================================================================
+
+static bool _in_interrupt(void) {
+#ifdef STM32F746xx
+    return (__get_IPSR() != 0U);
+#else
+    return false;
+#endif
+}
+
+static bool _is_sd_sink(LogSinkId id) {
+    return (id == LOG_SINK_SD_TEXT || id == LOG_SINK_SD_BINARY);
+}
+
+static bool _sink_accepts(LogSinkId id, LogLevel level) {
+    const LogSinkConfig* config = &sinks[id].config;
+    return config->enabled && config->write != NULL && level >= config->min_level;
+}
+
+static void _dispatch(LogSinkId id, const LogRecord* record, const uint8_t* data, size_t len) {
+    LogSinkSlot* slot = &sinks[id];
+
+    // SD 싱크는 SD 로깅 활성화 전까지 건너뜀
+    if (_is_sd_sink(id) && !sd_logging_enabled) {
+        slot->stats.skipped++;
+        return;
+    }
+
+    LoggerStatus status = slot->config.write(record, data, len);
+
+    if (status == LOGGER_STATUS_BUFFER_FULL &&
+        slot->config.backpressure == LOG_BACKPRESSURE_BLOCK && !_in_interrupt()) {
+        uint32_t start = TIME_GetCurrentMs();
+        while (status == LOGGER_STATUS_BUFFER_FULL &&
+               !TIME_IsTimeout(start, LOGGER_SINK_BLOCK_TIMEOUT_MS)) {
+            TIME_DelayMs(1);
+            status = slot->config.write(record, data, len);
+        }
+    }
+
+    if (status == LOGGER_STATUS_OK) {
+        slot->stats.written++;
+    } else if (status == LOGGER_STATUS_BUFFER_FULL) {
+        slot->stats.dropped++;
+    } else if (status == RESULT_ERROR_NOT_READY || status == RESULT_ERROR_SD_NOT_READY) {
+        slot->stats.skipped++;
+    } else {
+        slot->stats.errors++;
+    }
+}
+
+LoggerStatus LOGGER_ConfigureSink(LogSinkId id, const LogSinkConfig* config) {
+    if (id >= LOG_SINK_COUNT || config == NULL || config->encoder >= LOG_ENCODER_COUNT) {
+        return RESULT_ERROR_INVALID_PARAM;
+    }
+    sinks[id].config = *config;
+    return LOGGER_STATUS_OK;
+}
+
+LoggerStatus LOGGER_GetSinkConfig(LogSinkId id, LogSinkConfig* config) {
+    if (id >= LOG_SINK_COUNT || config == NULL) {
+        return RESULT_ERROR_INVALID_PARAM;
+    }
+    *config = sinks[id].config;
+    return LOGGER_STATUS_OK;
+}
+
+LoggerStatus LOGGER_SetSinkWriter(LogSinkId id, LogSinkWriteFn write) {
+    if (id >= LOG_SINK_COUNT) {
+        return RESULT_ERROR_INVALID_PARAM;
+    }
+    sinks[id].config.write = write;
+    return LOGGER_STATUS_OK;
+}
+
+void LOGGER_EnableSink(LogSinkId id, bool enable) {
+    if (id < LOG_SINK_COUNT) {
+        sinks[id].config.enabled = enable;
+    }
+}
+
+void LOGGER_SetSinkLevel(LogSinkId id, LogLevel min_level) {
+    if (id < LOG_SINK_COUNT) {
+        sinks[id].config.min_level = min_level;
+    }
+}
+
+void LOGGER_GetSinkStats(LogSinkId id, LogSinkStats* stats) {
+    if (id < LOG_SINK_COUNT && stats != NULL) {
+        *stats = sinks[id].stats;
+    }
+}
+
+// ============================================================================
+// 기존 인터페이스
+// ============================================================================
+
 LoggerStatus LOGGER_Connect(const char* server_ip, int port) {
     if (server_ip == NULL) return LOGGER_STATUS_ERROR;
     strncpy(current_config.server_ip, server_ip, sizeof(current_config.server_ip) - 1);
@@ -50,39 +306,35 @@ LoggerStatus LOGGER_Disconnect(void) {
 LoggerStatus LOGGER_Send(const char* message) {
     if (message == NULL) return LOGGER_STATUS_ERROR;
     
-    // 새로운 모드 시스템 사용
-    switch (current_mode) {
-        case LOGGER_MODE_TERMINAL_ONLY:
-            return LOGGER_Platform_Send(message);
-            
-        case LOGGER_MODE_SD_ONLY:
-            // SD 로깅이 활성화된 경우에만 저장
-            if (sd_logging_enabled && SDStorage_IsReady()) {
-                int result = SDStorage_WriteLog(message, strlen(message));
-                return (result == SDSTORAGE_OK) ? LOGGER_STATUS_OK : LOGGER_STATUS_ERROR;
-            }
-            return LOGGER_STATUS_ERROR;
-            
-        case LOGGER_MODE_DUAL:
-            // 터미널 우선 출력
-            LOGGER_Platform_Send(message);
-            // SD 출력 (SD 로깅 활성화 + 실패해도 무시)
-            if (sd_logging_enabled && SDStorage_IsReady()) {
-                SDStorage_WriteLog(message, strlen(message));
-            }
-            return LOGGER_STATUS_OK;
-            
-        default:
-            return LOGGER_STATUS_ERROR;
+    // prefix 없이 텍스트 싱크에 그대로 전달
+    // 기존처럼 레벨 필터 없이 보내도록 최고 레벨(ERROR)로 기록/필터링
+    const LogLevel level = LOG_LEVEL_ERROR;
+    LogRecord record = {
+        .level = level,
+        .timestamp = LOGGER_GetTimestamp(),
+        .tick_ms = TIME_GetCurrentMs(),
+        .message = message,
+        .message_len = strlen(message)
+    };
+
+    bool delivered = false;
+    for (int id = 0; id < LOG_SINK_COUNT; id++) {
+        if (sinks[id].config.encoder != LOG_ENCODER_TEXT || !_sink_accepts((LogSinkId)id, level)) {
+            continue;
+        }
+        uint32_t written_before = sinks[id].stats.written;
+        _dispatch((LogSinkId)id, &record, (const uint8_t*)message, record.message_len);
+        if (sinks[id].stats.written != written_before && id != LOG_SINK_CRASH_RING) {
+            delivered = true;
+        }
     }
+    return delivered ? LOGGER_STATUS_OK : LOGGER_STATUS_ERROR;
 }
 
 LoggerStatus LOGGER_SendWithLevel(LogLevel level, const char* message) {
     if (level < current_config.level) return LOGGER_STATUS_OK;
-    char formatted[256];
-    const char* level_str[] = {"[DEBUG]", "[INFO]", "[WARN]", "[ERROR]"};
-    snprintf(formatted, sizeof(formatted), "%s %s", level_str[level], message ? message : "");
-    return LOGGER_Send(formatted);
+    LOGGER_SendFormatted(level, "%s", message ? message : "");
+    return LOGGER_STATUS_OK;
 }
 
 bool LOGGER_IsConnected(void) {
@@ -95,7 +347,8 @@ void LOGGER_SetFilterLevel(LogLevel min_level) {
 }
 
 void LOGGER_SetSDFilterLevel(LogLevel min_level) {
-    sd_filter_level = min_level;
+    sinks[LOG_SINK_SD_TEXT].config.min_level = min_level;
+    sinks[LOG_SINK_SD_BINARY].config.min_level = min_level;
 }
 
 void LOGGER_EnableSDLogging(bool enable) {
@@ -109,12 +362,16 @@ bool LOGGER_IsSDLoggingEnabled(void) {
 void LOGGER_SetMode(LoggerMode_t mode) {
     current_mode = mode;
     
+    // 모드는 터미널/SD 텍스트 싱크 on/off의 단축 설정
+    sinks[LOG_SINK_TERMINAL].config.enabled = (mode != LOGGER_MODE_SD_ONLY);
+    sinks[LOG_SINK_SD_TEXT].config.enabled = (mode != LOGGER_MODE_TERMINAL_ONLY);
+    
     // 모드에 따른 연결 상태 설정
     if (mode == LOGGER_MODE_TERMINAL_ONLY) {
         logger_connected = true;  // 터미널은 항상 연결됨
     } else if (mode == LOGGER_MODE_SD_ONLY || mode == LOGGER_MODE_DUAL) {
-        // SD 백엔드 사용 시 SDStorage 연결 상태에 따라 결정
-        logger_connected = SDStorage_IsReady();
+        // SD 백엔드 사용 시 SD 서비스(마운트) 상태에 따라 결정
+        logger_connected = SDService_IsReady();
     }
 }
 
@@ -122,77 +379,156 @@ LoggerMode_t LOGGER_GetMode(void) {
     return current_mode;
 }
 
+void LOGGER_SetTimeBase(uint32_t utc_epoch_sec) {
+    uint32_t primask = _enter_critical();
+    time_base_tick = TIME_GetCurrentMs();
+    time_base_epoch = utc_epoch_sec;
+    prefix_cache_len = 0;  // 재동기화 시 캐시 무효화
+    time_base_valid = true;
+    _exit_critical(primask);
+}
+
+bool LOGGER_HasTimeBase(void) {
+    return time_base_valid;
+}
+
+uint32_t LOGGER_GetTimestamp(void) {
+    if (!time_base_valid) return 0;
+
+    uint32_t primask = _enter_critical();
+    uint32_t elapsed_ms = TIME_CalculateElapsed(time_base_tick);
+
+    // tick 오버플로우(약 49일) 전에 기준점을 앞으로 이동
+    if (elapsed_ms >= 3600000U) {
+        uint32_t elapsed_sec = elapsed_ms / 1000U;
+        time_base_epoch += elapsed_sec;
+        time_base_tick += elapsed_sec * 1000U;
+        elapsed_ms -= elapsed_sec * 1000U;
+    }
+
+    uint32_t timestamp = time_base_epoch + elapsed_ms / 1000U;
+    _exit_critical(primask);
+    return timestamp;
+}
+
+// now 초에 해당하는 "[hh..(KST)] " prefix를 out(호출자 버퍼)에 복사 (초가 바뀔 때만 snprintf)
+static size_t _get_time_prefix(uint32_t now, char* out) {
+    uint32_t primask = _enter_critical();
+    if (prefix_cache_len > 0 && now == prefix_cache_epoch) {
+        size_t cached_len = prefix_cache_len;
+        memcpy(out, prefix_cache, cached_len);
+        _exit_critical(primask);
+        return cached_len;
+    }
+    _exit_critical(primask);
+
+    // 포맷은 임계 구역 밖에서 호출자 버퍼에, 결과만 캐시에 반영
+    TIME_DateTime dt;
+    TIME_EpochToDateTime(now + LOGGER_TIMEZONE_OFFSET_SEC, &dt);
+
+    int len = snprintf(out, LOGGER_TIME_PREFIX_MAX,
+                       "[%02dh%02dm%02ds on %02d/%02d/%d (" LOGGER_TIMEZONE_LABEL ")] ",
+                       dt.hour, dt.minute, dt.second, dt.month, dt.day, dt.year);
+    size_t prefix_len = (len > 0 && len < LOGGER_TIME_PREFIX_MAX) ? (size_t)len : 0;
+
+    primask = _enter_critical();
+    memcpy(prefix_cache, out, prefix_len);
+    prefix_cache_len = prefix_len;
+    prefix_cache_epoch = now;
+    _exit_critical(primask);
+    return prefix_len;
+}
+
+// "[시간] [LEVEL] " prefix를 본문 바로 앞에 채우고 시작 위치 반환
+static char* _encode_text(char* body, const LogRecord* record) {
+    char* start = body - level_prefix_len[record->level];
+    memcpy(start, level_prefix[record->level], level_prefix_len[record->level]);
+
+    if (time_base_valid) {
+        char time_prefix[LOGGER_TIME_PREFIX_MAX];
+        size_t time_prefix_len = _get_time_prefix(record->timestamp, time_prefix);
+        start -= time_prefix_len;
+        memcpy(start, time_prefix, time_prefix_len);
+    }
+    return start;
+}
+
+// LogBinaryHeader를 본문 바로 앞에 채우고 시작 위치 반환
+static uint8_t* _encode_binary(char* body, const LogRecord* record) {
+    LogBinaryHeader header = {
+        .magic = LOGGER_BINARY_MAGIC,
+        .level = (uint8_t)record->level,
+        .message_len = (uint16_t)record->message_len,
+        .timestamp = record->timestamp,
+        .tick_ms = record->tick_ms
+    };
+    uint8_t* start = (uint8_t*)body - sizeof(header);
+    memcpy(start, &header, sizeof(header));
+    return start;
+}
+
 void LOGGER_SendFormatted(LogLevel level, const char* format, ...) {
     // 필터 레벨 체크
     if (level < filter_level) return;
     if (level < current_config.level) return;
     
-    char buffer[LOGGER_MAX_MESSAGE_SIZE];
-    const char* level_str[] = {"[DEBUG]", "[INFO]", "[WARN]", "[ERROR]"};
-    
-    // 타임스탬프 + 레벨 문자열 추가
-    int offset = 0;
-    const char* network_time = ResponseHandler_GetNetworkTime();
-    if (network_time != NULL && ResponseHandler_IsTimeSynchronized()) {
-        // 네트워크 시간이 있으면 타임스탬프 추가
-        offset = snprintf(buffer, sizeof(buffer), "[%s] %s ", network_time, level_str[level]);
-    } else {
-        // 네트워크 시간이 없으면 기본 형식
-        offset = snprintf(buffer, sizeof(buffer), "%s ", level_str[level]);
+    // 이 레벨을 받는 싱크가 사용하는 인코더 확인 (없으면 포맷 생략)
+    uint32_t encoder_mask = 0;
+    for (int id = 0; id < LOG_SINK_COUNT; id++) {
+        if (_sink_accepts((LogSinkId)id, level)) {
+            encoder_mask |= (1U << sinks[id].config.encoder);
+        }
     }
+    if (encoder_mask == 0) return;
+    
+    // [headroom | 본문]: 본문은 한 번만 포맷하고 prefix/헤더는 본문 앞에 덧씀
+    char buffer[LOGGER_MAX_MESSAGE_SIZE];
+    char* body = buffer + LOGGER_PREFIX_HEADROOM;
     
     // 가변 인수 처리 (버퍼 오버플로우 방지)
     va_list args;
     va_start(args, format);
-    int remaining_size = sizeof(buffer) - offset;
-    if (remaining_size > 0) {
-        vsnprintf(buffer + offset, remaining_size, format, args);
-        buffer[sizeof(buffer) - 1] = '\0';  // 안전장치: 항상 null 종료
-    }
+    int body_len = vsnprintf(body, sizeof(buffer) - LOGGER_PREFIX_HEADROOM, format, args);
     va_end(args);
+    if (body_len < 0) return;
+    if ((size_t)body_len >= sizeof(buffer) - LOGGER_PREFIX_HEADROOM) {
+        body_len = sizeof(buffer) - LOGGER_PREFIX_HEADROOM - 1;
+    }
+    
+    LogRecord record = {
+        .level = level,
+        .timestamp = LOGGER_GetTimestamp(),
+        .tick_ms = TIME_GetCurrentMs(),
+        .message = body,
+        .message_len = (size_t)body_len
+    };
     
-    // 모드에 따른 출력 처리
-    switch (current_mode) {
-        case LOGGER_MODE_TERMINAL_ONLY:
-            LOGGER_Platform_Send(buffer);
-            break;
-            
-        case LOGGER_MODE_SD_ONLY:
-            // SD 로깅 활성화 + SD 필터 레벨 체크
-            if (sd_logging_enabled && level >= sd_filter_level && SDStorage_IsReady()) {
-                SDStorage_WriteLog(buffer, strlen(buffer));
+    // 인코더별로 한 번 인코딩 후 해당 싱크들에 전달
+    if (encoder_mask & (1U << LOG_ENCODER_TEXT)) {
+        char* text = _encode_text(body, &record);
+        size_t text_len = (size_t)(body + body_len - text);
+        for (int id = 0; id < LOG_SINK_COUNT; id++) {
+            if (sinks[id].config.encoder == LOG_ENCODER_TEXT && _sink_accepts((LogSinkId)id, level)) {
+                _dispatch((LogSinkId)id, &record, (const uint8_t*)text, text_len);
             }
-            break;
-            
-        case LOGGER_MODE_DUAL:
-            // 터미널 출력 (실시간)
-            LOGGER_Platform_Send(buffer);
-            // SD 출력 (SD 로깅 활성화 + SD 필터 레벨 체크 + 에러 무시)
-            if (sd_logging_enabled && level >= sd_filter_level && SDStorage_IsReady()) {
-                int sd_result = SDStorage_WriteLog(buffer, strlen(buffer));
-                if (sd_result != 0 && level >= LOG_LEVEL_WARN) {
-                    // SD 쓰기 실패 시 터미널에 에러 출력
-                    char error_msg[128];
-                    const char* error_desc;
-                    switch(sd_result) {
-                        case -1: error_desc = "GENERAL_ERROR"; break;
-                        case -2: error_desc = "NOT_READY"; break;
-                        case -3: error_desc = "FILE_ERROR"; break;
-                        case -4: error_desc = "DISK_FULL"; break;
-                        case -5: error_desc = "INVALID_PARAM"; break;
-                        default: error_desc = "UNKNOWN"; break;
-                    }
-                    snprintf(error_msg, sizeof(error_msg), "[SD_ERROR] Write failed: %d (%s)", sd_result, error_desc);
-                    LOGGER_Platform_Send(error_msg);
-                }
-            } else if (level >= LOG_LEVEL_WARN) {
-                // WARN 이상 레벨인데 SD에 저장되지 않는 경우 디버그 정보 출력
-                char debug_msg[256];
-                snprintf(debug_msg, sizeof(debug_msg), 
-                    "[SD_DEBUG] Skip SD write: enabled=%d, level=%d>=filter=%d, ready=%d",
-                    sd_logging_enabled, level, sd_filter_level, SDStorage_IsReady());
-                LOGGER_Platform_Send(debug_msg);
+        }
+    }
+    
+    if (encoder_mask & (1U << LOG_ENCODER_BINARY)) {
+        uint8_t* binary = _encode_binary(body, &record);
+        size_t binary_len = sizeof(LogBinaryHeader) + (size_t)body_len;
+        for (int id = 0; id < LOG_SINK_COUNT; id++) {
+            if (sinks[id].config.encoder == LOG_ENCODER_BINARY && _sink_accepts((LogSinkId)id, level)) {
+                _dispatch((LogSinkId)id, &record, binary, binary_len);
+            }
+        }
+    }
+    
+    if (encoder_mask & (1U << LOG_ENCODER_RECORD)) {
+        for (int id = 0; id < LOG_SINK_COUNT; id++) {
+            if (sinks[id].config.encoder == LOG_ENCODER_RECORD && _sink_accepts((LogSinkId)id, level)) {
+                _dispatch((LogSinkId)id, &record, NULL, 0);
             }
-            break;
+        }
     }
 }
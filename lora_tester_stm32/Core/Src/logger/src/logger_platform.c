@@ -6,11 +6,83 @@
  */
 
 #include "logger_platform.h"
+#include "system_config.h"
 #include "stm32f7xx_hal.h"
 #include <string.h>
 
 extern UART_HandleTypeDef huart1; // CubeMX가 생성한 UART1 (Virtual COM Port)
 
+// ============================================================================
+// UART1 TX 링 버퍼 (DMA 전송)
+// 호출자는 링에 복사만 하고 바로 반환, DMA 완료 인터럽트가 다음 구간을 이어서 전송
+// ============================================================================
+
+ALIGN_32BYTES(static uint8_t tx_ring[LOGGER_UART_TX_RING_SIZE]);
+static volatile uint32_t tx_head = 0;      // 다음 쓰기 위치 (생산자)
+static volatile uint32_t tx_tail = 0;      // 다음 전송 위치 (DMA)
+static volatile uint32_t tx_dma_len = 0;   // 전송 중인 구간 길이
+static volatile bool tx_busy = false;
+static LoggerTxStats tx_stats = {0};
+
+static inline uint32_t _enter_critical(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+static inline void _exit_critical(uint32_t primask) {
+    __set_PRIMASK(primask);
+}
+
+static inline uint32_t _ring_used(void) {
+    return (tx_head - tx_tail + LOGGER_UART_TX_RING_SIZE) % LOGGER_UART_TX_RING_SIZE;
+}
+
+static bool _dma_available(void) {
+    return (huart1.hdmatx != NULL && huart1.hdmatx->Instance != NULL);
+}
+
+// 링 끝까지의 연속 구간을 DMA로 전송 시작 (크리티컬 섹션 안에서 호출)
+static void _start_next_chunk(void) {
+    if (tx_busy || tx_head == tx_tail) {
+        return;
+    }
+
+    uint32_t len = (tx_head > tx_tail) ? (tx_head - tx_tail) : (LOGGER_UART_TX_RING_SIZE - tx_tail);
+    if (len > LOGGER_UART_TX_MAX_CHUNK) {
+        len = LOGGER_UART_TX_MAX_CHUNK;
+    }
+
+#if (__DCACHE_PRESENT == 1)
+    // D-Cache 사용 시 DMA가 최신 데이터를 읽도록 32바이트 정렬 단위로 clean
+    if (SCB->CCR & SCB_CCR_DC_Msk) {
+        uint32_t addr = (uint32_t)&tx_ring[tx_tail];
+        uint32_t aligned = addr & ~0x1FUL;
+        SCB_CleanDCache_by_Addr((uint32_t*)aligned, (int32_t)(len + (addr - aligned)));
+    }
+#endif
+
+    tx_dma_len = len;
+    tx_busy = true;
+    if (HAL_UART_Transmit_DMA(&huart1, &tx_ring[tx_tail], (uint16_t)len) != HAL_OK) {
+        // 다음 Send 호출 또는 완료 콜백에서 재시도
+        tx_busy = false;
+        tx_dma_len = 0;
+        tx_stats.dma_errors++;
+    }
+}
+
+// 링에 데이터 복사 (공간은 호출자가 확인)
+static void _ring_write(const uint8_t* data, uint32_t len) {
+    uint32_t first = LOGGER_UART_TX_RING_SIZE - tx_head;
+    if (first > len) {
+        first = len;
+    }
+    memcpy(&tx_ring[tx_head], data, first);
+    memcpy(&tx_ring[0], data + first, len - first);
+    tx_head = (tx_head + len) % LOGGER_UART_TX_RING_SIZE;
+}
+
 LoggerStatus LOGGER_Platform_Connect(const char* server_ip, int port) {
     (void)server_ip; (void)port;
     // STM32에서는 UART1이 이미 초기화되어 있으므로 추가 설정 불필요
@@ -24,19 +96,103 @@ LoggerStatus LOGGER_Platform_Disconnect(void) {
 LoggerStatus LOGGER_Platform_Send(const char* message) {
     if (message == NULL) return LOGGER_STATUS_ERROR;
     
-    // UART1을 통해 메시지 전송 (Virtual COM Port)
-    int len = strlen(message);
-    if (len > 0) {
+    uint32_t len = strlen(message);
+    if (len == 0) return LOGGER_STATUS_ERROR;
+
+    // DMA 미초기화 시 기존 블로킹 전송으로 fallback
+    if (!_dma_available()) {
         if (HAL_UART_Transmit(&huart1, (uint8_t*)message, len, 1000) == HAL_OK) {
-            // 줄바꿈 추가
             HAL_UART_Transmit(&huart1, (uint8_t*)"\r\n", 2, 100);
             return LOGGER_STATUS_OK;
         }
+        return LOGGER_STATUS_ERROR;
     }
-    return LOGGER_STATUS_ERROR;
+
+    uint32_t primask = _enter_critical();
+
+    // 공간 부족 시 대기하지 않고 줄 단위로 버림 (부분 출력 방지)
+    uint32_t free_space = LOGGER_UART_TX_RING_SIZE - 1 - _ring_used();
+    if (len + 2 > free_space) {
+        tx_stats.dropped_lines++;
+        tx_stats.dropped_bytes += len + 2;
+        _exit_critical(primask);
+        return LOGGER_STATUS_BUFFER_FULL;
+    }
+
+    _ring_write((const uint8_t*)message, len);
+    _ring_write((const uint8_t*)"\r\n", 2);
+
+    uint32_t used = _ring_used();
+    if (used > tx_stats.high_watermark) {
+        tx_stats.high_watermark = used;
+    }
+
+    _start_next_chunk();
+    _exit_critical(primask);
+
+    return LOGGER_STATUS_OK;
 }
 
 LoggerStatus LOGGER_Platform_Configure(const LoggerConfig* config) {
     (void)config;
     return LOGGER_STATUS_OK;
 }
+
+// ============================================================================
+// DMA 완료/에러 처리 (uart_stm32.c의 HAL 콜백에서 호출, 인터럽트 컨텍스트)
+// ============================================================================
+
+void LOGGER_Platform_TxCpltCallback(void) {
+    uint32_t primask = _enter_critical();
+    tx_tail = (tx_tail + tx_dma_len) % LOGGER_UART_TX_RING_SIZE;
+    tx_dma_len = 0;
+    tx_busy = false;
+    _start_next_chunk();
+    _exit_critical(primask);
+}
+
+void LOGGER_Platform_TxErrorCallback(void) {
+    // 전송 중이던 구간은 tail을 유지하고 HAL abort로 상태 정리
+    // 재전송은 abort 완료 콜백에서 (그 전까지 tx_busy 유지로 새 DMA 시작 금지)
+    uint32_t primask = _enter_critical();
+    tx_stats.dma_errors++;
+    tx_dma_len = 0;
+    tx_busy = true;
+    _exit_critical(primask);
+
+    if (HAL_UART_AbortTransmit_IT(&huart1) != HAL_OK) {
+        // 비동기 abort 실패 시 블로킹 abort 후 바로 재시작
+        (void)HAL_UART_AbortTransmit(&huart1);
+        LOGGER_Platform_TxAbortCpltCallback();
+    }
+}
+
+void LOGGER_Platform_TxAbortCpltCallback(void) {
+    // HAL이 gState를 READY로 돌려놓은 뒤 호출됨 - 남은 구간 재전송
+    uint32_t primask = _enter_critical();
+    tx_busy = false;
+    _start_next_chunk();
+    _exit_critical(primask);
+}
+
+LoggerStatus LOGGER_Platform_Flush(uint32_t timeout_ms) {
+    uint32_t start = HAL_GetTick();
+
+    while (tx_head != tx_tail) {
+        if ((HAL_GetTick() - start) >= timeout_ms) {
+            return LOGGER_STATUS_TIMEOUT;
+        }
+        // 재시도가 필요한 경우를 대비해 전송 재개
+        uint32_t primask = _enter_critical();
+        _start_next_chunk();
+        _exit_critical(primask);
+    }
+    return LOGGER_STATUS_OK;
+}
+
+void LOGGER_Platform_GetTxStats(LoggerTxStats* stats) {
+    if (stats == NULL) return;
+    uint32_t primask = _enter_critical();
+    *stats = tx_stats;
+    _exit_critical(primask);
+}
@@ -27,11 +27,13 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "Checksum.h"
 #include "CommandSender.h"
 #include "LoraStarter.h"
 #include "Network.h"
 #include "ResponseHandler.h"
 #include "SDStorage.h"
+#include "SDService.h"
 #include "logger.h"
 #include "power_management.h"
 #include "system_config.h"
@@ -130,19 +132,8 @@ SDRAM_HandleTypeDef hsdram1;
 
 osThreadId defaultTaskHandle;
 osThreadId receiveTaskHandle;
-osThreadId sdLoggingTaskHandle; // SD 로깅 전용 태스크
+osThreadId sdLoggingTaskHandle; // SD 로깅 전용 태스크 (FatFs 볼륨 단독 소유)
 
-// SD 로깅 큐 및 상태 관리 (메모리 최적화)
-#define SD_LOG_QUEUE_SIZE 10        // 50 → 10으로 축소
-#define SD_LOG_MAX_MESSAGE_SIZE 128 // 512 → 128로 축소
-
-typedef struct {
-  char message[SD_LOG_MAX_MESSAGE_SIZE];
-  uint32_t timestamp;
-  size_t length;
-} SDLogEntry_t;
-
-osMessageQId sdLogQueueHandle;
 static bool g_sd_logging_active = false;
 
 /* USER CODE BEGIN PV */
@@ -157,6 +148,10 @@ volatile bool lora_new_response = false;
 
 // DMA 관련 변수
 DMA_HandleTypeDef hdma_usart6_rx;
+DMA_HandleTypeDef hdma_usart1_tx;
+DMA_HandleTypeDef hdma_sdmmc1_rx;
+DMA_HandleTypeDef hdma_sdmmc1_tx;
+DMA_HandleTypeDef hdma_crc;
 
 /* USER CODE END PV */
 
@@ -189,6 +184,9 @@ static void MX_TIM12_Init(void);
 static void MX_USART1_UART_Init(void);
 static void MX_USART6_UART_Init(void);
 void MX_USART6_DMA_Init(void); // USART6 DMA 초기화 함수 선언
+void MX_USART1_DMA_Init(void); // USART1 TX DMA 초기화 함수 선언 (로그 출력)
+void MX_SDMMC1_DMA_Init(void); // SDMMC1 RX/TX DMA 초기화 함수 선언
+void MX_CRC_DMA_Init(void);    // CRC 입력 DMA (메모리->CRC) 초기화 함수 선언
 void StartDefaultTask(void const *argument);
 void StartSDLoggingTask(void const *argument);
 void StartReceiveTask(void const *argument);
@@ -255,8 +253,11 @@ int main(void) {
   MX_GPIO_Init();
   MX_DMA_Init();        // DMA는 UART보다 먼저 초기화
   MX_USART6_DMA_Init(); // USART6 DMA 초기화 (UART보다 먼저)
+  MX_USART1_DMA_Init(); // USART1 TX DMA 초기화 (로그 출력용)
+  MX_SDMMC1_DMA_Init(); // SDMMC1 DMA 초기화 (FatFs 섹터 전송용)
   MX_ADC3_Init();
   MX_CRC_Init();
+  MX_CRC_DMA_Init(); // 긴 버퍼 CRC 계산용 DMA (Checksum 모듈)
   MX_DCMI_Init();
   MX_DMA2D_Init();
   MX_ETH_Init();
@@ -281,12 +282,18 @@ int main(void) {
 
   // UART 초기화 후 DMA 핸들 다시 연결 (HAL_UART_Init에서 리셋될 수 있음)
   __HAL_LINKDMA(&huart6, hdmarx, hdma_usart6_rx);
+  if (hdma_usart1_tx.Instance != NULL) {
+    __HAL_LINKDMA(&huart1, hdmatx, hdma_usart1_tx);
+  }
 
   // UART IDLE 인터럽트 활성화 (DMA 기반 수신을 위해)
   __HAL_UART_ENABLE_IT(&huart6, UART_IT_IDLE);
   MX_FATFS_Init();
   /* USER CODE BEGIN 2 */
 
+  // CRC 주변장치 공유 준비 (뮤텍스/DMA 완료 신호) - 설정/저널 CRC 사용 전
+  Checksum_Init();
+
   // Logger 초기화 (터미널 출력만 사용)
   LOGGER_Connect("STM32", 0);
 
@@ -347,17 +354,14 @@ int main(void) {
   /* USER CODE END RTOS_TIMERS */
 
   /* USER CODE BEGIN RTOS_QUEUES */
-  // SD 로깅 큐 생성 (안전성 체크 포함)
-  LOG_INFO("📤 Creating SD logging queue (size: %d, item: %d bytes)",
-           SD_LOG_QUEUE_SIZE, sizeof(SDLogEntry_t));
+  // SD 서비스 요청 큐 생성 (SD 태스크만 FatFs에 접근, 다른 태스크는 요청만)
+  LOG_INFO("📤 Creating SD service queue (depth: %d, payload: %d bytes)",
+           SD_SERVICE_QUEUE_DEPTH, SD_SERVICE_APPEND_MAX);
 
-  osMessageQDef(sdLogQueue, SD_LOG_QUEUE_SIZE, SDLogEntry_t);
-  sdLogQueueHandle = osMessageCreate(osMessageQ(sdLogQueue), NULL);
-
-  if (sdLogQueueHandle == NULL) {
-    LOG_ERROR("❌ SD logging queue creation FAILED - insufficient memory");
+  if (SDService_Init() != RESULT_SUCCESS) {
+    LOG_ERROR("❌ SD service queue creation FAILED - insufficient memory");
   } else {
-    LOG_INFO("✅ SD logging queue created successfully");
+    LOG_INFO("✅ SD service queue created successfully");
   }
   /* USER CODE END RTOS_QUEUES */
 
@@ -1036,6 +1040,12 @@ static void MX_SDMMC1_SD_Init(void) {
     Error_Handler();
   }
 
+  // SD 초기화 후 DMA 핸들 연결 (실패 시 sd_diskio는 폴링 모드로 동작)
+  if (hdma_sdmmc1_rx.Instance != NULL && hdma_sdmmc1_tx.Instance != NULL) {
+    __HAL_LINKDMA(&hsd1, hdmarx, hdma_sdmmc1_rx);
+    __HAL_LINKDMA(&hsd1, hdmatx, hdma_sdmmc1_tx);
+  }
+
   // BSP 초기화도 호출 (FatFs 호환성을 위해)
   uint8_t bsp_result = BSP_SD_Init();
   if (bsp_result != MSD_OK) {
@@ -1712,20 +1722,22 @@ static void MX_GPIO_Init(void) {
 static int _initialize_sd_card_and_test(void) {
   LOG_INFO("📤 [TX_TASK] Starting SD card basic functionality test...");
 
-  // SD 초기화 시도
-  LOG_INFO("📤 [TX_TASK] Attempting SD card initialization...");
-  int sd_result = SDStorage_Init();
+  // SD 마운트는 SD 태스크가 담당 - 준비될 때까지 대기
+  LOG_INFO("📤 [TX_TASK] Waiting for SD task to mount the card...");
+  int sd_result = SDService_WaitReady(SD_SERVICE_READY_WAIT_MS)
+                      ? SDSTORAGE_OK
+                      : SDSTORAGE_NOT_READY;
 
   if (sd_result == SDSTORAGE_OK) {
     LOG_INFO("✅ [TX_TASK] SD card initialization SUCCESS");
 
-    // 기본 쓰기 테스트
+    // 기본 쓰기 테스트 (SD 태스크에 append 요청)
     LOG_INFO("📤 [TX_TASK] Testing SD card write operation...");
     const char *test_message = "SD Card Test - Hello World from FreeRTOS!\n";
-    int write_result = SDStorage_WriteLog(test_message, strlen(test_message));
+    int write_result = SDService_Append(test_message, strlen(test_message));
 
     if (write_result == SDSTORAGE_OK) {
-      LOG_INFO("✅ [TX_TASK] SD card write operation SUCCESS");
+      LOG_INFO("✅ [TX_TASK] SD card write request queued");
       LOG_INFO("🎉 [TX_TASK] SD card functionality confirmed - ready for "
                "long-term logging");
     } else {
@@ -2029,8 +2041,7 @@ void StartSDLoggingTask(void const *argument) {
       uint32_t init_start_time = HAL_GetTick();
       const uint32_t INIT_TIMEOUT_MS = 10000; // 10초 타임아웃
 
-      // TODO: 실제로는 별도 태스크에서 SDStorage_Init 호출하고 여기서는 폴링
-      // 현재는 간단히 직접 호출하되 타임아웃 체크
+      // SD 태스크가 FatFs 볼륨 소유자이므로 마운트도 여기서만 수행
       init_result = SDStorage_Init();
       uint32_t init_duration = HAL_GetTick() - init_start_time;
 
@@ -2064,52 +2075,79 @@ void StartSDLoggingTask(void const *argument) {
     LOG_ERROR("[SD_TASK] ❌ All SD initialization attempts failed");
     LOG_INFO("[SD_TASK] Continuing with terminal-only logging");
 
-    // SD 실패해도 태스크는 계속 실행 (나중에 재시도 가능)
+    // SD 실패해도 태스크는 계속 실행 (들어온 요청은 NOT_READY로 완료 처리)
     for (;;) {
-      osDelay(60000); // 1분마다 재시도 체크 (향후 확장)
+      SDService_Process(60000); // 1분마다 재시도 체크 (향후 확장)
     }
   }
 
-  LOG_INFO("[SD_TASK] 🗂️ SD logging queue processing started");
+  LOG_INFO("[SD_TASK] 🗂️ SD service request processing started");
 
-  // SD 로그 큐 처리 메인 루프
+  // SD 서비스 메인 루프: 요청 처리(append 묶음 기록) + 회전/동기화 주기 작업
+  uint32_t last_report_tick = HAL_GetTick();
   for (;;) {
-    SDLogEntry_t log_entry;
-    osEvent event = osMessageGet(sdLogQueueHandle, 1000); // 1초 타임아웃
-
-    if (event.status == osEventMessage) {
-      // 큐에서 로그 엔트리 수신
-      log_entry = *((SDLogEntry_t *)event.value.p);
-
-      // SD에 안전하게 쓰기 (타임아웃 포함)
-      uint32_t write_start = HAL_GetTick();
-      int write_result =
-          SDStorage_WriteLog(log_entry.message, log_entry.length);
-      uint32_t write_duration = HAL_GetTick() - write_start;
-
-      if (write_result != SDSTORAGE_OK) {
-        // SD 쓰기 실패 - 터미널에만 에러 출력 (무한루프 방지)
-        printf("[SD_TASK] Write failed (duration: %lu ms, result: %d)\n",
-               write_duration, write_result);
-
-        // SD 쓰기 실패 시 잠시 대기 후 재시도 여부 결정
-        osDelay(1000);
-      }
-    }
+    SDService_Process(1000); // 요청이 없으면 1초마다 주기 작업
 
     // 주기적으로 SD 상태 체크 (1분마다)
-    static uint32_t status_check_counter = 0;
-    status_check_counter++;
-    if (status_check_counter % 60 == 0) { // 60초마다
+    if (HAL_GetTick() - last_report_tick >= 60000) {
+      last_report_tick = HAL_GetTick();
       if (SDStorage_IsReady()) {
-        // SD 상태 정상
+        // SD 상태 정상 - 처리량/SD 점유 시간 보고
+        static SDStorageStats prev_stats;
+        static uint32_t prev_tick;
+        SDStorageStats stats;
+        SDStorage_GetStats(&stats);
+        uint32_t now = HAL_GetTick();
+        uint32_t elapsed_ms = now - prev_tick;
+        if (prev_tick != 0 && elapsed_ms > 0) {
+          uint32_t busy_ms = stats.busy_ms - prev_stats.busy_ms;
+          LOG_INFO("[SD_TASK] %lu lines/s, %lu B/s, f_write %lu, f_sync %lu, busy %lu ms (%lu.%lu%%)",
+                   (stats.lines - prev_stats.lines) * 1000 / elapsed_ms,
+                   (stats.bytes - prev_stats.bytes) * 1000 / elapsed_ms,
+                   stats.write_calls - prev_stats.write_calls,
+                   stats.sync_calls - prev_stats.sync_calls, busy_ms,
+                   busy_ms * 100 / elapsed_ms, (busy_ms * 1000 / elapsed_ms) % 10);
+        }
+        // 현재 f_sync 정책 (적응형이면 카드 지연/밀린 요청에 따라 변함)
+        LOG_INFO("[SD_TASK] sync policy %lu B / %lu ms (grow %lu, shrink %lu)",
+                 stats.sync_bytes_target, stats.sync_interval_target_ms,
+                 stats.policy_grows, stats.policy_shrinks);
+        prev_stats = stats;
+        prev_tick = now;
+
+        // 요청 종류별 지연 시간 (큐 대기 + 처리, 누적)
+        SDServiceStats service_stats;
+        SDService_GetStats(&service_stats);
+        for (int type = 0; type < SDSERVICE_REQ_COUNT; type++) {
+          const SDServiceLatency *latency = &service_stats.latency[type];
+          if (latency->count > 0) {
+            LOG_INFO("[SD_TASK] %s: %lu req, %lu failed, avg %lu ms, max %lu ms",
+                     SDService_RequestName((SDServiceRequestType)type),
+                     latency->count, latency->failed,
+                     latency->total_ms / latency->count, latency->max_ms);
+          }
+        }
+        LOG_INFO("[SD_TASK] %lu batches (%lu appends), %lu rejected",
+                 service_stats.batches, service_stats.batched_appends,
+                 service_stats.rejected);
+
+        // SD 동작별 지연 요약 (us, 부팅 이후 누적) - 카드/flush 정책 비교용
+        // 전체 버킷은 SDService_Submit(SDSERVICE_REQ_LATENCY_DUMP, ...)로 요청
+        for (int op = 0; op < SDSTORAGE_LAT_COUNT; op++) {
+          LatencyHist hist;
+          char summary[96];
+          SDStorage_GetLatency((SDStorageLatencyOp)op, &hist);
+          if (hist.count > 0 &&
+              LatencyHist_FormatSummary(&hist, SDStorage_LatencyOpName((SDStorageLatencyOp)op),
+                                        summary, sizeof(summary)) > 0) {
+            LOG_INFO("[SD_TASK] lat %s", summary);
+          }
+        }
       } else {
         // SD 상태 이상 - 재초기화 시도 (향후 확장)
         LOG_WARN("[SD_TASK] SD card appears disconnected - monitoring");
       }
     }
-
-    osDelay(50); // CPU 부하 방지
   }
   /* USER CODE END StartSDLoggingTask */
 }
@@ -2284,6 +2322,28 @@ static void MX_DMA_Init(void) {
   /* USART6_IRQn interrupt configuration */
   HAL_NVIC_SetPriority(USART6_IRQn, 5, 0);
   HAL_NVIC_EnableIRQ(USART6_IRQn);
+
+  /* DMA2_Stream7_IRQn interrupt configuration - USART1_TX (로그 출력) */
+  HAL_NVIC_SetPriority(DMA2_Stream7_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream7_IRQn);
+
+  /* USART1_IRQn interrupt configuration - TX 완료(TC) 처리 */
+  HAL_NVIC_SetPriority(USART1_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(USART1_IRQn);
+
+  /* SDMMC1 DMA (RX: DMA2_Stream3, TX: DMA2_Stream6) - 완료 콜백에서 RTOS 메시지 전송 */
+  HAL_NVIC_SetPriority(DMA2_Stream3_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream3_IRQn);
+  HAL_NVIC_SetPriority(DMA2_Stream6_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream6_IRQn);
+
+  /* DMA2_Stream0 메모리->CRC (Checksum 모듈) - 완료 콜백에서 세마포어 해제 */
+  HAL_NVIC_SetPriority(DMA2_Stream0_IRQn, 6, 0);
+  HAL_NVIC_EnableIRQ(DMA2_Stream0_IRQn);
+
+  /* SDMMC1_IRQn interrupt configuration - DATAEND/에러 처리 */
+  HAL_NVIC_SetPriority(SDMMC1_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(SDMMC1_IRQn);
 }
 
 /**
@@ -2319,3 +2379,123 @@ void MX_USART6_DMA_Init(void) {
   /* Associate the initialized DMA handle to the UART handle */
   __HAL_LINKDMA(&huart6, hdmarx, hdma_usart6_rx);
 }
+
+/**
+ * @brief DMA2 Stream7 DMA configuration for USART1 TX (로그 출력)
+ * @param None
+ * @retval None
+ */
+void MX_USART1_DMA_Init(void) {
+  // DMA 이미 초기화되었는지 체크
+  if (hdma_usart1_tx.Instance != NULL) {
+    return; // 이미 초기화됨
+  }
+
+  /* Configure DMA for USART1 TX */
+  hdma_usart1_tx.Instance = DMA2_Stream7;
+  hdma_usart1_tx.Init.Channel = DMA_CHANNEL_4;
+  hdma_usart1_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  hdma_usart1_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_usart1_tx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_usart1_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  hdma_usart1_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_usart1_tx.Init.Mode = DMA_NORMAL;
+  hdma_usart1_tx.Init.Priority = DMA_PRIORITY_LOW;
+  hdma_usart1_tx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+
+  if (HAL_DMA_Init(&hdma_usart1_tx) != HAL_OK) {
+    // 실패 시 logger는 블로킹 전송으로 동작 (시스템 중단 방지)
+    hdma_usart1_tx.Instance = NULL; // 실패 표시
+    return;
+  }
+
+  /* Associate the initialized DMA handle to the UART handle */
+  __HAL_LINKDMA(&huart1, hdmatx, hdma_usart1_tx);
+}
+
+/**
+ * @brief DMA2 Stream3/Stream6 DMA configuration for SDMMC1 RX/TX
+ * @param None
+ * @retval None
+ */
+void MX_SDMMC1_DMA_Init(void) {
+  // DMA 이미 초기화되었는지 체크
+  if (hdma_sdmmc1_rx.Instance != NULL) {
+    return; // 이미 초기화됨
+  }
+
+  /* SDMMC1 FIFO는 워드 단위, 4비트 버스트 (RM0385 SDMMC DMA 권장 설정) */
+  hdma_sdmmc1_rx.Instance = DMA2_Stream3;
+  hdma_sdmmc1_rx.Init.Channel = DMA_CHANNEL_4;
+  hdma_sdmmc1_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+  hdma_sdmmc1_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_sdmmc1_rx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_sdmmc1_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+  hdma_sdmmc1_rx.Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+  hdma_sdmmc1_rx.Init.Mode = DMA_PFCTRL;
+  hdma_sdmmc1_rx.Init.Priority = DMA_PRIORITY_VERY_HIGH;
+  hdma_sdmmc1_rx.Init.FIFOMode = DMA_FIFOMODE_ENABLE;
+  hdma_sdmmc1_rx.Init.FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+  hdma_sdmmc1_rx.Init.MemBurst = DMA_MBURST_INC4;
+  hdma_sdmmc1_rx.Init.PeriphBurst = DMA_PBURST_INC4;
+
+  if (HAL_DMA_Init(&hdma_sdmmc1_rx) != HAL_OK) {
+    // 실패 시 sd_diskio는 폴링 모드로 동작 (시스템 중단 방지)
+    hdma_sdmmc1_rx.Instance = NULL; // 실패 표시
+    return;
+  }
+
+  hdma_sdmmc1_tx.Instance = DMA2_Stream6;
+  hdma_sdmmc1_tx.Init.Channel = DMA_CHANNEL_4;
+  hdma_sdmmc1_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  hdma_sdmmc1_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_sdmmc1_tx.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_sdmmc1_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+  hdma_sdmmc1_tx.Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+  hdma_sdmmc1_tx.Init.Mode = DMA_PFCTRL;
+  hdma_sdmmc1_tx.Init.Priority = DMA_PRIORITY_VERY_HIGH;
+  hdma_sdmmc1_tx.Init.FIFOMode = DMA_FIFOMODE_ENABLE;
+  hdma_sdmmc1_tx.Init.FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+  hdma_sdmmc1_tx.Init.MemBurst = DMA_MBURST_INC4;
+  hdma_sdmmc1_tx.Init.PeriphBurst = DMA_PBURST_INC4;
+
+  if (HAL_DMA_Init(&hdma_sdmmc1_tx) != HAL_OK) {
+    hdma_sdmmc1_rx.Instance = NULL; // 실패 표시 (RX/TX 모두 있어야 DMA 사용)
+    hdma_sdmmc1_tx.Instance = NULL;
+    return;
+  }
+}
+
+/**
+ * @brief DMA2 Stream0 DMA configuration for CRC input (메모리 -> CRC DR)
+ * @param None
+ * @retval None
+ */
+void MX_CRC_DMA_Init(void) {
+  // DMA 이미 초기화되었는지 체크
+  if (hdma_crc.Instance != NULL) {
+    return; // 이미 초기화됨
+  }
+
+  /* 메모리->메모리 모드: 소스(PAR)는 워드 증가, 대상(M0AR = CRC->DR)은 바이트 고정.
+     FIFO가 워드를 하위 바이트부터 풀어 DR에 바이트 순서대로 기록 (M2M은 FIFO 필수) */
+  hdma_crc.Instance = DMA2_Stream0;
+  hdma_crc.Init.Channel = DMA_CHANNEL_0;
+  hdma_crc.Init.Direction = DMA_MEMORY_TO_MEMORY;
+  hdma_crc.Init.PeriphInc = DMA_PINC_ENABLE;
+  hdma_crc.Init.MemInc = DMA_MINC_DISABLE;
+  hdma_crc.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+  hdma_crc.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  hdma_crc.Init.Mode = DMA_NORMAL;
+  hdma_crc.Init.Priority = DMA_PRIORITY_LOW;
+  hdma_crc.Init.FIFOMode = DMA_FIFOMODE_ENABLE;
+  hdma_crc.Init.FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+  hdma_crc.Init.MemBurst = DMA_MBURST_SINGLE;
+  hdma_crc.Init.PeriphBurst = DMA_PBURST_SINGLE;
+
+  if (HAL_DMA_Init(&hdma_crc) != HAL_OK) {
+    // 실패 시 Checksum은 CPU가 직접 CRC DR에 기록 (시스템 중단 방지)
+    hdma_crc.Instance = NULL; // 실패 표시
+    return;
+  }
+}
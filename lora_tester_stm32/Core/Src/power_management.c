@@ -1,5 +1,9 @@
 #include "power_management.h"
 #include "logger.h"
+#include "time.h"
+
+/* HAL_Delay 한 번에 기다리는 최대 시간 (긴 대기는 마감 시각까지 나눠서) */
+#define POWER_DELAY_SLICE_MS 60000U
 
 extern RTC_HandleTypeDef hrtc;
 
@@ -51,8 +55,13 @@ void PowerMgmt_SetAlarmAndSleep(uint32_t seconds) {
   /* 진짜 Sleep Mode: 한 번에 전체 시간 대기 */
   HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
 
-  /* 전체 시간 한 번에 대기 - 중간에 깨어나지 않음 */
-  HAL_Delay(seconds * 1000);
+  /* 전체 시간 대기 - 64비트 마감 시각 기준이라 곱셈 overflow/tick wrap에도 정확 */
+  TIME_Deadline deadline = TIME_DeadlineAfter((uint64_t)seconds * 1000U);
+  while (!TIME_DeadlineExpired(deadline)) {
+    uint64_t remaining = TIME_DeadlineRemainingMs(deadline);
+    TIME_DelayMs((remaining > POWER_DELAY_SLICE_MS) ? POWER_DELAY_SLICE_MS
+                                                    : (uint32_t)remaining);
+  }
 
   alarm_set = 0;
   alarm_triggered = 1;
@@ -106,7 +115,7 @@ void PowerMgmt_PrintSystemStatus(void) {
            (pwr_cr & PWR_CR1_LPDS) ? "Low Power" : "Normal");
 
   // 시스템 실행 시간
-  uint32_t uptime = HAL_GetTick() / 1000;
+  uint32_t uptime = (uint32_t)(TIME_GetMonotonicMs() / 1000U);
   LOG_INFO("[PowerMgmt] ⏱️  Uptime: %lu seconds", uptime);
 }
 
@@ -115,10 +124,10 @@ void PowerMgmt_PrintSystemStatus(void) {
  */
 uint32_t PowerMgmt_GetCpuUsage(void) {
   static uint32_t last_idle_time = 0;
-  static uint32_t last_total_time = 0;
+  static uint64_t last_total_time = 0;
 
-  uint32_t current_time = HAL_GetTick();
-  uint32_t idle_time = current_time - last_total_time; // 간략화된 계산
+  uint64_t current_time = TIME_GetMonotonicMs();
+  uint64_t idle_time = current_time - last_total_time; // 간략화된 계산
 
   last_total_time = current_time;
 
@@ -8,6 +8,7 @@
 #include "system_config_runtime.h"
 #include "system_config.h"
 #include "logger.h"
+#include "Checksum.h"
 #include <string.h>
 
 // ============================================================================
@@ -62,10 +63,18 @@ static void _init_sd_config_defaults(RuntimeSDCardConfig* config)
     config->transfer_wait_max_count = SD_TRANSFER_WAIT_MAX_COUNT;
     config->transfer_check_interval_ms = SD_TRANSFER_CHECK_INTERVAL_MS;
     config->log_file_max_size = SD_LOG_FILE_MAX_SIZE;
+    config->log_rotate_interval_ms = SD_LOG_ROTATE_INTERVAL_MS;
     strncpy(config->log_directory, "lora_logs", sizeof(config->log_directory) - 1);
     strncpy(config->log_file_prefix, "LORA", sizeof(config->log_file_prefix) - 1);
     config->auto_format_enabled = true;
-    config->compression_enabled = false;
+    config->compression_enabled = SD_COMPRESSION_ENABLED;
+    config->journal_enabled = SD_JOURNAL_ENABLED;
+    config->sync_interval_ms = SD_SYNC_INTERVAL_MS;
+    config->sync_bytes_threshold = SD_SYNC_BYTES_THRESHOLD;
+    config->adaptive_sync_enabled = SD_ADAPTIVE_SYNC_ENABLED;
+    config->sync_bytes_min = SD_SYNC_BYTES_MIN;
+    config->sync_interval_min_ms = SD_SYNC_INTERVAL_MIN_MS;
+    config->index_interval_bytes = SD_TIME_INDEX_INTERVAL;
 }
 
 /**
@@ -111,22 +120,16 @@ static void _init_hardware_config_defaults(HardwareConfig* config)
 }
 
 /**
- * @brief CRC 계산 (간단한 체크섬)
+ * @brief CRC 계산 (CRC-32/MPEG-2, 타겟은 CRC 주변장치)
  */
 static uint32_t _calculate_config_crc(const GlobalSystemConfig* config)
 {
-    const uint8_t* data = (const uint8_t*)config;
-    uint32_t crc = 0;
+    // CRC 필드는 구조체 중간에 있으므로 0으로 둔 사본에 대해 계산
+    GlobalSystemConfig copy;
+    memcpy(&copy, config, sizeof(copy));
+    copy.config_crc = 0;
     
-    // CRC 필드를 제외한 전체 구조체에 대해 간단한 체크섬 계산
-    size_t size = sizeof(GlobalSystemConfig) - sizeof(config->config_crc);
-    
-    for (size_t i = 0; i < size; i++) {
-        crc += data[i];
-        crc = (crc << 1) | (crc >> 31);  // 순환 시프트
-    }
-    
-    return crc;
+    return Checksum_Crc32(&copy, sizeof(copy));
 }
 
 // ============================================================================
@@ -158,9 +161,9 @@ ResultCode SystemConfig_Init(GlobalSystemConfig* config)
     strncpy(config->device_name, "LoRa-Tester-STM32", sizeof(config->device_name) - 1);
     strncpy(config->firmware_version, "v1.0.0", sizeof(config->firmware_version) - 1);
     
-    // CRC 계산 및 유효성 설정
-    config->config_crc = _calculate_config_crc(config);
+    // 유효성 설정 후 CRC 계산 (config_valid도 CRC 범위에 포함)
     config->config_valid = true;
+    config->config_crc = _calculate_config_crc(config);
     
     LOG_INFO("[SystemConfig] Configuration initialized successfully (version: %lu)", config->config_version);
     return RESULT_SUCCESS;
@@ -206,6 +209,27 @@ ResultCode SystemConfig_Validate(const GlobalSystemConfig* config)
         LOG_ERROR("[SystemConfig] Invalid SD log file max size: %lu bytes", config->sd_card.log_file_max_size);
         return RESULT_ERROR_INVALID_PARAM;
     }
+    if (config->sd_card.sync_interval_ms < 100 || config->sd_card.sync_interval_ms > 60000) { // 100ms~60초
+        LOG_ERROR("[SystemConfig] Invalid SD sync interval: %lu ms", config->sd_card.sync_interval_ms);
+        return RESULT_ERROR_INVALID_PARAM;
+    }
+    if (config->sd_card.sync_bytes_threshold < 512) {
+        LOG_ERROR("[SystemConfig] Invalid SD sync threshold: %lu bytes", config->sd_card.sync_bytes_threshold);
+        return RESULT_ERROR_INVALID_PARAM;
+    }
+    if (config->sd_card.adaptive_sync_enabled &&
+        (config->sd_card.sync_bytes_min < 512 ||
+         config->sd_card.sync_bytes_min > config->sd_card.sync_bytes_threshold ||
+         config->sd_card.sync_interval_min_ms < 100 ||
+         config->sd_card.sync_interval_min_ms > config->sd_card.sync_interval_ms)) {
+        LOG_ERROR("[SystemConfig] Invalid SD adaptive sync bounds: %lu bytes, %lu ms",
+                  config->sd_card.sync_bytes_min, config->sd_card.sync_interval_min_ms);
+        return RESULT_ERROR_INVALID_PARAM;
+    }
+    if (config->sd_card.index_interval_bytes != 0 && config->sd_card.index_interval_bytes < 1024) {
+        LOG_ERROR("[SystemConfig] Invalid SD index interval: %lu bytes", config->sd_card.index_interval_bytes);
+        return RESULT_ERROR_INVALID_PARAM;
+    }
     
     LOG_DEBUG("[SystemConfig] Configuration validation successful");
     return RESULT_SUCCESS;
@@ -8,6 +8,24 @@
 #include "time.h"
 #include "stm32f7xx_hal.h"
 
+// HAL 타임베이스 (stm32f7xx_hal_timebase_tim.c): 1MHz 카운터, 1ms마다 update 인터럽트로 HAL_IncTick
+extern TIM_HandleTypeDef htim6;
+
+// HAL_GetTick (32비트, 49.7일마다 wrap)을 64비트로 확장하기 위한 상태
+static uint32_t g_tick_high = 0;    // wrap 횟수
+static uint32_t g_tick_last = 0;
+
+// 인터럽트를 막은 상태에서 호출 - 49.7일 안에 한 번 이상 호출되면 wrap을 놓치지 않음
+static uint64_t _tick64(void)
+{
+    uint32_t tick = HAL_GetTick();
+    if (tick < g_tick_last) {
+        g_tick_high++;
+    }
+    g_tick_last = tick;
+    return ((uint64_t)g_tick_high << 32) | tick;
+}
+
 // STM32용 플랫폼 함수들
 uint32_t TIME_Platform_GetCurrentMs(void)
 {
@@ -17,4 +35,28 @@ uint32_t TIME_Platform_GetCurrentMs(void)
 void TIME_Platform_DelayMs(uint32_t ms)
 {
     HAL_Delay(ms);
-} 
\ No newline at end of file
+} 
+
+uint64_t TIME_Platform_GetMonotonicMs(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint64_t ms = _tick64();
+    __set_PRIMASK(primask);
+    return ms;
+}
+
+uint64_t TIME_Platform_GetMonotonicUs(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint64_t ms = _tick64();
+    uint32_t us = TIM6->CNT;
+    if (__HAL_TIM_GET_FLAG(&htim6, TIM_FLAG_UPDATE) != RESET) {
+        // 카운터가 넘어갔는데 인터럽트가 막혀 틱이 아직 안 올라감 - 다음 ms로 보고 카운터 다시 읽음
+        ms++;
+        us = TIM6->CNT;
+    }
+    __set_PRIMASK(primask);
+    return ms * 1000U + us;
+}
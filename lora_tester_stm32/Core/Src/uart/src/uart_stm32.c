@@ -8,6 +8,7 @@
 #include "uart.h"
 #include "stm32f7xx_hal.h"
 #include "logger.h"
+#include "logger_platform.h"
 #include "cmsis_os.h"
 #include <string.h>
 
@@ -272,6 +273,24 @@ UartStatus UART_Platform_Configure(const UartConfig* config) {
 // HAL UART 콜백 함수들 - main.c에서 이동됨
 // ============================================================================
 
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance == USART1)
+  {
+    // 로그 DMA 전송 완료 - 링 버퍼의 다음 구간 전송
+    LOGGER_Platform_TxCpltCallback();
+  }
+}
+
+void HAL_UART_AbortTransmitCpltCallback(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance == USART1)
+  {
+    // 로그 TX 에러 후 abort 완료 - 링 버퍼 남은 구간 재전송
+    LOGGER_Platform_TxAbortCpltCallback();
+  }
+}
+
 void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 {
   if (huart->Instance == USART6)
@@ -295,6 +314,13 @@ void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart)
 
 void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
 {
+  if (huart->Instance == USART1)
+  {
+    // 로그 TX DMA 에러 - 로그 출력 자체가 실패한 상황이므로 LOG 호출 없이 재전송
+    LOGGER_Platform_TxErrorCallback();
+    return;
+  }
+
   if (huart->Instance == USART6)
   {
     // UART 에러 발생
@@ -132,6 +132,73 @@ const Diskio_drvTypeDef  SD_Driver =
 
 /* USER CODE BEGIN beforeFunctionSection */
 /* can be used to modify / undefine following code or add new code */
+
+/*
+ * DMA 전송 + RTOS 완료 대기
+ * - 32바이트(캐시 라인) 정렬 버퍼만 직접 DMA, 그 외는 정렬된 scratch 버퍼 경유
+ * - 쓰기 전 D-Cache clean, 읽기 전/후 invalidate
+ * - 전송 중에는 osMessageGet으로 대기하므로 다른 태스크가 CPU 사용
+ * - DMA 시작 실패/에러/타임아웃 시 전송 중단 후 폴링 모드로 재시도
+ */
+#define SD_DMA_ERROR_MSG   (uint32_t) 3
+#define SD_IS_CACHE_ALIGNED(p)  ((((uint32_t)(p)) & 0x1F) == 0)
+
+extern SD_HandleTypeDef hsd1;
+
+static SD_DiskioStats sd_stats;
+
+static int SD_DmaAvailable(void)
+{
+  /* ISR 또는 스케줄러 시작 전에는 완료 대기가 불가능하므로 폴링 사용 */
+  if (__get_IPSR() != 0 || SDQueueID == NULL)
+  {
+    return 0;
+  }
+  if (osKernelRunning() == 0)
+  {
+    return 0;
+  }
+  return (hsd1.hdmarx != NULL) && (hsd1.hdmatx != NULL);
+}
+
+static void SD_DrainQueue(void)
+{
+  /* 이전 타임아웃 후 늦게 도착한 완료 메시지 제거 */
+  while (osMessageGet(SDQueueID, 0).status == osEventMessage)
+  {
+  }
+}
+
+static int SD_WaitDmaComplete(uint32_t expected_msg)
+{
+  osEvent event = osMessageGet(SDQueueID, SD_TIMEOUT);
+  if (event.status != osEventMessage)
+  {
+    sd_stats.timeouts++;
+    return -1;
+  }
+  return (event.value.v == expected_msg) ? 0 : -1;
+}
+
+static void SD_AbortTransfer(void)
+{
+  sd_stats.fallbacks++;
+  HAL_SD_Abort(&hsd1);
+}
+
+/* 32바이트 정렬 버퍼 읽기: DMA 우선, 실패 시 폴링 */
+static DRESULT SD_ReadAligned(BYTE *buff, DWORD sector, UINT count);
+/* 32바이트 정렬 버퍼 쓰기: DMA 우선, 실패 시 폴링 */
+static DRESULT SD_WriteAligned(const BYTE *buff, DWORD sector, UINT count);
+
+void SD_GetDiskioStats(SD_DiskioStats *stats)
+{
+  if (stats != NULL)
+  {
+    *stats = sd_stats;
+  }
+}
+
 /* USER CODE END beforeFunctionSection */
 
 /* Private functions ---------------------------------------------------------*/
@@ -152,6 +219,11 @@ static int SD_CheckStatusWithTimeout(uint32_t timeout)
     {
       return 0;
     }
+    /* 카드 프로그래밍 중에는 다른 태스크에 CPU 양보 */
+    if (__get_IPSR() == 0 && osKernelRunning())
+    {
+      osDelay(1);
+    }
   }
 
   return -1;
@@ -250,18 +322,8 @@ DSTATUS SD_status(BYTE lun)
 
 DRESULT SD_read(BYTE lun, BYTE *buff, DWORD sector, UINT count)
 {
-  uint8_t ret;
   DRESULT res = RES_ERROR;
-  uint32_t timer;
-#if (osCMSIS < 0x20000U)
-  osEvent event;
-#else
-  uint16_t event;
-  osStatus_t status;
-#endif
-#if (ENABLE_SD_DMA_CACHE_MAINTENANCE == 1)
-  uint32_t alignedAddr;
-#endif
+
   /*
   * ensure the SDCard is ready for a new operation
   */
@@ -272,49 +334,30 @@ DRESULT SD_read(BYTE lun, BYTE *buff, DWORD sector, UINT count)
   }
 
 #if defined(ENABLE_SCRATCH_BUFFER)
-  if (!((uint32_t)buff & 0x3))
+  if (SD_IS_CACHE_ALIGNED(buff))
   {
 #endif
-    /* Use polling mode instead of DMA to avoid callback issues */
-    ret = BSP_SD_ReadBlocks((uint32_t*)buff, (uint32_t)(sector), count, SD_TIMEOUT);
-
-    if (ret == MSD_OK) {
-      /* Polling mode - no need for message queue */
-      res = RES_OK;
-    }
-
+    res = SD_ReadAligned(buff, sector, count);
 #if defined(ENABLE_SCRATCH_BUFFER)
-    }
-    else
-    {
-      /* Slow path, fetch each sector a part and memcpy to destination buffer */
-      int i;
+  }
+  else
+  {
+    /* Slow path, fetch each sector a part and memcpy to destination buffer */
+    UINT i;
 
-      for (i = 0; i < count; i++)
+    for (i = 0; i < count; i++)
+    {
+      if (SD_ReadAligned(scratch, sector++, 1) != RES_OK)
       {
-        ret = BSP_SD_ReadBlocks((uint32_t*)scratch, (uint32_t)sector++, 1, SD_TIMEOUT);
-        if (ret == MSD_OK )
-        {
-          /* Polling mode - operation already completed */
-#if (ENABLE_SD_DMA_CACHE_MAINTENANCE == 1)
-          /*
-          *
-          * invalidate the scratch buffer before the next read to get the actual data instead of the cached one
-          */
-          SCB_InvalidateDCache_by_Addr((uint32_t*)scratch, BLOCKSIZE);
-#endif
-          memcpy(buff, scratch, BLOCKSIZE);
-          buff += BLOCKSIZE;
-        }
-        else
-        {
-          break;
-        }
+        break;
       }
-
-      if ((i == count) && (ret == MSD_OK ))
-        res = RES_OK;
+      memcpy(buff, scratch, BLOCKSIZE);
+      buff += BLOCKSIZE;
     }
+
+    if (i == count)
+      res = RES_OK;
+  }
 #endif
   return res;
 }
@@ -335,18 +378,6 @@ DRESULT SD_read(BYTE lun, BYTE *buff, DWORD sector, UINT count)
 DRESULT SD_write(BYTE lun, const BYTE *buff, DWORD sector, UINT count)
 {
   DRESULT res = RES_ERROR;
-  uint32_t timer;
-
-#if (osCMSIS < 0x20000U)
-  osEvent event;
-#else
-  uint16_t event;
-  osStatus_t status;
-#endif
-
-#if defined(ENABLE_SCRATCH_BUFFER)
-  int32_t ret;
-#endif
 
   /*
   * ensure the SDCard is ready for a new operation
@@ -358,96 +389,30 @@ DRESULT SD_write(BYTE lun, const BYTE *buff, DWORD sector, UINT count)
   }
 
 #if defined(ENABLE_SCRATCH_BUFFER)
-  if (!((uint32_t)buff & 0x3))
+  if (SD_IS_CACHE_ALIGNED(buff))
   {
 #endif
-#if (ENABLE_SD_DMA_CACHE_MAINTENANCE == 1)
-  uint32_t alignedAddr;
-  /*
-    the SCB_CleanDCache_by_Addr() requires a 32-Byte aligned address
-    adjust the address and the D-Cache size to clean accordingly.
-  */
-  alignedAddr = (uint32_t)buff & ~0x1F;
-  SCB_CleanDCache_by_Addr((uint32_t*)alignedAddr, count*BLOCKSIZE + ((uint32_t)buff - alignedAddr));
-#endif
-
-  if(BSP_SD_WriteBlocks((uint32_t*)buff,
-                        (uint32_t) (sector),
-                        count, SD_TIMEOUT) == MSD_OK)
-  {
-    /* Polling mode - no need for message queue */
-    res = RES_OK;
-  }
+    res = SD_WriteAligned(buff, sector, count);
 #if defined(ENABLE_SCRATCH_BUFFER)
-  else {
-    /* Slow path, fetch each sector a part and memcpy to destination buffer */
-    int i;
+  }
+  else
+  {
+    /* Slow path, copy each sector to the aligned scratch buffer */
+    UINT i;
 
-#if (ENABLE_SD_DMA_CACHE_MAINTENANCE == 1)
-    /*
-     * invalidate the scratch buffer before the next write to get the actual data instead of the cached one
-     */
-     SCB_InvalidateDCache_by_Addr((uint32_t*)scratch, BLOCKSIZE);
-#endif
-      for (i = 0; i < count; i++)
-      {
-        memcpy((void *)scratch, buff, BLOCKSIZE);
-        buff += BLOCKSIZE;
+    for (i = 0; i < count; i++)
+    {
+      memcpy((void *)scratch, buff, BLOCKSIZE);
+      buff += BLOCKSIZE;
 
-        ret = BSP_SD_WriteBlocks((uint32_t*)scratch, (uint32_t)sector++, 1, SD_TIMEOUT);
-        if (ret == MSD_OK )
-        {
-          /* Polling mode - operation already completed */
-#if (osCMSIS < 0x20000U)
-          /* wait for a message from the queue or a timeout */
-          event = osMessageGet(SDQueueID, SD_TIMEOUT);
-
-          if (event.status == osEventMessage)
-          {
-            if (event.value.v == READ_CPLT_MSG)
-            {
-              timer = osKernelSysTick();
-              /* block until SDIO IP is ready or a timeout occur */
-              while(osKernelSysTick() - timer <SD_TIMEOUT)
-#else
-                status = osMessageQueueGet(SDQueueID, (void *)&event, NULL, SD_TIMEOUT);
-              if ((status == osOK) && (event == READ_CPLT_MSG))
-              {
-                timer = osKernelGetTickCount();
-                /* block until SDIO IP is ready or a timeout occur */
-                ret = MSD_ERROR;
-                while(osKernelGetTickCount() - timer < SD_TIMEOUT)
-#endif
-                {
-                  ret = BSP_SD_GetCardState();
-
-                  if (ret == MSD_OK)
-                  {
-                    break;
-                  }
-                }
-
-                if (ret != MSD_OK)
-                {
-                  break;
-                }
-#if (osCMSIS < 0x20000U)
-              }
-            }
-#else
-          }
-#endif
-        }
-        else
-        {
-          break;
-        }
+      if (SD_WriteAligned(scratch, sector++, 1) != RES_OK)
+      {
+        break;
       }
-
-      if ((i == count) && (ret == MSD_OK ))
-        res = RES_OK;
     }
 
+    if (i == count)
+      res = RES_OK;
   }
 #endif
 
@@ -511,6 +476,82 @@ DRESULT SD_ioctl(BYTE lun, BYTE cmd, void *buff)
 
 /* USER CODE BEGIN afterIoctlSection */
 /* can be used to modify previous code / undefine following code / add new code */
+
+static DRESULT SD_ReadAligned(BYTE *buff, DWORD sector, UINT count)
+{
+  if (SD_DmaAvailable())
+  {
+    SD_DrainQueue();
+#if (ENABLE_SD_DMA_CACHE_MAINTENANCE == 1)
+    /* 캐시의 dirty 라인이 DMA 결과를 덮어쓰지 않도록 전송 전 invalidate */
+    SCB_InvalidateDCache_by_Addr((uint32_t*)buff, count * BLOCKSIZE);
+#endif
+    if (BSP_SD_ReadBlocks_DMA((uint32_t*)buff, (uint32_t)sector, count) == MSD_OK)
+    {
+      if (SD_WaitDmaComplete(READ_CPLT_MSG) == 0 &&
+          SD_CheckStatusWithTimeout(SD_TIMEOUT) == 0)
+      {
+#if (ENABLE_SD_DMA_CACHE_MAINTENANCE == 1)
+        /* 전송 중 투기적으로 로드된 캐시 라인 제거 */
+        SCB_InvalidateDCache_by_Addr((uint32_t*)buff, count * BLOCKSIZE);
+#endif
+        sd_stats.dma_reads++;
+        return RES_OK;
+      }
+    }
+    SD_AbortTransfer();
+    if (SD_CheckStatusWithTimeout(SD_TIMEOUT) < 0)
+    {
+      return RES_ERROR;
+    }
+  }
+
+  /* 폴링 모드: CPU가 FIFO를 읽어 캐시를 통해 기록하므로 캐시 관리 불필요 */
+  if (BSP_SD_ReadBlocks((uint32_t*)buff, (uint32_t)sector, count, SD_TIMEOUT) != MSD_OK)
+  {
+    return RES_ERROR;
+  }
+  sd_stats.polling_reads++;
+  return RES_OK;
+}
+
+static DRESULT SD_WriteAligned(const BYTE *buff, DWORD sector, UINT count)
+{
+  if (SD_DmaAvailable())
+  {
+    SD_DrainQueue();
+#if (ENABLE_SD_DMA_CACHE_MAINTENANCE == 1)
+    /* DMA가 최신 데이터를 읽도록 전송 전 clean */
+    SCB_CleanDCache_by_Addr((uint32_t*)buff, count * BLOCKSIZE);
+#endif
+    if (BSP_SD_WriteBlocks_DMA((uint32_t*)buff, (uint32_t)sector, count) == MSD_OK)
+    {
+      if (SD_WaitDmaComplete(WRITE_CPLT_MSG) == 0 &&
+          SD_CheckStatusWithTimeout(SD_TIMEOUT) == 0)
+      {
+        sd_stats.dma_writes++;
+        return RES_OK;
+      }
+    }
+    SD_AbortTransfer();
+    if (SD_CheckStatusWithTimeout(SD_TIMEOUT) < 0)
+    {
+      return RES_ERROR;
+    }
+  }
+
+  if (BSP_SD_WriteBlocks((uint32_t*)buff, (uint32_t)sector, count, SD_TIMEOUT) != MSD_OK)
+  {
+    return RES_ERROR;
+  }
+  if (SD_CheckStatusWithTimeout(SD_TIMEOUT) < 0)
+  {
+    return RES_ERROR;
+  }
+  sd_stats.polling_writes++;
+  return RES_OK;
+}
+
 /* USER CODE END afterIoctlSection */
 
 /* USER CODE BEGIN callbackSection */
@@ -556,6 +597,19 @@ void BSP_SD_ReadCpltCallback(void)
 }
 
 /* USER CODE BEGIN ErrorAbortCallbacks */
+/**
+  * @brief SD 전송 에러 콜백: 대기 중인 태스크를 즉시 깨워 폴링으로 재시도하게 함
+  * @param hsd: SD handle
+  * @retval None
+  */
+void HAL_SD_ErrorCallback(SD_HandleTypeDef *hsd)
+{
+  if (SDQueueID != NULL)
+  {
+    osMessagePut(SDQueueID, SD_DMA_ERROR_MSG, 0);
+  }
+}
+
 /*
 void BSP_SD_AbortCallback(void)
 {
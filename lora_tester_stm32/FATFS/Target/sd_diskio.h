@@ -36,6 +36,19 @@ extern const Diskio_drvTypeDef  SD_Driver;
 
 /* USER CODE BEGIN lastSection */
 /* can be used to modify / undefine previous code or add new definitions */
+
+/* SD 전송 통계 (DMA/폴링 경로별 횟수) */
+typedef struct {
+  uint32_t dma_reads;
+  uint32_t dma_writes;
+  uint32_t polling_reads;
+  uint32_t polling_writes;
+  uint32_t fallbacks;      /* DMA 실패 후 폴링으로 재시도한 횟수 */
+  uint32_t timeouts;       /* 완료 메시지 대기 타임아웃 횟수 */
+} SD_DiskioStats;
+
+void SD_GetDiskioStats(SD_DiskioStats *stats);
+
 /* USER CODE END lastSection */
 
 #endif /* __SD_DISKIO_H */
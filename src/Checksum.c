@@ -0,0 +1,309 @@
+#include "Checksum.h"
+#include <stdbool.h>
+
+#define CRC16_POLY      0x1021U
+#define CRC16_INIT      0xFFFFU
+#define CRC32_POLY      0x04C11DB7UL
+#define CRC32_INIT      0xFFFFFFFFUL
+
+uint16_t Checksum_Crc16Bitwise(const void* data, size_t len)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    uint16_t crc = CRC16_INIT;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)(p[i] << 8);
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000U) ? (uint16_t)((crc << 1) ^ CRC16_POLY) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+uint32_t Checksum_Crc32Bitwise(const void* data, size_t len)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    uint32_t crc = CRC32_INIT;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= (uint32_t)p[i] << 24;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80000000UL) ? (crc << 1) ^ CRC32_POLY : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+#ifdef STM32F746xx
+// ============================================================================
+// 타겟: CRC 주변장치
+// ============================================================================
+#include "stm32f7xx_hal.h"
+#include "cmsis_os.h"
+
+#define CHECKSUM_DMA_TIMEOUT_MS     100
+#define CHECKSUM_DMA_MAX_WORDS      0xFFFFU     // NDTR 16비트
+
+extern DMA_HandleTypeDef hdma_crc;  // DMA2_Stream0 메모리->CRC DR (MX_CRC_DMA_Init, 없으면 Instance NULL)
+
+typedef enum {
+    CRC_MODE_NONE = 0,
+    CRC_MODE_16,
+    CRC_MODE_32
+} CrcMode;
+
+osMutexDef(ChecksumMutex);
+osSemaphoreDef(ChecksumDmaDone);
+static osMutexId g_crc_mutex = NULL;
+static osSemaphoreId g_dma_done = NULL;
+static volatile bool g_dma_failed = false;
+static CrcMode g_mode = CRC_MODE_NONE;
+
+static void _dma_complete(DMA_HandleTypeDef* hdma)
+{
+    (void)hdma;
+    osSemaphoreRelease(g_dma_done);
+}
+
+static void _dma_error(DMA_HandleTypeDef* hdma)
+{
+    (void)hdma;
+    g_dma_failed = true;
+    osSemaphoreRelease(g_dma_done);
+}
+
+void Checksum_Init(void)
+{
+    if (g_crc_mutex == NULL) {
+        g_crc_mutex = osMutexCreate(osMutex(ChecksumMutex));
+    }
+    if (g_dma_done == NULL) {
+        // 이진 세마포어는 사용 가능 상태로 생성되므로 한 번 가져가 둠
+        g_dma_done = osSemaphoreCreate(osSemaphore(ChecksumDmaDone), 1);
+        if (g_dma_done != NULL) {
+            osSemaphoreWait(g_dma_done, 0);
+        }
+    }
+    if (hdma_crc.Instance != NULL) {
+        hdma_crc.XferCpltCallback = _dma_complete;
+        hdma_crc.XferErrorCallback = _dma_error;
+    }
+}
+
+static bool _lock(void)
+{
+    if (g_crc_mutex == NULL || osKernelRunning() == 0) {
+        return false;   // 스케줄러 시작 전: 단일 실행 흐름
+    }
+    osMutexWait(g_crc_mutex, osWaitForever);
+    return true;
+}
+
+static void _unlock(bool locked)
+{
+    if (locked) {
+        osMutexRelease(g_crc_mutex);
+    }
+}
+
+// 다항식 길이/초기값 설정 후 DR 리셋 (같은 모드면 리셋만)
+static void _configure(CrcMode mode)
+{
+    if (mode != g_mode) {
+        if (mode == CRC_MODE_16) {
+            WRITE_REG(CRC->POL, CRC16_POLY);
+            WRITE_REG(CRC->INIT, CRC16_INIT);
+            MODIFY_REG(CRC->CR, CRC_CR_POLYSIZE | CRC_CR_REV_IN | CRC_CR_REV_OUT, CRC_POLYLENGTH_16B);
+        } else {
+            WRITE_REG(CRC->POL, CRC32_POLY);
+            WRITE_REG(CRC->INIT, CRC32_INIT);
+            MODIFY_REG(CRC->CR, CRC_CR_POLYSIZE | CRC_CR_REV_IN | CRC_CR_REV_OUT, CRC_POLYLENGTH_32B);
+        }
+        g_mode = mode;
+    }
+    SET_BIT(CRC->CR, CRC_CR_RESET);
+}
+
+// CPU 기록: 정렬된 구간은 워드 단위 (바이트 순서를 맞추려고 __REV, DR은 MSB부터 처리)
+static void _feed_cpu(const uint8_t* p, size_t len)
+{
+    while (len > 0 && ((uintptr_t)p & 3U) != 0) {
+        *(__IO uint8_t*)&CRC->DR = *p++;
+        len--;
+    }
+    while (len >= 4) {
+        CRC->DR = __REV(*(const uint32_t*)p);
+        p += 4;
+        len -= 4;
+    }
+    while (len > 0) {
+        *(__IO uint8_t*)&CRC->DR = *p++;
+        len--;
+    }
+}
+
+// DMA 기록: 소스 워드 -> DR 바이트 (FIFO가 워드를 하위 바이트부터 풀어 메모리 순서 유지)
+// 실패 시 false (호출자가 CPU로 처음부터 다시 계산)
+static bool _feed_dma(const uint8_t* p, size_t len)
+{
+    while (len > 0 && ((uintptr_t)p & 3U) != 0) {
+        *(__IO uint8_t*)&CRC->DR = *p++;
+        len--;
+    }
+
+    if ((SCB->CCR & SCB_CCR_DC_Msk) != 0) {
+        // DMA가 최신 데이터를 읽도록 clean (캐시 라인 경계로 확장)
+        uint32_t start = (uint32_t)(uintptr_t)p & ~31U;
+        SCB_CleanDCache_by_Addr((uint32_t*)start, (int32_t)(len + ((uint32_t)(uintptr_t)p - start)));
+    }
+
+    while (len >= 4) {
+        size_t words = len / 4;
+        if (words > CHECKSUM_DMA_MAX_WORDS) {
+            words = CHECKSUM_DMA_MAX_WORDS;
+        }
+        g_dma_failed = false;
+        if (HAL_DMA_Start_IT(&hdma_crc, (uint32_t)(uintptr_t)p, (uint32_t)(uintptr_t)&CRC->DR,
+                             (uint32_t)words) != HAL_OK) {
+            return false;
+        }
+        if (osSemaphoreWait(g_dma_done, CHECKSUM_DMA_TIMEOUT_MS) != osOK || g_dma_failed) {
+            HAL_DMA_Abort(&hdma_crc);
+            return false;
+        }
+        p += words * 4;
+        len -= words * 4;
+    }
+
+    while (len > 0) {
+        *(__IO uint8_t*)&CRC->DR = *p++;
+        len--;
+    }
+    return true;
+}
+
+static uint32_t _calculate(CrcMode mode, const void* data, size_t len)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    bool locked = _lock();
+
+    _configure(mode);
+    bool use_dma = locked && len >= CHECKSUM_DMA_MIN_BYTES && hdma_crc.Instance != NULL &&
+                   g_dma_done != NULL;
+    if (!use_dma || !_feed_dma(p, len)) {
+        if (use_dma) {
+            _configure(mode);   // DMA 실패: CPU로 처음부터
+        }
+        _feed_cpu(p, len);
+    }
+    uint32_t crc = CRC->DR;
+
+    _unlock(locked);
+    return crc;
+}
+
+uint16_t Checksum_Crc16(const void* data, size_t len)
+{
+    if (data == NULL || len == 0) {
+        return CRC16_INIT;
+    }
+    return (uint16_t)_calculate(CRC_MODE_16, data, len);
+}
+
+uint32_t Checksum_Crc32(const void* data, size_t len)
+{
+    if (data == NULL || len == 0) {
+        return CRC32_INIT;
+    }
+    return _calculate(CRC_MODE_32, data, len);
+}
+
+#else
+// ============================================================================
+// 호스트: slicing-by-4 테이블
+//   T0[i] = 바이트 i 하나의 CRC, Tk[i] = T(k-1)[i] 뒤에 0 바이트 하나를 더 넣은 CRC
+//   4바이트를 상태와 XOR한 뒤 각 바이트를 남은 바이트 수에 맞는 테이블로 조회
+// ============================================================================
+
+static uint16_t g_crc16_table[4][256];
+static uint32_t g_crc32_table[4][256];
+static bool g_tables_ready = false;
+
+static void _build_tables(void)
+{
+    for (uint32_t i = 0; i < 256; i++) {
+        uint16_t crc16 = (uint16_t)(i << 8);
+        uint32_t crc32 = i << 24;
+        for (int bit = 0; bit < 8; bit++) {
+            crc16 = (crc16 & 0x8000U) ? (uint16_t)((crc16 << 1) ^ CRC16_POLY) : (uint16_t)(crc16 << 1);
+            crc32 = (crc32 & 0x80000000UL) ? (crc32 << 1) ^ CRC32_POLY : (crc32 << 1);
+        }
+        g_crc16_table[0][i] = crc16;
+        g_crc32_table[0][i] = crc32;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        for (int k = 1; k < 4; k++) {
+            uint16_t prev16 = g_crc16_table[k - 1][i];
+            uint32_t prev32 = g_crc32_table[k - 1][i];
+            g_crc16_table[k][i] = (uint16_t)((prev16 << 8) ^ g_crc16_table[0][prev16 >> 8]);
+            g_crc32_table[k][i] = (prev32 << 8) ^ g_crc32_table[0][prev32 >> 24];
+        }
+    }
+    g_tables_ready = true;
+}
+
+void Checksum_Init(void)
+{
+    if (!g_tables_ready) {
+        _build_tables();
+    }
+}
+
+uint16_t Checksum_Crc16(const void* data, size_t len)
+{
+    if (data == NULL) {
+        return CRC16_INIT;
+    }
+    if (!g_tables_ready) {
+        _build_tables();
+    }
+
+    const uint8_t* p = (const uint8_t*)data;
+    uint16_t crc = CRC16_INIT;
+    while (len >= 4) {
+        crc = (uint16_t)(g_crc16_table[3][(crc >> 8) ^ p[0]] ^ g_crc16_table[2][(crc & 0xFFU) ^ p[1]] ^
+                         g_crc16_table[1][p[2]] ^ g_crc16_table[0][p[3]]);
+        p += 4;
+        len -= 4;
+    }
+    while (len > 0) {
+        crc = (uint16_t)((crc << 8) ^ g_crc16_table[0][(crc >> 8) ^ *p++]);
+        len--;
+    }
+    return crc;
+}
+
+uint32_t Checksum_Crc32(const void* data, size_t len)
+{
+    if (data == NULL) {
+        return CRC32_INIT;
+    }
+    if (!g_tables_ready) {
+        _build_tables();
+    }
+
+    const uint8_t* p = (const uint8_t*)data;
+    uint32_t crc = CRC32_INIT;
+    while (len >= 4) {
+        crc ^= ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+        crc = g_crc32_table[3][crc >> 24] ^ g_crc32_table[2][(crc >> 16) & 0xFFU] ^
+              g_crc32_table[1][(crc >> 8) & 0xFFU] ^ g_crc32_table[0][crc & 0xFFU];
+        p += 4;
+        len -= 4;
+    }
+    while (len > 0) {
+        crc = (crc << 8) ^ g_crc32_table[0][(crc >> 24) ^ *p++];
+        len--;
+    }
+    return crc;
+}
+
+#endif
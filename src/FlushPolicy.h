@@ -0,0 +1,50 @@
+#ifndef FLUSHPOLICY_H
+#define FLUSHPOLICY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// SD f_sync 묶음 크기/주기 적응 정책
+//
+// f_sync마다 그 사이 f_write 최대 지연, f_sync 지연, 밀린 요청 수를 반영:
+//   카드 stall(지연 >= stall_us) 또는 밀린 요청 >= backlog_high
+//     -> 바이트 임계값/주기 2배 (상한: 최대 손실 바이트/시간)
+//   밀린 요청 없음 + 평균 f_sync 지연 < stall_us / 4
+//     -> 3/4로 축소 (하한: 최소값, 한가할 때 손실 최소화)
+//   그 외 유지
+// 상한은 RuntimeSDCardConfig의 기존 sync_bytes_threshold/sync_interval_ms (내구성 한계)
+
+typedef struct {
+    uint32_t bytes_min;
+    uint32_t bytes_max;
+    uint32_t interval_min_ms;
+    uint32_t interval_max_ms;
+    uint32_t stall_us;          // 이 이상 걸린 f_write/f_sync는 stall
+    uint32_t backlog_high;      // 이 이상 밀린 요청이면 묶음 확대
+} FlushPolicyConfig;
+
+typedef enum {
+    FLUSH_POLICY_HOLD = 0,
+    FLUSH_POLICY_GROW,
+    FLUSH_POLICY_SHRINK
+} FlushPolicyAction;
+
+typedef struct {
+    uint32_t bytes;             // 현재 f_sync 바이트 임계값
+    uint32_t interval_ms;       // 현재 f_sync 주기
+    uint32_t sync_ewma_us;      // f_sync 지연 이동 평균 (1/8 가중)
+    uint32_t backlog;           // 마지막으로 보고된 밀린 요청 수
+    uint32_t grows;
+    uint32_t shrinks;
+} FlushPolicy;
+
+// 최소값에서 시작 (부팅 직후 한가한 상태 가정)
+void FlushPolicy_Init(FlushPolicy* policy, const FlushPolicyConfig* config);
+
+void FlushPolicy_SetBacklog(FlushPolicy* policy, uint32_t backlog);
+
+// f_sync 1회 결과 반영 (설정이 바뀌었으면 새 범위로 맞춤)
+FlushPolicyAction FlushPolicy_OnSync(FlushPolicy* policy, const FlushPolicyConfig* config,
+                                     uint32_t max_write_us, uint32_t sync_us);
+
+#endif // FLUSHPOLICY_H
@@ -0,0 +1,275 @@
+#include "LogCompress.h"
+#include <string.h>
+
+// ============================================================================
+// 압축
+// ============================================================================
+
+static inline uint32_t _hash3(const uint8_t* p)
+{
+    uint32_t v = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+    return (v * 2654435761U) >> (32 - LOG_COMPRESS_HASH_BITS);
+}
+
+static void _close_literal(LogCompressor* c)
+{
+    c->literal_count = 0;
+}
+
+static void _emit_literal(LogCompressor* c, uint8_t byte)
+{
+    if (c->literal_count == 0) {
+        c->literal_pos = c->block_len++;
+    }
+    c->block[c->block_len++] = byte;
+    c->block[c->literal_pos] = (uint8_t)c->literal_count;
+    c->literal_count++;
+    if (c->literal_count == 128) {
+        _close_literal(c);
+    }
+}
+
+static void _emit_match(LogCompressor* c, uint32_t offset, uint32_t length)
+{
+    _close_literal(c);
+
+    uint32_t o = offset - 1;
+    uint32_t l = length - LOG_COMPRESS_MIN_MATCH;
+    uint8_t len_field = (l < 15) ? (uint8_t)l : 15;
+
+    c->block[c->block_len++] = (uint8_t)(0x80 | (len_field << 3) | (o >> 8));
+    c->block[c->block_len++] = (uint8_t)(o & 0xFF);
+    if (len_field == 15) {
+        c->block[c->block_len++] = (uint8_t)(length - 18);
+    }
+}
+
+void LogCompress_Init(LogCompressor* c)
+{
+    if (c == NULL) {
+        return;
+    }
+    memset(c->hash, 0, sizeof(c->hash));
+    c->window_len = 0;
+    c->window_base = 0;
+    c->block_len = LOG_COMPRESS_HEADER_SIZE;
+    c->raw_len = 0;
+    c->literal_pos = 0;
+    c->literal_count = 0;
+}
+
+bool LogCompress_HasRoom(const LogCompressor* c, size_t len)
+{
+    // 최악의 경우: 전부 리터럴 (128바이트마다 토큰 1개 + 열린 토큰 1개)
+    size_t worst = len + len / 128 + 2;
+    return (c->block_len + worst <= LOG_COMPRESS_BLOCK_SIZE) &&
+           (c->raw_len + len <= 0xFFFF);
+}
+
+// 윈도우에 새 입력을 넣을 공간 확보 (최근 WINDOW_SIZE 바이트만 유지)
+static void _slide_window(LogCompressor* c, size_t incoming)
+{
+    if (c->window_len + incoming <= sizeof(c->window)) {
+        return;
+    }
+    uint32_t drop = c->window_len - LOG_COMPRESS_WINDOW_SIZE;
+    memmove(c->window, c->window + drop, LOG_COMPRESS_WINDOW_SIZE);
+    c->window_base += drop;
+    c->window_len = LOG_COMPRESS_WINDOW_SIZE;
+}
+
+static void _compress_chunk(LogCompressor* c, const uint8_t* data, size_t len)
+{
+    _slide_window(c, len);
+    memcpy(c->window + c->window_len, data, len);
+
+    uint32_t p = c->window_len;
+    uint32_t end = c->window_len + (uint32_t)len;
+    const uint8_t* w = c->window;
+
+    while (p < end) {
+        uint32_t best_len = 0;
+        uint32_t best_offset = 0;
+
+        if (end - p >= LOG_COMPRESS_MIN_MATCH) {
+            uint32_t h = _hash3(&w[p]);
+            uint32_t candidate = c->hash[h];
+            uint32_t abs_pos = c->window_base + p;
+            c->hash[h] = abs_pos + 1;
+
+            if (candidate != 0) {
+                uint32_t cand_abs = candidate - 1;
+                uint32_t offset = abs_pos - cand_abs;
+                if (cand_abs >= c->window_base && offset <= LOG_COMPRESS_WINDOW_SIZE) {
+                    const uint8_t* src = &w[cand_abs - c->window_base];
+                    uint32_t max_len = end - p;
+                    if (max_len > LOG_COMPRESS_MAX_MATCH) {
+                        max_len = LOG_COMPRESS_MAX_MATCH;
+                    }
+                    uint32_t n = 0;
+                    while (n < max_len && src[n] == w[p + n]) {
+                        n++;
+                    }
+                    if (n >= LOG_COMPRESS_MIN_MATCH) {
+                        best_len = n;
+                        best_offset = offset;
+                    }
+                }
+            }
+        }
+
+        if (best_len > 0) {
+            _emit_match(c, best_offset, best_len);
+            // 매치 내부 위치도 해시에 등록 (다음 매치 후보)
+            for (uint32_t i = 1; i < best_len && p + i + LOG_COMPRESS_MIN_MATCH <= end; i++) {
+                c->hash[_hash3(&w[p + i])] = c->window_base + p + i + 1;
+            }
+            p += best_len;
+        } else {
+            _emit_literal(c, w[p]);
+            p++;
+        }
+    }
+
+    c->window_len = end;
+    c->raw_len += (uint32_t)len;
+}
+
+int LogCompress_Write(LogCompressor* c, const void* data, size_t len)
+{
+    if (c == NULL || (data == NULL && len > 0)) {
+        return LOG_COMPRESS_ERROR;
+    }
+    if (!LogCompress_HasRoom(c, len)) {
+        return LOG_COMPRESS_NO_ROOM;
+    }
+
+    // 윈도우 크기 단위로 나눠서 처리
+    const uint8_t* p = (const uint8_t*)data;
+    while (len > 0) {
+        size_t chunk = (len > LOG_COMPRESS_WINDOW_SIZE) ? LOG_COMPRESS_WINDOW_SIZE : len;
+        _compress_chunk(c, p, chunk);
+        p += chunk;
+        len -= chunk;
+    }
+    return LOG_COMPRESS_OK;
+}
+
+size_t LogCompress_PendingRaw(const LogCompressor* c)
+{
+    return (c != NULL) ? c->raw_len : 0;
+}
+
+size_t LogCompress_Flush(LogCompressor* c, const uint8_t** block)
+{
+    if (c == NULL || block == NULL || c->raw_len == 0) {
+        return 0;
+    }
+
+    _close_literal(c);
+
+    uint32_t payload_len = c->block_len - LOG_COMPRESS_HEADER_SIZE;
+    c->block[0] = LOG_COMPRESS_BLOCK_MAGIC;
+    c->block[1] = 0;
+    c->block[2] = (uint8_t)(payload_len & 0xFF);
+    c->block[3] = (uint8_t)(payload_len >> 8);
+    c->block[4] = (uint8_t)(c->raw_len & 0xFF);
+    c->block[5] = (uint8_t)(c->raw_len >> 8);
+
+    size_t size = c->block_len;
+    *block = c->block;
+
+    // 다음 블록 준비 (히스토리는 유지)
+    c->block_len = LOG_COMPRESS_HEADER_SIZE;
+    c->raw_len = 0;
+    return size;
+}
+
+// ============================================================================
+// 복원
+// ============================================================================
+
+void LogDecompress_Init(LogDecompressor* d)
+{
+    if (d != NULL) {
+        d->total = 0;
+    }
+}
+
+static inline void _put(LogDecompressor* d, uint8_t* out, size_t* n, uint8_t byte)
+{
+    out[(*n)++] = byte;
+    d->history[d->total & (LOG_COMPRESS_WINDOW_SIZE - 1)] = byte;
+    d->total++;
+}
+
+int LogDecompress_Block(LogDecompressor* d, const uint8_t* in, size_t in_len, size_t* consumed,
+                        uint8_t* out, size_t out_max, size_t* out_len)
+{
+    if (d == NULL || in == NULL || consumed == NULL || out == NULL || out_len == NULL) {
+        return LOG_COMPRESS_ERROR;
+    }
+    *consumed = 0;
+    *out_len = 0;
+
+    if (in_len < LOG_COMPRESS_HEADER_SIZE) {
+        return LOG_COMPRESS_TRUNCATED;
+    }
+    if (in[0] != LOG_COMPRESS_BLOCK_MAGIC) {
+        return LOG_COMPRESS_CORRUPT;
+    }
+
+    size_t payload_len = (size_t)in[2] | ((size_t)in[3] << 8);
+    size_t raw_len = (size_t)in[4] | ((size_t)in[5] << 8);
+    if (LOG_COMPRESS_HEADER_SIZE + payload_len > in_len) {
+        return LOG_COMPRESS_TRUNCATED;
+    }
+    if (raw_len > out_max) {
+        return LOG_COMPRESS_ERROR;
+    }
+
+    const uint8_t* p = in + LOG_COMPRESS_HEADER_SIZE;
+    const uint8_t* end = p + payload_len;
+    size_t n = 0;
+
+    while (p < end) {
+        uint8_t token = *p++;
+        if ((token & 0x80) == 0) {
+            size_t count = (size_t)token + 1;
+            if ((size_t)(end - p) < count || n + count > raw_len) {
+                return LOG_COMPRESS_CORRUPT;
+            }
+            for (size_t i = 0; i < count; i++) {
+                _put(d, out, &n, p[i]);
+            }
+            p += count;
+        } else {
+            if (p >= end) {
+                return LOG_COMPRESS_CORRUPT;
+            }
+            uint32_t offset = ((((uint32_t)token & 0x07) << 8) | *p++) + 1;
+            uint32_t length = ((token >> 3) & 0x0F) + LOG_COMPRESS_MIN_MATCH;
+            if (length == 18) {
+                if (p >= end) {
+                    return LOG_COMPRESS_CORRUPT;
+                }
+                length = 18 + *p++;
+            }
+            if (offset > d->total || offset > LOG_COMPRESS_WINDOW_SIZE || n + length > raw_len) {
+                return LOG_COMPRESS_CORRUPT;
+            }
+            for (uint32_t i = 0; i < length; i++) {
+                uint8_t byte = d->history[(d->total - offset) & (LOG_COMPRESS_WINDOW_SIZE - 1)];
+                _put(d, out, &n, byte);
+            }
+        }
+    }
+
+    if (n != raw_len) {
+        return LOG_COMPRESS_CORRUPT;
+    }
+
+    *consumed = LOG_COMPRESS_HEADER_SIZE + payload_len;
+    *out_len = n;
+    return LOG_COMPRESS_OK;
+}
@@ -0,0 +1,75 @@
+#ifndef LOGCOMPRESS_H
+#define LOGCOMPRESS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// SD 로그용 스트리밍 LZ77 압축 (정적 메모리, 작은 윈도우)
+//
+// 파일은 블록의 연속이며 각 블록은 flush 시점(f_sync)에 맞춰 끝남:
+//   [0xC5][flags][payload_len u16 LE][raw_len u16 LE][payload...]
+// 블록은 이전 블록의 히스토리를 참조할 수 있으므로 파일 처음부터 순서대로 풀어야 함.
+// 전원 차단으로 마지막 블록이 잘려도 그 이전 블록까지는 복원 가능.
+//
+// payload 토큰:
+//   0LLLLLLL                     : 리터럴 L+1개 (1~128) 뒤따름
+//   1LLLLOOO OOOOOOOO [EXT]      : 매치, offset = O+1 (1~2048)
+//                                  length = L+3 (L<15) 또는 18+EXT (L=15)
+
+#define LOG_COMPRESS_WINDOW_BITS    11
+#define LOG_COMPRESS_WINDOW_SIZE    (1U << LOG_COMPRESS_WINDOW_BITS)
+#define LOG_COMPRESS_HASH_BITS      10
+#define LOG_COMPRESS_HASH_SIZE      (1U << LOG_COMPRESS_HASH_BITS)
+#define LOG_COMPRESS_BLOCK_SIZE     4096    // 블록 최대 크기 (헤더 포함)
+#define LOG_COMPRESS_HEADER_SIZE    6
+#define LOG_COMPRESS_BLOCK_MAGIC    0xC5
+#define LOG_COMPRESS_MIN_MATCH      3
+#define LOG_COMPRESS_MAX_MATCH      (18 + 255)
+
+// 결과 코드
+#define LOG_COMPRESS_OK              0
+#define LOG_COMPRESS_ERROR          -1
+#define LOG_COMPRESS_NO_ROOM        -2   // 블록 공간 부족 (Flush 후 재시도)
+#define LOG_COMPRESS_CORRUPT        -3   // 잘못된 블록/토큰
+#define LOG_COMPRESS_TRUNCATED      -4   // 블록이 중간에 잘림
+
+typedef struct {
+    uint8_t  window[LOG_COMPRESS_WINDOW_SIZE * 2];  // 히스토리 + 새 입력
+    uint32_t window_len;
+    uint32_t window_base;                            // window[0]의 스트림 절대 위치
+    uint32_t hash[LOG_COMPRESS_HASH_SIZE];           // 절대 위치 + 1 (0: 비어있음)
+    uint8_t  block[LOG_COMPRESS_BLOCK_SIZE];
+    uint32_t block_len;
+    uint32_t raw_len;                                // 현재 블록의 원본 바이트 수
+    uint32_t literal_pos;                            // 열린 리터럴 토큰 위치
+    uint32_t literal_count;                          // 0이면 열린 리터럴 없음
+} LogCompressor;
+
+typedef struct {
+    uint8_t  history[LOG_COMPRESS_WINDOW_SIZE];
+    uint32_t total;                                  // 지금까지 복원된 바이트 수
+} LogDecompressor;
+
+// 압축기 초기화 (새 파일 시작 시에도 호출)
+void LogCompress_Init(LogCompressor* c);
+
+// 현재 블록에 len 바이트를 더 넣을 수 있는지 (최악의 경우 기준)
+bool LogCompress_HasRoom(const LogCompressor* c, size_t len);
+
+// 입력을 현재 블록에 압축 (공간 부족 시 LOG_COMPRESS_NO_ROOM)
+int LogCompress_Write(LogCompressor* c, const void* data, size_t len);
+
+// 현재 블록의 원본 바이트 수
+size_t LogCompress_PendingRaw(const LogCompressor* c);
+
+// 현재 블록을 마감하고 블록 데이터 반환 (비어있으면 0)
+size_t LogCompress_Flush(LogCompressor* c, const uint8_t** block);
+
+void LogDecompress_Init(LogDecompressor* d);
+
+// 블록 하나를 복원: in에서 블록 1개를 읽고 consumed/out_len 갱신
+int LogDecompress_Block(LogDecompressor* d, const uint8_t* in, size_t in_len, size_t* consumed,
+                        uint8_t* out, size_t out_max, size_t* out_len);
+
+#endif // LOGCOMPRESS_H
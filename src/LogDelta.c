@@ -0,0 +1,291 @@
+#include "LogDelta.h"
+#include <string.h>
+
+#define VARINT_MAX_BYTES    10
+
+static size_t _put_varint(uint8_t* p, uint64_t v)
+{
+    size_t n = 0;
+    while (v >= 0x80) {
+        p[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    p[n++] = (uint8_t)v;
+    return n;
+}
+
+// 성공 시 사용한 바이트 수, 실패 시 에러 코드
+static int _get_varint(const uint8_t* p, size_t len, uint64_t* v)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < VARINT_MAX_BYTES; i++) {
+        if (i >= len) {
+            return LOG_DELTA_TRUNCATED;
+        }
+        value |= (uint64_t)(p[i] & 0x7F) << (7 * i);
+        if ((p[i] & 0x80) == 0) {
+            *v = value;
+            return (int)(i + 1);
+        }
+    }
+    return LOG_DELTA_CORRUPT;
+}
+
+static uint64_t _zigzag(int64_t v)
+{
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+static int64_t _unzigzag(uint64_t v)
+{
+    return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+// 두 4비트 값을 한 바이트로, 하나라도 15 이상이면 escape
+static size_t _put_nibbles(uint8_t* p, uint32_t low, uint32_t high, bool varint_escape)
+{
+    if (low < 0x0F && high < 0x0F) {
+        p[0] = (uint8_t)(low | (high << 4));
+        return 1;
+    }
+    size_t n = 0;
+    p[n++] = LOG_DELTA_ESCAPE;
+    if (varint_escape) {
+        n += _put_varint(&p[n], low);
+        n += _put_varint(&p[n], high);
+    } else {
+        p[n++] = (uint8_t)low;
+        p[n++] = (uint8_t)high;
+    }
+    return n;
+}
+
+void LogDelta_Begin(LogDeltaCodec* codec, uint32_t frame_timestamp_ms)
+{
+    if (codec == NULL) {
+        return;
+    }
+    memset(&codec->prev, 0, sizeof(codec->prev));
+    codec->prev.timestamp_ms = frame_timestamp_ms;
+}
+
+size_t LogDelta_Encode(LogDeltaCodec* codec, const LogDeltaRecord* record, uint8_t* out, size_t max)
+{
+    if (codec == NULL || record == NULL || out == NULL || max < LOG_DELTA_MAX_RECORD) {
+        return 0;
+    }
+
+    const LogDeltaRecord* prev = &codec->prev;
+    uint32_t dt = record->timestamp_ms - prev->timestamp_ms;
+    uint16_t send_delta = (uint16_t)(record->send_count - prev->send_count);
+    uint16_t error_delta = (uint16_t)(record->error_count - prev->error_count);
+    uint8_t extra = 0;
+    uint8_t flags = 0;
+
+    if (send_delta != 0 || error_delta != 0) {
+        flags |= LOG_DELTA_FLAG_COUNTERS;
+    }
+    if (record->state_duration != dt) {
+        flags |= LOG_DELTA_FLAG_DURATION;
+    }
+    if (record->device_id != prev->device_id) {
+        extra |= LOG_DELTA_EXTRA_DEVICE_ID;
+    }
+    if (record->error_code != prev->error_code) {
+        extra |= LOG_DELTA_EXTRA_ERROR_CODE;
+    }
+    if (extra != 0) {
+        flags |= LOG_DELTA_FLAG_EXTRA;
+    }
+
+    size_t n = _put_nibbles(out, record->new_state, record->old_state, false);
+    n += _put_varint(&out[n], ((uint64_t)dt << LOG_DELTA_FLAG_BITS) | flags);
+    if (flags & LOG_DELTA_FLAG_COUNTERS) {
+        n += _put_nibbles(&out[n], send_delta, error_delta, true);
+    }
+    if (flags & LOG_DELTA_FLAG_DURATION) {
+        n += _put_varint(&out[n], _zigzag((int64_t)record->state_duration - (int64_t)dt));
+    }
+    if (flags & LOG_DELTA_FLAG_EXTRA) {
+        out[n++] = extra;
+        if (extra & LOG_DELTA_EXTRA_DEVICE_ID) {
+            out[n++] = record->device_id;
+        }
+        if (extra & LOG_DELTA_EXTRA_ERROR_CODE) {
+            out[n++] = record->error_code;
+        }
+    }
+
+    codec->prev = *record;
+    codec->prev.raw = NULL;
+    codec->prev.raw_len = 0;
+    return n;
+}
+
+size_t LogDelta_EncodeRaw(const void* packet, size_t size, uint8_t* out, size_t max)
+{
+    if (packet == NULL || out == NULL || size == 0 || size > 0xFF || max < LOG_DELTA_RAW_PREFIX + size) {
+        return 0;
+    }
+    out[0] = LOG_DELTA_RAW;
+    out[1] = (uint8_t)size;
+    if (packet != &out[LOG_DELTA_RAW_PREFIX]) {
+        memcpy(&out[LOG_DELTA_RAW_PREFIX], packet, size);
+    }
+    return LOG_DELTA_RAW_PREFIX + size;
+}
+
+// _put_nibbles의 역. 성공 시 사용한 바이트 수
+static int _get_nibbles(const uint8_t* p, size_t len, uint32_t* low, uint32_t* high, bool varint_escape)
+{
+    if (len < 1) {
+        return LOG_DELTA_TRUNCATED;
+    }
+    if (p[0] != LOG_DELTA_ESCAPE) {
+        *low = p[0] & 0x0F;
+        *high = p[0] >> 4;
+        return (*low == 0x0F || *high == 0x0F) ? LOG_DELTA_CORRUPT : 1;
+    }
+
+    if (!varint_escape) {
+        if (len < 3) {
+            return LOG_DELTA_TRUNCATED;
+        }
+        *low = p[1];
+        *high = p[2];
+        return 3;
+    }
+
+    uint64_t a;
+    uint64_t b;
+    int n1 = _get_varint(&p[1], len - 1, &a);
+    if (n1 < 0) {
+        return n1;
+    }
+    int n2 = _get_varint(&p[1 + n1], len - 1 - (size_t)n1, &b);
+    if (n2 < 0) {
+        return n2;
+    }
+    if (a > 0xFFFF || b > 0xFFFF) {
+        return LOG_DELTA_CORRUPT;
+    }
+    *low = (uint32_t)a;
+    *high = (uint32_t)b;
+    return 1 + n1 + n2;
+}
+
+int LogDelta_Decode(LogDeltaCodec* codec, const uint8_t* data, size_t len, LogDeltaRecord* record)
+{
+    if (codec == NULL || data == NULL || record == NULL) {
+        return LOG_DELTA_ERROR;
+    }
+
+    if (len > 0 && data[0] == LOG_DELTA_RAW) {
+        if (len < LOG_DELTA_RAW_PREFIX || len < LOG_DELTA_RAW_PREFIX + (size_t)data[1]) {
+            return LOG_DELTA_TRUNCATED;
+        }
+        if (data[1] == 0) {
+            return LOG_DELTA_CORRUPT;
+        }
+        *record = codec->prev;
+        record->raw = &data[LOG_DELTA_RAW_PREFIX];
+        record->raw_len = data[1];
+        return LOG_DELTA_RAW_PREFIX + data[1];
+    }
+
+    LogDeltaRecord rec = codec->prev;
+    rec.raw = NULL;
+    rec.raw_len = 0;
+    size_t n = 0;
+    uint32_t new_state;
+    uint32_t old_state;
+    int used = _get_nibbles(data, len, &new_state, &old_state, false);
+    if (used < 0) {
+        return used;
+    }
+    n += (size_t)used;
+    rec.old_state = (uint8_t)old_state;
+    rec.new_state = (uint8_t)new_state;
+
+    uint64_t head;
+    used = _get_varint(&data[n], len - n, &head);
+    if (used < 0) {
+        return used;
+    }
+    n += (size_t)used;
+    uint8_t flags = (uint8_t)(head & ((1U << LOG_DELTA_FLAG_BITS) - 1));
+    uint64_t dt = head >> LOG_DELTA_FLAG_BITS;
+    if (dt > 0xFFFFFFFFULL) {
+        return LOG_DELTA_CORRUPT;
+    }
+    rec.timestamp_ms = codec->prev.timestamp_ms + (uint32_t)dt;
+    rec.state_duration = (uint32_t)dt;
+
+    if (flags & LOG_DELTA_FLAG_COUNTERS) {
+        uint32_t send_delta;
+        uint32_t error_delta;
+        used = _get_nibbles(&data[n], len - n, &send_delta, &error_delta, true);
+        if (used < 0) {
+            return used;
+        }
+        n += (size_t)used;
+        rec.send_count = (uint16_t)(rec.send_count + send_delta);
+        rec.error_count = (uint16_t)(rec.error_count + error_delta);
+    }
+    if (flags & LOG_DELTA_FLAG_DURATION) {
+        uint64_t zz;
+        used = _get_varint(&data[n], len - n, &zz);
+        if (used < 0) {
+            return used;
+        }
+        n += (size_t)used;
+        rec.state_duration = (uint32_t)((int64_t)dt + _unzigzag(zz));
+    }
+    if (flags & LOG_DELTA_FLAG_EXTRA) {
+        if (n >= len) {
+            return LOG_DELTA_TRUNCATED;
+        }
+        uint8_t extra = data[n++];
+        if (extra == 0 || (extra & ~(LOG_DELTA_EXTRA_DEVICE_ID | LOG_DELTA_EXTRA_ERROR_CODE)) != 0) {
+            return LOG_DELTA_CORRUPT;
+        }
+        if (extra & LOG_DELTA_EXTRA_DEVICE_ID) {
+            if (n >= len) {
+                return LOG_DELTA_TRUNCATED;
+            }
+            rec.device_id = data[n++];
+        }
+        if (extra & LOG_DELTA_EXTRA_ERROR_CODE) {
+            if (n >= len) {
+                return LOG_DELTA_TRUNCATED;
+            }
+            rec.error_code = data[n++];
+        }
+    }
+
+    codec->prev = rec;
+    *record = rec;
+    return (int)n;
+}
+
+bool LogDelta_NextRecord(const LogFrameHeader* header, LogDeltaCodec* codec,
+                         size_t* offset, LogDeltaRecord* record)
+{
+    if (header == NULL || codec == NULL || offset == NULL || record == NULL ||
+        header->version != LOG_FRAME_VERSION_DELTA) {
+        return false;
+    }
+    if (*offset == 0) {
+        LogDelta_Begin(codec, header->first_timestamp_ms);
+    }
+    if (*offset >= header->payload_length) {
+        return false;
+    }
+
+    int used = LogDelta_Decode(codec, &header->payload[*offset], header->payload_length - *offset, record);
+    if (used <= 0) {
+        return false;
+    }
+    *offset += (size_t)used;
+    return true;
+}
@@ -0,0 +1,85 @@
+#ifndef LOGDELTA_H
+#define LOGDELTA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "LogFrame.h"
+
+// 상태 변경 레코드 v2 - 프레임 안에서 직전 레코드와의 차이만 기록 (LOG_FRAME_VERSION_DELTA 프레임)
+//
+// 레코드 형식:
+//   [states u8]        (old_state << 4) | new_state
+//                      둘 중 하나라도 15 이상이면 0xFF 뒤에 [new u8][old u8]
+//   [head varint]      (dt << 3) | flags - dt는 직전 레코드와의 시각 차이 (ms)
+//   flags bit0 COUNTERS: [counters u8] (send_delta | error_delta << 4), 카운터 차이는 u16 모듈로
+//                      둘 중 하나라도 15 이상이면 0xFF 뒤에 [send_delta varint][error_delta varint]
+//   flags bit1 DURATION: [zigzag varint] state_duration - dt (없으면 state_duration == dt)
+//   flags bit2 EXTRA:    [extra u8] bit0이면 [device_id u8], bit1이면 [error_code u8]이 이어짐
+// varint는 LEB128 (7비트씩, 하위 먼저)
+//
+// 상태 변경이 아닌 패킷(heartbeat/에러 로그)은 [0xFE][length u8][패킷 바이트]로 그대로 담음
+// (첫 바이트 packet_type, 상태 바이트 0xFE는 상위 nibble이 15라 상태 변경과 겹치지 않음)
+// 이 레코드는 차이 기준(직전 상태 변경 레코드)을 바꾸지 않음
+//
+// 프레임 첫 레코드 직전 상태는 시각 = 프레임 first_timestamp_ms, 나머지 0 (LogDelta_Begin)
+// 레코드별 체크섬은 없음 - 프레임 CRC가 대신함
+// 일반적인 전이(상태 1개 + dt 2~3바이트 + 카운터 0~1바이트)는 3~5바이트
+
+#define LOG_DELTA_MAX_RECORD        24      // 모든 필드가 바뀌고 escape를 쓸 때의 최대 크기
+
+#define LOG_DELTA_FLAG_COUNTERS     0x01
+#define LOG_DELTA_FLAG_DURATION     0x02
+#define LOG_DELTA_FLAG_EXTRA        0x04
+#define LOG_DELTA_FLAG_BITS         3
+
+#define LOG_DELTA_EXTRA_DEVICE_ID   0x01
+#define LOG_DELTA_EXTRA_ERROR_CODE  0x02
+
+#define LOG_DELTA_ESCAPE            0xFF
+#define LOG_DELTA_RAW               0xFE
+#define LOG_DELTA_RAW_PREFIX        2
+
+// 결과 코드 (LogFrame과 같은 값)
+#define LOG_DELTA_OK                0
+#define LOG_DELTA_ERROR            -1
+#define LOG_DELTA_CORRUPT          -3   // 잘못된 escape/flag 또는 varint 범위 초과
+#define LOG_DELTA_TRUNCATED        -4   // 레코드가 중간에 잘림
+
+typedef struct {
+    uint32_t timestamp_ms;
+    uint8_t device_id;
+    uint8_t old_state;
+    uint8_t new_state;
+    uint32_t state_duration;
+    uint16_t error_count;
+    uint16_t send_count;
+    uint8_t error_code;
+    const uint8_t* raw;         // 디코딩 시 그대로 담긴 패킷이면 입력 버퍼 안을 가리킴 (상태 변경이면 NULL)
+    uint8_t raw_len;
+} LogDeltaRecord;
+
+// 인코더/디코더 공통 상태 (직전 레코드)
+typedef struct {
+    LogDeltaRecord prev;
+} LogDeltaCodec;
+
+// 새 프레임 시작 - 직전 레코드를 초기 상태로
+void LogDelta_Begin(LogDeltaCodec* codec, uint32_t frame_timestamp_ms);
+
+// 레코드 하나를 out에 기록하고 크기 반환 (max < LOG_DELTA_MAX_RECORD면 0)
+size_t LogDelta_Encode(LogDeltaCodec* codec, const LogDeltaRecord* record, uint8_t* out, size_t max);
+
+// 패킷을 그대로 담는 레코드 기록, 크기 반환 (max가 모자라거나 size가 0/255 초과면 0)
+// packet이 out + LOG_DELTA_RAW_PREFIX이면 복사하지 않음 (패킷을 그 자리에 먼저 작성)
+size_t LogDelta_EncodeRaw(const void* packet, size_t size, uint8_t* out, size_t max);
+
+// data 앞의 레코드 하나를 복원 (그대로 담긴 패킷이면 record->raw만 바뀜). 성공 시 사용한 바이트 수, 실패 시 LOG_DELTA_CORRUPT/TRUNCATED
+int LogDelta_Decode(LogDeltaCodec* codec, const uint8_t* data, size_t len, LogDeltaRecord* record);
+
+// version 2 프레임 payload 안의 다음 레코드 (*offset을 진행)
+// *offset이 0이면 프레임 헤더로 codec을 초기화. 끝이거나 손상됐으면 false
+bool LogDelta_NextRecord(const LogFrameHeader* header, LogDeltaCodec* codec,
+                         size_t* offset, LogDeltaRecord* record);
+
+#endif // LOGDELTA_H
@@ -0,0 +1,248 @@
+#include "LogFrame.h"
+#include "Checksum.h"
+#include <string.h>
+
+static void _put_u16(uint8_t* p, uint16_t v)
+{
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void _put_u32(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)((v >> 8) & 0xFF);
+    p[2] = (uint8_t)((v >> 16) & 0xFF);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint16_t _get_u16(const uint8_t* p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t _get_u32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void _reset(LogFrame* frame)
+{
+    frame->used = LOG_FRAME_HEADER_SIZE;
+    frame->reserved = 0;
+    frame->record_count = 0;
+    frame->opened_ms = 0;
+}
+
+void LogFrame_Init(LogFrame* frame, LogFrameSink sink, size_t max_size, uint32_t max_age_ms)
+{
+    if (frame == NULL) {
+        return;
+    }
+    memset(frame, 0, sizeof(*frame));
+    if (max_size > LOG_FRAME_MAX_SIZE) {
+        max_size = LOG_FRAME_MAX_SIZE;
+    }
+    if (max_size < LOG_FRAME_OVERHEAD + LOG_FRAME_RECORD_PREFIX + 1) {
+        max_size = LOG_FRAME_OVERHEAD + LOG_FRAME_RECORD_PREFIX + 1;
+    }
+    frame->sink = sink;
+    frame->max_size = max_size;
+    frame->max_age_ms = max_age_ms;
+    frame->version = LOG_FRAME_VERSION;
+    _reset(frame);
+}
+
+int LogFrame_SetVersion(LogFrame* frame, uint8_t version)
+{
+    if (frame == NULL || frame->record_count > 0 || frame->reserved > 0 ||
+        (version != LOG_FRAME_VERSION && version != LOG_FRAME_VERSION_DELTA)) {
+        return LOG_FRAME_ERROR;
+    }
+    frame->version = version;
+    return LOG_FRAME_OK;
+}
+
+// 레코드 앞 길이 바이트 (version 2는 없음)
+static size_t _prefix(const LogFrame* frame)
+{
+    return (frame->version == LOG_FRAME_VERSION) ? LOG_FRAME_RECORD_PREFIX : 0;
+}
+
+bool LogFrame_IsEmpty(const LogFrame* frame)
+{
+    return frame == NULL || frame->record_count == 0;
+}
+
+// 헤더/CRC를 채워 sink로 전송 (성공/실패와 관계없이 프레임은 비움)
+static int _send(LogFrame* frame, uint32_t* reason_counter)
+{
+    if (frame->record_count == 0) {
+        return LOG_FRAME_OK;
+    }
+
+    uint8_t* buf = frame->buffer;
+    buf[0] = LOG_FRAME_MAGIC;
+    buf[1] = frame->version;
+    _put_u16(&buf[2], frame->next_seq++);
+    _put_u16(&buf[4], frame->record_count);
+    _put_u16(&buf[6], (uint16_t)(frame->used - LOG_FRAME_HEADER_SIZE));
+    _put_u32(&buf[8], frame->opened_ms);
+    _put_u16(&buf[frame->used], Checksum_Crc16(buf, frame->used));
+    size_t size = frame->used + LOG_FRAME_CRC_SIZE;
+
+    frame->stats.frames++;
+    frame->stats.records += frame->record_count;
+    frame->stats.bytes += (uint32_t)size;
+    (*reason_counter)++;
+
+    int result = (frame->sink != NULL) ? frame->sink(buf, size) : LOG_FRAME_ERROR;
+    if (result != 0) {
+        frame->stats.send_errors++;
+    }
+    _reset(frame);
+    return result;
+}
+
+void* LogFrame_Reserve(LogFrame* frame, size_t size, uint32_t now_ms, int* result)
+{
+    int send_result = LOG_FRAME_OK;
+    if (frame == NULL || size == 0 || size > LOG_FRAME_MAX_RECORD ||
+        LOG_FRAME_OVERHEAD + _prefix(frame) + size > frame->max_size) {
+        if (result != NULL) {
+            *result = LOG_FRAME_ERROR;
+        }
+        return NULL;
+    }
+
+    if (frame->record_count > 0) {
+        if (frame->max_age_ms > 0 && now_ms - frame->opened_ms >= frame->max_age_ms) {
+            send_result = _send(frame, &frame->stats.flush_age);
+        } else if (frame->used + _prefix(frame) + size + LOG_FRAME_CRC_SIZE > frame->max_size) {
+            send_result = _send(frame, &frame->stats.flush_size);
+        }
+    }
+    if (result != NULL) {
+        *result = send_result;
+    }
+
+    if (frame->record_count == 0) {
+        frame->opened_ms = now_ms;
+    }
+    if (_prefix(frame) > 0) {
+        frame->buffer[frame->used] = (uint8_t)size;
+    }
+    frame->reserved = size;
+    return &frame->buffer[frame->used + _prefix(frame)];
+}
+
+void LogFrame_Commit(LogFrame* frame)
+{
+    if (frame == NULL) {
+        return;
+    }
+    LogFrame_CommitSize(frame, frame->reserved);
+}
+
+void LogFrame_CommitSize(LogFrame* frame, size_t size)
+{
+    if (frame == NULL || frame->reserved == 0 || size == 0 || size > frame->reserved) {
+        return;
+    }
+    if (_prefix(frame) > 0) {
+        frame->buffer[frame->used] = (uint8_t)size;
+    }
+    frame->used += _prefix(frame) + size;
+    frame->reserved = 0;
+    frame->record_count++;
+}
+
+int LogFrame_Poll(LogFrame* frame, uint32_t now_ms)
+{
+    if (frame == NULL || frame->record_count == 0 || frame->max_age_ms == 0) {
+        return LOG_FRAME_OK;
+    }
+    if (now_ms - frame->opened_ms < frame->max_age_ms) {
+        return LOG_FRAME_OK;
+    }
+    return _send(frame, &frame->stats.flush_age);
+}
+
+int LogFrame_Flush(LogFrame* frame)
+{
+    if (frame == NULL) {
+        return LOG_FRAME_ERROR;
+    }
+    return _send(frame, &frame->stats.flush_explicit);
+}
+
+void LogFrame_GetStats(const LogFrame* frame, LogFrameStats* stats)
+{
+    if (frame == NULL || stats == NULL) {
+        return;
+    }
+    *stats = frame->stats;
+}
+
+uint32_t LogFrame_RecordsPerFrameX10(const LogFrameStats* stats)
+{
+    if (stats == NULL || stats->frames == 0) {
+        return 0;
+    }
+    return (uint32_t)(((uint64_t)stats->records * 10U) / stats->frames);
+}
+
+int LogFrame_Decode(const uint8_t* data, size_t len, LogFrameHeader* header)
+{
+    if (data == NULL || header == NULL) {
+        return LOG_FRAME_ERROR;
+    }
+    if (len < LOG_FRAME_HEADER_SIZE) {
+        return LOG_FRAME_TRUNCATED;
+    }
+    if (data[0] != LOG_FRAME_MAGIC ||
+        (data[1] != LOG_FRAME_VERSION && data[1] != LOG_FRAME_VERSION_DELTA)) {
+        return LOG_FRAME_CORRUPT;
+    }
+
+    uint16_t payload_length = _get_u16(&data[6]);
+    size_t total = LOG_FRAME_OVERHEAD + payload_length;
+    if (total > LOG_FRAME_MAX_SIZE) {
+        return LOG_FRAME_CORRUPT;
+    }
+    if (len < total) {
+        return LOG_FRAME_TRUNCATED;
+    }
+    if (_get_u16(&data[LOG_FRAME_HEADER_SIZE + payload_length]) !=
+        Checksum_Crc16(data, LOG_FRAME_HEADER_SIZE + payload_length)) {
+        return LOG_FRAME_CORRUPT;
+    }
+
+    header->version = data[1];
+    header->seq = _get_u16(&data[2]);
+    header->record_count = _get_u16(&data[4]);
+    header->payload_length = payload_length;
+    header->first_timestamp_ms = _get_u32(&data[8]);
+    header->payload = &data[LOG_FRAME_HEADER_SIZE];
+    return (int)total;
+}
+
+bool LogFrame_NextRecord(const LogFrameHeader* header, size_t* offset,
+                         const uint8_t** record, size_t* record_len)
+{
+    if (header == NULL || offset == NULL || record == NULL || record_len == NULL ||
+        header->version != LOG_FRAME_VERSION) {
+        return false;
+    }
+    if (*offset + LOG_FRAME_RECORD_PREFIX > header->payload_length) {
+        return false;
+    }
+    size_t len = header->payload[*offset];
+    if (len == 0 || *offset + LOG_FRAME_RECORD_PREFIX + len > header->payload_length) {
+        return false;
+    }
+    *record = &header->payload[*offset + LOG_FRAME_RECORD_PREFIX];
+    *record_len = len;
+    *offset += LOG_FRAME_RECORD_PREFIX + len;
+    return true;
+}
@@ -0,0 +1,114 @@
+#ifndef LOGFRAME_H
+#define LOGFRAME_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// 원격 로그 프레임 묶음 (LogRemote 패킷 여러 개를 한 번에 전송)
+//
+// 프레임 형식 (리틀 엔디안):
+//   [0x5A][version][seq u16][record_count u16][payload_length u16][first_timestamp_ms u32]
+//   [레코드...][crc16 u16]
+// version 1 레코드는 [length u8][패킷 바이트] - 패킷 첫 바이트는 packet_type
+// version 2 (LOG_FRAME_VERSION_DELTA)는 길이 없이 이어진 LogDelta 레코드 (LogDelta.h)
+// CRC는 헤더+payload에 대해 CRC-16/CCITT-FALSE (Checksum_Crc16)
+//
+// 전송 시점:
+//   크기 - 다음 레코드가 들어갈 자리가 없을 때 (LogFrame_Reserve)
+//   시간 - 첫 레코드 이후 max_age_ms 경과 (LogFrame_Poll / LogFrame_Reserve)
+//   명시 - LogFrame_Flush
+// 호출자는 LogFrame_Reserve가 돌려준 프레임 버퍼 안의 위치에 직접 패킷을 채우고
+// LogFrame_Commit으로 확정 (중간 복사 없음). 전송도 프레임 버퍼를 그대로 sink에 넘김.
+
+#define LOG_FRAME_MAGIC             0x5A
+#define LOG_FRAME_VERSION           1
+#define LOG_FRAME_VERSION_DELTA     2
+#define LOG_FRAME_HEADER_SIZE       12
+#define LOG_FRAME_CRC_SIZE          2
+#define LOG_FRAME_OVERHEAD          (LOG_FRAME_HEADER_SIZE + LOG_FRAME_CRC_SIZE)
+#define LOG_FRAME_RECORD_PREFIX     1
+#define LOG_FRAME_MAX_RECORD        255
+#define LOG_FRAME_MAX_SIZE          512     // 프레임 버퍼 크기 (TCP 세그먼트/SD 섹터 1개)
+
+// 결과 코드 (sink 에러는 그대로 전달)
+#define LOG_FRAME_OK                0
+#define LOG_FRAME_ERROR            -1
+#define LOG_FRAME_CORRUPT          -3   // 잘못된 헤더 또는 CRC 불일치
+#define LOG_FRAME_TRUNCATED        -4   // 프레임이 중간에 잘림 (데이터 더 필요)
+
+// 완성된 프레임을 보낼 함수 (Network_SendBinary와 같은 형태, 0이면 성공)
+typedef int (*LogFrameSink)(const void* data, size_t size);
+
+typedef struct {
+    uint32_t frames;            // 전송 시도한 프레임 수
+    uint32_t records;           // 전송 시도한 프레임에 담긴 레코드 수
+    uint32_t bytes;             // 전송 시도한 프레임 바이트 (헤더/CRC 포함)
+    uint32_t flush_size;        // 크기 때문에 전송
+    uint32_t flush_age;         // 시간 때문에 전송
+    uint32_t flush_explicit;    // LogFrame_Flush 호출로 전송
+    uint32_t send_errors;       // sink 실패 (해당 프레임은 버림)
+} LogFrameStats;
+
+typedef struct {
+    uint8_t buffer[LOG_FRAME_MAX_SIZE];
+    size_t used;                // 헤더 포함, CRC 제외
+    size_t reserved;            // Reserve 후 Commit 전인 레코드 크기 (0: 없음)
+    uint16_t record_count;
+    uint16_t next_seq;
+    uint32_t opened_ms;         // 첫 레코드 시각
+    size_t max_size;
+    uint32_t max_age_ms;
+    uint8_t version;            // LOG_FRAME_VERSION(기본) 또는 LOG_FRAME_VERSION_DELTA
+    LogFrameSink sink;
+    LogFrameStats stats;
+} LogFrame;
+
+typedef struct {
+    uint8_t version;
+    uint16_t seq;
+    uint16_t record_count;
+    uint16_t payload_length;
+    uint32_t first_timestamp_ms;
+    const uint8_t* payload;     // 입력 버퍼 내부를 가리킴
+} LogFrameHeader;
+
+// max_size: 프레임 최대 크기 (LOG_FRAME_MAX_SIZE로 제한), max_age_ms: 0이면 시간 기준 전송 없음
+void LogFrame_Init(LogFrame* frame, LogFrameSink sink, size_t max_size, uint32_t max_age_ms);
+
+// 레코드 형식 선택 (프레임이 비어 있을 때만, 기본은 LOG_FRAME_VERSION)
+// LOG_FRAME_VERSION_DELTA는 레코드 길이를 붙이지 않음 - 레코드 경계는 payload 형식이 정함
+int LogFrame_SetVersion(LogFrame* frame, uint8_t version);
+
+// 레코드 자리 확보 - 프레임 버퍼 안의 쓰기 위치를 반환 (size 바이트)
+// 자리가 없거나 오래된 프레임이면 먼저 전송하며, 그 전송이 실패하면 *result에 에러
+// (프레임은 버리고 새 프레임에 자리를 줌). size가 너무 크면 NULL.
+void* LogFrame_Reserve(LogFrame* frame, size_t size, uint32_t now_ms, int* result);
+
+// Reserve한 레코드 확정
+void LogFrame_Commit(LogFrame* frame);
+
+// Reserve한 자리 중 앞의 size 바이트만 확정 (최대 크기로 확보 후 실제 크기만큼 인코딩할 때)
+// 확보 후 LogFrame_IsEmpty가 true면 그 레코드가 새 프레임의 첫 레코드
+void LogFrame_CommitSize(LogFrame* frame, size_t size);
+
+// 시간 기준 전송 점검 (주기적으로 호출)
+int LogFrame_Poll(LogFrame* frame, uint32_t now_ms);
+
+// 담긴 레코드가 있으면 즉시 전송
+int LogFrame_Flush(LogFrame* frame);
+
+bool LogFrame_IsEmpty(const LogFrame* frame);
+void LogFrame_GetStats(const LogFrame* frame, LogFrameStats* stats);
+
+// 프레임당 평균 레코드 수 x10 (예: 73 -> 7.3)
+uint32_t LogFrame_RecordsPerFrameX10(const LogFrameStats* stats);
+
+// 수신 측: data 앞의 프레임 하나를 검사. 성공 시 프레임 크기 반환
+int LogFrame_Decode(const uint8_t* data, size_t len, LogFrameHeader* header);
+
+// payload 안의 다음 레코드 (*offset을 진행). 끝이거나 잘렸으면 false (version 1 프레임만)
+bool LogFrame_NextRecord(const LogFrameHeader* header, size_t* offset,
+                         const uint8_t** record, size_t* record_len);
+
+#endif // LOGFRAME_H
@@ -1,5 +1,6 @@
 #include "LogRemote.h"
 #include "Network.h"
+#include "Checksum.h"
 #include "time.h"
 #include <string.h>
 #include <stddef.h>
@@ -7,6 +8,115 @@
 static bool g_initialized = false;
 static uint8_t g_device_id = 0;
 static uint32_t g_last_state_time = 0;
+static LogFrame g_frame;
+static size_t g_frame_size = LOG_REMOTE_FRAME_SIZE;
+static uint32_t g_frame_age_ms = LOG_REMOTE_FRAME_AGE_MS;
+static LogRemoteEncoding g_encoding = LOG_REMOTE_ENCODING_V1;
+static LogDeltaCodec g_delta;
+static uint8_t g_state = 0;                     // 마지막 상태 변경의 new_state
+static uint32_t g_heartbeat_interval_ms = 0;
+static LogRemoteHeartbeatSource g_heartbeat_source = NULL;
+static uint32_t g_heartbeat_due = 0;
+static bool g_heartbeat_started = false;
+
+static int _send_frame(const void* data, size_t size)
+{
+    return Network_SendBinary(data, size);
+}
+
+// 마지막 필드가 checksum인 패킷 - checksum 앞까지의 CRC16
+static uint16_t _packet_checksum(const void* packet, size_t size)
+{
+    return Checksum_Crc16(packet, size - sizeof(uint16_t));
+}
+
+// 현재 프레임에 패킷 자리를 잡음 - 패킷은 반환된 자리에 바로 작성 (V2는 raw 레코드 접두 뒤)
+static void* _reserve_packet(size_t size, uint32_t current_time, int* result)
+{
+    if (g_encoding == LOG_REMOTE_ENCODING_V2) {
+        uint8_t* slot = LogFrame_Reserve(&g_frame, LOG_DELTA_RAW_PREFIX + size, current_time, result);
+        if (slot == NULL) {
+            return NULL;
+        }
+        if (LogFrame_IsEmpty(&g_frame)) {
+            LogDelta_Begin(&g_delta, current_time);
+        }
+        return slot + LOG_DELTA_RAW_PREFIX;
+    }
+    return LogFrame_Reserve(&g_frame, size, current_time, result);
+}
+
+// 자리에 작성한 패킷 확정 (V2는 접두만 채움, 복사 없음)
+static void _commit_packet(void* packet, size_t size)
+{
+    if (g_encoding == LOG_REMOTE_ENCODING_V2) {
+        uint8_t* slot = (uint8_t*)packet - LOG_DELTA_RAW_PREFIX;
+        LogFrame_CommitSize(&g_frame, LogDelta_EncodeRaw(packet, size, slot, LOG_DELTA_RAW_PREFIX + size));
+        return;
+    }
+    LogFrame_Commit(&g_frame);
+}
+
+static int _send_heartbeat(uint32_t current_time)
+{
+    LogRemoteHeartbeat info = {
+        .uptime_s = current_time / 1000U,
+        .last_rssi = LOG_REMOTE_RSSI_UNKNOWN,
+    };
+    if (g_heartbeat_source != NULL) {
+        g_heartbeat_source(&info);
+    }
+    
+    int result = 0;
+    HeartbeatPacket* packet = _reserve_packet(sizeof(HeartbeatPacket), current_time, &result);
+    if (packet == NULL) {
+        return -1;
+    }
+    
+    packet->packet_type = PACKET_TYPE_HEARTBEAT;
+    packet->timestamp = current_time;
+    packet->device_id = g_device_id;
+    packet->state = g_state;
+    packet->uptime_s = info.uptime_s;
+    packet->free_heap = info.free_heap;
+    packet->net_queue_bytes = info.net_queue_bytes;
+    packet->log_queue_depth = info.log_queue_depth;
+    packet->last_rssi = info.last_rssi;
+    packet->checksum = _packet_checksum(packet, sizeof(HeartbeatPacket));
+    _commit_packet(packet, sizeof(HeartbeatPacket));
+    return result;
+}
+
+// V2: 최대 크기로 자리를 잡고 실제 인코딩된 크기만 확정
+static int _send_state_change_delta(uint32_t current_time, uint32_t duration,
+                                    LoraState old_state, LoraState new_state,
+                                    uint16_t error_count, uint16_t send_count)
+{
+    int result = 0;
+    uint8_t* slot = LogFrame_Reserve(&g_frame, LOG_DELTA_MAX_RECORD, current_time, &result);
+    if (slot == NULL) {
+        return -1;
+    }
+    if (LogFrame_IsEmpty(&g_frame)) {
+        LogDelta_Begin(&g_delta, current_time);     // 새 프레임 - 첫 레코드 기준은 프레임 시각
+    }
+    
+    LogDeltaRecord record = {
+        .timestamp_ms = current_time,
+        .device_id = g_device_id,
+        .old_state = (uint8_t)old_state,
+        .new_state = (uint8_t)new_state,
+        .state_duration = duration,
+        .error_count = error_count,
+        .send_count = send_count,
+        .error_code = 0,
+    };
+    LogFrame_CommitSize(&g_frame, LogDelta_Encode(&g_delta, &record, slot, LOG_DELTA_MAX_RECORD));
+    
+    g_last_state_time = current_time;
+    g_state = (uint8_t)new_state;
+    return result;
+}
 
 int LogRemote_Init(const char* server_ip, uint16_t port, uint8_t device_id)
 {
@@ -19,6 +129,12 @@ int LogRemote_Init(const char* server_ip, uint16_t port, uint8_t device_id)
         g_initialized = true;
         g_device_id = device_id;
         g_last_state_time = 0;
+        g_state = 0;
+        g_heartbeat_started = false;
+        LogFrame_Init(&g_frame, _send_frame, g_frame_size, g_frame_age_ms);
+        if (g_encoding == LOG_REMOTE_ENCODING_V2) {
+            LogFrame_SetVersion(&g_frame, LOG_FRAME_VERSION_DELTA);
+        }
     }
     
     return result;
@@ -38,50 +154,156 @@ int LogRemote_SendStateChange(LoraState old_state, LoraState new_state,
         duration = current_time - g_last_state_time;
     }
     
-    StateChangePacket packet = {
-        .packet_type = PACKET_TYPE_STATE_CHANGE,
-        .timestamp = current_time,
-        .device_id = g_device_id,
-        .old_state = (uint8_t)old_state,
-        .new_state = (uint8_t)new_state,
-        .state_duration = duration,
-        .error_count = error_count,
-        .send_count = send_count,
-        .error_code = 0,
-        .reserved = 0,
-        .checksum = 0
-    };
+    if (g_encoding == LOG_REMOTE_ENCODING_V2) {
+        return _send_state_change_delta(current_time, duration, old_state, new_state,
+                                        error_count, send_count);
+    }
+    
+    // 프레임 버퍼 안에 바로 패킷 작성 (가득 찼거나 오래된 프레임은 먼저 전송됨)
+    int result = 0;
+    StateChangePacket* packet = LogFrame_Reserve(&g_frame, sizeof(StateChangePacket), current_time, &result);
+    if (packet == NULL) {
+        return -1;
+    }
+    
+    packet->packet_type = PACKET_TYPE_STATE_CHANGE;
+    packet->timestamp = current_time;
+    packet->device_id = g_device_id;
+    packet->old_state = (uint8_t)old_state;
+    packet->new_state = (uint8_t)new_state;
+    packet->state_duration = duration;
+    packet->error_count = error_count;
+    packet->send_count = send_count;
+    packet->error_code = 0;
+    packet->reserved = 0;
+    packet->checksum = 0;
     
     // 체크섬 계산
-    packet.checksum = LogRemote_CalculateChecksum(&packet);
+    packet->checksum = LogRemote_CalculateChecksum(packet);
+    LogFrame_Commit(&g_frame);
     
     g_last_state_time = current_time;
+    g_state = (uint8_t)new_state;
     
-    return Network_SendBinary(&packet, sizeof(packet));
+    // 이전 프레임 전송 실패는 호출자에게 알림 (이번 패킷은 새 프레임에 담김)
+    return result;
 }
 
-uint16_t LogRemote_CalculateChecksum(const StateChangePacket* packet)
+int LogRemote_Flush(void)
 {
-    if (packet == NULL) {
+    if (!g_initialized) {
+        return -1;
+    }
+    return LogFrame_Flush(&g_frame);
+}
+
+int LogRemote_Poll(void)
+{
+    if (!g_initialized) {
         return 0;
     }
     
-    // 간단한 XOR 체크섬 (실제로는 CRC16 사용 권장)
-    uint16_t checksum = 0;
-    const uint8_t* data = (const uint8_t*)packet;
+    bool heartbeat_on = g_heartbeat_interval_ms > 0;
+    int result = 0;
+    if (heartbeat_on || !LogFrame_IsEmpty(&g_frame)) {
+        uint32_t current_time = TIME_GetCurrentMs();
+        // 첫 Poll에서 바로 한 번, 이후 interval마다 (늦게 불려도 밀린 만큼 몰아서 보내지 않음)
+        if (heartbeat_on && (!g_heartbeat_started || (int32_t)(current_time - g_heartbeat_due) >= 0)) {
+            g_heartbeat_started = true;
+            g_heartbeat_due = current_time + g_heartbeat_interval_ms;
+            result = _send_heartbeat(current_time);
+        }
+        
+        int frame_result = LogFrame_Poll(&g_frame, current_time);
+        result = (result != 0) ? result : frame_result;
+    }
     
-    // checksum 필드를 제외한 모든 바이트에 대해 계산
-    for (size_t i = 0; i < sizeof(StateChangePacket) - sizeof(packet->checksum); i++) {
-        checksum ^= data[i];
-        checksum = (checksum << 1) | (checksum >> 15); // 좌 회전
+    // Network 쪽 밀린 전송(fan-out SD 큐, store-and-forward 재전송)은 이 주기 호출로만 진행
+    // 연결 안 된 백엔드는 NOT_CONNECTED - 프레임 전송 결과가 아니므로 무시
+    (void)Network_Poll();
+    return result;
+}
+
+void LogRemote_SetHeartbeat(uint32_t interval_ms, LogRemoteHeartbeatSource source)
+{
+    g_heartbeat_interval_ms = interval_ms;
+    g_heartbeat_source = source;
+    g_heartbeat_started = false;
+}
+
+int LogRemote_SendHeartbeat(void)
+{
+    if (!g_initialized) {
+        return -1;
+    }
+    return _send_heartbeat(TIME_GetCurrentMs());
+}
+
+LogRemoteModule LogRemote_ModuleFromResult(ResultCode result_code)
+{
+    if (result_code >= 0) {
+        return LOG_REMOTE_MODULE_GENERIC;
+    }
+    int32_t module = -result_code / 100;
+    return (module <= LOG_REMOTE_MODULE_NETWORK) ? (LogRemoteModule)module : LOG_REMOTE_MODULE_GENERIC;
+}
+
+int LogRemote_SendError(ResultCode result_code, LogRemoteModule module, uint16_t detail)
+{
+    if (!g_initialized) {
+        return -1;
+    }
+    
+    uint32_t current_time = TIME_GetCurrentMs();
+    int result = 0;
+    ErrorLogPacket* packet = _reserve_packet(sizeof(ErrorLogPacket), current_time, &result);
+    if (packet == NULL) {
+        return -1;
+    }
+    
+    packet->packet_type = PACKET_TYPE_ERROR_LOG;
+    packet->timestamp = current_time;
+    packet->device_id = g_device_id;
+    packet->module_id = (uint8_t)((module == LOG_REMOTE_MODULE_AUTO) ? LogRemote_ModuleFromResult(result_code) : module);
+    packet->state = g_state;
+    packet->result_code = result_code;
+    packet->detail = detail;
+    packet->checksum = _packet_checksum(packet, sizeof(ErrorLogPacket));
+    _commit_packet(packet, sizeof(ErrorLogPacket));
+    return result;
+}
+
+void LogRemote_SetFrameLimits(size_t max_size, uint32_t max_age_ms)
+{
+    // 다음 LogRemote_Init부터 적용
+    g_frame_size = max_size;
+    g_frame_age_ms = max_age_ms;
+}
+
+void LogRemote_SetEncoding(LogRemoteEncoding encoding)
+{
+    g_encoding = encoding;
+}
+
+void LogRemote_GetFrameStats(LogFrameStats* stats)
+{
+    LogFrame_GetStats(&g_frame, stats);
+}
+
+uint16_t LogRemote_CalculateChecksum(const StateChangePacket* packet)
+{
+    if (packet == NULL) {
+        return 0;
     }
     
-    return checksum;
+    // CRC-16/CCITT-FALSE, checksum 필드를 제외한 모든 바이트
+    return Checksum_Crc16(packet, offsetof(StateChangePacket, checksum));
 }
 
 void LogRemote_Disconnect(void)
 {
     if (g_initialized) {
+        LogFrame_Flush(&g_frame);   // 남은 패킷은 연결을 끊기 전에 전송
         Network_Disconnect();
         g_initialized = false;
         g_device_id = 0;
@@ -99,4 +321,12 @@ void LogRemote_Reset(void)
     g_initialized = false;
     g_device_id = 0;
     g_last_state_time = 0;
+    g_frame_size = LOG_REMOTE_FRAME_SIZE;
+    g_frame_age_ms = LOG_REMOTE_FRAME_AGE_MS;
+    g_encoding = LOG_REMOTE_ENCODING_V1;
+    g_state = 0;
+    g_heartbeat_interval_ms = 0;
+    g_heartbeat_source = NULL;
+    g_heartbeat_started = false;
+    LogFrame_Init(&g_frame, _send_frame, g_frame_size, g_frame_age_ms);
 }
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "LoraStarter.h"
+#include "LogFrame.h"
+#include "LogDelta.h"
+#include "error_codes.h"
 
 // 원격 로그 패킷 구조체 (20바이트 고정)
 #pragma pack(push, 1)
@@ -20,17 +23,93 @@ typedef struct {
     uint8_t reserved;           // 1byte: 패딩
     uint16_t checksum;          // 2byte: CRC16 체크섬
 } StateChangePacket;          // 총 20바이트
+
+// 주기 상태 보고 (송신 주기 사이의 생존 신호)
+typedef struct {
+    uint8_t packet_type;        // 1byte: 0x03 (Heartbeat)
+    uint32_t timestamp;         // 4byte: 시각 (ms)
+    uint8_t device_id;          // 1byte: 장치 ID
+    uint8_t state;              // 1byte: 현재 상태 (마지막 상태 변경의 new_state)
+    uint32_t uptime_s;          // 4byte: 부팅 후 경과 시간 (초)
+    uint32_t free_heap;         // 4byte: 남은 힙 (bytes)
+    uint32_t net_queue_bytes;   // 4byte: 네트워크 송신 대기 바이트
+    uint16_t log_queue_depth;   // 2byte: 로그/SD 쓰기 대기 항목 수
+    int8_t last_rssi;           // 1byte: 마지막 수신 RSSI (dBm, LOG_REMOTE_RSSI_UNKNOWN: 없음)
+    uint16_t checksum;          // 2byte: CRC16 체크섬
+} HeartbeatPacket;            // 총 24바이트
+
+// 에러 보고
+typedef struct {
+    uint8_t packet_type;        // 1byte: 0x02 (Error Log)
+    uint32_t timestamp;         // 4byte: 시각 (ms)
+    uint8_t device_id;          // 1byte: 장치 ID
+    uint8_t module_id;          // 1byte: 에러 발생 모듈 (LogRemoteModule)
+    uint8_t state;              // 1byte: 에러 당시 상태
+    int32_t result_code;        // 4byte: ResultCode (error_codes.h)
+    uint16_t detail;            // 2byte: 모듈별 부가 정보 (재시도 횟수 등)
+    uint16_t checksum;          // 2byte: CRC16 체크섬
+} ErrorLogPacket;             // 총 16바이트
 #pragma pack(pop)
 
+// 에러 패킷의 모듈 ID (error_codes.h의 모듈 구간과 같은 순서)
+typedef enum {
+    LOG_REMOTE_MODULE_GENERIC = 0,  // -1 ~ -99
+    LOG_REMOTE_MODULE_UART,         // -100 ~ -199
+    LOG_REMOTE_MODULE_SD,           // -200 ~ -299
+    LOG_REMOTE_MODULE_LOGGER,       // -300 ~ -399
+    LOG_REMOTE_MODULE_LORA,         // -400 ~ -499
+    LOG_REMOTE_MODULE_NETWORK,      // -500 ~ -599
+    LOG_REMOTE_MODULE_AUTO = 0xFF   // result_code 구간으로 결정
+} LogRemoteModule;
+
+#define LOG_REMOTE_RSSI_UNKNOWN     (-128)
+
+// heartbeat 내용 (LogRemote가 uptime_s/last_rssi 기본값을 채운 뒤 source가 덮어씀)
+typedef struct {
+    uint32_t uptime_s;
+    uint32_t free_heap;
+    uint32_t net_queue_bytes;
+    uint16_t log_queue_depth;
+    int8_t last_rssi;
+} LogRemoteHeartbeat;
+
+typedef void (*LogRemoteHeartbeatSource)(LogRemoteHeartbeat* heartbeat);
+
+// 프레임 묶음 기본값 - 패킷은 프레임에 모았다가 크기/시간/명시적 Flush로 전송
+#define LOG_REMOTE_FRAME_SIZE       LOG_FRAME_MAX_SIZE  // 상태 변경 패킷 23개
+#define LOG_REMOTE_FRAME_AGE_MS     1000
+
+// 상태 변경 패킷 인코딩
+//   V1: StateChangePacket 20바이트 고정 (LOG_FRAME_VERSION 프레임)
+//   V2: 프레임 안 차이 인코딩 LogDelta 레코드, 전이당 약 3~5바이트 (LOG_FRAME_VERSION_DELTA 프레임)
+typedef enum {
+    LOG_REMOTE_ENCODING_V1 = 0,
+    LOG_REMOTE_ENCODING_V2
+} LogRemoteEncoding;
+
 // LogRemote 모듈 함수들
 int LogRemote_Init(const char* server_ip, uint16_t port, uint8_t device_id);
 int LogRemote_SendStateChange(LoraState old_state, LoraState new_state, 
                              uint16_t error_count, uint16_t send_count);
 uint16_t LogRemote_CalculateChecksum(const StateChangePacket* packet);
+int LogRemote_Flush(void);                  // 모인 패킷 즉시 전송
+int LogRemote_Poll(void);                   // 시간 기준 전송 점검 + Network_Poll (주기 호출)
+void LogRemote_SetFrameLimits(size_t max_size, uint32_t max_age_ms);
+void LogRemote_GetFrameStats(LogFrameStats* stats);
+void LogRemote_SetEncoding(LogRemoteEncoding encoding);    // 다음 LogRemote_Init부터 적용
+
+// heartbeat/에러 패킷 - 상태 변경과 같은 프레임에 묶여 전송 (V2 프레임에는 그대로 담김)
+// interval_ms마다 LogRemote_Poll이 heartbeat를 보냄 (0이면 끔), source는 NULL 가능
+void LogRemote_SetHeartbeat(uint32_t interval_ms, LogRemoteHeartbeatSource source);
+int LogRemote_SendHeartbeat(void);
+int LogRemote_SendError(ResultCode result_code, LogRemoteModule module, uint16_t detail);
+LogRemoteModule LogRemote_ModuleFromResult(ResultCode result_code);
 void LogRemote_Disconnect(void);
 bool LogRemote_IsConnected(void);
 void LogRemote_Reset(void);  // 테스트용 리셋 함수
 
+#define LOG_REMOTE_HEARTBEAT_MS     5000    // 권장 heartbeat 주기
+
 // 패킷 타입 정의
 #define PACKET_TYPE_STATE_CHANGE    0x01
 #define PACKET_TYPE_ERROR_LOG       0x02
@@ -0,0 +1,48 @@
+#ifndef LOGTIMEINDEX_H
+#define LOGTIMEINDEX_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// SD 로그 파일용 희소 시간 인덱스 (.IDX, 로그 파일과 같은 번호)
+//
+// 로그 파일을 일정 바이트마다 (시각 -> 파일 오프셋) 항목 하나씩 기록:
+//   [epoch_sec u32 LE][uptime_ms u32 LE][offset u32 LE][check u32 LE]
+// offset은 텍스트 줄(.TXT) 또는 저널 레코드(.LJR)의 시작 위치.
+// check = MAGIC ^ epoch ^ uptime ^ offset (찢어진/잔여 항목 검출)
+//
+// 항목은 로그 데이터를 f_sync한 뒤에만 추가되므로 offset은 항상 기록된 데이터를 가리킴.
+// epoch_sec는 시간 동기화 전 0이고 이후 증가하므로 항목 배열은 epoch 기준 비내림차순
+// (동기화 전 항목은 모든 시각보다 앞선 것으로 취급).
+
+#define LOG_TIME_INDEX_ENTRY_SIZE   16
+#define LOG_TIME_INDEX_MAGIC        0x58444954UL    // "TIDX"
+#define LOG_TIME_INDEX_END          UINT32_MAX      // 구간 끝: 파일 끝까지
+
+typedef struct {
+    uint32_t epoch_sec;     // UTC epoch 초 (시간 동기화 전 0)
+    uint32_t uptime_ms;     // 기록 시점 tick (저널 레코드 timestamp_ms와 같은 기준)
+    uint32_t offset;        // 로그 파일 내 줄/레코드 시작 오프셋
+} LogTimeIndexEntry;
+
+void LogTimeIndex_Encode(const LogTimeIndexEntry* entry, uint8_t out[LOG_TIME_INDEX_ENTRY_SIZE]);
+
+// 항목 1개 검증 후 디코딩 (check 불일치 시 false)
+bool LogTimeIndex_Decode(const uint8_t in[LOG_TIME_INDEX_ENTRY_SIZE], LogTimeIndexEntry* entry);
+
+// 인덱스 파일 내용을 앞에서부터 파싱, 첫 무효 항목(찢어진 꼬리)이나 offset이
+// 줄어드는 항목에서 멈춤. 유효 항목 수 반환.
+size_t LogTimeIndex_Parse(const uint8_t* data, size_t len, LogTimeIndexEntry* entries, size_t max_entries);
+
+// [from_epoch, to_epoch] 구간을 포함하는 로그 오프셋 범위 (이진 탐색)
+//   start: from_epoch보다 이른 마지막 항목의 offset (없으면 0)
+//   end:   to_epoch보다 늦은 첫 항목의 offset (없으면 LOG_TIME_INDEX_END)
+void LogTimeIndex_FindRange(const LogTimeIndexEntry* entries, size_t count,
+                            uint32_t from_epoch, uint32_t to_epoch,
+                            uint32_t* start_offset, uint32_t* end_offset);
+
+// offset 이전의 마지막 항목 (저널 레코드 tick -> epoch 환산 기준), 없으면 NULL
+const LogTimeIndexEntry* LogTimeIndex_Anchor(const LogTimeIndexEntry* entries, size_t count, uint32_t offset);
+
+#endif // LOGTIMEINDEX_H
@@ -173,14 +173,14 @@ void LoraStarter_Process(LoraStarterContext* ctx, const char* uart_rx)
                         ctx->state = LORA_STATE_WAIT_SEND_INTERVAL; // 주기적 대기 상태로 전이
                         ctx->error_count = 0; // 성공 시 에러 카운터 리셋
                         ctx->retry_delay_ms = 1000; // 재시도 지연 시간 리셋
-                        ctx->last_send_time = TIME_GetCurrentMs(); // 마지막 송신 시간 저장
+                        ctx->last_send_time = TIME_GetMonotonicMs(); // 마지막 송신 시간 저장
                         break;
                     case RESPONSE_TIMEOUT:
                         LOG_WARN("[LoRa] SEND timeout");
                         ctx->state = LORA_STATE_WAIT_SEND_INTERVAL; // 주기적 대기 상태로 전이
                         ctx->error_count = 0; // 성공 시 에러 카운터 리셋
                         ctx->retry_delay_ms = 1000; // 재시도 지연 시간 리셋
-                        ctx->last_send_time = TIME_GetCurrentMs(); // 마지막 송신 시간 저장
+                        ctx->last_send_time = TIME_GetMonotonicMs(); // 마지막 송신 시간 저장
                         break;
                     case RESPONSE_ERROR:
                         LORA_LOG_SEND_FAILED("Network error");
@@ -204,7 +204,7 @@ void LoraStarter_Process(LoraStarterContext* ctx, const char* uart_rx)
             break;
         case LORA_STATE_WAIT_SEND_INTERVAL:
             {
-                uint32_t current_time = TIME_GetCurrentMs();
+                uint64_t current_time = TIME_GetMonotonicMs();
                 uint32_t interval_ms = (ctx->send_interval_ms > 0) ? ctx->send_interval_ms : 300000; // 기본값 5분
                 
                 if ((current_time - ctx->last_send_time) >= interval_ms) {
@@ -212,14 +212,14 @@ void LoraStarter_Process(LoraStarterContext* ctx, const char* uart_rx)
                     ctx->state = LORA_STATE_SEND_PERIODIC;
                 } else {
                     // 아직 대기 시간이 남았으므로 상태 유지
-                    uint32_t remaining_ms = interval_ms - (current_time - ctx->last_send_time);
+                    uint32_t remaining_ms = (uint32_t)(interval_ms - (current_time - ctx->last_send_time));
                     LOG_DEBUG("[LoRa] Waiting for send interval (%u ms remaining)", remaining_ms);
                 }
             }
             break;
         case LORA_STATE_JOIN_RETRY:
             {
-                uint32_t current_time = TIME_GetCurrentMs();
+                uint64_t current_time = TIME_GetMonotonicMs();
                 
                 if (ctx->last_retry_time == 0) {
                     // 첫 재시도: 바로 SEND_JOIN
@@ -234,7 +234,7 @@ void LoraStarter_Process(LoraStarterContext* ctx, const char* uart_rx)
                 } else {
                     // 아직 지연 시간이 지나지 않았다면 상태 유지
                     LOG_DEBUG("[LoRa] Waiting for retry delay (%lu ms remaining)", 
-                             ctx->retry_delay_ms - (current_time - ctx->last_retry_time));
+                             (unsigned long)(ctx->retry_delay_ms - (current_time - ctx->last_retry_time)));
                     // 아무것도 하지 않음
                 }
             }
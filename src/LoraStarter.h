@@ -1,6 +1,8 @@
 #ifndef LORASTARTER_H
 #define LORASTARTER_H
 
+#include <stdint.h>
+
 // LoRa 기본 초기화 명령어 배열 (TDD 검증됨)
 extern const char* LORA_DEFAULT_INIT_COMMANDS[];
 extern const int LORA_DEFAULT_INIT_COMMANDS_COUNT;
@@ -28,13 +30,13 @@ typedef struct {
     int cmd_index;
     const char** commands;
     int num_commands;
-    unsigned long last_send_time;   // 마지막 송신 시간
+    uint64_t last_send_time;        // 마지막 송신 시각 (TIME_GetMonotonicMs)
     unsigned long send_interval_ms; // 송신 주기 (밀리초)
     int send_count;                 // 송신 횟수 (테스트용)
     const char* send_message;       // 송신할 메시지 (하드코딩 제거)
     int error_count;                // 에러 발생 횟수
     int max_retry_count;            // 최대 재시도 횟수 (0이면 무제한)
-    unsigned long last_retry_time;  // 마지막 재시도 시간
+    uint64_t last_retry_time;       // 마지막 재시도 시각 (TIME_GetMonotonicMs, 0이면 아직 없음 - 64비트라 wrap으로 0이 되지 않음)
     unsigned long retry_delay_ms;   // 현재 재시도 지연 시간
 } LoraStarterContext;
 
@@ -0,0 +1,178 @@
+#include "NetFanout.h"
+#include <string.h>
+
+static void _release(NetFanout* fanout, uint8_t buf)
+{
+    if (fanout->pool[buf].refs > 0) {
+        fanout->pool[buf].refs--;
+    }
+}
+
+// 대상 큐의 가장 오래된 버퍼를 꺼내 참조 해제
+static void _pop(NetFanout* fanout, NetFanoutTarget* target)
+{
+    _release(fanout, target->queue[target->head]);
+    target->head = (uint8_t)((target->head + 1) % NET_FANOUT_POOL_SIZE);
+    target->count--;
+    target->stats.queued = target->count;
+}
+
+static int _find_free(const NetFanout* fanout)
+{
+    for (uint8_t i = 0; i < NET_FANOUT_POOL_SIZE; i++) {
+        if (fanout->pool[i].refs == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// 빈 버퍼가 생길 때까지 가장 많이 밀린 대상의 오래된 패킷을 버림
+static int _alloc(NetFanout* fanout)
+{
+    int buf = _find_free(fanout);
+    while (buf < 0) {
+        NetFanoutTarget* slowest = NULL;
+        for (uint8_t i = 0; i < NET_FANOUT_MAX_TARGETS; i++) {
+            NetFanoutTarget* target = &fanout->targets[i];
+            if (target->count > 0 && (slowest == NULL || target->count > slowest->count)) {
+                slowest = target;
+            }
+        }
+        if (slowest == NULL) {
+            return -1;      // 큐가 모두 비었는데 참조가 남음 - 생기면 안 됨
+        }
+        _pop(fanout, slowest);
+        slowest->stats.dropped++;
+        buf = _find_free(fanout);
+    }
+    return buf;
+}
+
+void NetFanout_Init(NetFanout* fanout)
+{
+    if (fanout != NULL) {
+        memset(fanout, 0, sizeof(*fanout));
+    }
+}
+
+int NetFanout_SetTarget(NetFanout* fanout, uint8_t index, NetFanoutSink sink)
+{
+    if (fanout == NULL || index >= NET_FANOUT_MAX_TARGETS) {
+        return NET_FANOUT_INVALID_PARAM;
+    }
+    if (sink == NULL) {
+        NetFanout_Clear(fanout, index);
+    }
+    fanout->targets[index].sink = sink;
+    return NET_FANOUT_OK;
+}
+
+int NetFanout_Submit(NetFanout* fanout, const void* data, size_t size, uint32_t target_mask)
+{
+    NetworkChunk chunk = { data, size };
+    return NetFanout_SubmitV(fanout, &chunk, 1, target_mask);
+}
+
+int NetFanout_SubmitV(NetFanout* fanout, const NetworkChunk* chunks, size_t count, uint32_t target_mask)
+{
+    size_t size = Network_ChunksSize(chunks, count);
+    if (fanout == NULL || size == 0 || size > NET_FANOUT_BUF_SIZE) {
+        return NET_FANOUT_INVALID_PARAM;
+    }
+
+    uint8_t refs = 0;
+    for (uint8_t i = 0; i < NET_FANOUT_MAX_TARGETS; i++) {
+        if ((target_mask & (1U << i)) && fanout->targets[i].sink != NULL) {
+            refs++;
+        }
+    }
+    if (refs == 0) {
+        return NET_FANOUT_ERROR;
+    }
+
+    int buf = _alloc(fanout);
+    if (buf < 0) {
+        return NET_FANOUT_ERROR;
+    }
+    size_t offset = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (chunks[i].size > 0) {
+            memcpy(&fanout->pool[buf].data[offset], chunks[i].data, chunks[i].size);
+            offset += chunks[i].size;
+        }
+    }
+    fanout->pool[buf].size = (uint16_t)size;
+    fanout->pool[buf].refs = refs;
+
+    for (uint8_t i = 0; i < NET_FANOUT_MAX_TARGETS; i++) {
+        NetFanoutTarget* target = &fanout->targets[i];
+        if (!(target_mask & (1U << i)) || target->sink == NULL) {
+            continue;
+        }
+        // 버퍼 하나는 대상마다 최대 한 번만 큐에 있으므로 큐는 넘치지 않음
+        target->queue[(target->head + target->count) % NET_FANOUT_POOL_SIZE] = (uint8_t)buf;
+        target->count++;
+        target->stats.submitted++;
+        target->stats.queued = target->count;
+        if (target->count > target->stats.queue_peak) {
+            target->stats.queue_peak = target->count;
+        }
+    }
+    return NET_FANOUT_OK;
+}
+
+int NetFanout_Drain(NetFanout* fanout, uint8_t index, uint32_t budget)
+{
+    if (fanout == NULL || index >= NET_FANOUT_MAX_TARGETS || fanout->targets[index].sink == NULL) {
+        return 0;
+    }
+
+    NetFanoutTarget* target = &fanout->targets[index];
+    int sent = 0;
+    uint32_t attempts = 0;
+    while (target->count > 0 && (budget == 0 || attempts < budget)) {
+        attempts++;
+        const NetFanoutBuf* buf = &fanout->pool[target->queue[target->head]];
+        int result = target->sink(buf->data, buf->size);
+        if (result == NET_FANOUT_RETRY) {
+            target->stats.retries++;
+            break;
+        }
+        if (result == NET_FANOUT_OK) {
+            target->stats.sent++;
+            sent++;
+        } else {
+            target->stats.errors++;
+        }
+        _pop(fanout, target);
+    }
+    return sent;
+}
+
+void NetFanout_Clear(NetFanout* fanout, uint8_t index)
+{
+    if (fanout == NULL || index >= NET_FANOUT_MAX_TARGETS) {
+        return;
+    }
+    NetFanoutTarget* target = &fanout->targets[index];
+    while (target->count > 0) {
+        _pop(fanout, target);
+    }
+}
+
+uint32_t NetFanout_Pending(const NetFanout* fanout, uint8_t index)
+{
+    if (fanout == NULL || index >= NET_FANOUT_MAX_TARGETS) {
+        return 0;
+    }
+    return fanout->targets[index].count;
+}
+
+void NetFanout_GetStats(const NetFanout* fanout, uint8_t index, NetFanoutStats* stats)
+{
+    if (fanout == NULL || stats == NULL || index >= NET_FANOUT_MAX_TARGETS) {
+        return;
+    }
+    *stats = fanout->targets[index].stats;
+}
@@ -0,0 +1,437 @@
+#include "NetSocket.h"
+
+#if defined(__linux__)
+
+#include "time.h"
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+typedef enum {
+    NET_SOCKET_CLOSED = 0,      // Open 전 / Close 후
+    NET_SOCKET_WAIT_RETRY,      // 백오프 대기 중
+    NET_SOCKET_CONNECTING,      // non-blocking connect 진행 중
+    NET_SOCKET_CONNECTED
+} NetSocketState;
+
+static int g_fd = -1;
+static NetSocketState g_state = NET_SOCKET_CLOSED;
+static NetworkTransport_t g_transport = NETWORK_TRANSPORT_TCP;
+static struct sockaddr_in g_addr;
+
+// 송신 링 (tail에서 읽고 head에 씀)
+static uint8_t g_ring[NET_SOCKET_QUEUE_SIZE];
+static size_t g_ring_head = 0;
+static size_t g_ring_tail = 0;
+static size_t g_ring_used = 0;
+
+// UDP 메시지 길이 (링과 같은 순서)
+static uint16_t g_msg_len[NET_SOCKET_MAX_MESSAGES];
+static size_t g_msg_head = 0;
+static size_t g_msg_tail = 0;
+static size_t g_msg_count = 0;
+
+static uint32_t g_backoff_min_ms = NET_SOCKET_BACKOFF_MIN_MS;
+static uint32_t g_backoff_max_ms = NET_SOCKET_BACKOFF_MAX_MS;
+static uint32_t g_backoff_ms = NET_SOCKET_BACKOFF_MIN_MS;
+static uint32_t g_retry_at_ms = 0;
+
+static uint32_t g_rate_start_ms = 0;
+static uint32_t g_rate_bytes = 0;
+
+static NetworkSocketStats g_stats;
+
+static void _ring_reset(void)
+{
+    g_ring_head = 0;
+    g_ring_tail = 0;
+    g_ring_used = 0;
+    g_msg_head = 0;
+    g_msg_tail = 0;
+    g_msg_count = 0;
+}
+
+static void _ring_consume(size_t size)
+{
+    g_ring_tail = (g_ring_tail + size) % NET_SOCKET_QUEUE_SIZE;
+    g_ring_used -= size;
+}
+
+// tail부터 size 바이트를 가리키는 iovec (링 끝에서 나뉘면 2개)
+static int _ring_iov(struct iovec* iov, size_t size)
+{
+    size_t first = NET_SOCKET_QUEUE_SIZE - g_ring_tail;
+    if (first > size) {
+        first = size;
+    }
+    iov[0].iov_base = &g_ring[g_ring_tail];
+    iov[0].iov_len = first;
+    if (first == size) {
+        return 1;
+    }
+    iov[1].iov_base = &g_ring[0];
+    iov[1].iov_len = size - first;
+    return 2;
+}
+
+static void _close_fd(void)
+{
+    if (g_fd >= 0) {
+        close(g_fd);
+        g_fd = -1;
+    }
+}
+
+static void _on_connected(void)
+{
+    g_state = NET_SOCKET_CONNECTED;
+    g_backoff_ms = g_backoff_min_ms;
+    g_stats.connects++;
+    if (g_transport == NETWORK_TRANSPORT_TCP) {
+        // 묶음은 송신 링에서 이미 처리 - Nagle 지연은 끔
+        int one = 1;
+        setsockopt(g_fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+}
+
+// connect 실패/연결 끊김 - 소켓을 닫고 백오프 후 재연결
+static void _schedule_retry(uint32_t now_ms)
+{
+    _close_fd();
+    g_state = NET_SOCKET_WAIT_RETRY;
+    g_stats.connect_failures++;
+    g_retry_at_ms = now_ms + g_backoff_ms;
+    g_backoff_ms = (g_backoff_ms >= g_backoff_max_ms / 2) ? g_backoff_max_ms : g_backoff_ms * 2;
+}
+
+static void _try_connect(uint32_t now_ms)
+{
+    int type = (g_transport == NETWORK_TRANSPORT_UDP) ? SOCK_DGRAM : SOCK_STREAM;
+    g_fd = socket(AF_INET, type | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (g_fd < 0) {
+        _schedule_retry(now_ms);
+        return;
+    }
+
+    if (connect(g_fd, (const struct sockaddr*)&g_addr, sizeof(g_addr)) == 0) {
+        _on_connected();
+    } else if (errno == EINPROGRESS) {
+        g_state = NET_SOCKET_CONNECTING;
+    } else {
+        _schedule_retry(now_ms);
+    }
+}
+
+static void _check_connecting(uint32_t now_ms)
+{
+    struct pollfd pfd = { .fd = g_fd, .events = POLLOUT, .revents = 0 };
+    if (poll(&pfd, 1, 0) <= 0) {
+        return;
+    }
+
+    int error = 0;
+    socklen_t len = sizeof(error);
+    if (getsockopt(g_fd, SOL_SOCKET, SO_ERROR, &error, &len) == 0 && error == 0) {
+        _on_connected();
+    } else {
+        _schedule_retry(now_ms);
+    }
+}
+
+static int _send_iov(struct iovec* iov, int iov_count)
+{
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = (size_t)iov_count;
+
+    // writev와 같지만 끊긴 연결에 SIGPIPE를 받지 않도록 sendmsg 사용
+    ssize_t sent;
+    do {
+        sent = sendmsg(g_fd, &msg, MSG_NOSIGNAL | MSG_DONTWAIT);
+    } while (sent < 0 && errno == EINTR);
+
+    g_stats.send_calls++;
+    if (sent > 0) {
+        g_stats.bytes_sent += (uint32_t)sent;
+        g_rate_bytes += (uint32_t)sent;
+    }
+    return (int)sent;
+}
+
+// 링 비우기 - 소켓 버퍼가 차면(EAGAIN) 다음 Poll로 미룸
+static void _drain(uint32_t now_ms)
+{
+    struct iovec iov[2];
+
+    while (g_state == NET_SOCKET_CONNECTED && g_ring_used > 0) {
+        size_t size = g_ring_used;
+        size_t messages = 0;
+
+        if (g_transport == NETWORK_TRANSPORT_UDP) {
+            // 데이터그램 하나에 들어가는 만큼 메시지를 묶음 (메시지는 나누지 않음)
+            size = 0;
+            while (messages < g_msg_count) {
+                size_t len = g_msg_len[(g_msg_tail + messages) % NET_SOCKET_MAX_MESSAGES];
+                if (size + len > NET_SOCKET_UDP_MAX_PAYLOAD) {
+                    break;
+                }
+                size += len;
+                messages++;
+            }
+        }
+
+        int sent = _send_iov(iov, _ring_iov(iov, size));
+        if (sent < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != ENOBUFS) {
+                // EPIPE/ECONNRESET/ECONNREFUSED(UDP 수신 측 없음) 등
+                _schedule_retry(now_ms);
+            }
+            return;
+        }
+
+        _ring_consume((size_t)sent);
+        if (g_transport == NETWORK_TRANSPORT_UDP) {
+            g_msg_tail = (g_msg_tail + messages) % NET_SOCKET_MAX_MESSAGES;
+            g_msg_count -= messages;
+        } else if ((size_t)sent < size) {
+            return;     // 부분 전송 - 소켓 버퍼 가득
+        }
+    }
+}
+
+static void _update_rate(uint32_t now_ms)
+{
+    uint32_t elapsed = now_ms - g_rate_start_ms;
+    if (elapsed >= NET_SOCKET_RATE_WINDOW_MS) {
+        g_stats.bytes_per_sec = (uint32_t)(((uint64_t)g_rate_bytes * 1000U) / elapsed);
+        g_rate_bytes = 0;
+        g_rate_start_ms = now_ms;
+    }
+}
+
+int NetSocket_Open(const char* server_ip, uint16_t port, NetworkTransport_t transport)
+{
+    if (server_ip == NULL || port == 0) {
+        return NETWORK_INVALID_PARAM;
+    }
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, server_ip, &addr.sin_addr) != 1) {
+        return NETWORK_INVALID_PARAM;
+    }
+
+    if (g_state != NET_SOCKET_CLOSED) {
+        NetSocket_Close();
+    }
+
+    g_addr = addr;
+    g_transport = transport;
+    _ring_reset();
+    memset(&g_stats, 0, sizeof(g_stats));
+    g_backoff_ms = g_backoff_min_ms;
+
+    uint32_t now = TIME_GetCurrentMs();
+    g_rate_start_ms = now;
+    g_rate_bytes = 0;
+    _try_connect(now);
+    return NETWORK_OK;
+}
+
+void NetSocket_Close(void)
+{
+    if (g_state == NET_SOCKET_CLOSED) {
+        return;
+    }
+    if (g_state == NET_SOCKET_CONNECTED) {
+        NetSocket_Flush(NET_SOCKET_CLOSE_FLUSH_MS);
+    }
+    _close_fd();
+    _ring_reset();
+    g_state = NET_SOCKET_CLOSED;
+}
+
+// 조각들을 skip 바이트 뒤부터 링 head에 복사
+static void _ring_write(const NetworkChunk* chunks, size_t count, size_t skip)
+{
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t* src = (const uint8_t*)chunks[i].data;
+        size_t size = chunks[i].size;
+        if (skip >= size) {
+            skip -= size;
+            continue;
+        }
+        src += skip;
+        size -= skip;
+        skip = 0;
+
+        size_t first = NET_SOCKET_QUEUE_SIZE - g_ring_head;
+        if (first > size) {
+            first = size;
+        }
+        memcpy(&g_ring[g_ring_head], src, first);
+        memcpy(&g_ring[0], src + first, size - first);
+        g_ring_head = (g_ring_head + size) % NET_SOCKET_QUEUE_SIZE;
+        g_ring_used += size;
+    }
+}
+
+// 링이 비어 있으면 조각을 그대로 sendmsg (writev) - 보낸 바이트 수, 못 보냈으면 0
+static size_t _send_direct(const NetworkChunk* chunks, size_t count, size_t size)
+{
+    struct iovec iov[NETWORK_MAX_CHUNKS];
+    int iov_count = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (chunks[i].size > 0) {
+            iov[iov_count].iov_base = (void*)chunks[i].data;
+            iov[iov_count].iov_len = chunks[i].size;
+            iov_count++;
+        }
+    }
+
+    int sent = _send_iov(iov, iov_count);
+    if (sent < 0) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != ENOBUFS) {
+            _schedule_retry(TIME_GetCurrentMs());
+        }
+        return 0;
+    }
+    // UDP 데이터그램은 전부 아니면 실패
+    return (g_transport == NETWORK_TRANSPORT_UDP && (size_t)sent != size) ? 0 : (size_t)sent;
+}
+
+int NetSocket_Send(const void* data, size_t size)
+{
+    NetworkChunk chunk = { data, size };
+    return NetSocket_SendV(&chunk, 1);
+}
+
+int NetSocket_SendV(const NetworkChunk* chunks, size_t count)
+{
+    if (g_state == NET_SOCKET_CLOSED) {
+        return NETWORK_NOT_CONNECTED;
+    }
+    size_t size = Network_ChunksSize(chunks, count);
+    if (size == 0) {
+        return NETWORK_INVALID_PARAM;
+    }
+    if (g_transport == NETWORK_TRANSPORT_UDP && size > NET_SOCKET_UDP_MAX_PAYLOAD) {
+        return NETWORK_INVALID_PARAM;
+    }
+
+    if (size > NET_SOCKET_QUEUE_SIZE - g_ring_used ||
+        (g_transport == NETWORK_TRANSPORT_UDP && g_msg_count == NET_SOCKET_MAX_MESSAGES)) {
+        // 링에 자리가 없으면 먼저 비워 보고 그래도 없으면 버림
+        NetSocket_Poll();
+        if (size > NET_SOCKET_QUEUE_SIZE - g_ring_used ||
+            (g_transport == NETWORK_TRANSPORT_UDP && g_msg_count == NET_SOCKET_MAX_MESSAGES)) {
+            g_stats.messages_dropped++;
+            g_stats.bytes_dropped += (uint32_t)size;
+            return NETWORK_QUEUE_FULL;
+        }
+    }
+
+    // 앞에 밀린 데이터가 없으면 링을 거치지 않고 바로 전송, 못 보낸 나머지만 링에 복사
+    size_t sent = 0;
+    if (g_state == NET_SOCKET_CONNECTED && g_ring_used == 0) {
+        sent = _send_direct(chunks, count, size);
+    }
+    if (sent < size) {
+        _ring_write(chunks, count, sent);
+        if (g_transport == NETWORK_TRANSPORT_UDP) {
+            g_msg_len[g_msg_head] = (uint16_t)size;
+            g_msg_head = (g_msg_head + 1) % NET_SOCKET_MAX_MESSAGES;
+            g_msg_count++;
+        }
+    }
+
+    g_stats.messages_queued++;
+    if (g_ring_used > g_stats.queue_peak_bytes) {
+        g_stats.queue_peak_bytes = (uint32_t)g_ring_used;
+    }
+
+    NetSocket_Poll();
+    return NETWORK_OK;
+}
+
+int NetSocket_Poll(void)
+{
+    uint32_t now = TIME_GetCurrentMs();
+
+    switch (g_state) {
+        case NET_SOCKET_CLOSED:
+            return NETWORK_NOT_CONNECTED;
+
+        case NET_SOCKET_WAIT_RETRY:
+            if ((int32_t)(now - g_retry_at_ms) >= 0) {
+                _try_connect(now);
+            }
+            break;
+
+        case NET_SOCKET_CONNECTING:
+            _check_connecting(now);
+            break;
+
+        case NET_SOCKET_CONNECTED:
+            break;
+    }
+
+    // connect가 바로 끝났으면 같은 호출에서 전송까지
+    _drain(now);
+    _update_rate(now);
+    return (g_state == NET_SOCKET_CONNECTED) ? NETWORK_OK : NETWORK_NOT_CONNECTED;
+}
+
+int NetSocket_Flush(uint32_t timeout_ms)
+{
+    for (uint32_t waited = 0; ; waited++) {
+        NetSocket_Poll();
+        if (g_ring_used == 0) {
+            return NETWORK_OK;
+        }
+        if (g_state == NET_SOCKET_CLOSED || waited >= timeout_ms) {
+            return NETWORK_TIMEOUT;
+        }
+
+        // 연결 중/소켓 버퍼 가득이면 쓰기 가능해질 때까지, 백오프 중이면 그냥 1ms 대기
+        struct pollfd pfd = { .fd = g_fd, .events = POLLOUT, .revents = 0 };
+        poll(&pfd, (g_fd >= 0) ? 1 : 0, 1);
+    }
+}
+
+bool NetSocket_IsLinkUp(void)
+{
+    return g_state == NET_SOCKET_CONNECTED;
+}
+
+void NetSocket_SetBackoff(uint32_t min_ms, uint32_t max_ms)
+{
+    g_backoff_min_ms = (min_ms > 0) ? min_ms : NET_SOCKET_BACKOFF_MIN_MS;
+    g_backoff_max_ms = (max_ms > 0) ? max_ms : NET_SOCKET_BACKOFF_MAX_MS;
+    if (g_backoff_max_ms < g_backoff_min_ms) {
+        g_backoff_max_ms = g_backoff_min_ms;
+    }
+    g_backoff_ms = g_backoff_min_ms;
+}
+
+void NetSocket_GetStats(NetworkSocketStats* stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    *stats = g_stats;
+    stats->queue_bytes = (uint32_t)g_ring_used;
+    stats->backoff_ms = g_backoff_ms;
+    stats->link_up = (g_state == NET_SOCKET_CONNECTED);
+}
+
+#endif // __linux__
@@ -0,0 +1,59 @@
+#ifndef NETSOCKET_H
+#define NETSOCKET_H
+
+#include "Network.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// 호스트(Linux) 소켓 전송 - Network 소켓 백엔드의 실제 구현
+//
+// NetSocket_Send는 데이터를 고정 크기 송신 링에 복사하고 바로 돌아옴 (블로킹 없음)
+// 링이 비어 있으면 복사 전에 바로 보내 봄 (NetSocket_SendV)
+// 링은 non-blocking 소켓으로 비움 (NetSocket_Poll, Send 끝에서도 한 번 시도):
+//   TCP - 링에 쌓인 바이트 전체를 sendmsg 한 번으로 (링 끝에서 나뉘면 iovec 2개)
+//         부분 전송이면 남은 부분은 다음 Poll에서 이어서 보냄
+//   UDP - 메시지 경계 유지, 데이터그램 하나(NET_SOCKET_UDP_MAX_PAYLOAD)에 들어가는 만큼
+//         메시지를 묶어 전송 (LogFrame은 자체 길이/CRC가 있어 수신 측이 나눠 읽음)
+// connect 실패/연결 끊김이면 지수 백오프(min -> x2 -> max)로 재연결, 링 데이터는 유지
+// (끊기기 직전 커널에 넘긴 TCP 데이터는 잃을 수 있음 - 수신 측은 프레임 seq로 확인)
+// 링이 가득 차면 새 메시지는 거부 (NETWORK_QUEUE_FULL), 이미 넣은 데이터는 보존
+// 시각은 TIME_GetCurrentMs 기준 (테스트는 mock 시간으로 백오프를 진행)
+
+#define NET_SOCKET_QUEUE_SIZE           (64U * 1024U)   // 송신 링 바이트
+#define NET_SOCKET_MAX_MESSAGES         1024U           // UDP 메시지 경계 기록 수
+#define NET_SOCKET_UDP_MAX_PAYLOAD      1472U           // 이더넷 MTU 1500 - IP/UDP 헤더
+#define NET_SOCKET_BACKOFF_MIN_MS       100U
+#define NET_SOCKET_BACKOFF_MAX_MS       10000U
+#define NET_SOCKET_RATE_WINDOW_MS       1000U           // bytes/s 계산 구간
+#define NET_SOCKET_CLOSE_FLUSH_MS       200U            // 해제 시 남은 데이터 전송 대기
+
+// 소켓 생성 후 non-blocking connect 시작 (연결 완료를 기다리지 않음)
+// 서버가 아직 없어도 NETWORK_OK - 데이터는 링에 쌓이고 백오프로 재연결
+int NetSocket_Open(const char* server_ip, uint16_t port, NetworkTransport_t transport);
+
+// 남은 데이터를 잠시(NET_SOCKET_CLOSE_FLUSH_MS) 보내 보고 소켓 해제, 링은 비움
+void NetSocket_Close(void);
+
+// 송신 링에 추가 후 전송 시도
+int NetSocket_Send(const void* data, size_t size);
+
+// 조각들을 한 메시지로 전송 - 링이 비어 있고 연결돼 있으면 조각을 그대로 sendmsg (링 복사 없음),
+// 소켓 버퍼가 차서 못 보낸 나머지만 링에 복사 (UDP는 데이터그램 하나로)
+int NetSocket_SendV(const NetworkChunk* chunks, size_t count);
+
+// 재연결/connect 완료 확인/링 비우기 (주기 호출), 연결돼 있으면 NETWORK_OK
+int NetSocket_Poll(void);
+
+// 링이 빌 때까지 최대 timeout_ms 대기 (1ms 단위 poll), 남으면 NETWORK_TIMEOUT
+int NetSocket_Flush(uint32_t timeout_ms);
+
+// 현재 연결(TCP 연결 완료/UDP connect 성공) 여부
+bool NetSocket_IsLinkUp(void);
+
+// 재연결 백오프 범위 변경 (0이면 기본값)
+void NetSocket_SetBackoff(uint32_t min_ms, uint32_t max_ms);
+
+void NetSocket_GetStats(NetworkSocketStats* stats);
+
+#endif // NETSOCKET_H
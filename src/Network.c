@@ -1,33 +1,280 @@
 #include "Network.h"
+#include "NetFanout.h"
 #include "SDStorage.h"
 #include <string.h>
+#ifdef STM32F746xx
+// 타겟에서는 FatFs를 SD 태스크만 사용 - SD 백엔드는 SD 서비스 요청 큐 경유
+#include "SDService.h"
+#include "system_config.h"
+#endif
+#if !defined(STM32F746xx) && defined(__linux__)
+// 호스트(Linux)에서는 실제 소켓으로 전송 - 그 외 빌드의 소켓 백엔드는 연결 상태만 흉내
+#define NETWORK_HAS_SOCKET 1
+#include "NetSocket.h"
+#include "StoreForward.h"
+#include "time.h"
+#endif
 #include <stddef.h>
 
-static bool g_connected = false;
+static bool g_connected[NETWORK_BACKEND_COUNT] = {false};
 static char g_server_ip[16] = {0};
 static uint16_t g_server_port = 0;
 static NetworkBackend_t g_backend = NETWORK_BACKEND_SOCKET;
+static uint32_t g_backends = 1U << NETWORK_BACKEND_SOCKET;     // 사용 백엔드 (bit = NetworkBackend_t)
+static NetworkTransport_t g_transport = NETWORK_TRANSPORT_TCP;
+
+// 백엔드가 2개 이상이면 패킷을 fan-out 큐로 나눠 보냄 (1개면 바로 전송, 복사 없음)
+static NetFanout g_fanout;
+static bool g_fanout_ready = false;
+
+#ifdef NETWORK_HAS_SOCKET
+// 송신 큐가 넘친 패킷 보관 (재연결/재초기화 후에도 유지되어 다음 연결로 재전송)
+static StoreForward g_forward;
+static bool g_forward_ready = false;
+
+// spill 파일은 SD 로그와 같은 볼륨 - SD 초기화(마운트 실패 시 포맷 포함)는 소유자
+// (SDStorage_Init/Network_InitSD 호출 측) 몫이므로 여기서는 하지 않고 spill 실패로 처리
+static int _spill_write(uint32_t offset, const void* data, size_t size)
+{
+    if (!SDStorage_IsReady()) {
+        return NETWORK_ERROR;
+    }
+    return (SDStorage_SpillWrite(offset, data, size) == SDSTORAGE_OK) ? NETWORK_OK : NETWORK_ERROR;
+}
+
+static int _spill_read(uint32_t offset, void* buf, size_t size, size_t* read_len)
+{
+    return (SDStorage_SpillRead(offset, buf, size, read_len) == SDSTORAGE_OK) ? NETWORK_OK : NETWORK_ERROR;
+}
+
+static int _spill_clear(void)
+{
+    return (SDStorage_SpillClear() == SDSTORAGE_OK) ? NETWORK_OK : NETWORK_ERROR;
+}
+
+static const StoreForwardSpill g_spill = { _spill_write, _spill_read, _spill_clear };
+
+static int _socket_send(const NetworkChunk* chunks, size_t count, size_t size)
+{
+    int result = NetSocket_SendV(chunks, count);
+    if (result != NETWORK_QUEUE_FULL) {
+        return result;
+    }
+    // 송신 큐 가득 (연결 끊김이 길어짐/수신 측이 느림) - 보관 후 Network_Poll에서 재전송
+    // 보관 레코드는 연속이어야 하므로 조각이 여럿이면 여기서만 한 번 모음 (장애 시 경로)
+    if (count == 1) {
+        return (StoreForward_Store(&g_forward, chunks[0].data, size) == STORE_FORWARD_OK) ? NETWORK_OK
+                                                                                          : NETWORK_QUEUE_FULL;
+    }
+    uint8_t packet[STORE_FORWARD_MAX_PACKET];
+    if (size > sizeof(packet)) {
+        return NETWORK_QUEUE_FULL;
+    }
+    size_t offset = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (chunks[i].size > 0) {
+            memcpy(&packet[offset], chunks[i].data, chunks[i].size);
+            offset += chunks[i].size;
+        }
+    }
+    return (StoreForward_Store(&g_forward, packet, size) == STORE_FORWARD_OK) ? NETWORK_OK : NETWORK_QUEUE_FULL;
+}
+#endif
+
+static int _send_socket(const NetworkChunk* chunks, size_t count, size_t size)
+{
+#ifdef NETWORK_HAS_SOCKET
+    return _socket_send(chunks, count, size);
+#else
+    (void)chunks;
+    (void)count;
+    (void)size;
+    return NETWORK_OK;
+#endif
+}
+
+static int _send_sd(const NetworkChunk* chunks, size_t count)
+{
+    // 조각 설명자만 옮김 (데이터 복사 없음)
+    SDStorageChunk parts[NETWORK_MAX_CHUNKS];
+    for (size_t i = 0; i < count; i++) {
+        parts[i].data = chunks[i].data;
+        parts[i].size = chunks[i].size;
+    }
+#ifdef STM32F746xx
+    int result = SDService_AppendV(parts, count);
+#else
+    int result = SDStorage_WriteLogV(parts, count);
+#endif
+    switch (result) {
+        case SDSTORAGE_OK:
+            return NETWORK_OK;
+        case SDSTORAGE_NOT_READY:
+            return NETWORK_NOT_CONNECTED;
+        case RESULT_ERROR_BUSY:
+            return NETWORK_QUEUE_FULL;     // SD 서비스 요청 큐 가득 (타겟)
+        case SDSTORAGE_INVALID_PARAM:
+            return NETWORK_INVALID_PARAM;
+        case SDSTORAGE_DISK_FULL:
+        case SDSTORAGE_FILE_ERROR:
+        default:
+            return NETWORK_ERROR;
+    }
+}
+
+// fan-out sink - 송신 큐/SD가 잠시 막힌 경우는 큐에 두고 다음 Poll에서 다시 시도
+static int _fanout_socket(const void* data, size_t size)
+{
+    NetworkChunk chunk = { data, size };
+    int result = _send_socket(&chunk, 1, size);
+    if (result == NETWORK_QUEUE_FULL) {
+        return NET_FANOUT_RETRY;
+    }
+    return (result == NETWORK_OK) ? NET_FANOUT_OK : NET_FANOUT_ERROR;
+}
+
+static int _fanout_sd(const void* data, size_t size)
+{
+    NetworkChunk chunk = { data, size };
+    int result = _send_sd(&chunk, 1);
+    if (result == NETWORK_NOT_CONNECTED || result == NETWORK_QUEUE_FULL) {
+        return NET_FANOUT_RETRY;
+    }
+    return (result == NETWORK_OK) ? NET_FANOUT_OK : NET_FANOUT_ERROR;
+}
+
+static void _fanout_init(void)
+{
+    if (!g_fanout_ready) {
+        NetFanout_Init(&g_fanout);
+        NetFanout_SetTarget(&g_fanout, NETWORK_BACKEND_SOCKET, _fanout_socket);
+        NetFanout_SetTarget(&g_fanout, NETWORK_BACKEND_SD_CARD, _fanout_sd);
+        g_fanout_ready = true;
+    }
+}
+
+static bool _is_fanout(void)
+{
+    return (g_backends & (g_backends - 1U)) != 0;
+}
+
+// 연결된 백엔드 bit
+static uint32_t _connected_mask(void)
+{
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < NETWORK_BACKEND_COUNT; i++) {
+        if ((g_backends & (1U << i)) && g_connected[i]) {
+            mask |= 1U << i;
+        }
+    }
+    return mask;
+}
+
+// 남은 fan-out 패킷을 보내고 백엔드 해제
+static void _disconnect_backend(NetworkBackend_t backend)
+{
+    if (!g_connected[backend]) {
+        return;
+    }
+    if (g_fanout_ready) {
+        NetFanout_Drain(&g_fanout, (uint8_t)backend, 0);
+        NetFanout_Clear(&g_fanout, (uint8_t)backend);
+    }
+
+    // 백엔드별 해제 처리
+    switch (backend) {
+        case NETWORK_BACKEND_SOCKET:
+#ifdef NETWORK_HAS_SOCKET
+            NetSocket_Close();
+#endif
+            memset(g_server_ip, 0, sizeof(g_server_ip));
+            g_server_port = 0;
+            break;
+
+        case NETWORK_BACKEND_SD_CARD:
+#ifdef STM32F746xx
+            // 볼륨은 SD 태스크 소유 - 남은 로그만 기록 요청
+            SDService_Submit(SDSERVICE_REQ_FLUSH, NULL, NULL);
+#else
+            SDStorage_Disconnect();
+#endif
+            break;
+
+        default:
+            break;
+    }
+
+    g_connected[backend] = false;
+}
 
 int Network_SetBackend(NetworkBackend_t backend)
 {
+    if ((uint32_t)backend >= NETWORK_BACKEND_COUNT) {
+        return NETWORK_INVALID_PARAM;
+    }
+    for (uint32_t i = 0; i < NETWORK_BACKEND_COUNT; i++) {
+        if (i != (uint32_t)backend) {
+            _disconnect_backend((NetworkBackend_t)i);
+        }
+    }
     g_backend = backend;
+    g_backends = 1U << backend;
     return NETWORK_OK;
 }
 
+int Network_EnableBackend(NetworkBackend_t backend, bool enable)
+{
+    if ((uint32_t)backend >= NETWORK_BACKEND_COUNT) {
+        return NETWORK_INVALID_PARAM;
+    }
+    if (enable) {
+        g_backends |= 1U << backend;
+        _fanout_init();
+        return NETWORK_OK;
+    }
+
+    _disconnect_backend(backend);
+    g_backends &= ~(1U << backend);
+    if (g_backend == backend && g_backends != 0) {
+        g_backend = (g_backends & (1U << NETWORK_BACKEND_SOCKET)) ? NETWORK_BACKEND_SOCKET
+                                                                  : NETWORK_BACKEND_SD_CARD;
+    }
+    return NETWORK_OK;
+}
+
+bool Network_IsBackendEnabled(NetworkBackend_t backend)
+{
+    return (uint32_t)backend < NETWORK_BACKEND_COUNT && (g_backends & (1U << backend)) != 0;
+}
+
 NetworkBackend_t Network_GetBackend(void)
 {
     return g_backend;
 }
 
+int Network_SetTransport(NetworkTransport_t transport)
+{
+    if (transport != NETWORK_TRANSPORT_TCP && transport != NETWORK_TRANSPORT_UDP) {
+        return NETWORK_INVALID_PARAM;
+    }
+    g_transport = transport;
+    return NETWORK_OK;
+}
+
 int Network_InitSD(void)
 {
-    if (g_backend != NETWORK_BACKEND_SD_CARD) {
+    if (!Network_IsBackendEnabled(NETWORK_BACKEND_SD_CARD)) {
         return NETWORK_ERROR;
     }
     
+#ifdef STM32F746xx
+    // 마운트는 SD 태스크 담당 - 준비될 때까지 대기만 함
+    int result = SDService_WaitReady(SD_SERVICE_READY_WAIT_MS) ? SDSTORAGE_OK : SDSTORAGE_NOT_READY;
+#else
     int result = SDStorage_Init();
+#endif
     if (result == SDSTORAGE_OK) {
-        g_connected = true;
+        g_connected[NETWORK_BACKEND_SD_CARD] = true;
         return NETWORK_OK;
     }
     
@@ -36,7 +283,7 @@ int Network_InitSD(void)
 
 int Network_Init(const char* server_ip, uint16_t port)
 {
-    if (g_backend != NETWORK_BACKEND_SOCKET) {
+    if (!Network_IsBackendEnabled(NETWORK_BACKEND_SOCKET)) {
         return NETWORK_ERROR;
     }
     
@@ -49,46 +296,59 @@ int Network_Init(const char* server_ip, uint16_t port)
     g_server_ip[sizeof(g_server_ip) - 1] = '\0';
     g_server_port = port;
     
-    // 실제 구현에서는 소켓 생성 및 연결
-    // 지금은 테스트를 위한 최소 구현
-    g_connected = true;
+#ifdef NETWORK_HAS_SOCKET
+    // 연결 완료는 기다리지 않음 - 전송 큐가 연결/재연결을 처리
+    int result = NetSocket_Open(server_ip, port, g_transport);
+    if (result != NETWORK_OK) {
+        return result;
+    }
+    if (!g_forward_ready) {
+        StoreForward_Init(&g_forward, &g_spill, STORE_FORWARD_DRAIN_BPS);
+        g_forward_ready = true;
+    }
+#endif
+    g_connected[NETWORK_BACKEND_SOCKET] = true;
     
     return NETWORK_OK;
 }
 
 int Network_SendBinary(const void* data, size_t size)
 {
-    if (!g_connected) {
+    NetworkChunk chunk = { data, size };
+    return Network_SendBinaryV(&chunk, 1);
+}
+
+int Network_SendBinaryV(const NetworkChunk* chunks, size_t count)
+{
+    uint32_t connected = _connected_mask();
+    if (connected == 0) {
         return NETWORK_NOT_CONNECTED;
     }
     
-    if (data == NULL || size == 0) {
+    size_t size = Network_ChunksSize(chunks, count);
+    if (size == 0) {
         return NETWORK_INVALID_PARAM;
     }
     
+    if (_is_fanout()) {
+        // 버퍼에 한 번만 복사해 백엔드 큐에 나눠 넣음 - 소켓은 바로 송신 링으로, SD는 Network_Poll에서
+        if (size > NET_FANOUT_BUF_SIZE) {
+            return NETWORK_INVALID_PARAM;
+        }
+        if (NetFanout_SubmitV(&g_fanout, chunks, count, connected) != NET_FANOUT_OK) {
+            return NETWORK_ERROR;
+        }
+        NetFanout_Drain(&g_fanout, NETWORK_BACKEND_SOCKET, 0);
+        return NETWORK_OK;
+    }
+    
     // 백엔드에 따른 분기 처리
     switch (g_backend) {
         case NETWORK_BACKEND_SOCKET:
-            // 실제 구현에서는 소켓을 통한 데이터 전송
-            // 지금은 테스트를 위한 최소 구현
-            return NETWORK_OK;
+            return _send_socket(chunks, count, size);
             
         case NETWORK_BACKEND_SD_CARD:
-            {
-                int result = SDStorage_WriteLog(data, size);
-                switch (result) {
-                    case SDSTORAGE_OK:
-                        return NETWORK_OK;
-                    case SDSTORAGE_NOT_READY:
-                        return NETWORK_NOT_CONNECTED;
-                    case SDSTORAGE_INVALID_PARAM:
-                        return NETWORK_INVALID_PARAM;
-                    case SDSTORAGE_DISK_FULL:
-                    case SDSTORAGE_FILE_ERROR:
-                    default:
-                        return NETWORK_ERROR;
-                }
-            }
+            return _send_sd(chunks, count);
             
         default:
             return NETWORK_ERROR;
@@ -97,28 +357,107 @@ int Network_SendBinary(const void* data, size_t size)
 
 bool Network_IsConnected(void)
 {
-    if (g_backend == NETWORK_BACKEND_SD_CARD) {
-        return g_connected && SDStorage_IsReady();
+    uint32_t connected = _connected_mask();
+    if (connected & (1U << NETWORK_BACKEND_SD_CARD)) {
+#ifdef STM32F746xx
+        bool sd_ready = SDService_IsReady();
+#else
+        bool sd_ready = SDStorage_IsReady();
+#endif
+        if (!sd_ready) {
+            connected &= ~(1U << NETWORK_BACKEND_SD_CARD);
+        }
     }
-    return g_connected;
+    return connected != 0;
 }
 
 void Network_Disconnect(void)
 {
-    if (g_connected) {
-        // 백엔드별 해제 처리
-        switch (g_backend) {
-            case NETWORK_BACKEND_SOCKET:
-                // 실제 구현에서는 소켓 해제
-                memset(g_server_ip, 0, sizeof(g_server_ip));
-                g_server_port = 0;
-                break;
-                
-            case NETWORK_BACKEND_SD_CARD:
-                SDStorage_Disconnect();
-                break;
+    for (uint32_t i = 0; i < NETWORK_BACKEND_COUNT; i++) {
+        _disconnect_backend((NetworkBackend_t)i);
+    }
+}
+
+int Network_Poll(void)
+{
+    uint32_t connected = _connected_mask();
+    if (connected == 0) {
+        return NETWORK_NOT_CONNECTED;
+    }
+#ifdef NETWORK_HAS_SOCKET
+    if (connected & (1U << NETWORK_BACKEND_SOCKET)) {
+        NetSocket_Poll();
+        if (NetSocket_IsLinkUp() && !StoreForward_IsEmpty(&g_forward)) {
+            StoreForward_Drain(&g_forward, NetSocket_Send, TIME_GetCurrentMs());
         }
-        
-        g_connected = false;
     }
+#endif
+    if (g_fanout_ready) {
+        NetFanout_Drain(&g_fanout, NETWORK_BACKEND_SOCKET, 0);
+        // SD 쓰기는 느릴 수 있어 Poll마다 몇 개씩만 - 호출자(실시간 전송)를 오래 잡지 않음
+        NetFanout_Drain(&g_fanout, NETWORK_BACKEND_SD_CARD, NETWORK_FANOUT_SD_BUDGET);
+    }
+    return NETWORK_OK;
+}
+
+int Network_Flush(uint32_t timeout_ms)
+{
+    uint32_t connected = _connected_mask();
+    if (connected == 0) {
+        return NETWORK_NOT_CONNECTED;
+    }
+    if (g_fanout_ready) {
+        NetFanout_Drain(&g_fanout, NETWORK_BACKEND_SOCKET, 0);
+        NetFanout_Drain(&g_fanout, NETWORK_BACKEND_SD_CARD, 0);
+    }
+#ifdef NETWORK_HAS_SOCKET
+    if (connected & (1U << NETWORK_BACKEND_SOCKET)) {
+        return NetSocket_Flush(timeout_ms);
+    }
+#else
+    (void)timeout_ms;
+#endif
+    return NETWORK_OK;
+}
+
+int Network_GetBackendStats(NetworkBackend_t backend, NetworkBackendStats* stats)
+{
+    if (stats == NULL || (uint32_t)backend >= NETWORK_BACKEND_COUNT) {
+        return NETWORK_INVALID_PARAM;
+    }
+    memset(stats, 0, sizeof(*stats));
+    if (g_fanout_ready) {
+        NetFanoutStats fanout;
+        NetFanout_GetStats(&g_fanout, (uint8_t)backend, &fanout);
+        stats->submitted = fanout.submitted;
+        stats->sent = fanout.sent;
+        stats->dropped = fanout.dropped;
+        stats->errors = fanout.errors;
+        stats->retries = fanout.retries;
+        stats->queued = fanout.queued;
+        stats->queue_peak = fanout.queue_peak;
+    }
+    return NETWORK_OK;
+}
+
+int Network_GetSocketStats(NetworkSocketStats* stats)
+{
+    if (stats == NULL) {
+        return NETWORK_INVALID_PARAM;
+    }
+#ifdef NETWORK_HAS_SOCKET
+    NetSocket_GetStats(stats);
+
+    StoreForwardStats forward;
+    memset(&forward, 0, sizeof(forward));
+    StoreForward_GetStats(&g_forward, &forward);
+    stats->stored_packets = forward.stored;
+    stats->spilled_packets = forward.spilled;
+    stats->replayed_packets = forward.replayed;
+    stats->dropped_packets = forward.dropped;
+    stats->backlog_bytes = forward.ram_bytes + forward.spill_bytes;
+#else
+    memset(stats, 0, sizeof(*stats));
+#endif
+    return NETWORK_OK;
 }
\ No newline at end of file
@@ -1,113 +1,1335 @@
 #include "SDStorage.h"
+#include "LogCompress.h"
+#include "LogJournal.h"
+#include "LogTimeIndex.h"
+#include "FlushPolicy.h"
+#include "Checksum.h"
+#include "logger.h"
+#include "system_config.h"
 #include <string.h>
 #include <stdio.h>
+#include <stddef.h>
+
+// 플랫폼별 HAL 헤더
+#ifdef STM32F746xx
+#include "stm32f7xx_hal.h"
+extern UART_HandleTypeDef huart6;
+extern SD_HandleTypeDef hsd1;  // SD 핸들 선언 추가
+#endif
+
+// FatFs 경로: 타겟(SD 카드) 또는 호스트 디스크 이미지(SDSTORAGE_HOST_FATFS, 테스트/벤치마크)
+#if defined(STM32F746xx) || defined(SDSTORAGE_HOST_FATFS)
+#define SDSTORAGE_USE_FATFS
+#endif
 
 // 플랫폼별 조건부 컴파일
 #ifdef STM32F746xx
 #include "fatfs.h"
-#include "rtc.h"
+#include "main.h"  // RTC handle과 타입 정의
+#define SD_TICK_MS()        HAL_GetTick()
+#define SD_DELAY_MS(ms)     HAL_Delay(ms)
+// 지연 측정: DWT 사이클 카운터 (216MHz에서 약 19.8초까지 측정 가능)
+#define SD_LAT_START()          DWT->CYCCNT
+#define SD_LAT_ELAPSED_US(s)    ((DWT->CYCCNT - (s)) / (SystemCoreClock / 1000000U))
+#elif defined(SDSTORAGE_HOST_FATFS)
+// 호스트: sd_diskio_image 드라이버가 SDFatFS/SDPath 제공, 시간은 time 모듈 (테스트는 mock)
+#include "sd_diskio_image.h"
+#include "time.h"
+#define SD_TICK_MS()        TIME_GetCurrentMs()
+#define SD_DELAY_MS(ms)     TIME_DelayMs(ms)
+#define SD_LAT_START()          TIME_GetCurrentMs()
+#define SD_LAT_ELAPSED_US(s)    ((TIME_GetCurrentMs() - (s)) * 1000U)
+// 호스트 logger.h에는 시간 기준이 없으므로 테스트(스텁)/벤치마크(타겟 logger)가 제공
+uint32_t LOGGER_GetTimestamp(void);
 #else
 // PC/테스트 환경에서는 파일 I/O 시뮬레이션
 #include <time.h>
 #include <stdio.h>
 #include <stdlib.h>
+#define SD_LAT_START()          0U
+#define SD_LAT_ELAPSED_US(s)    ((void)(s), 0U)
+#endif
+
+// 내부 상태 관리
+static bool g_sd_ready = false;
+static char g_current_log_file[256] = {0};
+static size_t g_current_log_size = 0;
+static bool g_directory_available = false;  // 디렉토리 사용 가능 여부
+#define SDSTORAGE_SPILL_NAME_MAX 96
+static char g_spill_file[SDSTORAGE_SPILL_NAME_MAX] = SDSTORAGE_SPILL_FILE;  // SDStorage_SetSpillFile
+
+// 동작별 지연 히스토그램 (SD 태스크에서만 갱신/조회)
+static LatencyHist g_latency[SDSTORAGE_LAT_COUNT];
+static const char* const g_latency_names[SDSTORAGE_LAT_COUNT] = {
+    "f_write", "f_sync", "mount", "rotate"
+};
+
+static uint32_t _latency_record(SDStorageLatencyOp op, uint32_t start) {
+    uint32_t us = SD_LAT_ELAPSED_US(start);
+    LatencyHist_Record(&g_latency[op], us);
+    return us;
+}
+
+static void _latency_clock_init(void) {
+#ifdef STM32F746xx
+    // DWT 사이클 카운터 활성화 (디버거 미연결 시에도 동작, F7은 잠금 해제 필요)
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->LAR = 0xC5ACCE55;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
 #endif
+}
+
+#ifdef SDSTORAGE_USE_FATFS
+// 지속적 파일 핸들 시스템 (한 번 열어두고 계속 사용)
+static FIL g_persistent_log_file;  // 지속적으로 열려있는 로그 파일
+static bool g_file_is_open = false;  // 파일이 열려있는 상태 추적
+
+// 압축 스트림 상태 (파일 단위로 히스토리 리셋, 블록 경계는 flush 지점에 맞춤)
+static LogCompressor g_compressor;
+static bool g_compress_file = false;  // 현재 파일이 .LZL 압축 파일인지
+
+// 저널 상태 (.LJR: 레코드마다 CRC32, 마운트 시 앞에서부터 검사해 찢어진 꼬리 복구)
+static LogJournalWriter g_journal;
+static bool g_journal_file = false;   // 현재 파일이 .LJR 저널 파일인지
+static int g_current_file_number = 0;
+
+// 섹터 정렬 write-behind 버퍼: 가득 찼을 때만 섹터 단위로 f_write
+// 파일 오프셋이 섹터 경계에서 시작하도록 첫 청크 크기(g_wb_limit)를 조정
+static uint8_t g_wb_buffer[SD_WRITE_BEHIND_SIZE] __attribute__((aligned(32)));
+static size_t g_wb_len = 0;
+static size_t g_wb_limit = SD_WRITE_BEHIND_SIZE;
+static uint32_t g_unsynced_bytes = 0;   // f_write 했지만 f_sync 전인 바이트
+static uint32_t g_last_sync_tick = 0;
+static SDStorageStats g_stats;
+static uint64_t g_busy_us = 0;          // busy_ms의 us 단위 누적 (1ms 미만 쓰기도 합산)
+static FlushPolicy g_flush_policy;      // 적응형 f_sync 임계값/주기 (adaptive_sync_enabled)
+static uint32_t g_max_write_us = 0;     // 마지막 f_sync 이후 가장 느린 f_write
+
+// 시간 인덱스: f_sync 전까지 RAM에 모았다가 로그 데이터가 기록된 뒤 .IDX에 추가
+#define SDSTORAGE_TIME_INDEX_PENDING    16
+static LogTimeIndexEntry g_tidx_pending[SDSTORAGE_TIME_INDEX_PENDING];
+static uint32_t g_tidx_pending_count = 0;
+static uint32_t g_tidx_next_offset = 0;     // 다음 항목을 남길 로그 오프셋
+
+// 연속 클러스터 사전 할당 + fast-seek (append 시 FAT 탐색/클러스터 할당 없음)
+// 연속 할당이면 링크맵은 [크기, 조각 수, 시작 클러스터, 0] 4개면 충분
+#define SDSTORAGE_CLMT_SIZE  16
+static DWORD g_clmt[SDSTORAGE_CLMT_SIZE];
+static FSIZE_t g_prealloc_size = 0;     // 0: 사전 할당 안 됨 (일반 append)
+static int g_index_open_number = 0;     // 동기화 크기를 매니페스트에 기록 중인 파일 번호 (0: 없음)
+static uint32_t g_file_open_tick = 0;   // 시간 기반 회전용
+
+// 쓰기/flush 재진입 방지 (정상 경로는 SD 서비스 태스크 단독 호출, 직접 호출 경합과 재귀 차단용)
+static volatile bool g_write_busy = false;
+
+#ifdef STM32F746xx
+static volatile osThreadId g_write_owner = NULL;
+
+static bool _try_lock_write(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    bool acquired = !g_write_busy;
+    if (acquired) {
+        g_write_busy = true;
+        g_write_owner = (__get_IPSR() == 0) ? osThreadGetId() : NULL;
+    }
+    __set_PRIMASK(primask);
+    return acquired;
+}
+
+// 다른 태스크가 쓰는 중이면 timeout_ms까지 대기 (같은 태스크의 재귀 호출은 즉시 실패)
+static bool _lock_write(uint32_t timeout_ms) {
+    uint32_t start = SD_TICK_MS();
+    while (!_try_lock_write()) {
+        if (__get_IPSR() != 0 || osKernelRunning() == 0 || g_write_owner == osThreadGetId()) {
+            return false;
+        }
+        if (SD_TICK_MS() - start >= timeout_ms) {
+            return false;
+        }
+        osDelay(1);
+    }
+    return true;
+}
+
+static void _unlock_write(void) {
+    g_write_owner = NULL;
+    g_write_busy = false;
+}
+#else
+// 호스트: 단일 스레드 - 재귀 호출만 차단
+static bool _try_lock_write(void) {
+    bool acquired = !g_write_busy;
+    g_write_busy = true;
+    return acquired;
+}
+
+static bool _lock_write(uint32_t timeout_ms) {
+    (void)timeout_ms;
+    return _try_lock_write();
+}
+
+static void _unlock_write(void) {
+    g_write_busy = false;
+}
+#endif
+
+#else
+static FILE* g_log_file = NULL;
+#endif
+
+// 내부 함수 구현 - 함수 호출 순서에 맞게 배치
+#ifdef SDSTORAGE_USE_FATFS
+// ----------------------------------------------------------------------------
+// 다음 로그 파일 번호 매니페스트 (LOGINDEX.BIN)
+// 512B 섹터마다 슬롯 1개, 두 슬롯을 번갈아 기록하므로 쓰기 도중 전원이 끊겨도
+// 다른 슬롯이 유효함. 부팅 시 파일 1개 읽기 + f_stat 최대 3회(TXT/LZL/LJR)로
+// 다음 번호 결정. 사전 할당된 .TXT/.LZL은 f_sync마다 동기화된 크기도 기록해
+// 전원 차단 후 마운트 시 할당 크기로 남은 꼬리를 잘라냄.
+// ----------------------------------------------------------------------------
+#define SDSTORAGE_INDEX_FILE    "LOGINDEX.BIN"
+#define SDSTORAGE_INDEX_MAGIC   0x5844494CUL    // "LIDX"
+#define SDSTORAGE_INDEX_SLOTS   2
+
+typedef struct {
+    uint32_t magic;
+    uint32_t sequence;          // 기록할 때마다 증가 (큰 값이 최신)
+    uint32_t next_number;
+    uint32_t next_number_inv;   // ~next_number (찢어진 슬롯 검출)
+    uint32_t open_number;       // 사전 할당 상태로 열린 .TXT/.LZL 번호 (0: 없음)
+    uint32_t synced_size;       // 그 파일의 마지막 f_sync 시점 크기
+    uint32_t open_check;        // ~(open_number ^ synced_size)
+} LogIndexSlot;
+
+static uint32_t g_index_sequence = 0;
+static int g_file_counter = 0;  // 다음 로그 파일 번호 (0: 아직 탐색 전)
+
+static void _log_path(char* path, size_t max_len, const char* name)
+{
+    if (g_directory_available) {
+        snprintf(path, max_len, "lora_logs/%s", name);
+    } else {
+        snprintf(path, max_len, "%s", name);
+    }
+}
+
+static bool _index_slot_valid(const LogIndexSlot* slot)
+{
+    return slot->magic == SDSTORAGE_INDEX_MAGIC &&
+           slot->next_number == (uint32_t)~slot->next_number_inv &&
+           slot->next_number >= 1 && slot->next_number <= 9999;
+}
+
+static bool _index_open_valid(const LogIndexSlot* slot)
+{
+    return slot->open_number >= 1 && slot->open_number <= 9999 &&
+           slot->open_check == ~(slot->open_number ^ slot->synced_size);
+}
+
+// 매니페스트에서 최신 슬롯 읽기 (유효 슬롯 중 sequence 최대)
+// 열린 파일 필드가 없는 이전 형식 슬롯(16바이트)은 열린 파일 없음으로 취급
+static bool _read_log_index(LogIndexSlot* latest)
+{
+    char path[32];
+    FIL index_file;
+    _log_path(path, sizeof(path), SDSTORAGE_INDEX_FILE);
+    if (f_open(&index_file, path, FA_READ) != FR_OK) {
+        return false;
+    }
+    
+    bool found = false;
+    g_index_sequence = 0;
+    for (int i = 0; i < SDSTORAGE_INDEX_SLOTS; i++) {
+        LogIndexSlot slot;
+        UINT bytes_read = 0;
+        memset(&slot, 0, sizeof(slot));
+        if (f_lseek(&index_file, (FSIZE_t)i * _MIN_SS) != FR_OK ||
+            f_read(&index_file, &slot, sizeof(slot), &bytes_read) != FR_OK ||
+            bytes_read < offsetof(LogIndexSlot, open_number) || !_index_slot_valid(&slot)) {
+            continue;
+        }
+        if (!found || slot.sequence > g_index_sequence) {
+            g_index_sequence = slot.sequence;
+            *latest = slot;
+            found = true;
+        }
+    }
+    f_close(&index_file);
+    return found;
+}
+
+// 매니페스트 갱신: 오래된 슬롯에 기록 후 f_sync
+static void _write_log_index(int next_number, int open_number, FSIZE_t synced_size)
+{
+    char path[32];
+    FIL index_file;
+    _log_path(path, sizeof(path), SDSTORAGE_INDEX_FILE);
+    if (f_open(&index_file, path, FA_OPEN_ALWAYS | FA_WRITE) != FR_OK) {
+        return;
+    }
+    
+    g_index_sequence++;
+    LogIndexSlot slot = {
+        .magic = SDSTORAGE_INDEX_MAGIC,
+        .sequence = g_index_sequence,
+        .next_number = (uint32_t)next_number,
+        .next_number_inv = ~(uint32_t)next_number,
+        .open_number = (uint32_t)open_number,
+        .synced_size = (uint32_t)synced_size,
+        .open_check = ~((uint32_t)open_number ^ (uint32_t)synced_size),
+    };
+    UINT bytes_written = 0;
+    if (f_lseek(&index_file, (FSIZE_t)(g_index_sequence % SDSTORAGE_INDEX_SLOTS) * _MIN_SS) == FR_OK) {
+        f_write(&index_file, &slot, sizeof(slot), &bytes_written);
+    }
+    f_close(&index_file);
+}
+
+// 로그 파일 존재 여부 (TXT/LZL/LJR 번호 공유)
+static bool _log_number_exists(int number)
+{
+    static const char* const extensions[] = { "TXT", "LZL", "LJR" };
+    char name[16];
+    char path[32];
+    FILINFO info;
+    
+    for (size_t i = 0; i < sizeof(extensions) / sizeof(extensions[0]); i++) {
+        snprintf(name, sizeof(name), "LORA%04d.%s", number, extensions[i]);
+        _log_path(path, sizeof(path), name);
+        if (f_stat(path, &info) == FR_OK) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 매니페스트가 없거나 손상된 경우: f_readdir 1회 순회로 최대 번호 탐색
+static int _scan_max_log_number(void)
+{
+    DIR dir;
+    FILINFO info;
+    int max_number = 0;
+    
+    if (f_opendir(&dir, g_directory_available ? "lora_logs" : "/") != FR_OK) {
+        return 0;
+    }
+    while (f_readdir(&dir, &info) == FR_OK && info.fname[0] != '\0') {
+        const char* name = info.fname;
+        if (strncmp(name, "LORA", 4) != 0 || name[8] != '.' ||
+            (strcmp(&name[9], "TXT") != 0 && strcmp(&name[9], "LZL") != 0 &&
+             strcmp(&name[9], "LJR") != 0)) {
+            continue;
+        }
+        int number = 0;
+        bool valid = true;
+        for (int i = 4; i < 8; i++) {
+            if (name[i] < '0' || name[i] > '9') {
+                valid = false;
+                break;
+            }
+            number = number * 10 + (name[i] - '0');
+        }
+        if (valid && number > max_number) {
+            max_number = number;
+        }
+    }
+    f_closedir(&dir);
+    return max_number;
+}
+
+static int _generate_log_filename(char* filename, size_t max_len)
+{
+    // 8.3 형식 파일명 생성 - 매니페스트(또는 디렉토리 1회 순회)로 다음 번호 결정
+    // 마운트 후 첫 번째 호출에서만 다음 번호 탐색
+    if (g_file_counter == 0) {
+        uint32_t start_tick = SD_TICK_MS();
+        const char* method = "index";
+        
+        // 매니페스트 번호가 이미 사용 중이면(갱신 전 전원 차단) 디렉토리 순회로 보정
+        LogIndexSlot slot;
+        bool indexed = _read_log_index(&slot);
+        g_file_counter = indexed ? (int)slot.next_number : 0;
+        if (!indexed || _log_number_exists(g_file_counter)) {
+            method = "scan";
+            g_file_counter = _scan_max_log_number() + 1;
+        }
+        if (g_file_counter > 9999) {
+            g_file_counter = 1;
+        }
+        
+        LOG_INFO("[SDStorage] Next log file number: %d (%s, %lu ms)", g_file_counter, method,
+                 SD_TICK_MS() - start_tick);
+    }
+    
+    // 저널/압축 설정에 따라 확장자 결정 (파일 단위로 고정, 저널 우선)
+    g_journal_file = GET_SD_JOURNAL_ENABLED();
+    g_compress_file = !g_journal_file && GET_SD_COMPRESSION_ENABLED();
+    if (g_journal_file && GET_SD_COMPRESSION_ENABLED()) {
+        LOG_WARN("[SDStorage] Journal and compression both enabled - writing uncompressed .LJR");
+    }
+    const char* extension = g_journal_file ? "LJR" : (g_compress_file ? "LZL" : "TXT");
+    g_current_file_number = g_file_counter;
+    
+    // 디렉토리 사용 가능 여부에 따라 경로 결정
+    int result;
+    if (g_directory_available) {
+        // lora_logs 디렉토리에 파일 생성
+        result = snprintf(filename, max_len, "lora_logs/LORA%04d.%s", g_file_counter, extension);
+    } else {
+        // 루트 디렉토리에 파일 생성
+        result = snprintf(filename, max_len, "LORA%04d.%s", g_file_counter, extension);
+    }
+    
+    g_file_counter = (g_file_counter >= 9999) ? 1 : g_file_counter + 1;
+    g_index_open_number = 0;
+    _write_log_index(g_file_counter, 0, 0);
+    
+    if (result < 0 || (size_t)result >= max_len) {
+        return SDSTORAGE_ERROR;
+    }
+    
+    return SDSTORAGE_OK;
+}
+
+// 다음 청크가 섹터 경계에서 끝나도록 버퍼 한도 재계산
+static void _wb_align_to_file(void) {
+    g_wb_len = 0;
+    g_wb_limit = SD_WRITE_BEHIND_SIZE - (size_t)(f_tell(&g_persistent_log_file) % _MIN_SS);
+}
+
+// 빈 로그 파일을 연속 클러스터로 사전 할당하고 fast-seek 링크맵 생성
+// 파일 크기는 할당 크기로 보이므로 닫을 때 쓰기 위치에서 잘라냄
+// 전원 차단 시: .LJR은 마운트 시 유효 레코드 끝에서, .TXT/.LZL은 매니페스트에
+// 기록된 동기화 크기에서 잘라냄 (f_sync마다 매니페스트 섹터 1개 추가 기록)
+static void _preallocate_file(void) {
+    g_prealloc_size = 0;
+    g_persistent_log_file.cltbl = NULL;
+    if (f_size(&g_persistent_log_file) != 0) {
+        return;  // 기존 파일 이어쓰기 (재초기화 후) - 일반 append
+    }
+    
+    FSIZE_t size = GET_SD_LOG_FILE_MAX_SIZE() + SD_LOG_PREALLOC_HEADROOM;
+    FRESULT expand_result = f_expand(&g_persistent_log_file, size, 1);
+    if (expand_result != FR_OK) {
+        // 연속 공간 부족 등 - 일반 append로 동작
+        LOG_WARN("[SDStorage] Preallocation failed: %d (fallback to append)", expand_result);
+        return;
+    }
+    
+    g_clmt[0] = SDSTORAGE_CLMT_SIZE;
+    g_persistent_log_file.cltbl = g_clmt;
+    if (f_lseek(&g_persistent_log_file, CREATE_LINKMAP) != FR_OK) {
+        g_persistent_log_file.cltbl = NULL;
+    }
+    f_lseek(&g_persistent_log_file, 0);
+    g_prealloc_size = size;
+    
+    if (!g_journal_file) {
+        g_index_open_number = g_current_file_number;
+        _write_log_index(g_file_counter, g_index_open_number, 0);
+    }
+}
+
+// 사전 할당 영역을 넘어서는 쓰기: fast-seek 해제 후 일반 클러스터 할당으로 전환
+static void _release_prealloc_if_exceeded(size_t incoming) {
+    if (g_prealloc_size != 0 && f_tell(&g_persistent_log_file) + incoming > g_prealloc_size) {
+        g_persistent_log_file.cltbl = NULL;
+        g_prealloc_size = 0;
+    }
+}
+
+// 사전 할당된 파일의 미사용 꼬리 잘라내기
+static FRESULT _trim_preallocation(void) {
+    FRESULT result = FR_OK;
+    if (g_prealloc_size != 0) {
+        g_persistent_log_file.cltbl = NULL;
+        result = f_truncate(&g_persistent_log_file);
+        g_prealloc_size = 0;
+    }
+    return result;
+}
+
+// ----------------------------------------------------------------------------
+// 시간 인덱스 (LORA####.IDX, LogTimeIndex 형식)
+// 압축 파일(.LZL)은 블록이 이전 히스토리를 참조해 중간부터 풀 수 없으므로 인덱스 없음
+// ----------------------------------------------------------------------------
+
+static bool _time_index_path(char* path, size_t max_len) {
+    size_t len = strlen(g_current_log_file);
+    if (len < 4 || len >= max_len || g_current_log_file[len - 4] != '.') {
+        return false;
+    }
+    memcpy(path, g_current_log_file, len - 3);
+    memcpy(&path[len - 3], "IDX", 4);
+    return true;
+}
+
+// 새 로그 파일: 같은 번호의 예전 인덱스(번호 순환 후 잔여)를 비움
+static void _time_index_start(bool new_file) {
+    g_tidx_pending_count = 0;
+    g_tidx_next_offset = 0;
+    if (!new_file || g_compress_file || SystemConfig_GetSDCard()->index_interval_bytes == 0) {
+        return;
+    }
+    char path[sizeof(g_current_log_file)];
+    FIL index_file;
+    if (_time_index_path(path, sizeof(path)) &&
+        f_open(&index_file, path, FA_CREATE_ALWAYS | FA_WRITE) == FR_OK) {
+        f_close(&index_file);
+    }
+}
+
+// 다음 줄/레코드가 시작되는 위치가 간격을 넘었으면 항목 예약
+static void _time_index_mark(void) {
+    uint32_t interval = SystemConfig_GetSDCard()->index_interval_bytes;
+    uint32_t offset = (uint32_t)f_tell(&g_persistent_log_file) + (uint32_t)g_wb_len;
+    if (interval == 0 || g_compress_file || offset < g_tidx_next_offset ||
+        g_tidx_pending_count >= SDSTORAGE_TIME_INDEX_PENDING) {
+        return;
+    }
+    LogTimeIndexEntry* entry = &g_tidx_pending[g_tidx_pending_count++];
+    entry->epoch_sec = LOGGER_GetTimestamp();
+    entry->uptime_ms = SD_TICK_MS();
+    entry->offset = offset;
+    g_tidx_next_offset = offset + interval;
+}
+
+// f_sync 성공 후 예약된 항목을 인덱스 파일에 추가 (인덱스 실패는 로그 기록에 영향 없음)
+static void _time_index_commit(void) {
+    if (g_tidx_pending_count == 0) {
+        return;
+    }
+    uint8_t encoded[SDSTORAGE_TIME_INDEX_PENDING * LOG_TIME_INDEX_ENTRY_SIZE];
+    for (uint32_t i = 0; i < g_tidx_pending_count; i++) {
+        LogTimeIndex_Encode(&g_tidx_pending[i], &encoded[i * LOG_TIME_INDEX_ENTRY_SIZE]);
+    }
+    UINT size = (UINT)(g_tidx_pending_count * LOG_TIME_INDEX_ENTRY_SIZE);
+    g_tidx_pending_count = 0;
+    
+    char path[sizeof(g_current_log_file)];
+    FIL index_file;
+    if (!_time_index_path(path, sizeof(path)) ||
+        f_open(&index_file, path, FA_OPEN_APPEND | FA_WRITE) != FR_OK) {
+        return;
+    }
+    UINT bytes_written = 0;
+    FRESULT result = f_write(&index_file, encoded, size, &bytes_written);
+    f_close(&index_file);
+    if (result != FR_OK || bytes_written != size) {
+        LOG_WARN("[SDStorage] Time index write failed: %d", result);
+    }
+}
+
+static ResultCode _start_journal(void);
+static void _resume_journal(void);
+
+// 지속적 파일 핸들 관리 함수들
+static void _ensure_persistent_file_open(void) {
+    if (!g_file_is_open || strlen(g_current_log_file) == 0) {
+        // 파일이 열려있지 않거나 파일명이 없으면 새로 열기
+        if (g_file_is_open) {
+            f_close(&g_persistent_log_file);
+            g_file_is_open = false;
+        }
+        
+        // 파일명 생성 (필요시)
+        if (strlen(g_current_log_file) == 0) {
+            _generate_log_filename(g_current_log_file, sizeof(g_current_log_file));
+        }
+        
+        // 파일 열기 (append 모드, 저널 이어쓰기 시 기존 레코드 검사를 위해 읽기 허용)
+        FRESULT open_result = f_open(&g_persistent_log_file, g_current_log_file,
+                                     FA_OPEN_APPEND | FA_WRITE | FA_READ);
+        if (open_result != FR_OK) {
+            // 파일이 없으면 생성
+            open_result = f_open(&g_persistent_log_file, g_current_log_file, FA_CREATE_ALWAYS | FA_WRITE);
+        }
+        
+        if (open_result == FR_OK) {
+            if (g_journal_file && f_size(&g_persistent_log_file) != 0) {
+                _resume_journal();
+            }
+            bool new_file = f_size(&g_persistent_log_file) == 0;
+            g_file_is_open = true;
+            g_unsynced_bytes = 0;
+            g_last_sync_tick = SD_TICK_MS();
+            g_file_open_tick = g_last_sync_tick;
+            _preallocate_file();
+            _wb_align_to_file();
+            _time_index_start(new_file);
+            if (g_journal_file && new_file) {
+                _start_journal();
+            }
+            LOG_DEBUG("[SDStorage] Persistent file opened: %s", g_current_log_file);
+        } else {
+            LOG_ERROR("[SDStorage] Failed to open persistent file: %d", open_result);
+        }
+    }
+}
+
+// 버퍼 내용을 파일에 기록 (동기화는 하지 않음)
+static ResultCode _wb_write_out(void) {
+    if (g_wb_len == 0) {
+        return SDSTORAGE_OK;
+    }
+    if (!g_file_is_open) {
+        g_wb_len = 0;
+        return SDSTORAGE_FILE_ERROR;
+    }
+    
+    _release_prealloc_if_exceeded(g_wb_len);
+    
+    uint32_t start = SD_LAT_START();
+    UINT bytes_written;
+    FRESULT write_result = f_write(&g_persistent_log_file, g_wb_buffer, g_wb_len, &bytes_written);
+    uint32_t write_us = _latency_record(SDSTORAGE_LAT_WRITE, start);
+    g_busy_us += write_us;
+    g_stats.busy_ms = (uint32_t)(g_busy_us / 1000U);
+    if (write_us > g_max_write_us) {
+        g_max_write_us = write_us;
+    }
+    g_stats.write_calls++;
+    
+    if (write_result != FR_OK || bytes_written != g_wb_len) {
+        LOG_ERROR("[SDStorage] Buffered write failed: %d, written: %d/%d", write_result, bytes_written, g_wb_len);
+        g_wb_len = 0;
+        return SDSTORAGE_FILE_ERROR;
+    }
+    
+    g_unsynced_bytes += bytes_written;
+    _wb_align_to_file();
+    return SDSTORAGE_OK;
+}
+
+// 버퍼에 추가, 가득 차면 섹터 단위로 기록
+static ResultCode _wb_append(const void* data, size_t size) {
+    const uint8_t* src = (const uint8_t*)data;
+    while (size > 0) {
+        size_t room = g_wb_limit - g_wb_len;
+        size_t chunk = (size < room) ? size : room;
+        memcpy(&g_wb_buffer[g_wb_len], src, chunk);
+        g_wb_len += chunk;
+        src += chunk;
+        size -= chunk;
+        
+        if (g_wb_len == g_wb_limit) {
+            ResultCode result = _wb_write_out();
+            if (result != SDSTORAGE_OK) {
+                return result;
+            }
+        }
+    }
+    return SDSTORAGE_OK;
+}
+
+// 저널 CRC32: 공용 Checksum 모듈 (타겟은 CRC 주변장치, 긴 블록은 DMA)
+static uint32_t _journal_crc(const uint8_t* data, size_t len) {
+    return Checksum_Crc32(data, len);
+}
+
+// 새 저널 파일: 파일마다 다른 태그로 writer를 초기화하고 파일 헤더 레코드 기록
+// (태그가 다르면 사전 할당 영역에 남은 예전 레코드가 복구 시 섞이지 않음)
+static ResultCode _start_journal(void) {
+    uint8_t header[LOG_JOURNAL_OVERHEAD + LOG_JOURNAL_FILE_HEADER_PAYLOAD];
+    uint32_t now = SD_TICK_MS();
+    uint16_t tag = (uint16_t)((now ^ (now >> 16)) * 31U + (uint32_t)g_current_file_number);
+    
+    LogJournal_InitWriter(&g_journal, _journal_crc, tag);
+    int size = LogJournal_EncodeFileHeader(&g_journal, now, (uint16_t)g_current_file_number,
+                                           header, sizeof(header));
+    if (size < 0) {
+        return SDSTORAGE_ERROR;
+    }
+    g_current_log_size += (size_t)size;
+    return _wb_append(header, (size_t)size);
+}
+
+// 읽기 콜백 (복구 스캔용)
+static size_t _journal_read(void* ctx, uint32_t offset, uint8_t* buf, size_t len) {
+    FIL* file = (FIL*)ctx;
+    UINT bytes_read = 0;
+    if (f_lseek(file, offset) != FR_OK || f_read(file, buf, (UINT)len, &bytes_read) != FR_OK) {
+        return 0;
+    }
+    return bytes_read;
+}
+
+// 기존 저널 파일 이어쓰기 (쓰기 실패 후 다시 열기, 9999 -> 1 번호 순환)
+// 잃어버린 write-behind 버퍼나 찢어진 꼬리 뒤에 이어 쓰면 seq가 끊겨 다음 부팅 복구 시
+// 뒤의 레코드가 잘리므로, 마지막 유효 레코드 뒤를 잘라내고 file_tag/seq를 이어받음
+// (파일 헤더조차 유효하지 않으면 비워서 새 저널로 시작)
+static void _resume_journal(void) {
+    // 파일을 연 직후라 write-behind 버퍼는 비어 있음 - 스캔 버퍼로 사용
+    LogJournalScanResult scan;
+    LogJournal_Scan(_journal_crc, _journal_read, &g_persistent_log_file, g_wb_buffer, sizeof(g_wb_buffer), &scan);
+    
+    FSIZE_t file_size = f_size(&g_persistent_log_file);
+    FRESULT result = f_lseek(&g_persistent_log_file, scan.valid_end);
+    if (result == FR_OK && scan.valid_end < file_size) {
+        result = f_truncate(&g_persistent_log_file);
+    }
+    if (result != FR_OK) {
+        LOG_ERROR("[SDStorage] Journal resume failed: %d", result);
+        return;
+    }
+    
+    if (scan.records > 0) {
+        LogJournal_InitWriter(&g_journal, _journal_crc, scan.file_tag);
+        g_journal.next_seq = scan.next_seq;
+    }
+    g_current_log_size = scan.valid_end;
+    LOG_INFO("[SDStorage] Journal resumed: %lu records, next seq %u, %lu bytes truncated",
+             scan.records, scan.next_seq, (uint32_t)(file_size - scan.valid_end));
+}
+
+// 사전 할당된 채 닫히지 않은 .TXT/.LZL: 디렉토리 엔트리 크기가 할당 크기이므로
+// 매니페스트에 기록된 마지막 동기화 크기 뒤(사전 할당 영역의 잔여 데이터)를 잘라냄
+static void _recover_synced_size(const LogIndexSlot* slot) {
+    static const char* const extensions[] = { "TXT", "LZL" };
+    char name[16];
+    char path[32];
+    FIL file;
+    
+    for (size_t i = 0; i < sizeof(extensions) / sizeof(extensions[0]); i++) {
+        snprintf(name, sizeof(name), "LORA%04lu.%s", (unsigned long)slot->open_number, extensions[i]);
+        _log_path(path, sizeof(path), name);
+        if (f_open(&file, path, FA_WRITE) != FR_OK) {
+            continue;
+        }
+        
+        FSIZE_t file_size = f_size(&file);
+        FRESULT result = FR_OK;
+        if (slot->synced_size < file_size) {
+            result = f_lseek(&file, slot->synced_size);
+            if (result == FR_OK) {
+                result = f_truncate(&file);
+            }
+        }
+        f_close(&file);
+        
+        LOG_INFO("[SDStorage] Log %s: %lu bytes synced, %lu bytes truncated (result %d)", name,
+                 slot->synced_size, (uint32_t)(file_size - slot->synced_size), result);
+        return;
+    }
+}
+
+// 이전 부팅의 마지막 로그 파일 복구. 마운트 직후 파일이 열리기 전에 호출.
+// 저널 파일은 마지막 유효 레코드 뒤(찢어진 레코드, 사전 할당 영역의 잔여 데이터)를 잘라냄.
+static void _recover_last_file(void) {
+    LogIndexSlot slot;
+    bool indexed = _read_log_index(&slot);
+    if (indexed && _index_open_valid(&slot)) {
+        _recover_synced_size(&slot);
+    }
+    
+    int next_number = indexed ? (int)slot.next_number : 0;
+    if (!indexed || _log_number_exists(next_number)) {
+        next_number = _scan_max_log_number() + 1;
+    }
+    int last_number = (next_number <= 1 || next_number > 9999) ? 9999 : next_number - 1;
+    
+    char name[16];
+    char path[32];
+    snprintf(name, sizeof(name), "LORA%04d.LJR", last_number);
+    _log_path(path, sizeof(path), name);
+    
+    FIL file;
+    if (f_open(&file, path, FA_READ | FA_WRITE) != FR_OK) {
+        return;  // 마지막 파일이 저널이 아니거나 없음
+    }
+    
+    // write-behind 버퍼는 파일이 열리기 전이므로 스캔 버퍼로 사용
+    uint32_t start_tick = SD_TICK_MS();
+    LogJournalScanResult scan;
+    LogJournal_Scan(_journal_crc, _journal_read, &file, g_wb_buffer, sizeof(g_wb_buffer), &scan);
+    
+    FSIZE_t file_size = f_size(&file);
+    FRESULT result = FR_OK;
+    if (scan.valid_end < file_size) {
+        result = f_lseek(&file, scan.valid_end);
+        if (result == FR_OK) {
+            result = f_truncate(&file);
+        }
+    }
+    f_close(&file);
+    
+    LOG_INFO("[SDStorage] Journal %s: %lu records valid, %lu bytes truncated (%lu ms, result %d)",
+             name, scan.records, (uint32_t)(file_size - scan.valid_end), SD_TICK_MS() - start_tick, result);
+}
+
+// 압축 블록을 마감해 write-behind 버퍼로 넘김
+static ResultCode _flush_compressed_block(void) {
+    const uint8_t* block = NULL;
+    size_t block_size = LogCompress_Flush(&g_compressor, &block);
+    if (block_size == 0) {
+        return SDSTORAGE_OK;
+    }
+    g_current_log_size += block_size;
+    return _wb_append(block, block_size);
+}
+
+// 적응형 정책 범위: 하한은 sync_*_min, 상한은 기존 내구성 설정 (최대 손실)
+static void _flush_policy_config(FlushPolicyConfig* policy_config) {
+    const RuntimeSDCardConfig* config = SystemConfig_GetSDCard();
+    policy_config->bytes_min = config->sync_bytes_min;
+    policy_config->bytes_max = config->sync_bytes_threshold;
+    policy_config->interval_min_ms = config->sync_interval_min_ms;
+    policy_config->interval_max_ms = config->sync_interval_ms;
+    policy_config->stall_us = SD_ADAPTIVE_STALL_US;
+    policy_config->backlog_high = SD_ADAPTIVE_BACKLOG_HIGH;
+}
+
+static void _flush_policy_update(uint32_t sync_us) {
+    if (!SystemConfig_GetSDCard()->adaptive_sync_enabled) {
+        return;
+    }
+    FlushPolicyConfig policy_config;
+    _flush_policy_config(&policy_config);
+    FlushPolicyAction action = FlushPolicy_OnSync(&g_flush_policy, &policy_config, g_max_write_us, sync_us);
+    if (action != FLUSH_POLICY_HOLD) {
+        LOG_DEBUG("[SDStorage] Sync policy %s: %lu bytes / %lu ms (sync %lu us, backlog %lu)",
+                  action == FLUSH_POLICY_GROW ? "grow" : "shrink", g_flush_policy.bytes,
+                  g_flush_policy.interval_ms, sync_us, g_flush_policy.backlog);
+    }
+}
+
+// 버퍼/압축 블록을 모두 기록하고 f_sync (FAT/디렉토리 엔트리 갱신)
+static ResultCode _sync_file(void) {
+    ResultCode result = SDSTORAGE_OK;
+    if (g_compress_file) {
+        result = _flush_compressed_block();
+    }
+    if (result == SDSTORAGE_OK) {
+        result = _wb_write_out();
+    }
+    if (result != SDSTORAGE_OK) {
+        return result;
+    }
+    
+    g_last_sync_tick = SD_TICK_MS();
+    if (g_unsynced_bytes == 0) {
+        return SDSTORAGE_OK;
+    }
+    
+    uint32_t start = SD_LAT_START();
+    FRESULT sync_result = f_sync(&g_persistent_log_file);
+    uint32_t sync_us = _latency_record(SDSTORAGE_LAT_SYNC, start);
+    g_busy_us += sync_us;
+    g_stats.busy_ms = (uint32_t)(g_busy_us / 1000U);
+    g_stats.sync_calls++;
+    g_unsynced_bytes = 0;
+    _flush_policy_update(sync_us);
+    g_max_write_us = 0;
+    if (sync_result != FR_OK) {
+        return SDSTORAGE_FILE_ERROR;
+    }
+    if (g_index_open_number != 0) {
+        _write_log_index(g_file_counter, g_index_open_number, f_tell(&g_persistent_log_file));
+    }
+    _time_index_commit();
+    return SDSTORAGE_OK;
+}
+
+// 바이트/시간 임계값에 도달했으면 동기화
+static ResultCode _sync_if_due(void) {
+    const RuntimeSDCardConfig* config = SystemConfig_GetSDCard();
+    uint32_t pending = g_unsynced_bytes + (uint32_t)g_wb_len;
+    if (g_compress_file) {
+        pending += (uint32_t)LogCompress_PendingRaw(&g_compressor);
+    }
+    if (pending == 0) {
+        return SDSTORAGE_OK;
+    }
+    
+    uint32_t bytes_threshold = config->sync_bytes_threshold;
+    uint32_t interval_ms = config->sync_interval_ms;
+    if (config->adaptive_sync_enabled) {
+        bytes_threshold = g_flush_policy.bytes;
+        interval_ms = g_flush_policy.interval_ms;
+    }
+    
+    if (g_unsynced_bytes + g_wb_len >= bytes_threshold ||
+        SD_TICK_MS() - g_last_sync_tick >= interval_ms) {
+        return _sync_file();
+    }
+    return SDSTORAGE_OK;
+}
+
+static void _close_persistent_file(void) {
+    if (g_file_is_open) {
+        _sync_file();
+        FRESULT result = _trim_preallocation();
+        if (f_close(&g_persistent_log_file) != FR_OK) {
+            result = FR_DISK_ERR;
+        }
+        g_file_is_open = false;
+        // 잘라낸 크기가 디렉토리 엔트리에 반영됐으면 더 이상 마운트 시 복구할 필요 없음
+        // (실패 시 같은 파일을 다시 열면 계속 동기화 크기를 기록)
+        if (g_index_open_number != 0 && result == FR_OK) {
+            _write_log_index(g_file_counter, 0, 0);
+            g_index_open_number = 0;
+        }
+        LOG_DEBUG("[SDStorage] Persistent file closed: %s", g_current_log_file);
+    }
+}
+
+#else
+// PC/테스트 환경: 파일명만 생성 (실제 파일 없음)
+static int _generate_log_filename(char* filename, size_t max_len)
+{
+    static int file_counter = 1;
+    int result = snprintf(filename, max_len, "lora_logs/LORA%04d.TXT", file_counter);
+    file_counter = (file_counter >= 9999) ? 1 : file_counter + 1;
+    return (result < 0 || (size_t)result >= max_len) ? SDSTORAGE_ERROR : SDSTORAGE_OK;
+}
+
+static void _close_persistent_file(void) {
+}
+#endif
+
+// 내부 함수 선언
+static ResultCode _create_log_directory(void);
+static void _close_persistent_file(void);
+static ResultCode _initialize_sd_hardware(void);
+static ResultCode _mount_filesystem_with_retry(void);
+// static uint32_t _get_current_timestamp(void); - unused function removed
+
+ResultCode SDStorage_Init(void)
+{
+    LOG_INFO("[SDStorage] Starting SD card initialization...");
+    
+    // 초기화 시 지속적 파일 닫기
+    _close_persistent_file();
+    
+    // 1. SD 하드웨어 초기화 및 상태 확인
+    _latency_clock_init();
+    uint32_t mount_start = SD_LAT_START();
+    ResultCode hw_result = _initialize_sd_hardware();
+    if (hw_result != SDSTORAGE_OK) {
+        _latency_record(SDSTORAGE_LAT_MOUNT, mount_start);
+        return hw_result;
+    }
+    
+    // 2. 파일시스템 마운트 (재시도 로직 포함)
+    ResultCode mount_result = _mount_filesystem_with_retry();
+    uint32_t mount_us = _latency_record(SDSTORAGE_LAT_MOUNT, mount_start);
+    if (mount_result != SDSTORAGE_OK) {
+        return mount_result;
+    }
+    
+    LOG_INFO("[SDStorage] File system mount successful (%lu us)", (unsigned long)mount_us);
+    
+    // 3. 디렉토리 생성 시도
+    LOG_INFO("[SDStorage] Creating log directory...");
+    ResultCode dir_result = _create_log_directory();
+    g_directory_available = (dir_result == SDSTORAGE_OK);
+    
+    // 4. 이전 로그 파일 복구 (이번 부팅에서 처음 마운트할 때만)
+#ifdef SDSTORAGE_USE_FATFS
+    if (strlen(g_current_log_file) == 0) {
+        g_file_counter = 0;  // 카드가 바뀌었을 수 있으므로 매니페스트부터 다시 읽음
+        _recover_last_file();
+    }
+    
+    // 적응형 동기화는 최소값(한가한 카드)에서 시작
+    FlushPolicyConfig policy_config;
+    _flush_policy_config(&policy_config);
+    FlushPolicy_Init(&g_flush_policy, &policy_config);
+    g_max_write_us = 0;
+#endif
+    
+    // 5. 최종 상태 설정
+    g_sd_ready = true;
+    
+    // 기존 로그 파일명이 있으면 보존, 크기는 리셋하지 않음
+    if (strlen(g_current_log_file) > 0) {
+        LOG_INFO("[SDStorage] Preserving existing log file: %s (size: %d bytes)", 
+                 g_current_log_file, g_current_log_size);
+    } else {
+        // 첫 초기화인 경우에만 크기와 파일명 초기화
+        g_current_log_size = 0;
+        memset(g_current_log_file, 0, sizeof(g_current_log_file));
+        LOG_INFO("[SDStorage] First initialization - log file will be created on first write");
+    }
+    
+    LOG_INFO("[SDStorage] Initialization completed successfully");
+    return SDSTORAGE_OK;
+}
 
-// 내부 상태 관리
-static bool g_sd_ready = false;
-static char g_current_log_file[256] = {0};
-static size_t g_current_log_size = 0;
+static ResultCode _write_log(const SDStorageChunk* chunks, size_t count, bool sync, uint8_t type);
 
-#ifdef STM32F746xx
-static FIL g_log_file;
-static bool g_file_open = false;
+ResultCode SDStorage_WriteLog(const void* data, size_t size)
+{
+    SDStorageChunk chunk = { data, size };
+    return SDStorage_WriteLogV(&chunk, 1);
+}
+
+ResultCode SDStorage_WriteLogV(const SDStorageChunk* chunks, size_t count)
+{
+#ifdef SDSTORAGE_USE_FATFS
+    if (!_lock_write(SD_WRITE_LOCK_WAIT_MS)) {
+        return SDSTORAGE_NOT_READY;  // 재귀 호출 또는 다른 쓰기/회전이 오래 걸리는 중
+    }
+    ResultCode result = _write_log(chunks, count, true, LOG_JOURNAL_TYPE_TEXT);
+    _unlock_write();
+    return result;
 #else
-static FILE* g_log_file = NULL;
+    return _write_log(chunks, count, true, LOG_JOURNAL_TYPE_TEXT);
 #endif
+}
 
-// 내부 함수 선언
-static int _create_log_directory(void);
-static int _generate_log_filename(char* filename, size_t max_len);
-static uint32_t _get_current_timestamp(void);
+ResultCode SDStorage_WriteBinaryV(const SDStorageChunk* chunks, size_t count)
+{
+#ifdef SDSTORAGE_USE_FATFS
+    if (!_lock_write(SD_WRITE_LOCK_WAIT_MS)) {
+        return SDSTORAGE_NOT_READY;
+    }
+    ResultCode result = _write_log(chunks, count, true, LOG_JOURNAL_TYPE_BINARY);
+    _unlock_write();
+    return result;
+#else
+    return _write_log(chunks, count, true, LOG_JOURNAL_TYPE_BINARY);
+#endif
+}
 
-int SDStorage_Init(void)
+ResultCode SDStorage_WriteLogBatch(const SDStorageChunk* chunks, size_t count, size_t* written)
 {
-#ifdef STM32F746xx
-    // STM32 환경: FatFs 초기화
-    if (f_mount(&SDFatFS, SDPath, 1) != FR_OK) {
-        return SDSTORAGE_ERROR;
+    if (written != NULL) {
+        *written = 0;
+    }
+    if (chunks == NULL || count == 0) {
+        return SDSTORAGE_INVALID_PARAM;
     }
     
-    // SD 카드 상태 확인
-    FATFS *fs;
-    DWORD fre_clust;
-    if (f_getfree(SDPath, &fre_clust, &fs) != FR_OK) {
-        return SDSTORAGE_ERROR;
+#ifdef SDSTORAGE_USE_FATFS
+    if (!_lock_write(SD_WRITE_LOCK_WAIT_MS)) {
+        return SDSTORAGE_NOT_READY;
     }
-#else
-    // PC/테스트 환경: 시뮬레이션
-    // 실제로는 파일 시스템이 준비되었다고 가정
 #endif
-
-    // 로그 디렉토리 생성
-    if (_create_log_directory() != SDSTORAGE_OK) {
-        return SDSTORAGE_ERROR;
+    ResultCode result = SDSTORAGE_OK;
+    size_t done = 0;
+    for (; done < count && result == SDSTORAGE_OK; done++) {
+        // 동기화 판단은 마지막 줄에서만 (묶음 중간에 f_sync 하지 않음)
+        result = _write_log(&chunks[done], 1, done + 1 == count, LOG_JOURNAL_TYPE_TEXT);
     }
+    if (result != SDSTORAGE_OK) {
+        done--;
+    }
+#ifdef SDSTORAGE_USE_FATFS
+    _unlock_write();
+#endif
     
-    g_sd_ready = true;
-    g_current_log_size = 0;
-    memset(g_current_log_file, 0, sizeof(g_current_log_file));
+    if (written != NULL) {
+        *written = done;
+    }
+    return result;
+}
+
+// 한 줄(레코드)의 조각 합계, 잘못된 조각이 있으면 0
+static size_t _chunks_size(const SDStorageChunk* chunks, size_t count)
+{
+    size_t size = 0;
+    if (chunks == NULL) {
+        return 0;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (chunks[i].data == NULL && chunks[i].size > 0) {
+            return 0;
+        }
+        size += chunks[i].size;
+    }
+    return size;
+}
+
+#ifdef SDSTORAGE_USE_FATFS
+// 조각들(+ 줄바꿈)을 압축 스트림 또는 write-behind 버퍼에 그대로 추가 (중간 버퍼 없음)
+static ResultCode _append_record(const SDStorageChunk* chunks, size_t count, size_t record_size, bool line_end)
+{
+    static const char crlf[2] = { '\r', '\n' };
+    ResultCode result = SDSTORAGE_OK;
+    if (g_compress_file) {
+        // 압축 스트림에 추가, 블록이 차거나 임계값을 넘으면 버퍼로 넘김
+        if (!LogCompress_HasRoom(&g_compressor, record_size)) {
+            result = _flush_compressed_block();
+        }
+        if (result == SDSTORAGE_OK) {
+            for (size_t i = 0; i < count; i++) {
+                LogCompress_Write(&g_compressor, chunks[i].data, chunks[i].size);
+            }
+            if (line_end) {
+                LogCompress_Write(&g_compressor, crlf, sizeof(crlf));
+            }
+            if (LogCompress_PendingRaw(&g_compressor) >= SD_COMPRESS_FLUSH_RAW_BYTES) {
+                result = _flush_compressed_block();
+            }
+        }
+        return result;
+    }
     
-    return SDSTORAGE_OK;
+    // write-behind 버퍼에 추가 (섹터 단위로 기록)
+    _time_index_mark();
+    for (size_t i = 0; i < count && result == SDSTORAGE_OK; i++) {
+        if (chunks[i].size > 0) {
+            result = _wb_append(chunks[i].data, chunks[i].size);
+        }
+    }
+    if (result == SDSTORAGE_OK && line_end) {
+        result = _wb_append(crlf, sizeof(crlf));
+    }
+    g_current_log_size += record_size;
+    return result;
 }
+#endif
 
-int SDStorage_WriteLog(const void* data, size_t size)
+// type: 저널 레코드 종류 (TEXT는 일반 파일에서 한 줄, BINARY는 저널 파일에만 기록 가능)
+static ResultCode _write_log(const SDStorageChunk* chunks, size_t count, bool sync, uint8_t type)
 {
     if (!g_sd_ready) {
         return SDSTORAGE_NOT_READY;
     }
     
-    if (data == NULL || size == 0) {
+    size_t size = _chunks_size(chunks, count);
+    if (size == 0) {
         return SDSTORAGE_INVALID_PARAM;
     }
     
-    // 새 로그 파일이 필요한 경우 생성
-    if (strlen(g_current_log_file) == 0 || 
-        g_current_log_size + size > SDSTORAGE_MAX_LOG_SIZE) {
+    // 새 로그 파일이 필요한 경우 생성 (크기/시간 기반 회전은 SD 태스크의 SDStorage_RotateIfNeeded)
+    if (strlen(g_current_log_file) == 0) {
         if (SDStorage_CreateNewLogFile() != SDSTORAGE_OK) {
             return SDSTORAGE_FILE_ERROR;
         }
     }
 
-#ifdef STM32F746xx
-    // STM32 환경: FatFs를 사용한 파일 쓰기
-    if (!g_file_open) {
-        if (f_open(&g_log_file, g_current_log_file, FA_WRITE | FA_OPEN_APPEND) != FR_OK) {
-            return SDSTORAGE_FILE_ERROR;
-        }
-        g_file_open = true;
-    }
+#ifdef SDSTORAGE_USE_FATFS
+    // 새로운 방식: 지속적 파일 핸들 사용 (한 번 열어두고 계속 쓰기)
+    _ensure_persistent_file_open();
     
-    UINT bytes_written;
-    if (f_write(&g_log_file, data, size, &bytes_written) != FR_OK) {
+    if (!g_file_is_open) {
+        LOG_ERROR("[SDStorage] Cannot open persistent file");
         return SDSTORAGE_FILE_ERROR;
     }
+    if (type != LOG_JOURNAL_TYPE_TEXT && !g_journal_file) {
+        return RESULT_ERROR_NOT_SUPPORTED;  // 텍스트/압축 파일에는 바이너리 레코드를 구분할 틀이 없음
+    }
     
-    if (bytes_written != size) {
-        return SDSTORAGE_DISK_FULL;
+    // 저널 파일이면 레코드(헤더 + 데이터 + CRC32), 아니면 데이터 + 줄바꿈
+    // 저널 레코드는 CRC가 연속 버퍼를 요구하므로 조각을 write_buffer 본문 자리에 모아 제자리 인코딩
+    // 일반 줄은 조각을 바로 write-behind 버퍼/압축 스트림으로 (한 번 더 복사하지 않음)
+    uint8_t write_buffer[LOGGER_WRITE_BUFFER_SIZE];
+    SDStorageChunk record = { write_buffer, 0 };
+    size_t record_size = 0;
+    if (g_journal_file) {
+        if (LOG_JOURNAL_OVERHEAD + size <= sizeof(write_buffer)) {
+            uint8_t* payload = &write_buffer[LOG_JOURNAL_HEADER_SIZE];
+            for (size_t i = 0; i < count; i++) {
+                if (chunks[i].size > 0) {
+                    memcpy(payload, chunks[i].data, chunks[i].size);
+                    payload += chunks[i].size;
+                }
+            }
+            int encoded = LogJournal_Encode(&g_journal, type, SD_TICK_MS(),
+                                            &write_buffer[LOG_JOURNAL_HEADER_SIZE], size,
+                                            write_buffer, sizeof(write_buffer));
+            record.size = (encoded > 0) ? (size_t)encoded : 0;
+            record_size = record.size;
+        }
+    } else if (size + 2 < sizeof(write_buffer)) {
+        record_size = size + 2;
     }
     
-    // 즉시 플러시하여 데이터 안정성 확보
-    f_sync(&g_log_file);
+    if (record_size > 0) {
+        ResultCode result = g_journal_file ? _append_record(&record, 1, record_size, false)
+                                           : _append_record(chunks, count, record_size, true);
+        
+        if (result == SDSTORAGE_OK && sync) {
+            result = _sync_if_due();
+        }
+        
+        if (result != SDSTORAGE_OK) {
+            LOG_ERROR("[SDStorage] Persistent write failed: %d", result);
+            // 쓰기 실패 시 파일 다시 열기 시도
+            _close_persistent_file();
+            return SDSTORAGE_FILE_ERROR;
+        }
+        
+        g_stats.lines++;
+        g_stats.bytes += record_size;
+        return SDSTORAGE_OK;
+    } else {
+        LOG_ERROR("[SDStorage] Data too large for write buffer: %d bytes", size);
+        return SDSTORAGE_INVALID_PARAM;
+    }
 #else
     // PC/테스트 환경: 파일 I/O 시뮬레이션 (항상 성공)
     // 실제 파일 쓰기 없이 성공으로 처리
+    (void)sync;
+    (void)type;
 #endif
 
     g_current_log_size += size;
     return SDSTORAGE_OK;
 }
 
+ResultCode SDStorage_Flush(void)
+{
+    if (!g_sd_ready) {
+        return SDSTORAGE_NOT_READY;
+    }
+    
+#ifdef SDSTORAGE_USE_FATFS
+    if (!g_file_is_open) {
+        return SDSTORAGE_OK;
+    }
+    if (!_try_lock_write()) {
+        return SDSTORAGE_OK;  // 쓰기 진행 중이면 다음 기회에 flush
+    }
+    ResultCode result = _sync_file();
+    _unlock_write();
+    return result;
+#else
+    return SDSTORAGE_OK;
+#endif
+}
+
+ResultCode SDStorage_FlushIfDue(void)
+{
+    if (!g_sd_ready) {
+        return SDSTORAGE_NOT_READY;
+    }
+    
+#ifdef SDSTORAGE_USE_FATFS
+    if (!g_file_is_open) {
+        return SDSTORAGE_OK;
+    }
+    if (!_try_lock_write()) {
+        return SDSTORAGE_OK;
+    }
+    ResultCode result = _sync_if_due();
+    _unlock_write();
+    return result;
+#else
+    return SDSTORAGE_OK;
+#endif
+}
+
+ResultCode SDStorage_RotateIfNeeded(void)
+{
+    if (!g_sd_ready) {
+        return SDSTORAGE_NOT_READY;
+    }
+    
+#ifdef SDSTORAGE_USE_FATFS
+    if (!g_file_is_open) {
+        return SDSTORAGE_OK;
+    }
+    
+    const RuntimeSDCardConfig* config = SystemConfig_GetSDCard();
+    bool size_exceeded = g_current_log_size >= config->log_file_max_size;
+    bool age_exceeded = config->log_rotate_interval_ms != 0 &&
+                        SD_TICK_MS() - g_file_open_tick >= config->log_rotate_interval_ms;
+    if (!size_exceeded && !age_exceeded) {
+        return SDSTORAGE_OK;
+    }
+    
+    if (!_lock_write(SD_WRITE_LOCK_WAIT_MS)) {
+        return SDSTORAGE_OK;  // 다음 주기에 재시도
+    }
+    
+    // 현재 파일 마무리(잘라내기 포함) 후 다음 번호 파일을 열고 사전 할당
+    uint32_t start = SD_LAT_START();
+    ResultCode result = SDStorage_CreateNewLogFile();
+    if (result == SDSTORAGE_OK) {
+        _ensure_persistent_file_open();
+        if (!g_file_is_open) {
+            result = SDSTORAGE_FILE_ERROR;
+        }
+    }
+    _latency_record(SDSTORAGE_LAT_ROTATE, start);
+    _unlock_write();
+    
+    if (result == SDSTORAGE_OK) {
+        LOG_INFO("[SDStorage] Log rotated (%s) -> %s", size_exceeded ? "size" : "time", g_current_log_file);
+    }
+    return result;
+#else
+    return SDSTORAGE_OK;
+#endif
+}
+
+void SDStorage_GetStats(SDStorageStats* stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+#ifdef SDSTORAGE_USE_FATFS
+    const RuntimeSDCardConfig* config = SystemConfig_GetSDCard();
+    *stats = g_stats;
+    if (config->adaptive_sync_enabled) {
+        stats->sync_bytes_target = g_flush_policy.bytes;
+        stats->sync_interval_target_ms = g_flush_policy.interval_ms;
+    } else {
+        stats->sync_bytes_target = config->sync_bytes_threshold;
+        stats->sync_interval_target_ms = config->sync_interval_ms;
+    }
+    stats->policy_grows = g_flush_policy.grows;
+    stats->policy_shrinks = g_flush_policy.shrinks;
+#else
+    memset(stats, 0, sizeof(*stats));
+#endif
+}
+
+void SDStorage_SetBacklog(uint32_t pending_requests)
+{
+#ifdef SDSTORAGE_USE_FATFS
+    FlushPolicy_SetBacklog(&g_flush_policy, pending_requests);
+#else
+    (void)pending_requests;
+#endif
+}
+
+void SDStorage_GetLatency(SDStorageLatencyOp op, LatencyHist* hist)
+{
+    if (hist == NULL) {
+        return;
+    }
+    if (op < SDSTORAGE_LAT_COUNT) {
+        *hist = g_latency[op];
+    } else {
+        LatencyHist_Reset(hist);
+    }
+}
+
+const char* SDStorage_LatencyOpName(SDStorageLatencyOp op)
+{
+    return (op < SDSTORAGE_LAT_COUNT) ? g_latency_names[op] : "unknown";
+}
+
+void SDStorage_ResetLatency(void)
+{
+    for (int op = 0; op < SDSTORAGE_LAT_COUNT; op++) {
+        LatencyHist_Reset(&g_latency[op]);
+    }
+}
+
+void SDStorage_DumpLatency(void)
+{
+    char line[LATENCY_HIST_BUCKETS * 16];
+    for (int op = 0; op < SDSTORAGE_LAT_COUNT; op++) {
+        if (g_latency[op].count == 0) {
+            continue;
+        }
+        if (LatencyHist_FormatSummary(&g_latency[op], g_latency_names[op], line, sizeof(line)) > 0) {
+            LOG_INFO("[SDStorage] lat %s", line);
+        }
+        if (LatencyHist_FormatBuckets(&g_latency[op], g_latency_names[op], line, sizeof(line)) > 0) {
+            LOG_INFO("[SDStorage] hist %s", line);
+        }
+    }
+}
+
 bool SDStorage_IsReady(void)
 {
     return g_sd_ready;
@@ -116,11 +1338,9 @@ bool SDStorage_IsReady(void)
 void SDStorage_Disconnect(void)
 {
     if (g_sd_ready) {
-#ifdef STM32F746xx
-        if (g_file_open) {
-            f_close(&g_log_file);
-            g_file_open = false;
-        }
+#ifdef SDSTORAGE_USE_FATFS
+        // 지속적 파일 닫기 후 마운트 해제
+        _close_persistent_file();
         f_mount(NULL, SDPath, 0);
 #else
         if (g_log_file != NULL) {
@@ -135,23 +1355,15 @@ void SDStorage_Disconnect(void)
     }
 }
 
-int SDStorage_CreateNewLogFile(void)
+ResultCode SDStorage_CreateNewLogFile(void)
 {
     if (!g_sd_ready) {
         return SDSTORAGE_NOT_READY;
     }
     
-    // 이전 파일이 열려있다면 닫기
-#ifdef STM32F746xx
-    if (g_file_open) {
-        f_close(&g_log_file);
-        g_file_open = false;
-    }
-#else
-    if (g_log_file != NULL) {
-        fclose(g_log_file);
-        g_log_file = NULL;
-    }
+#ifdef SDSTORAGE_USE_FATFS
+    // 이전 파일의 압축 블록을 마무리하고 닫음 (새 파일은 새 압축 스트림으로 시작)
+    _close_persistent_file();
 #endif
     
     // 새 파일명 생성
@@ -159,16 +1371,53 @@ int SDStorage_CreateNewLogFile(void)
         return SDSTORAGE_ERROR;
     }
     
-    // 파일 생성 확인
-#ifdef STM32F746xx
-    if (f_open(&g_log_file, g_current_log_file, FA_CREATE_NEW | FA_WRITE) != FR_OK) {
+    // 파일 생성 테스트 (간단한 방식)
+#ifdef SDSTORAGE_USE_FATFS
+    LOG_INFO("[SDStorage] Testing file creation: %s", g_current_log_file);
+    
+    // 지역 변수로 파일 객체 생성
+    FIL test_file;
+    memset(&test_file, 0, sizeof(test_file));
+    
+    // SD 카드 상태 재확인
+    DSTATUS current_disk_status = disk_status(0);
+    LOG_INFO("[SDStorage] Current disk status: 0x%02X", current_disk_status);
+    
+    // 파일 생성 테스트
+    FRESULT open_result = f_open(&test_file, g_current_log_file, FA_CREATE_ALWAYS | FA_WRITE);
+    LOG_INFO("[SDStorage] f_open result: %d", open_result);
+    
+    if (open_result != FR_OK) {
+        LOG_ERROR("[SDStorage] f_open failed: %d", open_result);
+        
+        // 상세 에러 분석
+        switch (open_result) {
+            case 16: // FR_INVALID_OBJECT
+                LOG_ERROR("[SDStorage] FR_INVALID_OBJECT - File object initialization issue");
+                break;
+            case 9: // FR_WRITE_PROTECTED  
+                LOG_ERROR("[SDStorage] FR_WRITE_PROTECTED - SD card is write protected");
+                break;
+            case 3: // FR_NOT_READY
+                LOG_ERROR("[SDStorage] FR_NOT_READY - Disk not ready");
+                break;
+            default:
+                LOG_ERROR("[SDStorage] Unknown f_open error: %d", open_result);
+                break;
+        }
+        
+        LOG_WARN("[SDStorage] Disabling SD logging due to file creation failure");
+        g_sd_ready = false;  // SD 로깅 비활성화
         return SDSTORAGE_FILE_ERROR;
     }
-    f_close(&g_log_file);
-    g_file_open = false;
+    
+    // 파일 생성 확인 후 즉시 닫기 (추적 등록 없이)
+    f_close(&test_file);
+    LogCompress_Init(&g_compressor);
+    LOG_INFO("[SDStorage] File created and ready for logging: %s", g_current_log_file);
 #else
     // PC/테스트 환경: 파일 생성 시뮬레이션 (항상 성공)
-    // 실제 파일 생성 없이 성공으로 처리
+    LOG_INFO("[SDStorage] Test environment - file creation simulated");
 #endif
     
     g_current_log_size = 0;
@@ -180,71 +1429,308 @@ size_t SDStorage_GetCurrentLogSize(void)
     return g_current_log_size;
 }
 
-// 내부 함수 구현
-static int _create_log_directory(void)
+void SDStorage_SetSpillFile(const char* name)
 {
-#ifdef STM32F746xx
-    // STM32: FatFs 디렉토리 생성
-    f_mkdir(SDSTORAGE_LOG_DIR);  // 이미 존재해도 에러 무시
+    snprintf(g_spill_file, sizeof(g_spill_file), "%s", (name != NULL) ? name : SDSTORAGE_SPILL_FILE);
+}
+
+ResultCode SDStorage_SpillWrite(uint32_t offset, const void* data, size_t size)
+{
+    if (!g_sd_ready) {
+        return SDSTORAGE_NOT_READY;
+    }
+    if (data == NULL || size == 0) {
+        return SDSTORAGE_INVALID_PARAM;
+    }
+
+#ifdef SDSTORAGE_USE_FATFS
+    if (!_lock_write(SD_WRITE_LOCK_WAIT_MS)) {
+        return SDSTORAGE_NOT_READY;
+    }
+    char path[SDSTORAGE_SPILL_NAME_MAX + 16];
+    _log_path(path, sizeof(path), g_spill_file);
+    FIL spill_file;
+    UINT bytes_written = 0;
+    FRESULT result = f_open(&spill_file, path, FA_OPEN_ALWAYS | FA_WRITE);
+    if (result == FR_OK) {
+        result = f_lseek(&spill_file, (FSIZE_t)offset);
+        if (result == FR_OK) {
+            result = f_write(&spill_file, data, (UINT)size, &bytes_written);
+        }
+        FRESULT close_result = f_close(&spill_file);
+        if (result == FR_OK) {
+            result = close_result;
+        }
+    }
+    _unlock_write();
+
+    if (result != FR_OK) {
+        return SDSTORAGE_FILE_ERROR;
+    }
+    return (bytes_written == size) ? SDSTORAGE_OK : SDSTORAGE_DISK_FULL;
 #else
-    // PC: mkdir 시뮬레이션 (테스트에서는 성공으로 가정)
-    // 실제로는 디렉토리 생성 시뮬레이션
+    FILE* spill_file = fopen(g_spill_file, "r+b");
+    if (spill_file == NULL) {
+        spill_file = fopen(g_spill_file, "w+b");
+    }
+    if (spill_file == NULL) {
+        return SDSTORAGE_FILE_ERROR;
+    }
+    size_t bytes_written = 0;
+    if (fseek(spill_file, (long)offset, SEEK_SET) == 0) {
+        bytes_written = fwrite(data, 1, size, spill_file);
+    }
+    fclose(spill_file);
+    return (bytes_written == size) ? SDSTORAGE_OK : SDSTORAGE_FILE_ERROR;
+#endif
+}
+
+ResultCode SDStorage_SpillRead(uint32_t offset, void* buf, size_t size, size_t* read_len)
+{
+    if (read_len != NULL) {
+        *read_len = 0;
+    }
+    if (!g_sd_ready) {
+        return SDSTORAGE_NOT_READY;
+    }
+    if (buf == NULL || read_len == NULL) {
+        return SDSTORAGE_INVALID_PARAM;
+    }
+
+#ifdef SDSTORAGE_USE_FATFS
+    if (!_lock_write(SD_WRITE_LOCK_WAIT_MS)) {
+        return SDSTORAGE_NOT_READY;
+    }
+    char path[SDSTORAGE_SPILL_NAME_MAX + 16];
+    _log_path(path, sizeof(path), g_spill_file);
+    FIL spill_file;
+    UINT bytes_read = 0;
+    FRESULT result = f_open(&spill_file, path, FA_READ);
+    if (result == FR_OK) {
+        result = f_lseek(&spill_file, (FSIZE_t)offset);
+        if (result == FR_OK) {
+            result = f_read(&spill_file, buf, (UINT)size, &bytes_read);
+        }
+        f_close(&spill_file);
+    }
+    _unlock_write();
+
+    *read_len = bytes_read;
+    return (result == FR_OK) ? SDSTORAGE_OK : SDSTORAGE_FILE_ERROR;
+#else
+    FILE* spill_file = fopen(g_spill_file, "rb");
+    if (spill_file == NULL) {
+        return SDSTORAGE_FILE_ERROR;
+    }
+    if (fseek(spill_file, (long)offset, SEEK_SET) == 0) {
+        *read_len = fread(buf, 1, size, spill_file);
+    }
+    fclose(spill_file);
+    return SDSTORAGE_OK;
 #endif
+}
+
+ResultCode SDStorage_SpillClear(void)
+{
+    if (!g_sd_ready) {
+        return SDSTORAGE_NOT_READY;
+    }
+
+#ifdef SDSTORAGE_USE_FATFS
+    if (!_lock_write(SD_WRITE_LOCK_WAIT_MS)) {
+        return SDSTORAGE_NOT_READY;
+    }
+    char path[SDSTORAGE_SPILL_NAME_MAX + 16];
+    _log_path(path, sizeof(path), g_spill_file);
+    FRESULT result = f_unlink(path);
+    _unlock_write();
+    return (result == FR_OK || result == FR_NO_FILE) ? SDSTORAGE_OK : SDSTORAGE_FILE_ERROR;
+#else
+    remove(g_spill_file);
     return SDSTORAGE_OK;
+#endif
 }
 
-static int _generate_log_filename(char* filename, size_t max_len)
+// 내부 함수 구현
+static ResultCode _create_log_directory(void)
 {
-    uint32_t timestamp = _get_current_timestamp();
+#ifdef SDSTORAGE_USE_FATFS
+    // FatFs가 이미 정상 동작하므로 HAL 테스트 불필요
+    
+    // f_mkdir 전에 볼륨 상태 재확인 (에러 6 방지)
+    LOG_INFO("[SDStorage] Verifying volume state before f_mkdir...");
     
-    // YYYYMMDD_HHMMSS 형식으로 타임스탬프 생성
-    uint16_t year = 2025;   // 기본값
-    uint8_t month = 1, day = 1, hour = 0, minute = 0, second = 0;
+    // 볼륨 재마운트 시도 (상태 안정화)
+    FRESULT remount_result = f_mount(&SDFatFS, SDPath, 1);
+    LOG_INFO("[SDStorage] Volume re-mount result: %d", remount_result);
     
+    FRESULT mkdir_result = FR_NOT_ENABLED;  // 초기값 설정
+    
+    if (remount_result == FR_OK) {
+        LOG_INFO("[SDStorage] Volume ready - attempting f_mkdir...");
+        mkdir_result = f_mkdir("lora_logs");
+        LOG_INFO("[SDStorage] f_mkdir result: %d", mkdir_result);
+    } else {
+        LOG_ERROR("[SDStorage] Volume re-mount failed: %d", remount_result);
+    }
+    
+    // FR_EXIST(9)는 이미 존재함을 의미하므로 성공으로 처리
+    if (mkdir_result == FR_OK || mkdir_result == FR_EXIST) {
+        LOG_INFO("[SDStorage] Directory ready (created or already exists)");
+        return SDSTORAGE_OK;  // 디렉토리 성공
+    } else {
+        LOG_ERROR("[SDStorage] f_mkdir failed: %d - FatFs level problem", mkdir_result);
+        LOG_INFO("[SDStorage] Will try direct file creation without directory");
+        return SDSTORAGE_ERROR;  // 디렉토리 실패
+    }
+#else
+    // PC: mkdir 시뮬레이션 (테스트에서는 성공으로 가정)
+    LOG_INFO("[SDStorage] Test environment - directory creation simulated");
+    return SDSTORAGE_OK;
+#endif
+}
+
+// SD 하드웨어 초기화 및 상태 확인
+static ResultCode _initialize_sd_hardware(void)
+{
 #ifdef STM32F746xx
-    // STM32: RTC에서 실제 시간 읽기
-    RTC_TimeTypeDef sTime;
-    RTC_DateTypeDef sDate;
-    
-    if (HAL_RTC_GetTime(&hrtc, &sTime, RTC_FORMAT_BIN) == HAL_OK &&
-        HAL_RTC_GetDate(&hrtc, &sDate, RTC_FORMAT_BIN) == HAL_OK) {
-        year = 2000 + sDate.Year;
-        month = sDate.Month;
-        day = sDate.Date;
-        hour = sTime.Hours;
-        minute = sTime.Minutes;
-        second = sTime.Seconds;
-    }
-#else
-    // PC: 간단한 타임스탬프 시뮬레이션 (테스트용)
-    // 실제 시간 대신 고정된 값 사용
-    year = 2025;
-    month = 7;
-    day = 23;
-    hour = 10;
-    minute = 30;
-    second = timestamp % 60;  // 타임스탬프 기반 변화
-#endif
-    
-    int result = snprintf(filename, max_len, 
-                         "%s/%s%04d%02d%02d_%02d%02d%02d%s",
-                         SDSTORAGE_LOG_DIR,
-                         SDSTORAGE_LOG_PREFIX,
-                         year, month, day, hour, minute, second,
-                         SDSTORAGE_LOG_EXTENSION);
+    extern SD_HandleTypeDef hsd1;
+    HAL_SD_CardStateTypeDef card_state = HAL_SD_GetCardState(&hsd1);
+    LOG_INFO("[SDStorage] Initial SD card state: %d", card_state);
     
-    if (result < 0 || (size_t)result >= max_len) {
-        return SDSTORAGE_ERROR;
+    // SD 카드가 TRANSFER 상태가 될 때까지 대기
+    int wait_count = 0;
+    while (card_state != HAL_SD_CARD_TRANSFER && wait_count < SD_TRANSFER_WAIT_MAX_COUNT) {
+        LOG_INFO("[SDStorage] Waiting for SD card TRANSFER state... (attempt %d)", wait_count + 1);
+        SD_DELAY_MS(SD_TRANSFER_CHECK_INTERVAL_MS);
+        card_state = HAL_SD_GetCardState(&hsd1);
+        wait_count++;
     }
     
+    if (card_state == HAL_SD_CARD_TRANSFER) {
+        LOG_INFO("[SDStorage] ✅ SD card reached TRANSFER state successfully");
+        
+        // SDMMC 에러 코드 상세 체크
+        if (hsd1.ErrorCode != HAL_SD_ERROR_NONE) {
+            LOG_WARN("[SDStorage] SDMMC ErrorCode detected: 0x%08X", hsd1.ErrorCode);
+            
+            if (hsd1.ErrorCode & SDMMC_ERROR_TX_UNDERRUN) {
+                LOG_WARN("[SDStorage] TX_UNDERRUN detected - clock may be too fast");
+            }
+            if (hsd1.ErrorCode & SDMMC_ERROR_DATA_CRC_FAIL) {
+                LOG_WARN("[SDStorage] CRC_FAIL detected - cache issue possible");
+                SCB_CleanInvalidateDCache();
+            }
+            
+            // 에러 코드 클리어
+            hsd1.ErrorCode = HAL_SD_ERROR_NONE;
+        }
+        
+        // disk_initialize 호출
+        DSTATUS disk_status = disk_initialize(0);
+        LOG_INFO("[SDStorage] disk_initialize result: 0x%02X", disk_status);
+        
+        if (disk_status != 0) {
+            LOG_ERROR("[SDStorage] disk_initialize failed - SD card not ready");
+            LOG_ERROR("[SDStorage] Possible causes: write-protected, bad card, or BSP/HAL conflict");
+            return SDSTORAGE_ERROR;
+        }
+        
+        return SDSTORAGE_OK;
+    } else {
+        LOG_ERROR("[SDStorage] ❌ SD card failed to reach TRANSFER state (state: %d)", card_state);
+        LOG_ERROR("[SDStorage] SDMMC ErrorCode: 0x%08X", hsd1.ErrorCode);
+        return SDSTORAGE_ERROR;
+    }
+#elif defined(SDSTORAGE_HOST_FATFS)
+    // 디스크 이미지: 카드 상태 대기 없이 disk_initialize만 확인 (미삽입 주입 시 실패)
+    DSTATUS disk_status = disk_initialize(0);
+    if (disk_status != 0) {
+        LOG_ERROR("[SDStorage] disk_initialize failed: 0x%02X", disk_status);
+        return SDSTORAGE_ERROR;
+    }
     return SDSTORAGE_OK;
+#else
+    return SDSTORAGE_OK;  // PC 환경에서는 성공으로 처리
+#endif
 }
 
-static uint32_t _get_current_timestamp(void)
+// 파일시스템 마운트 (재시도 로직 포함)
+static ResultCode _mount_filesystem_with_retry(void)
 {
+#ifdef SDSTORAGE_USE_FATFS
+    // SD 카드 안정화 대기
+    LOG_INFO("[SDStorage] Waiting for SD card stabilization (%dms)...", SD_CARD_STABILIZE_DELAY_MS);
+    SD_DELAY_MS(SD_CARD_STABILIZE_DELAY_MS);
+    
+    // f_mount 여러 번 재시도
+    LOG_INFO("[SDStorage] Attempting f_mount with retry logic...");
+    FRESULT mount_result = FR_DISK_ERR;
+    
+    for (int retry = 0; retry < SD_MOUNT_RETRY_COUNT; retry++) {
+        LOG_INFO("[SDStorage] f_mount attempt %d/%d...", retry + 1, SD_MOUNT_RETRY_COUNT);
+        mount_result = f_mount(&SDFatFS, SDPath, 1);  // 즉시 마운트
+        LOG_INFO("[SDStorage] f_mount result: %d", mount_result);
+        
+        if (mount_result == FR_OK) {
+            LOG_INFO("[SDStorage] ✅ f_mount successful on attempt %d", retry + 1);
+            return SDSTORAGE_OK;
+        } else {
+            LOG_WARN("[SDStorage] f_mount failed on attempt %d, retrying in %dms...", retry + 1, SD_MOUNT_RETRY_DELAY_MS);
+            if (retry < SD_MOUNT_RETRY_COUNT - 1) {  // 마지막 시도가 아니면 대기
 #ifdef STM32F746xx
-    return HAL_GetTick();
+                // STM32F7 D-Cache 클리어
+                LOG_INFO("[SDStorage] Clearing D-Cache for STM32F7 compatibility...");
+                SCB_CleanInvalidateDCache();
+#endif
+                SD_DELAY_MS(SD_MOUNT_RETRY_DELAY_MS);
+            }
+        }
+    }
+    
+    // 모든 재시도 실패 시 추가 복구 시도
+    if (mount_result != FR_OK) {
+        LOG_WARN("[SDStorage] f_mount failed with result: %d", mount_result);
+        
+        if (mount_result == FR_DISK_ERR) {
+            LOG_WARN("[SDStorage] FR_DISK_ERR detected - trying deferred mount...");
+            mount_result = f_mount(&SDFatFS, SDPath, 0);
+            LOG_INFO("[SDStorage] Deferred mount result: %d", mount_result);
+            
+            if (mount_result == FR_OK) {
+                LOG_INFO("[SDStorage] Deferred mount successful!");
+                return SDSTORAGE_OK;
+            }
+        }
+        else if (mount_result == FR_NOT_READY || mount_result == FR_NO_FILESYSTEM) {
+            // 파일시스템 생성 시도
+            static BYTE work[_MAX_SS];
+            LOG_INFO("[SDStorage] Attempting to create filesystem with f_mkfs...");
+            FRESULT mkfs_result = f_mkfs(SDPath, FM_ANY, 0, work, sizeof(work));
+            LOG_INFO("[SDStorage] f_mkfs(FM_ANY) result: %d", mkfs_result);
+            
+            if (mkfs_result != FR_OK) {
+                mkfs_result = f_mkfs(SDPath, FM_FAT32, 4096, work, sizeof(work));
+                LOG_INFO("[SDStorage] f_mkfs(FM_FAT32) result: %d", mkfs_result);
+            }
+            
+            if (mkfs_result == FR_OK) {
+                // 파일시스템 생성 후 재마운트
+                mount_result = f_mount(&SDFatFS, SDPath, 1);
+                LOG_INFO("[SDStorage] Re-mount after mkfs result: %d", mount_result);
+                
+                if (mount_result == FR_OK) {
+                    return SDSTORAGE_OK;
+                }
+            }
+        }
+        
+        LOG_ERROR("[SDStorage] All mount attempts failed");
+        return SDSTORAGE_ERROR;
+    }
+    
+    return SDSTORAGE_OK;
 #else
-    return (uint32_t)time(NULL);
+    return SDSTORAGE_OK;  // PC 환경에서는 성공으로 처리
 #endif
 }
\ No newline at end of file
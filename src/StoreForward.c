@@ -0,0 +1,246 @@
+#include "StoreForward.h"
+#include <string.h>
+
+static void _ram_read(const StoreForward* sf, size_t pos, void* dst, size_t size)
+{
+    size_t first = STORE_FORWARD_RAM_SIZE - pos;
+    if (first > size) {
+        first = size;
+    }
+    memcpy(dst, &sf->ram[pos], first);
+    memcpy((uint8_t*)dst + first, &sf->ram[0], size - first);
+}
+
+static void _ram_write(StoreForward* sf, const void* src, size_t size)
+{
+    size_t first = STORE_FORWARD_RAM_SIZE - sf->ram_head;
+    if (first > size) {
+        first = size;
+    }
+    memcpy(&sf->ram[sf->ram_head], src, first);
+    memcpy(&sf->ram[0], (const uint8_t*)src + first, size - first);
+    sf->ram_head = (sf->ram_head + size) % STORE_FORWARD_RAM_SIZE;
+    sf->ram_used += size;
+}
+
+static size_t _ram_peek_len(const StoreForward* sf)
+{
+    uint8_t prefix[STORE_FORWARD_RECORD_PREFIX];
+    _ram_read(sf, sf->ram_tail, prefix, sizeof(prefix));
+    return (size_t)(prefix[0] | (prefix[1] << 8));
+}
+
+static void _ram_consume(StoreForward* sf, size_t len)
+{
+    size_t record = STORE_FORWARD_RECORD_PREFIX + len;
+    sf->ram_tail = (sf->ram_tail + record) % STORE_FORWARD_RAM_SIZE;
+    sf->ram_used -= record;
+    sf->ram_packets--;
+}
+
+static void _ram_reset(StoreForward* sf)
+{
+    sf->ram_head = 0;
+    sf->ram_tail = 0;
+    sf->ram_used = 0;
+    sf->ram_packets = 0;
+}
+
+static void _spill_reset(StoreForward* sf)
+{
+    if (sf->spill != NULL && sf->spill_write > 0) {
+        sf->spill->clear();
+    }
+    sf->spill_write = 0;
+    sf->spill_read = 0;
+    sf->spill_packets = 0;
+    sf->read_buf_offset = 0;
+    sf->read_buf_len = 0;
+}
+
+// RAM 링 전체를 spill 파일 끝에 기록 (링 끝에서 나뉘면 2번)
+static int _spill_ram(StoreForward* sf)
+{
+    if (sf->spill == NULL || sf->ram_used == 0) {
+        return STORE_FORWARD_ERROR;
+    }
+    if (sf->spill_write + sf->ram_used > STORE_FORWARD_SPILL_MAX_BYTES) {
+        return STORE_FORWARD_ERROR;
+    }
+
+    size_t first = STORE_FORWARD_RAM_SIZE - sf->ram_tail;
+    if (first > sf->ram_used) {
+        first = sf->ram_used;
+    }
+    if (sf->spill->write(sf->spill_write, &sf->ram[sf->ram_tail], first) != 0 ||
+        (sf->ram_used > first &&
+         sf->spill->write(sf->spill_write + (uint32_t)first, &sf->ram[0], sf->ram_used - first) != 0)) {
+        sf->stats.spill_errors++;
+        return STORE_FORWARD_ERROR;
+    }
+
+    sf->spill_write += (uint32_t)sf->ram_used;
+    sf->spill_packets += sf->ram_packets;
+    sf->stats.spilled += sf->ram_packets;
+    _ram_reset(sf);
+    return STORE_FORWARD_OK;
+}
+
+static bool _read_buf_has(const StoreForward* sf, uint32_t offset, size_t size)
+{
+    return offset >= sf->read_buf_offset &&
+           offset - sf->read_buf_offset + size <= sf->read_buf_len;
+}
+
+static bool _read_buf_fill(StoreForward* sf, uint32_t offset)
+{
+    size_t size = sf->spill_write - offset;
+    if (size > STORE_FORWARD_READ_CHUNK) {
+        size = STORE_FORWARD_READ_CHUNK;
+    }
+    size_t read_len = 0;
+    if (sf->spill->read(offset, sf->read_buf, size, &read_len) != 0) {
+        sf->stats.spill_errors++;
+        sf->read_buf_len = 0;
+        return false;
+    }
+    sf->read_buf_offset = offset;
+    sf->read_buf_len = read_len;
+    return true;
+}
+
+// spill 파일의 다음 레코드 (read_buf 안을 가리킴), 읽기 실패면 NULL
+static const uint8_t* _spill_peek(StoreForward* sf, size_t* len)
+{
+    uint32_t offset = sf->spill_read;
+    if (!_read_buf_has(sf, offset, STORE_FORWARD_RECORD_PREFIX) && !_read_buf_fill(sf, offset)) {
+        return NULL;
+    }
+    if (!_read_buf_has(sf, offset, STORE_FORWARD_RECORD_PREFIX)) {
+        return NULL;
+    }
+
+    const uint8_t* prefix = &sf->read_buf[offset - sf->read_buf_offset];
+    size_t packet_len = (size_t)(prefix[0] | (prefix[1] << 8));
+    if (packet_len == 0 || packet_len > STORE_FORWARD_MAX_PACKET) {
+        return NULL;
+    }
+    if (!_read_buf_has(sf, offset, STORE_FORWARD_RECORD_PREFIX + packet_len)) {
+        if (!_read_buf_fill(sf, offset) ||
+            !_read_buf_has(sf, offset, STORE_FORWARD_RECORD_PREFIX + packet_len)) {
+            return NULL;
+        }
+    }
+
+    *len = packet_len;
+    return &sf->read_buf[offset - sf->read_buf_offset + STORE_FORWARD_RECORD_PREFIX];
+}
+
+void StoreForward_Init(StoreForward* sf, const StoreForwardSpill* spill, uint32_t bytes_per_sec)
+{
+    if (sf == NULL) {
+        return;
+    }
+    memset(sf, 0, sizeof(*sf));
+    sf->spill = spill;
+    sf->bytes_per_sec = (bytes_per_sec > 0) ? bytes_per_sec : STORE_FORWARD_DRAIN_BPS;
+    sf->burst_bytes = STORE_FORWARD_DRAIN_BURST;
+}
+
+bool StoreForward_IsEmpty(const StoreForward* sf)
+{
+    return sf == NULL || (sf->ram_used == 0 && sf->spill_read == sf->spill_write);
+}
+
+int StoreForward_Store(StoreForward* sf, const void* data, size_t size)
+{
+    if (sf == NULL || data == NULL || size == 0 || size > STORE_FORWARD_MAX_PACKET) {
+        return STORE_FORWARD_ERROR;
+    }
+
+    size_t record = STORE_FORWARD_RECORD_PREFIX + size;
+    if (record > STORE_FORWARD_RAM_SIZE - sf->ram_used && _spill_ram(sf) != STORE_FORWARD_OK) {
+        // spill 불가 - 가장 오래된 RAM 패킷부터 버려 자리 확보
+        while (record > STORE_FORWARD_RAM_SIZE - sf->ram_used) {
+            _ram_consume(sf, _ram_peek_len(sf));
+            sf->stats.dropped++;
+        }
+    }
+
+    uint8_t prefix[STORE_FORWARD_RECORD_PREFIX] = { (uint8_t)(size & 0xFF), (uint8_t)(size >> 8) };
+    _ram_write(sf, prefix, sizeof(prefix));
+    _ram_write(sf, data, size);
+    sf->ram_packets++;
+    sf->stats.stored++;
+    return STORE_FORWARD_OK;
+}
+
+int StoreForward_Drain(StoreForward* sf, StoreForwardSink sink, uint32_t now_ms)
+{
+    if (sf == NULL || sink == NULL) {
+        return 0;
+    }
+
+    // 토큰 보충 (경과 시간 x 속도, burst까지)
+    if (!sf->drain_started) {
+        sf->drain_started = true;
+        sf->tokens = sf->burst_bytes;
+        sf->last_drain_ms = now_ms;
+    } else {
+        uint64_t add = ((uint64_t)(now_ms - sf->last_drain_ms) * sf->bytes_per_sec) / 1000U;
+        if (add > 0) {
+            sf->tokens = (add >= sf->burst_bytes - sf->tokens) ? sf->burst_bytes : sf->tokens + (uint32_t)add;
+            sf->last_drain_ms = now_ms;
+        }
+    }
+
+    int replayed = 0;
+    while (!StoreForward_IsEmpty(sf)) {
+        const uint8_t* packet;
+        size_t len = 0;
+        bool from_spill = sf->spill_read < sf->spill_write;
+
+        if (from_spill) {
+            packet = _spill_peek(sf, &len);
+            if (packet == NULL) {
+                // 읽을 수 없는 spill 파일 - 남은 spill 패킷은 포기하고 RAM 링부터 계속
+                sf->stats.dropped += sf->spill_packets;
+                _spill_reset(sf);
+                continue;
+            }
+        } else {
+            len = _ram_peek_len(sf);
+            _ram_read(sf, (sf->ram_tail + STORE_FORWARD_RECORD_PREFIX) % STORE_FORWARD_RAM_SIZE,
+                      sf->packet, len);
+            packet = sf->packet;
+        }
+
+        if (len > sf->tokens || sink(packet, len) != 0) {
+            break;
+        }
+        sf->tokens -= (uint32_t)len;
+        sf->stats.replayed++;
+        replayed++;
+
+        if (from_spill) {
+            sf->spill_read += (uint32_t)(STORE_FORWARD_RECORD_PREFIX + len);
+            sf->spill_packets--;
+            if (sf->spill_read == sf->spill_write) {
+                _spill_reset(sf);
+            }
+        } else {
+            _ram_consume(sf, len);
+        }
+    }
+    return replayed;
+}
+
+void StoreForward_GetStats(const StoreForward* sf, StoreForwardStats* stats)
+{
+    if (sf == NULL || stats == NULL) {
+        return;
+    }
+    *stats = sf->stats;
+    stats->ram_bytes = (uint32_t)sf->ram_used;
+    stats->spill_bytes = sf->spill_write - sf->spill_read;
+}
@@ -0,0 +1,92 @@
+#ifndef STOREFORWARD_H
+#define STOREFORWARD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// 전송 못 한 패킷 보관 후 재전송 (store-and-forward)
+//
+// 보관 순서: RAM 링 -> (가득 차면) RAM 링 전체를 spill 파일 끝에 기록 -> RAM 링 비움
+// RAM 링에는 항상 가장 최근 패킷이 있으므로 재전송 순서는 spill 파일 앞부분 -> RAM 링 (FIFO)
+// spill에 실패하거나(SD 없음/가득) spill 상한을 넘으면 RAM 링의 가장 오래된 패킷부터 버림
+//
+// 레코드 형식 (RAM 링과 spill 파일 동일): [length u16 LE][패킷 바이트]
+// spill 파일은 호출자가 준 함수로 접근 (Network: SDStorage_Spill*), 위치는 이 모듈이 관리하므로
+// 쓰기 도중 실패해도 다음 쓰기가 같은 위치를 덮어씀
+//
+// 재전송은 토큰 버킷으로 속도 제한 (bytes_per_sec, 최대 burst_bytes 누적)
+// 재전송 중에도 실시간 패킷은 호출자가 바로 보냄 - 밀린 데이터가 실시간 전송을 막지 않음
+
+#define STORE_FORWARD_RAM_SIZE          (16U * 1024U)
+#define STORE_FORWARD_RECORD_PREFIX     2U
+#define STORE_FORWARD_MAX_PACKET        1024U
+#define STORE_FORWARD_READ_CHUNK        2048U           // spill 읽기 단위 (레코드 최대 크기 이상)
+#define STORE_FORWARD_SPILL_MAX_BYTES   (4U * 1024U * 1024U)
+#define STORE_FORWARD_DRAIN_BPS         (8U * 1024U)    // 기본 재전송 속도 (bytes/s)
+#define STORE_FORWARD_DRAIN_BURST       (2U * 1024U)
+
+// 결과 코드
+#define STORE_FORWARD_OK                 0
+#define STORE_FORWARD_ERROR             -1
+#define STORE_FORWARD_DROPPED           -5      // 보관할 곳이 없어 패킷을 버림
+
+// spill 파일 접근 (0이면 성공)
+typedef struct {
+    int (*write)(uint32_t offset, const void* data, size_t size);
+    int (*read)(uint32_t offset, void* buf, size_t size, size_t* read_len);
+    int (*clear)(void);
+} StoreForwardSpill;
+
+// 재전송 대상 (0이면 성공, 실패하면 그 패킷부터 다음 Drain에서 다시 시도)
+typedef int (*StoreForwardSink)(const void* data, size_t size);
+
+typedef struct {
+    uint32_t stored;            // 보관한 패킷
+    uint32_t spilled;           // RAM 링에서 spill 파일로 옮긴 패킷
+    uint32_t replayed;          // 재전송한 패킷
+    uint32_t dropped;           // 버린 패킷 (보관 거부 + RAM 링에서 밀려남)
+    uint32_t spill_errors;      // spill 파일 쓰기/읽기 실패
+    uint32_t ram_bytes;         // 현재 RAM 링 사용량
+    uint32_t spill_bytes;       // 현재 spill 파일의 재전송 대기 바이트
+} StoreForwardStats;
+
+typedef struct {
+    uint8_t ram[STORE_FORWARD_RAM_SIZE];
+    size_t ram_head;
+    size_t ram_tail;
+    size_t ram_used;
+    uint32_t ram_packets;
+
+    const StoreForwardSpill* spill;
+    uint32_t spill_write;       // spill 파일 끝 (다음 기록 위치)
+    uint32_t spill_read;        // 다음 재전송 레코드 위치
+    uint32_t spill_packets;
+    uint8_t read_buf[STORE_FORWARD_READ_CHUNK];
+    uint32_t read_buf_offset;   // read_buf[0]의 파일 위치
+    size_t read_buf_len;
+    uint8_t packet[STORE_FORWARD_MAX_PACKET];   // RAM 링 레코드가 링 끝에서 나뉠 때 이어 붙일 곳
+
+    uint32_t bytes_per_sec;
+    uint32_t burst_bytes;
+    uint32_t tokens;
+    uint32_t last_drain_ms;
+    bool drain_started;
+
+    StoreForwardStats stats;
+} StoreForward;
+
+// spill이 NULL이면 RAM 링만 사용, bytes_per_sec가 0이면 기본값
+void StoreForward_Init(StoreForward* sf, const StoreForwardSpill* spill, uint32_t bytes_per_sec);
+
+// 패킷 보관 (size <= STORE_FORWARD_MAX_PACKET)
+// 이 패킷 대신 오래된 패킷을 버렸어도 STORE_FORWARD_OK, 이 패킷을 못 넣으면 STORE_FORWARD_DROPPED
+int StoreForward_Store(StoreForward* sf, const void* data, size_t size);
+
+// 속도 제한 안에서 오래된 순서로 sink에 재전송, 재전송한 패킷 수 반환
+int StoreForward_Drain(StoreForward* sf, StoreForwardSink sink, uint32_t now_ms);
+
+bool StoreForward_IsEmpty(const StoreForward* sf);
+void StoreForward_GetStats(const StoreForward* sf, StoreForwardStats* stats);
+
+#endif // STOREFORWARD_H
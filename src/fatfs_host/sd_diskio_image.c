@@ -0,0 +1,258 @@
+#include "sd_diskio_image.h"
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+FATFS SDFatFS;
+char SDPath[4];
+
+typedef struct {
+    uint32_t per_call_us;
+    uint32_t per_sector_us;
+    uint32_t fail_after;        // 남은 성공 횟수
+    uint32_t fail_count;        // 이후 실패할 횟수 (0: 주입 없음)
+} SDImageFault;
+
+static uint8_t* g_image = NULL;
+static uint32_t g_sector_count = 0;
+static int g_fd = -1;
+static DSTATUS g_status = STA_NOINIT;
+static bool g_not_ready = false;
+static SDImageFault g_faults[SD_IMAGE_OP_COUNT];
+static SDImageStats g_stats;
+
+// 기본 지연: 실제 대기 (<time.h>는 src/time.h에 가려지므로 usleep 사용)
+static void _sleep_us(uint32_t us)
+{
+    usleep(us);
+}
+
+static SDImageDelayFn g_delay = _sleep_us;
+
+// 지연 주입 후 오류 주입 여부 판단 (true: 이번 호출 실패)
+static bool _inject(SDImageOp op, UINT sectors)
+{
+    SDImageFault* fault = &g_faults[op];
+    g_stats.calls[op]++;
+    g_stats.sectors[op] += sectors;
+
+    uint32_t delay_us = fault->per_call_us + fault->per_sector_us * sectors;
+    if (delay_us > 0) {
+        g_stats.injected_delay_us += delay_us;
+        g_delay(delay_us);
+    }
+
+    if (fault->fail_count == 0) {
+        return false;
+    }
+    if (fault->fail_after > 0) {
+        fault->fail_after--;
+        return false;
+    }
+    fault->fail_count--;
+    g_stats.injected_errors++;
+    return true;
+}
+
+static DSTATUS SDImage_initialize(BYTE lun)
+{
+    (void)lun;
+    g_status = (g_image != NULL && !g_not_ready) ? 0 : STA_NOINIT;
+    return g_status;
+}
+
+static DSTATUS SDImage_status(BYTE lun)
+{
+    (void)lun;
+    if (g_not_ready) {
+        g_status = STA_NOINIT;
+    }
+    return g_status;
+}
+
+static DRESULT SDImage_read(BYTE lun, BYTE* buff, DWORD sector, UINT count)
+{
+    (void)lun;
+    if (g_status & STA_NOINIT) {
+        return RES_NOTRDY;
+    }
+    if (sector + count > g_sector_count) {
+        return RES_PARERR;
+    }
+    if (_inject(SD_IMAGE_OP_READ, count)) {
+        return RES_ERROR;
+    }
+    memcpy(buff, &g_image[(size_t)sector * SD_IMAGE_SECTOR_SIZE], (size_t)count * SD_IMAGE_SECTOR_SIZE);
+    return RES_OK;
+}
+
+static DRESULT SDImage_write(BYTE lun, const BYTE* buff, DWORD sector, UINT count)
+{
+    (void)lun;
+    if (g_status & STA_NOINIT) {
+        return RES_NOTRDY;
+    }
+    if (sector + count > g_sector_count) {
+        return RES_PARERR;
+    }
+    if (_inject(SD_IMAGE_OP_WRITE, count)) {
+        return RES_ERROR;   // 실패한 쓰기는 이미지에 반영하지 않음
+    }
+    memcpy(&g_image[(size_t)sector * SD_IMAGE_SECTOR_SIZE], buff, (size_t)count * SD_IMAGE_SECTOR_SIZE);
+    return RES_OK;
+}
+
+static DRESULT SDImage_ioctl(BYTE lun, BYTE cmd, void* buff)
+{
+    (void)lun;
+    if (g_status & STA_NOINIT) {
+        return RES_NOTRDY;
+    }
+
+    switch (cmd) {
+        case CTRL_SYNC:
+            // mmap 내용은 프로세스가 죽어도 파일에 남으므로 msync 불필요 (카드 busy만 재현)
+            return _inject(SD_IMAGE_OP_SYNC, 0) ? RES_ERROR : RES_OK;
+        case GET_SECTOR_COUNT:
+            *(DWORD*)buff = g_sector_count;
+            return RES_OK;
+        case GET_SECTOR_SIZE:
+            *(WORD*)buff = SD_IMAGE_SECTOR_SIZE;
+            return RES_OK;
+        case GET_BLOCK_SIZE:
+            *(DWORD*)buff = SD_IMAGE_BLOCK_SIZE;
+            return RES_OK;
+        default:
+            return RES_PARERR;
+    }
+}
+
+static const Diskio_drvTypeDef SDImage_Driver = {
+    SDImage_initialize,
+    SDImage_status,
+    SDImage_read,
+    SDImage_write,
+    SDImage_ioctl,
+};
+
+int SDImage_Open(const char* path, uint32_t sector_count)
+{
+    if (g_image != NULL || sector_count == 0) {
+        return SD_IMAGE_ERROR;
+    }
+
+    size_t size = (size_t)sector_count * SD_IMAGE_SECTOR_SIZE;
+    if (path == NULL) {
+        g_image = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    } else {
+        g_fd = open(path, O_RDWR | O_CREAT, 0644);
+        struct stat st;
+        if (g_fd < 0 || fstat(g_fd, &st) != 0 ||
+            ((size_t)st.st_size < size && ftruncate(g_fd, (off_t)size) != 0)) {
+            if (g_fd >= 0) {
+                close(g_fd);
+                g_fd = -1;
+            }
+            return SD_IMAGE_ERROR;
+        }
+        g_image = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, g_fd, 0);
+    }
+    if (g_image == MAP_FAILED) {
+        g_image = NULL;
+        if (g_fd >= 0) {
+            close(g_fd);
+            g_fd = -1;
+        }
+        return SD_IMAGE_ERROR;
+    }
+
+    g_sector_count = sector_count;
+    g_status = STA_NOINIT;
+    SDImage_ResetFaults();
+    if (FATFS_LinkDriver(&SDImage_Driver, SDPath) != 0) {
+        SDImage_Close();
+        return SD_IMAGE_ERROR;
+    }
+    return SD_IMAGE_OK;
+}
+
+void SDImage_Close(void)
+{
+    if (g_image == NULL) {
+        return;
+    }
+    FATFS_UnLinkDriver(SDPath);
+    munmap(g_image, (size_t)g_sector_count * SD_IMAGE_SECTOR_SIZE);
+    if (g_fd >= 0) {
+        close(g_fd);
+        g_fd = -1;
+    }
+    g_image = NULL;
+    g_sector_count = 0;
+    g_status = STA_NOINIT;
+}
+
+void SDImage_Erase(void)
+{
+    if (g_image != NULL) {
+        memset(g_image, 0, (size_t)g_sector_count * SD_IMAGE_SECTOR_SIZE);
+    }
+}
+
+uint8_t* SDImage_Data(void)
+{
+    return g_image;
+}
+
+uint32_t SDImage_SectorCount(void)
+{
+    return g_sector_count;
+}
+
+void SDImage_SetLatency(SDImageOp op, uint32_t per_call_us, uint32_t per_sector_us)
+{
+    if (op < SD_IMAGE_OP_COUNT) {
+        g_faults[op].per_call_us = per_call_us;
+        g_faults[op].per_sector_us = per_sector_us;
+    }
+}
+
+void SDImage_SetDelayFn(SDImageDelayFn fn)
+{
+    g_delay = (fn != NULL) ? fn : _sleep_us;
+}
+
+void SDImage_FailAfter(SDImageOp op, uint32_t after_calls, uint32_t count)
+{
+    if (op < SD_IMAGE_OP_COUNT) {
+        g_faults[op].fail_after = after_calls;
+        g_faults[op].fail_count = count;
+    }
+}
+
+void SDImage_SetNotReady(bool not_ready)
+{
+    g_not_ready = not_ready;
+}
+
+void SDImage_ResetFaults(void)
+{
+    memset(g_faults, 0, sizeof(g_faults));
+    g_not_ready = false;
+    g_delay = _sleep_us;
+    SDImage_ResetStats();
+}
+
+void SDImage_GetStats(SDImageStats* stats)
+{
+    if (stats != NULL) {
+        *stats = g_stats;
+    }
+}
+
+void SDImage_ResetStats(void)
+{
+    memset(&g_stats, 0, sizeof(g_stats));
+}
@@ -0,0 +1,74 @@
+#ifndef SD_DISKIO_IMAGE_H
+#define SD_DISKIO_IMAGE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ff.h"
+#include "ff_gen_drv.h"
+
+// 호스트용 FatFs 디스크 드라이버: 섹터를 디스크 이미지(파일 mmap 또는 익명 메모리)에 매핑
+// 타겟의 sd_diskio.c 자리에 연결되어 SDStorage + FatFs 전체 경로를 호스트에서 실행
+// (테스트/벤치마크 전용, SDSTORAGE_HOST_FATFS 빌드)
+//
+// 지연/오류 주입으로 느린 카드, 간헐적 쓰기 실패, 카드 미삽입을 재현
+
+#define SD_IMAGE_SECTOR_SIZE    512
+#define SD_IMAGE_BLOCK_SIZE     8       // 지우기 블록 크기 (섹터 단위, f_mkfs 정렬용)
+
+// 결과 코드
+#define SD_IMAGE_OK              0
+#define SD_IMAGE_ERROR          -1
+
+// 지연/오류 주입 대상 동작
+typedef enum {
+    SD_IMAGE_OP_READ = 0,
+    SD_IMAGE_OP_WRITE,
+    SD_IMAGE_OP_SYNC,       // disk_ioctl(CTRL_SYNC) - f_sync/f_close 시 카드 busy
+    SD_IMAGE_OP_COUNT
+} SDImageOp;
+
+typedef struct {
+    uint32_t calls[SD_IMAGE_OP_COUNT];
+    uint32_t sectors[SD_IMAGE_OP_COUNT];    // 읽기/쓰기 섹터 수
+    uint32_t injected_errors;
+    uint64_t injected_delay_us;             // 주입된 지연 합계
+} SDImageStats;
+
+// 지연 구현 (기본: nanosleep, 테스트는 가상 시간 진행 함수로 교체)
+typedef void (*SDImageDelayFn)(uint32_t us);
+
+// fatfs.c(타겟)와 같은 이름의 전역 - SDStorage가 그대로 사용
+extern FATFS SDFatFS;
+extern char SDPath[4];
+
+// 이미지 열기 후 드라이버 연결 (path NULL: 익명 메모리 이미지)
+// 파일이 sector_count보다 작으면 확장 (기존 내용 유지, 새 영역은 0 = 포맷 안 된 카드)
+int SDImage_Open(const char* path, uint32_t sector_count);
+
+// 드라이버 해제 및 이미지 닫기 (파일 이미지는 내용 유지)
+void SDImage_Close(void);
+
+// 이미지 전체를 0으로 (포맷 안 된 카드)
+void SDImage_Erase(void);
+
+// 이미지 메모리 직접 접근 (손상/찢어진 쓰기 재현용)
+uint8_t* SDImage_Data(void);
+uint32_t SDImage_SectorCount(void);
+
+// 지연 주입: 호출당 고정 지연 + 섹터당 지연 (us)
+void SDImage_SetLatency(SDImageOp op, uint32_t per_call_us, uint32_t per_sector_us);
+void SDImage_SetDelayFn(SDImageDelayFn fn);
+
+// 오류 주입: op가 after_calls번 성공한 뒤 count번 RES_ERROR (count 0: 해제)
+void SDImage_FailAfter(SDImageOp op, uint32_t after_calls, uint32_t count);
+
+// 카드 미삽입/초기화 실패 (disk_initialize/disk_status가 STA_NOINIT)
+void SDImage_SetNotReady(bool not_ready);
+
+// 주입 설정(지연/오류/미삽입) 및 통계 초기화
+void SDImage_ResetFaults(void);
+
+void SDImage_GetStats(SDImageStats* stats);
+void SDImage_ResetStats(void);
+
+#endif // SD_DISKIO_IMAGE_H
@@ -1,4 +1,5 @@
 #include "time.h"
+#include <stddef.h>
 
 // ============================================================================
 // 기본 시간 함수
@@ -46,4 +47,100 @@ uint32_t TIME_CalculateRemaining(uint32_t start_time, uint32_t timeout_ms)
     } else {
         return timeout_ms - elapsed;
     }
-} 
\ No newline at end of file
+} 
+
+// ============================================================================
+// 64비트 단조 시간 / 마감 시각
+// ============================================================================
+
+uint64_t TIME_GetMonotonicMs(void)
+{
+    return TIME_Platform_GetMonotonicMs();
+}
+
+uint64_t TIME_GetMonotonicUs(void)
+{
+    return TIME_Platform_GetMonotonicUs();
+}
+
+TIME_Deadline TIME_DeadlineAfter(uint64_t timeout_ms)
+{
+    uint64_t now = TIME_GetMonotonicMs();
+    
+    if (timeout_ms >= TIME_DEADLINE_NEVER - now) {
+        return TIME_DEADLINE_NEVER;
+    }
+    return now + timeout_ms;
+}
+
+bool TIME_DeadlineExpired(TIME_Deadline deadline)
+{
+    if (deadline == TIME_DEADLINE_NEVER) {
+        return false;
+    }
+    return TIME_GetMonotonicMs() >= deadline;
+}
+
+uint64_t TIME_DeadlineRemainingMs(TIME_Deadline deadline)
+{
+    uint64_t now = TIME_GetMonotonicMs();
+    
+    if (now >= deadline) {
+        return 0;
+    }
+    return deadline - now;
+}
+
+// ============================================================================
+// 달력 변환 함수
+// ============================================================================
+
+// 3월을 한 해의 시작으로 보는 civil 날짜 <-> 일수 변환 (윤일이 연말에 오도록)
+static int32_t _days_from_civil(int32_t y, uint32_t m, uint32_t d)
+{
+    y -= (m <= 2) ? 1 : 0;
+    int32_t era = (y >= 0 ? y : y - 399) / 400;
+    uint32_t yoe = (uint32_t)(y - era * 400);
+    uint32_t doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (int32_t)doe - 719468;
+}
+
+uint32_t TIME_DateTimeToEpoch(const TIME_DateTime* dt)
+{
+    if (dt == NULL) {
+        return 0;
+    }
+
+    int32_t days = _days_from_civil(dt->year, dt->month, dt->day);
+    return (uint32_t)days * 86400U + dt->hour * 3600U + dt->minute * 60U + dt->second;
+}
+
+void TIME_EpochToDateTime(uint32_t epoch_sec, TIME_DateTime* dt)
+{
+    if (dt == NULL) {
+        return;
+    }
+
+    uint32_t days = epoch_sec / 86400U;
+    uint32_t secs = epoch_sec % 86400U;
+
+    dt->hour = (uint8_t)(secs / 3600U);
+    dt->minute = (uint8_t)((secs % 3600U) / 60U);
+    dt->second = (uint8_t)(secs % 60U);
+
+    // 1970-01-01은 0000-03-01 기준 719468일째
+    uint32_t z = days + 719468U;
+    uint32_t era = z / 146097U;
+    uint32_t doe = z - era * 146097U;
+    uint32_t yoe = (doe - doe / 1460U + doe / 36524U - doe / 146096U) / 365U;
+    uint32_t doy = doe - (365U * yoe + yoe / 4U - yoe / 100U);
+    uint32_t mp = (5U * doy + 2U) / 153U;
+    uint32_t d = doy - (153U * mp + 2U) / 5U + 1U;
+    uint32_t m = (mp < 10U) ? mp + 3U : mp - 9U;
+    uint32_t y = yoe + era * 400U + ((m <= 2U) ? 1U : 0U);
+
+    dt->year = (uint16_t)y;
+    dt->month = (uint8_t)m;
+    dt->day = (uint8_t)d;
+}
\ No newline at end of file
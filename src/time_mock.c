@@ -1,7 +1,7 @@
 #include "time.h"
 
-// Mock 전용 전역 변수
-static uint32_t mock_current_time = 0;
+// Mock 전용 전역 변수 (64비트 단조 ms - TIME_GetCurrentMs는 하위 32비트라 wrap도 재현됨)
+static uint64_t mock_current_time = 0;
 
 // ============================================================================
 // Mock 함수 (테스트용)
@@ -27,10 +27,20 @@ void TIME_Mock_Reset(void)
 // ============================================================================
 
 uint32_t TIME_Platform_GetCurrentMs(void)
+{
+    return (uint32_t)mock_current_time;
+}
+
+uint64_t TIME_Platform_GetMonotonicMs(void)
 {
     return mock_current_time;
 }
 
+uint64_t TIME_Platform_GetMonotonicUs(void)
+{
+    return mock_current_time * 1000U;
+}
+
 void TIME_Platform_DelayMs(uint32_t ms)
 {
     mock_current_time += ms;
@@ -128,13 +128,14 @@ UartStatus UART_ReceiveWithTimeout(char* buffer, int buffer_size,
     LOG_DEBUG("[UART] Receiving with timeout: %lu ms", timeout_ms);
     
     // 시간 모듈이 필요하므로 extern으로 포함
-    extern uint32_t TIME_GetCurrentMs(void);
-    extern bool TIME_IsTimeout(uint32_t start_time, uint32_t timeout_ms);
+    // (32비트 ms는 49.7일마다 wrap되므로 64비트 단조 시간 기준 마감 시각 사용)
+    extern uint64_t TIME_DeadlineAfter(uint64_t timeout_ms);
+    extern bool TIME_DeadlineExpired(uint64_t deadline);
     extern void TIME_DelayMs(uint32_t ms);
     
-    uint32_t start_time = TIME_GetCurrentMs();
+    uint64_t deadline = TIME_DeadlineAfter(timeout_ms);
     
-    while (!TIME_IsTimeout(start_time, timeout_ms)) {
+    while (!TIME_DeadlineExpired(deadline)) {
         UartStatus status = UART_Platform_Receive(buffer, buffer_size, bytes_received);
         
         if (status == UART_STATUS_OK && *bytes_received > 0) {
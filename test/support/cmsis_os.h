@@ -0,0 +1,139 @@
+#ifndef CMSIS_OS_H
+#define CMSIS_OS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 호스트 테스트용 CMSIS-RTOS v1 스텁 (메일 큐만 구현, 단일 스레드)
+// 메일 큐는 고정 블록 풀 + FIFO - 대기 없이 바로 반환하고, 할당/넣기 실패를 주입할 수 있음
+// 타겟 코드(.c)를 테스트 파일에 직접 포함하는 경우에만 사용
+
+typedef enum {
+    osOK            = 0,
+    osEventMail     = 0x20,
+    osEventTimeout  = 0x40,
+    osErrorResource = 0x81,
+    osErrorOS       = 0xFF
+} osStatus;
+
+typedef struct {
+    osStatus status;
+    union {
+        uint32_t v;
+        void* p;
+        int32_t signals;
+    } value;
+} osEvent;
+
+typedef struct {
+    uint32_t queue_sz;
+    uint32_t item_sz;
+} osMailQDef_t;
+
+#define osMailQDef(name, queue_sz, type) \
+    const osMailQDef_t os_mailQ_def_##name = { (queue_sz), sizeof(type) }
+#define osMailQ(name)  (&os_mailQ_def_##name)
+
+#define OS_STUB_MAIL_MAX  64
+
+typedef struct os_mailQ_cb {
+    uint32_t queue_sz;
+    uint32_t item_sz;
+    uint8_t* pool;
+    bool used[OS_STUB_MAIL_MAX];
+    void* fifo[OS_STUB_MAIL_MAX];
+    uint32_t head;
+    uint32_t count;
+} *osMailQId;
+
+static uint32_t os_stub_fail_allocs = 0;   // 다음 N번 osMailAlloc 실패
+static uint32_t os_stub_delay_ms = 0;      // osDelay 누적 (ms)
+
+static inline osMailQId osMailCreate(const osMailQDef_t* def, void* thread_id)
+{
+    (void)thread_id;
+    if (def->queue_sz > OS_STUB_MAIL_MAX) {
+        return NULL;
+    }
+    osMailQId queue = (osMailQId)calloc(1, sizeof(*queue));
+    queue->queue_sz = def->queue_sz;
+    queue->item_sz = def->item_sz;
+    queue->pool = (uint8_t*)calloc(def->queue_sz, def->item_sz);
+    return queue;
+}
+
+// 스텁 전용: 큐와 블록 풀 해제
+static inline void OS_Stub_MailDelete(osMailQId queue)
+{
+    if (queue != NULL) {
+        free(queue->pool);
+        free(queue);
+    }
+}
+
+static inline void* osMailAlloc(osMailQId queue, uint32_t millisec)
+{
+    (void)millisec;
+    if (os_stub_fail_allocs > 0) {
+        os_stub_fail_allocs--;
+        return NULL;
+    }
+    for (uint32_t i = 0; i < queue->queue_sz; i++) {
+        if (!queue->used[i]) {
+            queue->used[i] = true;
+            return &queue->pool[i * queue->item_sz];
+        }
+    }
+    return NULL;
+}
+
+static inline osStatus osMailFree(osMailQId queue, void* mail)
+{
+    uint32_t index = (uint32_t)(((uint8_t*)mail - queue->pool) / queue->item_sz);
+    if (index >= queue->queue_sz || !queue->used[index]) {
+        return osErrorOS;
+    }
+    queue->used[index] = false;
+    return osOK;
+}
+
+static inline osStatus osMailPut(osMailQId queue, void* mail)
+{
+    if (queue->count >= queue->queue_sz) {
+        return osErrorResource;
+    }
+    queue->fifo[(queue->head + queue->count) % queue->queue_sz] = mail;
+    queue->count++;
+    return osOK;
+}
+
+static inline osEvent osMailGet(osMailQId queue, uint32_t millisec)
+{
+    osEvent event;
+    event.value.p = NULL;
+    if (queue->count == 0) {
+        event.status = (millisec == 0) ? osOK : osEventTimeout;
+        return event;
+    }
+    event.status = osEventMail;
+    event.value.p = queue->fifo[queue->head];
+    queue->head = (queue->head + 1) % queue->queue_sz;
+    queue->count--;
+    return event;
+}
+
+// 스텁 전용: 큐에 들어 있는 메일 수
+static inline uint32_t OS_Stub_MailCount(osMailQId queue)
+{
+    return queue->count;
+}
+
+static inline osStatus osDelay(uint32_t millisec)
+{
+    os_stub_delay_ms += millisec;
+    return osOK;
+}
+
+#endif // CMSIS_OS_H
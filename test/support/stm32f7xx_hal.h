@@ -0,0 +1,32 @@
+#ifndef STM32F7XX_HAL_H
+#define STM32F7XX_HAL_H
+
+#include <stdint.h>
+
+// 호스트 테스트용 HAL 스텁: tick과 PRIMASK 조작만 제공
+// (타겟 코드(.c)를 테스트 파일에 직접 포함하는 경우에만 사용)
+
+static uint32_t hal_stub_tick = 0;
+static uint32_t hal_stub_primask = 0;
+
+static inline uint32_t HAL_GetTick(void)
+{
+    return hal_stub_tick;
+}
+
+static inline uint32_t __get_PRIMASK(void)
+{
+    return hal_stub_primask;
+}
+
+static inline void __set_PRIMASK(uint32_t primask)
+{
+    hal_stub_primask = primask;
+}
+
+static inline void __disable_irq(void)
+{
+    hal_stub_primask = 1;
+}
+
+#endif // STM32F7XX_HAL_H
@@ -0,0 +1,67 @@
+#include "unity.h"
+#include "Checksum.h"
+#include <string.h>
+
+static uint8_t buffer[1024 + 8];
+
+void setUp(void)
+{
+    // 결정적 의사 난수 패턴
+    uint32_t x = 0x12345678;
+    for (size_t i = 0; i < sizeof(buffer); i++) {
+        x = x * 1103515245U + 12345U;
+        buffer[i] = (uint8_t)(x >> 16);
+    }
+    Checksum_Init();
+}
+
+void tearDown(void)
+{
+}
+
+void test_Checksum_Crc16MatchesCheckValue(void)
+{
+    TEST_ASSERT_EQUAL_HEX16(CHECKSUM_CRC16_CHECK, Checksum_Crc16("123456789", 9));
+    TEST_ASSERT_EQUAL_HEX16(CHECKSUM_CRC16_CHECK, Checksum_Crc16Bitwise("123456789", 9));
+}
+
+void test_Checksum_Crc32MatchesCheckValue(void)
+{
+    TEST_ASSERT_EQUAL_HEX32(CHECKSUM_CRC32_CHECK, Checksum_Crc32("123456789", 9));
+    TEST_ASSERT_EQUAL_HEX32(CHECKSUM_CRC32_CHECK, Checksum_Crc32Bitwise("123456789", 9));
+}
+
+void test_Checksum_EmptyInputReturnsInitialValue(void)
+{
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, Checksum_Crc16(buffer, 0));
+    TEST_ASSERT_EQUAL_HEX32(0xFFFFFFFF, Checksum_Crc32(buffer, 0));
+}
+
+void test_Checksum_TableMatchesBitwiseForAllLengthsAndAlignments(void)
+{
+    for (size_t offset = 0; offset < 4; offset++) {
+        for (size_t len = 0; len <= 70; len++) {
+            TEST_ASSERT_EQUAL_HEX16(Checksum_Crc16Bitwise(&buffer[offset], len),
+                                    Checksum_Crc16(&buffer[offset], len));
+            TEST_ASSERT_EQUAL_HEX32(Checksum_Crc32Bitwise(&buffer[offset], len),
+                                    Checksum_Crc32(&buffer[offset], len));
+        }
+    }
+}
+
+void test_Checksum_TableMatchesBitwiseForLargeBuffer(void)
+{
+    TEST_ASSERT_EQUAL_HEX16(Checksum_Crc16Bitwise(buffer, 1024), Checksum_Crc16(buffer, 1024));
+    TEST_ASSERT_EQUAL_HEX32(Checksum_Crc32Bitwise(&buffer[3], 1021), Checksum_Crc32(&buffer[3], 1021));
+}
+
+void test_Checksum_DetectsSingleBitFlip(void)
+{
+    uint16_t crc16 = Checksum_Crc16(buffer, 20);
+    uint32_t crc32 = Checksum_Crc32(buffer, 20);
+
+    buffer[7] ^= 0x04;
+
+    TEST_ASSERT_NOT_EQUAL(crc16, Checksum_Crc16(buffer, 20));
+    TEST_ASSERT_NOT_EQUAL(crc32, Checksum_Crc32(buffer, 20));
+}
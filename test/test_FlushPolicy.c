@@ -0,0 +1,89 @@
+#include "unity.h"
+#include "FlushPolicy.h"
+
+static FlushPolicy policy;
+static FlushPolicyConfig config;
+
+void setUp(void)
+{
+    config.bytes_min = 4096;
+    config.bytes_max = 16384;
+    config.interval_min_ms = 500;
+    config.interval_max_ms = 2000;
+    config.stall_us = 50000;
+    config.backlog_high = 8;
+    FlushPolicy_Init(&policy, &config);
+}
+
+void tearDown(void)
+{
+}
+
+void test_FlushPolicy_StartsAtMinimum(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(4096, policy.bytes);
+    TEST_ASSERT_EQUAL_UINT32(500, policy.interval_ms);
+}
+
+void test_FlushPolicy_GrowsOnSyncStallUpToDurabilityBound(void)
+{
+    TEST_ASSERT_EQUAL(FLUSH_POLICY_GROW, FlushPolicy_OnSync(&policy, &config, 300, 400000));
+    TEST_ASSERT_EQUAL_UINT32(8192, policy.bytes);
+    TEST_ASSERT_EQUAL_UINT32(1000, policy.interval_ms);
+
+    FlushPolicy_OnSync(&policy, &config, 300, 400000);
+    TEST_ASSERT_EQUAL(FLUSH_POLICY_HOLD, FlushPolicy_OnSync(&policy, &config, 300, 400000));
+    TEST_ASSERT_EQUAL_UINT32(16384, policy.bytes);
+    TEST_ASSERT_EQUAL_UINT32(2000, policy.interval_ms);
+    TEST_ASSERT_EQUAL_UINT32(2, policy.grows);
+}
+
+void test_FlushPolicy_GrowsOnWriteStall(void)
+{
+    TEST_ASSERT_EQUAL(FLUSH_POLICY_GROW, FlushPolicy_OnSync(&policy, &config, 120000, 2000));
+}
+
+void test_FlushPolicy_GrowsWhenBacklogHigh(void)
+{
+    FlushPolicy_SetBacklog(&policy, 8);
+
+    TEST_ASSERT_EQUAL(FLUSH_POLICY_GROW, FlushPolicy_OnSync(&policy, &config, 300, 2000));
+}
+
+void test_FlushPolicy_ShrinksBackWhenFastAndIdle(void)
+{
+    FlushPolicy_OnSync(&policy, &config, 300, 400000);
+    FlushPolicy_OnSync(&policy, &config, 300, 400000);
+    TEST_ASSERT_EQUAL_UINT32(16384, policy.bytes);
+
+    // 평균 지연이 stall_us / 4 아래로 내려갈 때까지는 유지
+    int syncs = 0;
+    while (policy.bytes > config.bytes_min && syncs < 100) {
+        FlushPolicy_OnSync(&policy, &config, 300, 1000);
+        syncs++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(4096, policy.bytes);
+    TEST_ASSERT_EQUAL_UINT32(500, policy.interval_ms);
+    TEST_ASSERT_GREATER_THAN(0, policy.shrinks);
+    TEST_ASSERT_LESS_THAN(100, syncs);
+}
+
+void test_FlushPolicy_HoldsWithModerateBacklog(void)
+{
+    FlushPolicy_OnSync(&policy, &config, 300, 400000);
+    FlushPolicy_SetBacklog(&policy, 3);
+
+    TEST_ASSERT_EQUAL(FLUSH_POLICY_HOLD, FlushPolicy_OnSync(&policy, &config, 300, 1000));
+    TEST_ASSERT_EQUAL_UINT32(8192, policy.bytes);
+}
+
+void test_FlushPolicy_FollowsChangedBounds(void)
+{
+    FlushPolicy_OnSync(&policy, &config, 300, 400000);
+    config.bytes_max = 6000;
+    config.interval_max_ms = 800;
+
+    FlushPolicy_OnSync(&policy, &config, 300, 400000);
+    TEST_ASSERT_EQUAL_UINT32(6000, policy.bytes);
+    TEST_ASSERT_EQUAL_UINT32(800, policy.interval_ms);
+}
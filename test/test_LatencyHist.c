@@ -0,0 +1,113 @@
+#include "unity.h"
+#include "LatencyHist.h"
+#include <string.h>
+
+static LatencyHist hist;
+
+void setUp(void)
+{
+    LatencyHist_Reset(&hist);
+}
+
+void tearDown(void)
+{
+}
+
+void test_LatencyHist_BucketBoundaries(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(0, LatencyHist_Bucket(0));
+    TEST_ASSERT_EQUAL_UINT32(0, LatencyHist_Bucket(1));
+    TEST_ASSERT_EQUAL_UINT32(1, LatencyHist_Bucket(2));
+    TEST_ASSERT_EQUAL_UINT32(1, LatencyHist_Bucket(3));
+    TEST_ASSERT_EQUAL_UINT32(10, LatencyHist_Bucket(1024));
+    TEST_ASSERT_EQUAL_UINT32(9, LatencyHist_Bucket(1023));
+    TEST_ASSERT_EQUAL_UINT32(LATENCY_HIST_BUCKETS - 1, LatencyHist_Bucket(UINT32_MAX));
+
+    TEST_ASSERT_EQUAL_UINT32(1, LatencyHist_BucketUpperUs(0));
+    TEST_ASSERT_EQUAL_UINT32(2047, LatencyHist_BucketUpperUs(10));
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, LatencyHist_BucketUpperUs(LATENCY_HIST_BUCKETS - 1));
+}
+
+void test_LatencyHist_RecordTracksCountMinMaxAverage(void)
+{
+    LatencyHist_Record(&hist, 300);
+    LatencyHist_Record(&hist, 100);
+    LatencyHist_Record(&hist, 500);
+
+    TEST_ASSERT_EQUAL_UINT32(3, hist.count);
+    TEST_ASSERT_EQUAL_UINT32(100, hist.min_us);
+    TEST_ASSERT_EQUAL_UINT32(500, hist.max_us);
+    TEST_ASSERT_EQUAL_UINT32(300, LatencyHist_AverageUs(&hist));
+    TEST_ASSERT_EQUAL_UINT32(1, hist.buckets[LatencyHist_Bucket(100)]);
+    TEST_ASSERT_EQUAL_UINT32(2, hist.buckets[8]);   // 300, 500 -> [256, 512)
+}
+
+void test_LatencyHist_PercentileFindsRareStall(void)
+{
+    // 쓰기 99번은 ~300us, 1번은 400ms stall
+    for (int i = 0; i < 99; i++) {
+        LatencyHist_Record(&hist, 300);
+    }
+    LatencyHist_Record(&hist, 400000);
+
+    TEST_ASSERT_EQUAL_UINT32(511, LatencyHist_Percentile(&hist, 500));
+    TEST_ASSERT_EQUAL_UINT32(511, LatencyHist_Percentile(&hist, 990));
+    TEST_ASSERT_EQUAL_UINT32(400000, LatencyHist_Percentile(&hist, 1000));  // 상한은 max로 제한
+    TEST_ASSERT_EQUAL_UINT32(400000, hist.max_us);
+}
+
+void test_LatencyHist_PercentileOfEmptyIsZero(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(0, LatencyHist_Percentile(&hist, 500));
+    TEST_ASSERT_EQUAL_UINT32(0, LatencyHist_AverageUs(&hist));
+}
+
+void test_LatencyHist_MergeCombinesBucketsAndExtremes(void)
+{
+    LatencyHist other;
+    LatencyHist_Reset(&other);
+    LatencyHist_Record(&hist, 50);
+    LatencyHist_Record(&other, 10);
+    LatencyHist_Record(&other, 9000);
+
+    LatencyHist_Merge(&hist, &other);
+
+    TEST_ASSERT_EQUAL_UINT32(3, hist.count);
+    TEST_ASSERT_EQUAL_UINT32(10, hist.min_us);
+    TEST_ASSERT_EQUAL_UINT32(9000, hist.max_us);
+    TEST_ASSERT_EQUAL_UINT32(9060, (uint32_t)hist.total_us);
+    TEST_ASSERT_EQUAL_UINT32(1, hist.buckets[LatencyHist_Bucket(9000)]);
+}
+
+void test_LatencyHist_FormatSummary(void)
+{
+    char buf[96];
+    LatencyHist_Record(&hist, 300);
+    LatencyHist_Record(&hist, 700);
+
+    int len = LatencyHist_FormatSummary(&hist, "f_write", buf, sizeof(buf));
+
+    TEST_ASSERT_EQUAL_STRING("f_write n=2 avg=500 p50=511 p99=700 max=700", buf);
+    TEST_ASSERT_EQUAL_INT((int)strlen(buf), len);
+}
+
+void test_LatencyHist_FormatBucketsSkipsEmpty(void)
+{
+    char buf[96];
+    LatencyHist_Record(&hist, 1);
+    LatencyHist_Record(&hist, 300);
+    LatencyHist_Record(&hist, 310);
+
+    LatencyHist_FormatBuckets(&hist, "f_sync", buf, sizeof(buf));
+
+    TEST_ASSERT_EQUAL_STRING("f_sync b0:1 b8:2", buf);
+}
+
+void test_LatencyHist_FormatRejectsSmallBuffer(void)
+{
+    char buf[8];
+    LatencyHist_Record(&hist, 300);
+
+    TEST_ASSERT_EQUAL_INT(LATENCY_HIST_ERROR, LatencyHist_FormatSummary(&hist, "f_write", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(LATENCY_HIST_ERROR, LatencyHist_FormatBuckets(&hist, "f_write", buf, sizeof(buf)));
+}
@@ -0,0 +1,218 @@
+#include "unity.h"
+#include "LogCompress.h"
+#include <string.h>
+#include <stdio.h>
+
+static LogCompressor compressor;
+static LogDecompressor decompressor;
+static uint8_t stream[16384];
+static size_t stream_len;
+static uint8_t restored[16384];
+static size_t restored_len;
+
+void setUp(void)
+{
+    LogCompress_Init(&compressor);
+    LogDecompress_Init(&decompressor);
+    stream_len = 0;
+    restored_len = 0;
+}
+
+void tearDown(void)
+{
+}
+
+// 블록을 스트림 버퍼에 이어붙임
+static void flush_to_stream(void)
+{
+    const uint8_t* block = NULL;
+    size_t size = LogCompress_Flush(&compressor, &block);
+    if (size > 0) {
+        memcpy(&stream[stream_len], block, size);
+        stream_len += size;
+    }
+}
+
+// 압축기에 쓰되 블록이 차면 flush 후 재시도
+static void write_with_flush(const char* text)
+{
+    size_t len = strlen(text);
+    if (LogCompress_Write(&compressor, text, len) == LOG_COMPRESS_NO_ROOM) {
+        flush_to_stream();
+        TEST_ASSERT_EQUAL(LOG_COMPRESS_OK, LogCompress_Write(&compressor, text, len));
+    }
+}
+
+// 스트림 전체를 블록 단위로 복원
+static int decompress_stream(void)
+{
+    size_t pos = 0;
+    while (pos < stream_len) {
+        size_t consumed = 0;
+        size_t out_len = 0;
+        int result = LogDecompress_Block(&decompressor, &stream[pos], stream_len - pos, &consumed,
+                                         &restored[restored_len], sizeof(restored) - restored_len, &out_len);
+        if (result != LOG_COMPRESS_OK) {
+            return result;
+        }
+        pos += consumed;
+        restored_len += out_len;
+    }
+    return LOG_COMPRESS_OK;
+}
+
+// 빈 압축기 flush는 블록을 만들지 않음
+void test_LogCompress_Flush_should_return_zero_when_empty(void)
+{
+    const uint8_t* block = NULL;
+    TEST_ASSERT_EQUAL(0, LogCompress_Flush(&compressor, &block));
+}
+
+// 블록 헤더 형식 테스트
+void test_LogCompress_Flush_should_write_block_header(void)
+{
+    const char* text = "AT+JOIN\r\n";
+    TEST_ASSERT_EQUAL(LOG_COMPRESS_OK, LogCompress_Write(&compressor, text, strlen(text)));
+
+    const uint8_t* block = NULL;
+    size_t size = LogCompress_Flush(&compressor, &block);
+
+    TEST_ASSERT_NOT_NULL(block);
+    TEST_ASSERT_EQUAL_HEX8(LOG_COMPRESS_BLOCK_MAGIC, block[0]);
+    TEST_ASSERT_EQUAL(size - LOG_COMPRESS_HEADER_SIZE, block[2] | (block[3] << 8));
+    TEST_ASSERT_EQUAL(strlen(text), block[4] | (block[5] << 8));
+}
+
+// 단일 블록 왕복 테스트
+void test_LogCompress_should_roundtrip_single_block(void)
+{
+    const char* text = "[2025-01-01 09:00:00 KST] [INFO] [LoRa] Send success\r\n";
+    write_with_flush(text);
+    flush_to_stream();
+
+    TEST_ASSERT_EQUAL(LOG_COMPRESS_OK, decompress_stream());
+    TEST_ASSERT_EQUAL(strlen(text), restored_len);
+    TEST_ASSERT_EQUAL_MEMORY(text, restored, restored_len);
+}
+
+// 반복되는 로그는 압축되어야 함
+void test_LogCompress_should_shrink_repetitive_log_lines(void)
+{
+    char line[96];
+    size_t raw_total = 0;
+    for (int i = 0; i < 40; i++) {
+        snprintf(line, sizeof(line), "[2025-01-01 09:00:%02d KST] [INFO] [LoRa] Send success, seq=%d\r\n", i % 60, i);
+        write_with_flush(line);
+        raw_total += strlen(line);
+    }
+    flush_to_stream();
+
+    TEST_ASSERT_TRUE(stream_len * 3 < raw_total);
+    TEST_ASSERT_EQUAL(LOG_COMPRESS_OK, decompress_stream());
+    TEST_ASSERT_EQUAL(raw_total, restored_len);
+}
+
+// 여러 블록에 걸친 히스토리 참조 왕복 테스트
+void test_LogCompress_should_roundtrip_across_multiple_blocks(void)
+{
+    char expected[12000];
+    size_t expected_len = 0;
+    char line[96];
+
+    for (int i = 0; i < 150; i++) {
+        int n = snprintf(line, sizeof(line), "[DEBUG] [LoRa] RX: +EVT:RXP2P:-%d:%d:%08X\r\n", 40 + i % 30, i % 11, i * 2654435761U);
+        write_with_flush(line);
+        memcpy(&expected[expected_len], line, (size_t)n);
+        expected_len += (size_t)n;
+        if (i % 37 == 0) {
+            flush_to_stream();  // f_sync 주기 모사
+        }
+    }
+    flush_to_stream();
+
+    TEST_ASSERT_EQUAL(LOG_COMPRESS_OK, decompress_stream());
+    TEST_ASSERT_EQUAL(expected_len, restored_len);
+    TEST_ASSERT_EQUAL_MEMORY(expected, restored, expected_len);
+}
+
+// 압축되지 않는 입력(바이너리)도 왕복 가능해야 함
+void test_LogCompress_should_roundtrip_incompressible_data(void)
+{
+    uint8_t data[3000];
+    uint32_t x = 0x12345678;
+    for (size_t i = 0; i < sizeof(data); i++) {
+        x = x * 1103515245U + 12345U;
+        data[i] = (uint8_t)(x >> 24);
+    }
+
+    TEST_ASSERT_TRUE(LogCompress_HasRoom(&compressor, sizeof(data)));
+    TEST_ASSERT_EQUAL(LOG_COMPRESS_OK, LogCompress_Write(&compressor, data, sizeof(data)));
+    flush_to_stream();
+
+    TEST_ASSERT_EQUAL(LOG_COMPRESS_OK, decompress_stream());
+    TEST_ASSERT_EQUAL(sizeof(data), restored_len);
+    TEST_ASSERT_EQUAL_MEMORY(data, restored, sizeof(data));
+}
+
+// 긴 반복(확장 길이 매치) 왕복 테스트
+void test_LogCompress_should_roundtrip_long_runs(void)
+{
+    char data[1500];
+    memset(data, '=', sizeof(data));
+    TEST_ASSERT_EQUAL(LOG_COMPRESS_OK, LogCompress_Write(&compressor, data, sizeof(data)));
+    flush_to_stream();
+
+    TEST_ASSERT_TRUE(stream_len < 40);
+    TEST_ASSERT_EQUAL(LOG_COMPRESS_OK, decompress_stream());
+    TEST_ASSERT_EQUAL(sizeof(data), restored_len);
+    TEST_ASSERT_EQUAL_MEMORY(data, restored, sizeof(data));
+}
+
+// 블록 공간이 부족하면 NO_ROOM 반환
+void test_LogCompress_Write_should_return_no_room_when_block_full(void)
+{
+    uint8_t data[LOG_COMPRESS_BLOCK_SIZE];
+    memset(data, 0xA5, sizeof(data));
+    TEST_ASSERT_EQUAL(LOG_COMPRESS_NO_ROOM, LogCompress_Write(&compressor, data, sizeof(data)));
+    TEST_ASSERT_EQUAL(0, LogCompress_PendingRaw(&compressor));
+}
+
+// 잘린 블록은 TRUNCATED
+void test_LogDecompress_should_detect_truncated_block(void)
+{
+    write_with_flush("LoRa JOIN attempt 1\r\nLoRa JOIN attempt 2\r\n");
+    flush_to_stream();
+
+    size_t consumed = 0;
+    size_t out_len = 0;
+    TEST_ASSERT_EQUAL(LOG_COMPRESS_TRUNCATED,
+                      LogDecompress_Block(&decompressor, stream, stream_len - 1, &consumed,
+                                          restored, sizeof(restored), &out_len));
+    TEST_ASSERT_EQUAL(0, consumed);
+}
+
+// 잘못된 매직은 CORRUPT
+void test_LogDecompress_should_reject_bad_magic(void)
+{
+    write_with_flush("hello\r\n");
+    flush_to_stream();
+    stream[0] = 0x00;
+
+    size_t consumed = 0;
+    size_t out_len = 0;
+    TEST_ASSERT_EQUAL(LOG_COMPRESS_CORRUPT,
+                      LogDecompress_Block(&decompressor, stream, stream_len, &consumed,
+                                          restored, sizeof(restored), &out_len));
+}
+
+// 히스토리 범위를 벗어난 offset은 CORRUPT
+void test_LogDecompress_should_reject_offset_beyond_history(void)
+{
+    // 매치 토큰 하나: 길이 3, offset 5 (히스토리 없음)
+    uint8_t block[] = { LOG_COMPRESS_BLOCK_MAGIC, 0, 2, 0, 3, 0, 0x80, 0x04 };
+    size_t consumed = 0;
+    size_t out_len = 0;
+    TEST_ASSERT_EQUAL(LOG_COMPRESS_CORRUPT,
+                      LogDecompress_Block(&decompressor, block, sizeof(block), &consumed,
+                                          restored, sizeof(restored), &out_len));
+}
@@ -0,0 +1,257 @@
+#include "unity.h"
+#include "LogDelta.h"
+#include "LogFrame.h"
+#include "Checksum.h"
+#include <string.h>
+
+static LogDeltaCodec encoder;
+static LogDeltaCodec decoder;
+
+static uint8_t sent[LOG_FRAME_MAX_SIZE];
+static size_t sent_size;
+
+static int _capture_sink(const void* data, size_t size)
+{
+    memcpy(sent, data, size);
+    sent_size = size;
+    return 0;
+}
+
+static LogDeltaRecord _record(uint32_t ts, uint8_t old_state, uint8_t new_state, uint32_t duration,
+                              uint16_t errors, uint16_t sends)
+{
+    LogDeltaRecord record = {
+        .timestamp_ms = ts,
+        .device_id = 0x01,
+        .old_state = old_state,
+        .new_state = new_state,
+        .state_duration = duration,
+        .error_count = errors,
+        .send_count = sends,
+        .error_code = 0,
+    };
+    return record;
+}
+
+static void _assert_record_equal(const LogDeltaRecord* expected, const LogDeltaRecord* actual)
+{
+    TEST_ASSERT_EQUAL_UINT32(expected->timestamp_ms, actual->timestamp_ms);
+    TEST_ASSERT_EQUAL(expected->device_id, actual->device_id);
+    TEST_ASSERT_EQUAL(expected->old_state, actual->old_state);
+    TEST_ASSERT_EQUAL(expected->new_state, actual->new_state);
+    TEST_ASSERT_EQUAL_UINT32(expected->state_duration, actual->state_duration);
+    TEST_ASSERT_EQUAL_UINT16(expected->error_count, actual->error_count);
+    TEST_ASSERT_EQUAL_UINT16(expected->send_count, actual->send_count);
+    TEST_ASSERT_EQUAL(expected->error_code, actual->error_code);
+}
+
+// 인코딩 후 바로 디코딩해 같은 값인지 확인, 인코딩 크기는 *total에 누적
+static void _round_trip(const LogDeltaRecord* record, size_t* total)
+{
+    uint8_t buf[LOG_DELTA_MAX_RECORD];
+    size_t size = LogDelta_Encode(&encoder, record, buf, sizeof(buf));
+    TEST_ASSERT_TRUE(size > 0 && size <= LOG_DELTA_MAX_RECORD);
+
+    LogDeltaRecord decoded;
+    TEST_ASSERT_EQUAL((int)size, LogDelta_Decode(&decoder, buf, size, &decoded));
+    _assert_record_equal(record, &decoded);
+    if (total != NULL) {
+        *total += size;
+    }
+}
+
+void setUp(void)
+{
+    LogDelta_Begin(&encoder, 1000);
+    LogDelta_Begin(&decoder, 1000);
+    sent_size = 0;
+}
+
+void tearDown(void)
+{
+}
+
+void test_LogDelta_TypicalTransitionIsUnderSixBytes(void)
+{
+    // LoraStarter 한 주기: SEND_PERIODIC -> WAIT_SEND_RESPONSE -> WAIT_SEND_INTERVAL -> SEND_PERIODIC
+    static const uint8_t cycle[][2] = { { 6, 7 }, { 7, 8 }, { 8, 6 } };
+    static const uint32_t delays[] = { 120, 2300, 57580 };
+    uint32_t now = 1000;
+    uint32_t last = 0;
+    uint16_t sends = 0;
+    uint16_t errors = 0;
+    size_t total = 0;
+    int count = 0;
+
+    for (int i = 0; i < 60; i++) {
+        int step = i % 3;
+        now += delays[step];
+        if (step == 0) {
+            sends++;
+        }
+        if (i % 17 == 16) {
+            errors++;
+        }
+        LogDeltaRecord record = _record(now, cycle[step][0], cycle[step][1],
+                                        (last > 0) ? now - last : 0, errors, sends);
+        _round_trip(&record, &total);
+        last = now;
+        count++;
+    }
+
+    TEST_ASSERT_TRUE(total < (size_t)count * 6);     // 평균 6바이트 미만
+}
+
+void test_LogDelta_FirstRecordCarriesDeviceIdAndDuration(void)
+{
+    LogDeltaRecord record = _record(1000, 0, 1, 5000, 0, 0);
+    record.device_id = 0x42;
+
+    uint8_t buf[LOG_DELTA_MAX_RECORD];
+    size_t size = LogDelta_Encode(&encoder, &record, buf, sizeof(buf));
+    // states, head(dt=0), duration varint(2), extra, device_id
+    TEST_ASSERT_EQUAL(6, size);
+    TEST_ASSERT_EQUAL_HEX8(0x01, buf[0]);
+    TEST_ASSERT_EQUAL_HEX8(LOG_DELTA_FLAG_DURATION | LOG_DELTA_FLAG_EXTRA, buf[1]);
+
+    LogDeltaRecord decoded;
+    TEST_ASSERT_EQUAL((int)size, LogDelta_Decode(&decoder, buf, size, &decoded));
+    _assert_record_equal(&record, &decoded);
+}
+
+void test_LogDelta_EscapesLargeStatesAndCounterJumps(void)
+{
+    LogDeltaRecord record = _record(1100, 14, 200, 100, 0, 0);
+    _round_trip(&record, NULL);
+
+    record = _record(1200, 200, 3, 100, 500, 15);
+    record.error_code = 0x7E;
+    _round_trip(&record, NULL);
+
+    // 카운터 감소 (리셋)와 u16 wrap
+    record = _record(1300, 3, 4, 100, 0, 65535);
+    _round_trip(&record, NULL);
+    record = _record(1400, 4, 5, 100, 1, 2);
+    _round_trip(&record, NULL);
+}
+
+void test_LogDelta_HandlesTimestampWrapAndExtremeDurations(void)
+{
+    LogDelta_Begin(&encoder, 0xFFFFFF00UL);
+    LogDelta_Begin(&decoder, 0xFFFFFF00UL);
+
+    LogDeltaRecord record = _record(0xFFFFFFF0UL, 1, 2, 0xFFFFFFFFUL, 0, 0);
+    _round_trip(&record, NULL);
+    record = _record(0x00000010UL, 2, 3, 0, 0, 0);          // 32비트 시각 wrap
+    _round_trip(&record, NULL);
+    record = _record(0x80000010UL, 3, 4, 7, 0, 0);          // dt가 크고 duration은 작음
+    _round_trip(&record, NULL);
+}
+
+void test_LogDelta_EncodeRejectsSmallBuffer(void)
+{
+    uint8_t buf[LOG_DELTA_MAX_RECORD];
+    LogDeltaRecord record = _record(1000, 0, 1, 0, 0, 0);
+    TEST_ASSERT_EQUAL(0, LogDelta_Encode(&encoder, &record, buf, LOG_DELTA_MAX_RECORD - 1));
+    TEST_ASSERT_EQUAL(0, LogDelta_Encode(&encoder, NULL, buf, sizeof(buf)));
+}
+
+void test_LogDelta_DecodeDetectsTruncatedAndCorruptRecords(void)
+{
+    uint8_t buf[LOG_DELTA_MAX_RECORD];
+    LogDeltaRecord record = _record(90000, 200, 3, 1234567, 300, 20);
+    record.device_id = 0x33;
+    record.error_code = 0x44;
+    size_t size = LogDelta_Encode(&encoder, &record, buf, sizeof(buf));
+
+    LogDeltaRecord decoded;
+    for (size_t cut = 0; cut < size; cut++) {
+        LogDelta_Begin(&decoder, 1000);
+        TEST_ASSERT_EQUAL(LOG_DELTA_TRUNCATED, LogDelta_Decode(&decoder, buf, cut, &decoded));
+    }
+
+    // escape 없이 15가 든 상태 바이트
+    static const uint8_t bad_states[] = { 0xF1, 0x00 };
+    TEST_ASSERT_EQUAL(LOG_DELTA_CORRUPT, LogDelta_Decode(&decoder, bad_states, sizeof(bad_states), &decoded));
+
+    // 정의되지 않은 extra 비트
+    static const uint8_t bad_extra[] = { 0x01, LOG_DELTA_FLAG_EXTRA, 0x80 };
+    TEST_ASSERT_EQUAL(LOG_DELTA_CORRUPT, LogDelta_Decode(&decoder, bad_extra, sizeof(bad_extra), &decoded));
+
+    // 10바이트를 넘는 varint
+    uint8_t bad_varint[12];
+    memset(bad_varint, 0x80, sizeof(bad_varint));
+    bad_varint[0] = 0x01;
+    TEST_ASSERT_EQUAL(LOG_DELTA_CORRUPT, LogDelta_Decode(&decoder, bad_varint, sizeof(bad_varint), &decoded));
+}
+
+void test_LogDelta_RoundTripsThroughDeltaFrame(void)
+{
+    LogFrame frame;
+    LogFrame_Init(&frame, _capture_sink, LOG_FRAME_MAX_SIZE, 0);
+    LogFrame_SetVersion(&frame, LOG_FRAME_VERSION_DELTA);
+
+    LogDeltaRecord records[40];
+    for (int i = 0; i < 40; i++) {
+        uint32_t now = 5000 + (uint32_t)i * 333U;
+        records[i] = _record(now, (uint8_t)(i % 15), (uint8_t)((i + 1) % 15), (i > 0) ? 333U : 0U,
+                             (uint16_t)(i / 10), (uint16_t)(i / 3));
+
+        int result = 0;
+        uint8_t* slot = LogFrame_Reserve(&frame, LOG_DELTA_MAX_RECORD, now, &result);
+        TEST_ASSERT_NOT_NULL(slot);
+        if (LogFrame_IsEmpty(&frame)) {
+            LogDelta_Begin(&encoder, now);
+        }
+        LogFrame_CommitSize(&frame, LogDelta_Encode(&encoder, &records[i], slot, LOG_DELTA_MAX_RECORD));
+    }
+    LogFrame_Flush(&frame);
+
+    LogFrameHeader header;
+    TEST_ASSERT_EQUAL((int)sent_size, LogFrame_Decode(sent, sent_size, &header));
+    TEST_ASSERT_EQUAL(40, header.record_count);
+
+    LogDeltaCodec codec;
+    LogDeltaRecord decoded;
+    size_t offset = 0;
+    for (int i = 0; i < 40; i++) {
+        TEST_ASSERT_TRUE(LogDelta_NextRecord(&header, &codec, &offset, &decoded));
+        _assert_record_equal(&records[i], &decoded);
+    }
+    TEST_ASSERT_FALSE(LogDelta_NextRecord(&header, &codec, &offset, &decoded));
+}
+
+void test_LogDelta_RawRecordPassesThroughWithoutChangingDeltaBase(void)
+{
+    uint8_t buf[64];
+    size_t n = 0;
+    LogDeltaRecord first = _record(1100, 9, 10, 100, 0, 1);
+    LogDeltaRecord second = _record(1400, 10, 11, 300, 0, 1);
+    static const uint8_t packet[] = { 0x03, 0x11, 0x22, 0x33 };
+
+    n += LogDelta_Encode(&encoder, &first, &buf[n], LOG_DELTA_MAX_RECORD);
+    size_t raw_at = n;
+    size_t raw_size = LogDelta_EncodeRaw(packet, sizeof(packet), &buf[n], sizeof(buf) - n);
+    TEST_ASSERT_EQUAL(LOG_DELTA_RAW_PREFIX + sizeof(packet), raw_size);
+    n += raw_size;
+    n += LogDelta_Encode(&encoder, &second, &buf[n], LOG_DELTA_MAX_RECORD);
+
+    LogDeltaRecord decoded;
+    size_t offset = 0;
+    offset += (size_t)LogDelta_Decode(&decoder, &buf[offset], n - offset, &decoded);
+    TEST_ASSERT_NULL(decoded.raw);
+    _assert_record_equal(&first, &decoded);
+
+    offset += (size_t)LogDelta_Decode(&decoder, &buf[offset], n - offset, &decoded);
+    TEST_ASSERT_NOT_NULL(decoded.raw);
+    TEST_ASSERT_EQUAL(sizeof(packet), decoded.raw_len);
+    TEST_ASSERT_EQUAL_MEMORY(packet, decoded.raw, sizeof(packet));
+
+    TEST_ASSERT_EQUAL((int)(n - offset), LogDelta_Decode(&decoder, &buf[offset], n - offset, &decoded));
+    TEST_ASSERT_NULL(decoded.raw);
+    _assert_record_equal(&second, &decoded);
+
+    // 잘린 raw 레코드, 너무 작은 출력 버퍼
+    TEST_ASSERT_EQUAL(LOG_DELTA_TRUNCATED, LogDelta_Decode(&decoder, &buf[raw_at], raw_size - 1, &decoded));
+    TEST_ASSERT_EQUAL(0, LogDelta_EncodeRaw(packet, sizeof(packet), buf, sizeof(packet)));
+}
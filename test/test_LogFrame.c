@@ -0,0 +1,217 @@
+#include "unity.h"
+#include "LogFrame.h"
+#include "Checksum.h"
+#include <string.h>
+
+static LogFrame frame;
+static uint8_t sent[8][LOG_FRAME_MAX_SIZE];
+static size_t sent_size[8];
+static int sent_count;
+static int sink_result;
+
+static int _capture_sink(const void* data, size_t size)
+{
+    if (sent_count < 8) {
+        memcpy(sent[sent_count], data, size);
+        sent_size[sent_count] = size;
+    }
+    sent_count++;
+    return sink_result;
+}
+
+void setUp(void)
+{
+    sent_count = 0;
+    sink_result = 0;
+    memset(sent_size, 0, sizeof(sent_size));
+    LogFrame_Init(&frame, _capture_sink, LOG_FRAME_MAX_SIZE, 1000);
+}
+
+void tearDown(void)
+{
+}
+
+static void _add_record(uint8_t fill, size_t size, uint32_t now_ms)
+{
+    int result = 99;
+    uint8_t* slot = LogFrame_Reserve(&frame, size, now_ms, &result);
+    TEST_ASSERT_NOT_NULL(slot);
+    memset(slot, fill, size);
+    LogFrame_Commit(&frame);
+}
+
+void test_LogFrame_FlushSendsOneFrameWithAllRecords(void)
+{
+    _add_record(0x11, 20, 100);
+    _add_record(0x22, 20, 150);
+    _add_record(0x33, 5, 200);
+    TEST_ASSERT_EQUAL(0, sent_count);
+
+    TEST_ASSERT_EQUAL(LOG_FRAME_OK, LogFrame_Flush(&frame));
+    TEST_ASSERT_EQUAL(1, sent_count);
+    TEST_ASSERT_EQUAL(LOG_FRAME_OVERHEAD + 3 + 45, sent_size[0]);
+
+    LogFrameHeader header;
+    TEST_ASSERT_EQUAL((int)sent_size[0], LogFrame_Decode(sent[0], sent_size[0], &header));
+    TEST_ASSERT_EQUAL(3, header.record_count);
+    TEST_ASSERT_EQUAL(0, header.seq);
+    TEST_ASSERT_EQUAL_UINT32(100, header.first_timestamp_ms);
+
+    size_t offset = 0;
+    const uint8_t* record;
+    size_t record_len;
+    TEST_ASSERT_TRUE(LogFrame_NextRecord(&header, &offset, &record, &record_len));
+    TEST_ASSERT_EQUAL(20, record_len);
+    TEST_ASSERT_EQUAL_HEX8(0x11, record[19]);
+    TEST_ASSERT_TRUE(LogFrame_NextRecord(&header, &offset, &record, &record_len));
+    TEST_ASSERT_TRUE(LogFrame_NextRecord(&header, &offset, &record, &record_len));
+    TEST_ASSERT_EQUAL(5, record_len);
+    TEST_ASSERT_EQUAL_HEX8(0x33, record[0]);
+    TEST_ASSERT_FALSE(LogFrame_NextRecord(&header, &offset, &record, &record_len));
+}
+
+void test_LogFrame_FlushOfEmptyFrameSendsNothing(void)
+{
+    TEST_ASSERT_EQUAL(LOG_FRAME_OK, LogFrame_Flush(&frame));
+    TEST_ASSERT_EQUAL(0, sent_count);
+    TEST_ASSERT_TRUE(LogFrame_IsEmpty(&frame));
+}
+
+void test_LogFrame_SendsWhenNextRecordDoesNotFit(void)
+{
+    // 512 - 14 = 498바이트 payload -> 21바이트 레코드 23개
+    for (int i = 0; i < 23; i++) {
+        _add_record((uint8_t)i, 20, 0);
+    }
+    TEST_ASSERT_EQUAL(0, sent_count);
+
+    _add_record(0xEE, 20, 0);
+    TEST_ASSERT_EQUAL(1, sent_count);
+    TEST_ASSERT_TRUE(sent_size[0] <= LOG_FRAME_MAX_SIZE);
+
+    LogFrameHeader header;
+    TEST_ASSERT_GREATER_THAN(0, LogFrame_Decode(sent[0], sent_size[0], &header));
+    TEST_ASSERT_EQUAL(23, header.record_count);
+
+    LogFrameStats stats;
+    LogFrame_GetStats(&frame, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.flush_size);
+    TEST_ASSERT_FALSE(LogFrame_IsEmpty(&frame));    // 새 레코드는 다음 프레임에
+}
+
+void test_LogFrame_SendsWhenFrameIsOld(void)
+{
+    _add_record(0x01, 20, 1000);
+    TEST_ASSERT_EQUAL(LOG_FRAME_OK, LogFrame_Poll(&frame, 1999));
+    TEST_ASSERT_EQUAL(0, sent_count);
+
+    TEST_ASSERT_EQUAL(LOG_FRAME_OK, LogFrame_Poll(&frame, 2000));
+    TEST_ASSERT_EQUAL(1, sent_count);
+
+    // Reserve도 오래된 프레임을 먼저 보냄
+    _add_record(0x02, 20, 3000);
+    _add_record(0x03, 20, 4500);
+    TEST_ASSERT_EQUAL(2, sent_count);
+
+    LogFrameStats stats;
+    LogFrame_GetStats(&frame, &stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.flush_age);
+}
+
+void test_LogFrame_SequenceIncrementsPerFrame(void)
+{
+    LogFrameHeader header;
+    _add_record(0x01, 4, 0);
+    LogFrame_Flush(&frame);
+    _add_record(0x02, 4, 0);
+    LogFrame_Flush(&frame);
+
+    TEST_ASSERT_GREATER_THAN(0, LogFrame_Decode(sent[1], sent_size[1], &header));
+    TEST_ASSERT_EQUAL(1, header.seq);
+}
+
+void test_LogFrame_DecodeRejectsCorruptAndTruncatedFrames(void)
+{
+    LogFrameHeader header;
+    _add_record(0x5A, 20, 0);
+    LogFrame_Flush(&frame);
+
+    TEST_ASSERT_EQUAL(LOG_FRAME_TRUNCATED, LogFrame_Decode(sent[0], sent_size[0] - 1, &header));
+    sent[0][LOG_FRAME_HEADER_SIZE + 3] ^= 0x01;
+    TEST_ASSERT_EQUAL(LOG_FRAME_CORRUPT, LogFrame_Decode(sent[0], sent_size[0], &header));
+    sent[0][0] = 0x00;
+    TEST_ASSERT_EQUAL(LOG_FRAME_CORRUPT, LogFrame_Decode(sent[0], sent_size[0], &header));
+}
+
+void test_LogFrame_SinkFailureDropsFrameAndReportsError(void)
+{
+    sink_result = -1;
+    _add_record(0x01, 20, 0);
+
+    TEST_ASSERT_EQUAL(-1, LogFrame_Flush(&frame));
+    TEST_ASSERT_TRUE(LogFrame_IsEmpty(&frame));
+
+    LogFrameStats stats;
+    LogFrame_GetStats(&frame, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.send_errors);
+}
+
+void test_LogFrame_RejectsRecordLargerThanFrame(void)
+{
+    int result = 0;
+    LogFrame_Init(&frame, _capture_sink, 64, 0);
+
+    TEST_ASSERT_NULL(LogFrame_Reserve(&frame, 60, 0, &result));
+    TEST_ASSERT_EQUAL(LOG_FRAME_ERROR, result);
+    TEST_ASSERT_NULL(LogFrame_Reserve(&frame, 0, 0, &result));
+}
+
+void test_LogFrame_ReportsAverageRecordsPerFrame(void)
+{
+    for (int i = 0; i < 5; i++) {
+        _add_record(0x01, 20, 0);
+    }
+    LogFrame_Flush(&frame);
+    _add_record(0x01, 20, 0);
+    _add_record(0x01, 20, 0);
+    LogFrame_Flush(&frame);
+
+    LogFrameStats stats;
+    LogFrame_GetStats(&frame, &stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.frames);
+    TEST_ASSERT_EQUAL_UINT32(7, stats.records);
+    TEST_ASSERT_EQUAL_UINT32(35, LogFrame_RecordsPerFrameX10(&stats));
+}
+
+void test_LogFrame_DeltaVersionPacksRecordsWithoutLengthPrefix(void)
+{
+    TEST_ASSERT_EQUAL(LOG_FRAME_OK, LogFrame_SetVersion(&frame, LOG_FRAME_VERSION_DELTA));
+
+    // 최대 크기로 잡고 실제 크기만 확정
+    int result = 99;
+    uint8_t* slot = LogFrame_Reserve(&frame, 24, 100, &result);
+    TEST_ASSERT_NOT_NULL(slot);
+    memset(slot, 0x11, 3);
+    LogFrame_CommitSize(&frame, 3);
+    slot = LogFrame_Reserve(&frame, 24, 200, &result);
+    memset(slot, 0x22, 5);
+    LogFrame_CommitSize(&frame, 5);
+
+    // 레코드가 든 프레임의 형식은 바꿀 수 없음
+    TEST_ASSERT_EQUAL(LOG_FRAME_ERROR, LogFrame_SetVersion(&frame, LOG_FRAME_VERSION));
+    LogFrame_Flush(&frame);
+    TEST_ASSERT_EQUAL(LOG_FRAME_OVERHEAD + 8, sent_size[0]);
+
+    LogFrameHeader header;
+    TEST_ASSERT_EQUAL((int)sent_size[0], LogFrame_Decode(sent[0], sent_size[0], &header));
+    TEST_ASSERT_EQUAL(LOG_FRAME_VERSION_DELTA, header.version);
+    TEST_ASSERT_EQUAL(2, header.record_count);
+    TEST_ASSERT_EQUAL(0x11, header.payload[2]);
+    TEST_ASSERT_EQUAL(0x22, header.payload[3]);
+
+    // 길이 prefix가 없으므로 version 1 레코드 순회는 거부
+    size_t offset = 0;
+    const uint8_t* record = NULL;
+    size_t record_len = 0;
+    TEST_ASSERT_FALSE(LogFrame_NextRecord(&header, &offset, &record, &record_len));
+}
@@ -0,0 +1,224 @@
+#include "unity.h"
+#include "LogJournal.h"
+#include "Checksum.h"
+#include <string.h>
+#include <stdio.h>
+
+static LogJournalWriter writer;
+static uint8_t file_data[16384];
+static size_t file_len;
+static uint8_t scan_buffer[LOG_JOURNAL_MAX_RECORD];
+
+void setUp(void)
+{
+    LogJournal_InitWriter(&writer, NULL, 0x1234);
+    memset(file_data, 0, sizeof(file_data));
+    file_len = 0;
+}
+
+void tearDown(void)
+{
+}
+
+static size_t read_file(void* ctx, uint32_t offset, uint8_t* buf, size_t len)
+{
+    size_t size = *(size_t*)ctx;
+    if (offset >= size) {
+        return 0;
+    }
+    if (len > size - offset) {
+        len = size - offset;
+    }
+    memcpy(buf, &file_data[offset], len);
+    return len;
+}
+
+static void append_header(uint16_t file_number)
+{
+    int size = LogJournal_EncodeFileHeader(&writer, 0, file_number, &file_data[file_len],
+                                           sizeof(file_data) - file_len);
+    TEST_ASSERT_GREATER_THAN(0, size);
+    file_len += (size_t)size;
+}
+
+static void append_line(uint32_t timestamp_ms, const char* text)
+{
+    int size = LogJournal_Encode(&writer, LOG_JOURNAL_TYPE_TEXT, timestamp_ms, text, strlen(text),
+                                 &file_data[file_len], sizeof(file_data) - file_len);
+    TEST_ASSERT_EQUAL(LOG_JOURNAL_OVERHEAD + strlen(text), size);
+    file_len += (size_t)size;
+}
+
+static void scan(size_t size, LogJournalScanResult* result)
+{
+    TEST_ASSERT_EQUAL(LOG_JOURNAL_OK, LogJournal_Scan(NULL, read_file, &size, scan_buffer,
+                                                      sizeof(scan_buffer), result));
+}
+
+void test_Crc32_MatchesMpeg2CheckValue(void)
+{
+    // CRC-32/MPEG-2 check 값 (STM32 CRC 주변장치 기본 설정과 동일)
+    TEST_ASSERT_EQUAL_HEX32(0x0376E6E7, LogJournal_Crc32((const uint8_t*)"123456789", 9));
+}
+
+void test_Encode_Decode_RoundTrip(void)
+{
+    append_header(7);
+    append_line(1500, "JOIN OK");
+
+    LogJournalRecord rec;
+    int size = LogJournal_Decode(NULL, file_data, file_len, &rec);
+    TEST_ASSERT_EQUAL(LOG_JOURNAL_OVERHEAD + LOG_JOURNAL_FILE_HEADER_PAYLOAD, size);
+    TEST_ASSERT_EQUAL(LOG_JOURNAL_TYPE_FILE_HEADER, rec.type);
+    TEST_ASSERT_EQUAL(0, rec.seq);
+
+    size = LogJournal_Decode(NULL, &file_data[size], file_len - (size_t)size, &rec);
+    TEST_ASSERT_EQUAL(LOG_JOURNAL_OVERHEAD + 7, size);
+    TEST_ASSERT_EQUAL(LOG_JOURNAL_TYPE_TEXT, rec.type);
+    TEST_ASSERT_EQUAL(1500, rec.timestamp_ms);
+    TEST_ASSERT_EQUAL(1, rec.seq);
+    TEST_ASSERT_EQUAL_HEX16(0x1234, rec.file_tag);
+    TEST_ASSERT_EQUAL(7, rec.length);
+    TEST_ASSERT_EQUAL_MEMORY("JOIN OK", rec.payload, 7);
+}
+
+void test_Encode_RejectsOversizedPayloadAndSmallBuffer(void)
+{
+    uint8_t out[32];
+    static uint8_t big[LOG_JOURNAL_MAX_PAYLOAD + 1];
+    TEST_ASSERT_EQUAL(LOG_JOURNAL_ERROR,
+                      LogJournal_Encode(&writer, LOG_JOURNAL_TYPE_TEXT, 0, big, sizeof(big), out, sizeof(out)));
+    TEST_ASSERT_EQUAL(LOG_JOURNAL_NO_ROOM,
+                      LogJournal_Encode(&writer, LOG_JOURNAL_TYPE_TEXT, 0, big, 17, out, sizeof(out)));
+    TEST_ASSERT_EQUAL(0, writer.next_seq);
+}
+
+void test_Decode_DetectsTruncationAndCorruption(void)
+{
+    append_header(1);
+    LogJournalRecord rec;
+
+    TEST_ASSERT_EQUAL(LOG_JOURNAL_TRUNCATED, LogJournal_Decode(NULL, file_data, 5, &rec));
+    TEST_ASSERT_EQUAL(LOG_JOURNAL_TRUNCATED, LogJournal_Decode(NULL, file_data, file_len - 1, &rec));
+
+    file_data[LOG_JOURNAL_HEADER_SIZE] ^= 0x01;
+    TEST_ASSERT_EQUAL(LOG_JOURNAL_CORRUPT, LogJournal_Decode(NULL, file_data, file_len, &rec));
+}
+
+void test_Scan_AcceptsCleanFile(void)
+{
+    append_header(42);
+    for (int i = 0; i < 100; i++) {
+        char line[48];
+        snprintf(line, sizeof(line), "[WARN] line %d", i);
+        append_line(1000 + (uint32_t)i, line);
+    }
+
+    LogJournalScanResult result;
+    scan(file_len, &result);
+    TEST_ASSERT_EQUAL(file_len, result.valid_end);
+    TEST_ASSERT_EQUAL(101, result.records);
+    TEST_ASSERT_EQUAL(101, result.next_seq);
+    TEST_ASSERT_EQUAL(1099, result.last_timestamp_ms);
+    TEST_ASSERT_EQUAL(42, result.file_number);
+    TEST_ASSERT_EQUAL_HEX16(0x1234, result.file_tag);
+}
+
+void test_Scan_StopsAtTornTail(void)
+{
+    append_header(1);
+    append_line(10, "first");
+    size_t valid = file_len;
+    append_line(20, "second line torn by brownout");
+
+    LogJournalScanResult result;
+    scan(file_len - 3, &result);
+    TEST_ASSERT_EQUAL(valid, result.valid_end);
+    TEST_ASSERT_EQUAL(2, result.records);
+}
+
+void test_Scan_StopsAtCorruptRecordInMiddle(void)
+{
+    append_header(1);
+    append_line(10, "first");
+    size_t valid = file_len;
+    append_line(20, "second");
+    append_line(30, "third");
+    file_data[valid + LOG_JOURNAL_HEADER_SIZE] ^= 0xFF;
+
+    LogJournalScanResult result;
+    scan(file_len, &result);
+    TEST_ASSERT_EQUAL(valid, result.valid_end);
+}
+
+void test_Scan_IgnoresStaleRecordsFromPreallocatedArea(void)
+{
+    // 사전 할당 영역에 남아 있던 다른 파일의 레코드 (CRC는 유효)
+    LogJournalWriter old_writer;
+    LogJournal_InitWriter(&old_writer, NULL, 0x9999);
+    old_writer.next_seq = 2;
+
+    append_header(1);
+    append_line(10, "current");
+    size_t valid = file_len;
+    int size = LogJournal_Encode(&old_writer, LOG_JOURNAL_TYPE_TEXT, 5, "stale", 5,
+                                 &file_data[file_len], sizeof(file_data) - file_len);
+    file_len += (size_t)size;
+
+    LogJournalScanResult result;
+    scan(file_len, &result);
+    TEST_ASSERT_EQUAL(valid, result.valid_end);
+}
+
+void test_Scan_StopsAtSequenceGap(void)
+{
+    append_header(1);
+    append_line(10, "one");
+    size_t valid = file_len;
+    writer.next_seq++;
+    append_line(20, "skipped");
+
+    LogJournalScanResult result;
+    scan(file_len, &result);
+    TEST_ASSERT_EQUAL(valid, result.valid_end);
+}
+
+void test_Scan_EmptyOrForeignFileHasNoValidData(void)
+{
+    LogJournalScanResult result;
+    scan(0, &result);
+    TEST_ASSERT_EQUAL(0, result.valid_end);
+    TEST_ASSERT_EQUAL(0, result.records);
+
+    // 헤더 없이 시작하는 파일
+    append_line(10, "no header");
+    scan(file_len, &result);
+    TEST_ASSERT_EQUAL(0, result.valid_end);
+}
+
+void test_Scan_HandlesRecordsAcrossBufferRefills(void)
+{
+    // 최대 크기 레코드가 버퍼 경계에 걸치도록 구성
+    static char big[LOG_JOURNAL_MAX_PAYLOAD + 1];
+    memset(big, 'x', LOG_JOURNAL_MAX_PAYLOAD);
+    big[LOG_JOURNAL_MAX_PAYLOAD] = '\0';
+
+    append_header(1);
+    append_line(1, "short");
+    for (int i = 0; i < 10; i++) {
+        append_line(2 + (uint32_t)i, big);
+    }
+
+    LogJournalScanResult result;
+    scan(file_len, &result);
+    TEST_ASSERT_EQUAL(file_len, result.valid_end);
+    TEST_ASSERT_EQUAL(12, result.records);
+}
+
+void test_Scan_RejectsSmallBuffer(void)
+{
+    LogJournalScanResult result;
+    size_t size = 0;
+    TEST_ASSERT_EQUAL(LOG_JOURNAL_ERROR, LogJournal_Scan(NULL, read_file, &size, scan_buffer,
+                                                         LOG_JOURNAL_MAX_RECORD - 1, &result));
+}
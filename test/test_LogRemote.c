@@ -1,12 +1,16 @@
 #include "unity.h"
 #include "LogRemote.h"
+#include "LogFrame.h"
+#include "LogDelta.h"
+#include "Checksum.h"
 #include "mock_Network.h"
 #include "mock_time.h"
 #include <string.h>
 
 void setUp(void)
 {
-    // Setup에서는 기본 mock 동작만 설정
+    // Setup에서는 기본 mock 동작만 설정 - LogRemote_Poll은 매번 Network_Poll도 부름
+    Network_Poll_IgnoreAndReturn(0);
 }
 
 void tearDown(void)
@@ -137,9 +141,16 @@ void test_LogRemote_should_calculate_checksum_correctly(void)
     // 같은 데이터는 같은 체크섬을 생성해야 함
     uint16_t second_checksum = LogRemote_CalculateChecksum(&packet);
     TEST_ASSERT_EQUAL(calculated_checksum, second_checksum);
+    
+    // checksum 필드 앞 18바이트의 CRC-16/CCITT-FALSE
+    TEST_ASSERT_EQUAL_HEX16(Checksum_Crc16Bitwise(&packet, 18), calculated_checksum);
+    
+    // 1비트 변화도 검출
+    packet.error_count ^= 0x0100;
+    TEST_ASSERT_NOT_EQUAL(calculated_checksum, LogRemote_CalculateChecksum(&packet));
 }
 
-// 네트워크 전송 실패 테스트
+// 네트워크 전송 실패 테스트 - 패킷은 프레임에 모이므로 실패는 프레임 전송 시점에 보고됨
 void test_LogRemote_SendStateChange_should_return_error_when_network_send_fails(void)
 {
     Network_Init_ExpectAndReturn("192.168.1.100", 8080, 0);
@@ -149,10 +160,110 @@ void test_LogRemote_SendStateChange_should_return_error_when_network_send_fails(
     Network_SendBinary_IgnoreAndReturn(-1);
     
     int result = LogRemote_SendStateChange(LORA_STATE_INIT, LORA_STATE_SEND_CMD, 0, 0);
+    TEST_ASSERT_EQUAL(0, result);
+    
+    result = LogRemote_Flush();
     
     TEST_ASSERT_EQUAL(-1, result);
 }
 
+// 프레임 묶음 테스트용 - 전송된 프레임 캡처
+static uint8_t g_sent_frame[LOG_FRAME_MAX_SIZE];
+static size_t g_sent_size;
+static int g_send_calls;
+
+static int _capture_send(const void* data, size_t size, int cmock_num_calls)
+{
+    (void)cmock_num_calls;
+    memcpy(g_sent_frame, data, size);
+    g_sent_size = size;
+    g_send_calls++;
+    return 0;
+}
+
+static void _init_with_capture(void)
+{
+    g_sent_size = 0;
+    g_send_calls = 0;
+    Network_Init_ExpectAndReturn("192.168.1.100", 8080, 0);
+    LogRemote_Init("192.168.1.100", 8080, 0x01);
+    Network_SendBinary_StubWithCallback(_capture_send);
+}
+
+// 상태 변경 여러 개가 프레임 하나로 전송되는지 테스트
+void test_LogRemote_should_batch_state_changes_into_one_frame(void)
+{
+    _init_with_capture();
+    
+    TIME_GetCurrentMs_ExpectAndReturn(1000);
+    LogRemote_SendStateChange(LORA_STATE_INIT, LORA_STATE_SEND_CMD, 0, 0);
+    TIME_GetCurrentMs_ExpectAndReturn(1100);
+    LogRemote_SendStateChange(LORA_STATE_SEND_CMD, LORA_STATE_WAIT_OK, 0, 1);
+    TIME_GetCurrentMs_ExpectAndReturn(1200);
+    LogRemote_SendStateChange(LORA_STATE_WAIT_OK, LORA_STATE_SEND_PERIODIC, 0, 2);
+    TEST_ASSERT_EQUAL(0, g_send_calls);
+    
+    TEST_ASSERT_EQUAL(0, LogRemote_Flush());
+    TEST_ASSERT_EQUAL(1, g_send_calls);
+    
+    LogFrameHeader header;
+    TEST_ASSERT_EQUAL((int)g_sent_size, LogFrame_Decode(g_sent_frame, g_sent_size, &header));
+    TEST_ASSERT_EQUAL(3, header.record_count);
+    
+    // 세 번째 레코드는 원래 20바이트 패킷 그대로
+    size_t offset = 0;
+    const uint8_t* record = NULL;
+    size_t record_len = 0;
+    LogFrame_NextRecord(&header, &offset, &record, &record_len);
+    LogFrame_NextRecord(&header, &offset, &record, &record_len);
+    TEST_ASSERT_TRUE(LogFrame_NextRecord(&header, &offset, &record, &record_len));
+    TEST_ASSERT_EQUAL(sizeof(StateChangePacket), record_len);
+    
+    StateChangePacket packet;
+    memcpy(&packet, record, sizeof(packet));
+    TEST_ASSERT_EQUAL(PACKET_TYPE_STATE_CHANGE, packet.packet_type);
+    TEST_ASSERT_EQUAL(1200, packet.timestamp);
+    TEST_ASSERT_EQUAL(100, packet.state_duration);
+    TEST_ASSERT_EQUAL(2, packet.send_count);
+    TEST_ASSERT_EQUAL(LogRemote_CalculateChecksum(&packet), packet.checksum);
+}
+
+// 오래된 프레임은 Poll에서 전송되는지 테스트
+void test_LogRemote_Poll_should_send_frame_after_max_age(void)
+{
+    _init_with_capture();
+    
+    TIME_GetCurrentMs_ExpectAndReturn(5000);
+    LogRemote_SendStateChange(LORA_STATE_INIT, LORA_STATE_SEND_CMD, 0, 0);
+    
+    TIME_GetCurrentMs_ExpectAndReturn(5000 + LOG_REMOTE_FRAME_AGE_MS - 1);
+    TEST_ASSERT_EQUAL(0, LogRemote_Poll());
+    TEST_ASSERT_EQUAL(0, g_send_calls);
+    
+    TIME_GetCurrentMs_ExpectAndReturn(5000 + LOG_REMOTE_FRAME_AGE_MS);
+    TEST_ASSERT_EQUAL(0, LogRemote_Poll());
+    TEST_ASSERT_EQUAL(1, g_send_calls);
+    
+    LogFrameStats stats;
+    LogRemote_GetFrameStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.flush_age);
+    TEST_ASSERT_EQUAL_UINT32(10, LogFrame_RecordsPerFrameX10(&stats));
+}
+
+// 연결 해제 전에 남은 패킷을 전송하는지 테스트
+void test_LogRemote_Disconnect_should_flush_pending_frame(void)
+{
+    _init_with_capture();
+    
+    TIME_GetCurrentMs_ExpectAndReturn(1000);
+    LogRemote_SendStateChange(LORA_STATE_INIT, LORA_STATE_SEND_CMD, 0, 0);
+    Network_Disconnect_Expect();
+    
+    LogRemote_Disconnect();
+    
+    TEST_ASSERT_EQUAL(1, g_send_calls);
+}
+
 // NULL 포인터 안전성 테스트  
 void test_LogRemote_should_handle_null_pointers_safely(void)
 {
@@ -182,4 +293,174 @@ void test_LogRemote_should_use_correct_device_id(void)
     
     int result = LogRemote_SendStateChange(LORA_STATE_INIT, LORA_STATE_SEND_CMD, 0, 0);
     TEST_ASSERT_EQUAL(0, result);
-}
\ No newline at end of file
+}
+// V2 인코딩 - 전이당 6바이트 미만, 디코딩하면 V1과 같은 값
+void test_LogRemote_V2_encoding_should_send_compact_delta_records(void)
+{
+    LogRemote_SetEncoding(LOG_REMOTE_ENCODING_V2);
+    LogRemote_SetFrameLimits(LOG_REMOTE_FRAME_SIZE, 0);    // 시간 기준 전송 없이 한 프레임에
+    _init_with_capture();
+    
+    TIME_GetCurrentMs_ExpectAndReturn(1000);
+    LogRemote_SendStateChange(LORA_STATE_INIT, LORA_STATE_SEND_CMD, 0, 0);
+    for (uint16_t i = 1; i <= 20; i++) {
+        TIME_GetCurrentMs_ExpectAndReturn(1000 + i * 250U);
+        LogRemote_SendStateChange(LORA_STATE_SEND_CMD, LORA_STATE_WAIT_OK, 0, i);
+    }
+    TEST_ASSERT_EQUAL(0, LogRemote_Flush());
+    TEST_ASSERT_EQUAL(1, g_send_calls);
+    
+    LogFrameHeader header;
+    TEST_ASSERT_EQUAL((int)g_sent_size, LogFrame_Decode(g_sent_frame, g_sent_size, &header));
+    TEST_ASSERT_EQUAL(LOG_FRAME_VERSION_DELTA, header.version);
+    TEST_ASSERT_EQUAL(21, header.record_count);
+    TEST_ASSERT_TRUE(header.payload_length < 21 * 6);
+    
+    LogDeltaCodec codec;
+    LogDeltaRecord record;
+    size_t offset = 0;
+    TEST_ASSERT_TRUE(LogDelta_NextRecord(&header, &codec, &offset, &record));
+    TEST_ASSERT_EQUAL_UINT32(1000, record.timestamp_ms);
+    TEST_ASSERT_EQUAL(0x01, record.device_id);
+    TEST_ASSERT_EQUAL_UINT32(0, record.state_duration);
+    for (int i = 1; i <= 20; i++) {
+        TEST_ASSERT_TRUE(LogDelta_NextRecord(&header, &codec, &offset, &record));
+    }
+    TEST_ASSERT_EQUAL_UINT32(6000, record.timestamp_ms);
+    TEST_ASSERT_EQUAL(LORA_STATE_SEND_CMD, record.old_state);
+    TEST_ASSERT_EQUAL(LORA_STATE_WAIT_OK, record.new_state);
+    TEST_ASSERT_EQUAL_UINT32(250, record.state_duration);
+    TEST_ASSERT_EQUAL(20, record.send_count);
+    TEST_ASSERT_EQUAL(0x01, record.device_id);
+    TEST_ASSERT_FALSE(LogDelta_NextRecord(&header, &codec, &offset, &record));
+    TEST_ASSERT_EQUAL(header.payload_length, offset);
+}
+
+static void _heartbeat_source(LogRemoteHeartbeat* heartbeat)
+{
+    heartbeat->free_heap = 12345;
+    heartbeat->net_queue_bytes = 640;
+    heartbeat->log_queue_depth = 3;
+    heartbeat->last_rssi = -87;
+}
+
+// Poll이 heartbeat 주기를 지키고 같은 프레임 경로로 보내는지 테스트
+void test_LogRemote_Poll_should_send_heartbeat_every_interval(void)
+{
+    LogRemote_SetHeartbeat(5000, _heartbeat_source);
+    _init_with_capture();
+    
+    TIME_GetCurrentMs_ExpectAndReturn(1000);        // 첫 Poll - 바로 heartbeat
+    TEST_ASSERT_EQUAL(0, LogRemote_Poll());
+    TIME_GetCurrentMs_ExpectAndReturn(2000);        // 프레임 시간 초과로 전송
+    TEST_ASSERT_EQUAL(0, LogRemote_Poll());
+    TEST_ASSERT_EQUAL(1, g_send_calls);
+    
+    LogFrameHeader header;
+    TEST_ASSERT_EQUAL((int)g_sent_size, LogFrame_Decode(g_sent_frame, g_sent_size, &header));
+    TEST_ASSERT_EQUAL(1, header.record_count);
+    size_t offset = 0;
+    const uint8_t* record = NULL;
+    size_t record_len = 0;
+    TEST_ASSERT_TRUE(LogFrame_NextRecord(&header, &offset, &record, &record_len));
+    TEST_ASSERT_EQUAL(sizeof(HeartbeatPacket), record_len);
+    
+    HeartbeatPacket packet;
+    memcpy(&packet, record, sizeof(packet));
+    TEST_ASSERT_EQUAL(PACKET_TYPE_HEARTBEAT, packet.packet_type);
+    TEST_ASSERT_EQUAL_UINT32(1000, packet.timestamp);
+    TEST_ASSERT_EQUAL_UINT32(1, packet.uptime_s);
+    TEST_ASSERT_EQUAL_UINT32(12345, packet.free_heap);
+    TEST_ASSERT_EQUAL_UINT32(640, packet.net_queue_bytes);
+    TEST_ASSERT_EQUAL(3, packet.log_queue_depth);
+    TEST_ASSERT_EQUAL(-87, packet.last_rssi);
+    TEST_ASSERT_EQUAL_HEX16(Checksum_Crc16(&packet, offsetof(HeartbeatPacket, checksum)), packet.checksum);
+    
+    // 주기 전에는 heartbeat 없음, 주기가 되면 다시
+    TIME_GetCurrentMs_ExpectAndReturn(5999);
+    LogRemote_Poll();
+    TEST_ASSERT_EQUAL(0, LogRemote_Flush());
+    TEST_ASSERT_EQUAL(1, g_send_calls);
+    TIME_GetCurrentMs_ExpectAndReturn(6000);
+    LogRemote_Poll();
+    TEST_ASSERT_EQUAL(0, LogRemote_Flush());
+    TEST_ASSERT_EQUAL(2, g_send_calls);
+}
+
+// 에러 패킷에 ResultCode, 모듈, 당시 상태가 담기는지 테스트
+void test_LogRemote_SendError_should_carry_result_code_and_module(void)
+{
+    _init_with_capture();
+    
+    TIME_GetCurrentMs_ExpectAndReturn(1000);
+    LogRemote_SendStateChange(LORA_STATE_SEND_JOIN, LORA_STATE_WAIT_JOIN_OK, 0, 0);
+    TIME_GetCurrentMs_ExpectAndReturn(1500);
+    TEST_ASSERT_EQUAL(0, LogRemote_SendError(RESULT_ERROR_SD_DISK_FULL, LOG_REMOTE_MODULE_AUTO, 7));
+    TEST_ASSERT_EQUAL(0, LogRemote_Flush());
+    
+    LogFrameHeader header;
+    TEST_ASSERT_EQUAL((int)g_sent_size, LogFrame_Decode(g_sent_frame, g_sent_size, &header));
+    TEST_ASSERT_EQUAL(2, header.record_count);
+    size_t offset = 0;
+    const uint8_t* record = NULL;
+    size_t record_len = 0;
+    LogFrame_NextRecord(&header, &offset, &record, &record_len);
+    TEST_ASSERT_TRUE(LogFrame_NextRecord(&header, &offset, &record, &record_len));
+    TEST_ASSERT_EQUAL(sizeof(ErrorLogPacket), record_len);
+    
+    ErrorLogPacket packet;
+    memcpy(&packet, record, sizeof(packet));
+    TEST_ASSERT_EQUAL(PACKET_TYPE_ERROR_LOG, packet.packet_type);
+    TEST_ASSERT_EQUAL_UINT32(1500, packet.timestamp);
+    TEST_ASSERT_EQUAL(LOG_REMOTE_MODULE_SD, packet.module_id);
+    TEST_ASSERT_EQUAL(LORA_STATE_WAIT_JOIN_OK, packet.state);
+    TEST_ASSERT_EQUAL_INT32(RESULT_ERROR_SD_DISK_FULL, packet.result_code);
+    TEST_ASSERT_EQUAL(7, packet.detail);
+    TEST_ASSERT_EQUAL_HEX16(Checksum_Crc16(&packet, offsetof(ErrorLogPacket, checksum)), packet.checksum);
+    
+    TEST_ASSERT_EQUAL(LOG_REMOTE_MODULE_NETWORK, LogRemote_ModuleFromResult(RESULT_ERROR_NETWORK_SEND));
+    TEST_ASSERT_EQUAL(LOG_REMOTE_MODULE_GENERIC, LogRemote_ModuleFromResult(RESULT_ERROR_TIMEOUT));
+}
+
+// V2 프레임에서는 heartbeat/에러가 그대로 담기고 상태 변경 차이 인코딩은 유지되는지 테스트
+void test_LogRemote_V2_should_carry_heartbeat_and_error_between_deltas(void)
+{
+    LogRemote_SetEncoding(LOG_REMOTE_ENCODING_V2);
+    _init_with_capture();
+    
+    TIME_GetCurrentMs_ExpectAndReturn(1000);
+    LogRemote_SendStateChange(LORA_STATE_SEND_PERIODIC, LORA_STATE_WAIT_SEND_RESPONSE, 0, 1);
+    TIME_GetCurrentMs_ExpectAndReturn(1100);
+    LogRemote_SendHeartbeat();
+    TIME_GetCurrentMs_ExpectAndReturn(1200);
+    LogRemote_SendError(RESULT_ERROR_LORA_TIMEOUT, LOG_REMOTE_MODULE_AUTO, 0);
+    TIME_GetCurrentMs_ExpectAndReturn(1300);
+    LogRemote_SendStateChange(LORA_STATE_WAIT_SEND_RESPONSE, LORA_STATE_WAIT_SEND_INTERVAL, 1, 1);
+    TEST_ASSERT_EQUAL(0, LogRemote_Flush());
+    
+    LogFrameHeader header;
+    TEST_ASSERT_EQUAL((int)g_sent_size, LogFrame_Decode(g_sent_frame, g_sent_size, &header));
+    TEST_ASSERT_EQUAL(4, header.record_count);
+    
+    LogDeltaCodec codec;
+    LogDeltaRecord record;
+    size_t offset = 0;
+    TEST_ASSERT_TRUE(LogDelta_NextRecord(&header, &codec, &offset, &record));
+    TEST_ASSERT_NULL(record.raw);
+    TEST_ASSERT_TRUE(LogDelta_NextRecord(&header, &codec, &offset, &record));
+    TEST_ASSERT_EQUAL(sizeof(HeartbeatPacket), record.raw_len);
+    TEST_ASSERT_EQUAL(PACKET_TYPE_HEARTBEAT, record.raw[0]);
+    TEST_ASSERT_TRUE(LogDelta_NextRecord(&header, &codec, &offset, &record));
+    TEST_ASSERT_EQUAL(sizeof(ErrorLogPacket), record.raw_len);
+    
+    ErrorLogPacket error;
+    memcpy(&error, record.raw, sizeof(error));
+    TEST_ASSERT_EQUAL(LOG_REMOTE_MODULE_LORA, error.module_id);
+    TEST_ASSERT_EQUAL(LORA_STATE_WAIT_SEND_RESPONSE, error.state);
+    
+    TEST_ASSERT_TRUE(LogDelta_NextRecord(&header, &codec, &offset, &record));
+    TEST_ASSERT_NULL(record.raw);
+    TEST_ASSERT_EQUAL_UINT32(1300, record.timestamp_ms);
+    TEST_ASSERT_EQUAL_UINT32(300, record.state_duration);
+    TEST_ASSERT_EQUAL(1, record.error_count);
+}
@@ -0,0 +1,117 @@
+#include "unity.h"
+#include "LogTimeIndex.h"
+#include <string.h>
+
+static uint8_t raw[LOG_TIME_INDEX_ENTRY_SIZE * 8];
+
+void setUp(void)
+{
+    memset(raw, 0, sizeof(raw));
+}
+
+void tearDown(void)
+{
+}
+
+static void encode_all(const LogTimeIndexEntry* entries, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        LogTimeIndex_Encode(&entries[i], &raw[i * LOG_TIME_INDEX_ENTRY_SIZE]);
+    }
+}
+
+void test_LogTimeIndex_EncodeDecodeRoundTrip(void)
+{
+    LogTimeIndexEntry entry = { 1735689600UL, 123456, 65536 };
+    LogTimeIndexEntry decoded;
+
+    LogTimeIndex_Encode(&entry, raw);
+
+    TEST_ASSERT_TRUE(LogTimeIndex_Decode(raw, &decoded));
+    TEST_ASSERT_EQUAL_UINT32(entry.epoch_sec, decoded.epoch_sec);
+    TEST_ASSERT_EQUAL_UINT32(entry.uptime_ms, decoded.uptime_ms);
+    TEST_ASSERT_EQUAL_UINT32(entry.offset, decoded.offset);
+    TEST_ASSERT_EQUAL_HEX8(0x00, raw[8]);     // offset little endian
+    TEST_ASSERT_EQUAL_HEX8(0x00, raw[9]);
+    TEST_ASSERT_EQUAL_HEX8(0x01, raw[10]);
+}
+
+void test_LogTimeIndex_DecodeRejectsCorruptOrBlankEntry(void)
+{
+    LogTimeIndexEntry entry = { 1735689600UL, 1000, 4096 };
+    LogTimeIndexEntry decoded;
+
+    LogTimeIndex_Encode(&entry, raw);
+    raw[5] ^= 0x10;
+
+    TEST_ASSERT_FALSE(LogTimeIndex_Decode(raw, &decoded));
+    TEST_ASSERT_FALSE(LogTimeIndex_Decode(&raw[LOG_TIME_INDEX_ENTRY_SIZE], &decoded));  // 0으로 채워진 영역
+}
+
+void test_LogTimeIndex_ParseStopsAtTornTail(void)
+{
+    LogTimeIndexEntry entries[3] = { { 0, 10, 0 }, { 100, 20, 4096 }, { 101, 30, 8192 } };
+    LogTimeIndexEntry parsed[8];
+    encode_all(entries, 3);
+
+    // 마지막 항목이 절반만 기록됨
+    size_t count = LogTimeIndex_Parse(raw, LOG_TIME_INDEX_ENTRY_SIZE * 2 + 8, parsed, 8);
+
+    TEST_ASSERT_EQUAL(2, count);
+    TEST_ASSERT_EQUAL_UINT32(4096, parsed[1].offset);
+}
+
+void test_LogTimeIndex_ParseStopsWhenOffsetDoesNotIncrease(void)
+{
+    LogTimeIndexEntry entries[3] = { { 100, 10, 0 }, { 101, 20, 4096 }, { 102, 30, 4096 } };
+    LogTimeIndexEntry parsed[8];
+    encode_all(entries, 3);
+
+    TEST_ASSERT_EQUAL(2, LogTimeIndex_Parse(raw, LOG_TIME_INDEX_ENTRY_SIZE * 3, parsed, 8));
+}
+
+void test_LogTimeIndex_FindRangeSelectsSliceAroundInterval(void)
+{
+    // 동기화 전 항목(epoch 0) 다음에 초 단위 항목
+    LogTimeIndexEntry entries[] = {
+        { 0, 100, 0 }, { 0, 900, 1000 }, { 500, 1500, 2000 }, { 510, 11500, 3000 },
+        { 520, 21500, 4000 }, { 530, 31500, 5000 },
+    };
+    uint32_t start, end;
+
+    LogTimeIndex_FindRange(entries, 6, 512, 519, &start, &end);
+    TEST_ASSERT_EQUAL_UINT32(3000, start);
+    TEST_ASSERT_EQUAL_UINT32(4000, end);
+
+    // 경계와 같은 시각: 같은 초의 줄이 앞 항목 뒤에도 있을 수 있음
+    LogTimeIndex_FindRange(entries, 6, 520, 520, &start, &end);
+    TEST_ASSERT_EQUAL_UINT32(3000, start);
+    TEST_ASSERT_EQUAL_UINT32(5000, end);
+}
+
+void test_LogTimeIndex_FindRangeOutsideIndexUsesFileBounds(void)
+{
+    LogTimeIndexEntry entries[] = { { 500, 0, 0 }, { 510, 0, 1000 } };
+    uint32_t start, end;
+
+    LogTimeIndex_FindRange(entries, 2, 100, 200, &start, &end);
+    TEST_ASSERT_EQUAL_UINT32(0, start);
+    TEST_ASSERT_EQUAL_UINT32(0, end);       // 파일 시작 이전 - 빈 구간
+
+    LogTimeIndex_FindRange(entries, 2, 600, 700, &start, &end);
+    TEST_ASSERT_EQUAL_UINT32(1000, start);
+    TEST_ASSERT_EQUAL_UINT32(LOG_TIME_INDEX_END, end);
+
+    LogTimeIndex_FindRange(entries, 0, 600, 700, &start, &end);
+    TEST_ASSERT_EQUAL_UINT32(0, start);
+    TEST_ASSERT_EQUAL_UINT32(LOG_TIME_INDEX_END, end);
+}
+
+void test_LogTimeIndex_AnchorIsLastEntryAtOrBeforeOffset(void)
+{
+    LogTimeIndexEntry entries[] = { { 500, 0, 0 }, { 510, 0, 1000 }, { 520, 0, 2000 } };
+
+    TEST_ASSERT_EQUAL_PTR(&entries[1], LogTimeIndex_Anchor(entries, 3, 1999));
+    TEST_ASSERT_EQUAL_PTR(&entries[2], LogTimeIndex_Anchor(entries, 3, 2000));
+    TEST_ASSERT_NULL(LogTimeIndex_Anchor(entries, 0, 10));
+}
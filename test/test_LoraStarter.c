@@ -7,6 +7,9 @@
 uint32_t TIME_GetCurrentMs(void) {
     return TIME_Platform_GetCurrentMs();
 }
+uint64_t TIME_GetMonotonicMs(void) {
+    return TIME_Platform_GetMonotonicMs();
+}
 // -----------------------------------------------------------------------------
 // ↑ 위 코드는 테스트 빌드에서만 사용되는 임시 조치입니다. 실제 소스/테스트 분리 리팩터링 필요!
 // -----------------------------------------------------------------------------
@@ -779,4 +782,49 @@ void test_LoraStarter_should_set_last_send_time_on_timeout(void)
     TEST_ASSERT_EQUAL(7000, ctx.last_send_time);
 }
 
+// 49.7일 (32비트 ms) 경계를 넘는 송신 주기와 JOIN 재시도
+void test_LoraStarter_should_keep_timers_across_32bit_tick_wrap(void)
+{
+    LoraStarterContext ctx = {
+        .state = LORA_STATE_WAIT_SEND_RESPONSE,
+        .send_interval_ms = 30000
+    };
+    
+    // 경계 10초 전에 송신 완료
+    TIME_Mock_SetCurrentTime(0xFFFFFFFF - 10000);
+    ResponseHandler_ParseSendResponse_ExpectAndReturn("+EVT:SEND_CONFIRMED_OK", RESPONSE_OK);
+    LoraStarter_Process(&ctx, "+EVT:SEND_CONFIRMED_OK");
+    TEST_ASSERT_EQUAL(LORA_STATE_WAIT_SEND_INTERVAL, ctx.state);
+    
+    // 경계를 넘어 20초 경과 - 32비트 시각은 작아졌지만 아직 주기 전
+    TIME_Mock_AdvanceTime(20000);
+    TEST_ASSERT_TRUE(TIME_GetCurrentMs() < 20000);
+    LoraStarter_Process(&ctx, NULL);
+    TEST_ASSERT_EQUAL(LORA_STATE_WAIT_SEND_INTERVAL, ctx.state);
+    
+    TIME_Mock_AdvanceTime(10000);
+    LoraStarter_Process(&ctx, NULL);
+    TEST_ASSERT_EQUAL(LORA_STATE_SEND_PERIODIC, ctx.state);
+    
+    // 32비트 시각이 정확히 0인 순간의 재시도도 "첫 재시도"로 오인하지 않음
+    TIME_Mock_SetCurrentTime(0xFFFFFFFF);
+    TIME_Mock_AdvanceTime(1);
+    TEST_ASSERT_EQUAL(0, TIME_GetCurrentMs());
+    ctx.state = LORA_STATE_JOIN_RETRY;
+    ctx.last_retry_time = 0;
+    ctx.retry_delay_ms = 2000;
+    LoraStarter_Process(&ctx, NULL);
+    TEST_ASSERT_EQUAL(LORA_STATE_SEND_JOIN, ctx.state);
+    TEST_ASSERT_TRUE(ctx.last_retry_time == 0x100000000ULL);
+    
+    ctx.state = LORA_STATE_JOIN_RETRY;
+    TIME_Mock_AdvanceTime(1000);
+    LoraStarter_Process(&ctx, NULL);
+    TEST_ASSERT_EQUAL(LORA_STATE_JOIN_RETRY, ctx.state);      // 아직 2초 지연 중
+    
+    TIME_Mock_AdvanceTime(1000);
+    LoraStarter_Process(&ctx, NULL);
+    TEST_ASSERT_EQUAL(LORA_STATE_SEND_JOIN, ctx.state);
+}
+
 #endif // TEST
@@ -0,0 +1,179 @@
+#include "unity.h"
+#include "NetFanout.h"
+#include <string.h>
+
+#define FAST    0
+#define SLOW    1
+
+static NetFanout fanout;
+
+// 대상별로 받은 패킷 (첫 4바이트 = 순번)
+static uint32_t received[NET_FANOUT_MAX_TARGETS][256];
+static int received_count[NET_FANOUT_MAX_TARGETS];
+static int sink_result[NET_FANOUT_MAX_TARGETS];
+static const void* last_data[NET_FANOUT_MAX_TARGETS];
+
+static void _record(int target, const void* data, size_t size)
+{
+    uint32_t id = 0;
+    memcpy(&id, data, (size < sizeof(id)) ? size : sizeof(id));
+    received[target][received_count[target]++] = id;
+    last_data[target] = data;
+}
+
+static int _fast_sink(const void* data, size_t size)
+{
+    if (sink_result[FAST] != NET_FANOUT_OK) {
+        return sink_result[FAST];
+    }
+    _record(FAST, data, size);
+    return NET_FANOUT_OK;
+}
+
+static int _slow_sink(const void* data, size_t size)
+{
+    if (sink_result[SLOW] != NET_FANOUT_OK) {
+        return sink_result[SLOW];
+    }
+    _record(SLOW, data, size);
+    return NET_FANOUT_OK;
+}
+
+static int _submit(uint32_t id, uint32_t mask)
+{
+    uint8_t packet[32];
+    memset(packet, 0xA5, sizeof(packet));
+    memcpy(packet, &id, sizeof(id));
+    return NetFanout_Submit(&fanout, packet, sizeof(packet), mask);
+}
+
+void setUp(void)
+{
+    NetFanout_Init(&fanout);
+    NetFanout_SetTarget(&fanout, FAST, _fast_sink);
+    NetFanout_SetTarget(&fanout, SLOW, _slow_sink);
+    memset(received_count, 0, sizeof(received_count));
+    memset(sink_result, 0, sizeof(sink_result));
+    memset(last_data, 0, sizeof(last_data));
+}
+
+void tearDown(void)
+{
+}
+
+void test_NetFanout_SharesOneBufferBetweenTargets(void)
+{
+    TEST_ASSERT_EQUAL(NET_FANOUT_OK, _submit(7, 0x3));
+    TEST_ASSERT_EQUAL(1, NetFanout_Pending(&fanout, FAST));
+    TEST_ASSERT_EQUAL(1, NetFanout_Pending(&fanout, SLOW));
+
+    TEST_ASSERT_EQUAL(1, NetFanout_Drain(&fanout, FAST, 0));
+    TEST_ASSERT_EQUAL(1, NetFanout_Drain(&fanout, SLOW, 0));
+    TEST_ASSERT_EQUAL_UINT32(7, received[FAST][0]);
+    TEST_ASSERT_EQUAL_UINT32(7, received[SLOW][0]);
+    TEST_ASSERT_TRUE(last_data[FAST] == last_data[SLOW]);      // 복사본이 아니라 같은 버퍼
+}
+
+void test_NetFanout_ReleasesBufferOnlyAfterAllTargetsSent(void)
+{
+    // 느린 대상이 밀려 있어도 풀 크기만큼은 두 대상 모두 받음
+    for (uint32_t i = 0; i < NET_FANOUT_POOL_SIZE; i++) {
+        TEST_ASSERT_EQUAL(NET_FANOUT_OK, _submit(i, 0x3));
+        NetFanout_Drain(&fanout, FAST, 0);
+    }
+    TEST_ASSERT_EQUAL(NET_FANOUT_POOL_SIZE, NetFanout_Pending(&fanout, SLOW));
+
+    TEST_ASSERT_EQUAL(NET_FANOUT_POOL_SIZE, NetFanout_Drain(&fanout, SLOW, 0));
+    for (uint32_t i = 0; i < NET_FANOUT_POOL_SIZE; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i, received[SLOW][i]);
+    }
+
+    NetFanoutStats stats;
+    NetFanout_GetStats(&fanout, SLOW, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.dropped);
+    TEST_ASSERT_EQUAL_UINT32(NET_FANOUT_POOL_SIZE, stats.queue_peak);
+}
+
+void test_NetFanout_StalledTargetDoesNotBlockOthers(void)
+{
+    sink_result[SLOW] = NET_FANOUT_RETRY;      // SD가 멈춤
+
+    for (uint32_t i = 0; i < 100; i++) {
+        TEST_ASSERT_EQUAL(NET_FANOUT_OK, _submit(i, 0x3));
+        TEST_ASSERT_EQUAL(1, NetFanout_Drain(&fanout, FAST, 0));
+        NetFanout_Drain(&fanout, SLOW, 0);
+    }
+
+    // 빠른 대상은 모두 순서대로 받고, 느린 대상은 가장 최근 패킷만 남음
+    TEST_ASSERT_EQUAL(100, received_count[FAST]);
+    for (uint32_t i = 0; i < 100; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i, received[FAST][i]);
+    }
+    NetFanoutStats stats;
+    NetFanout_GetStats(&fanout, SLOW, &stats);
+    TEST_ASSERT_EQUAL_UINT32(100 - NET_FANOUT_POOL_SIZE, stats.dropped);
+    TEST_ASSERT_EQUAL_UINT32(NET_FANOUT_POOL_SIZE, stats.queued);
+
+    sink_result[SLOW] = NET_FANOUT_OK;
+    TEST_ASSERT_EQUAL(NET_FANOUT_POOL_SIZE, NetFanout_Drain(&fanout, SLOW, 0));
+    TEST_ASSERT_EQUAL_UINT32(100 - NET_FANOUT_POOL_SIZE, received[SLOW][0]);
+    TEST_ASSERT_EQUAL_UINT32(99, received[SLOW][NET_FANOUT_POOL_SIZE - 1]);
+}
+
+void test_NetFanout_DrainBudgetAndSinkErrors(void)
+{
+    for (uint32_t i = 0; i < 6; i++) {
+        _submit(i, 1U << SLOW);
+    }
+    TEST_ASSERT_EQUAL(0, NetFanout_Pending(&fanout, FAST));
+
+    TEST_ASSERT_EQUAL(4, NetFanout_Drain(&fanout, SLOW, 4));
+    TEST_ASSERT_EQUAL(2, NetFanout_Pending(&fanout, SLOW));
+
+    // 실패한 패킷은 그 대상에서만 버림
+    sink_result[SLOW] = NET_FANOUT_ERROR;
+    TEST_ASSERT_EQUAL(0, NetFanout_Drain(&fanout, SLOW, 1));
+    sink_result[SLOW] = NET_FANOUT_OK;
+    TEST_ASSERT_EQUAL(1, NetFanout_Drain(&fanout, SLOW, 0));
+    TEST_ASSERT_EQUAL_UINT32(5, received[SLOW][4]);
+
+    NetFanoutStats stats;
+    NetFanout_GetStats(&fanout, SLOW, &stats);
+    TEST_ASSERT_EQUAL_UINT32(6, stats.submitted);
+    TEST_ASSERT_EQUAL_UINT32(5, stats.sent);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.errors);
+}
+
+void test_NetFanout_RejectsInvalidSubmit(void)
+{
+    uint8_t big[NET_FANOUT_BUF_SIZE + 1];
+    memset(big, 0, sizeof(big));
+    TEST_ASSERT_EQUAL(NET_FANOUT_INVALID_PARAM, NetFanout_Submit(&fanout, big, sizeof(big), 0x3));
+    TEST_ASSERT_EQUAL(NET_FANOUT_INVALID_PARAM, NetFanout_Submit(&fanout, NULL, 4, 0x3));
+    TEST_ASSERT_EQUAL(NET_FANOUT_ERROR, _submit(1, 0));
+
+    // 제거한 대상은 큐를 버리고 더 이상 받지 않음
+    _submit(2, 0x3);
+    NetFanout_SetTarget(&fanout, SLOW, NULL);
+    TEST_ASSERT_EQUAL(0, NetFanout_Pending(&fanout, SLOW));
+    TEST_ASSERT_EQUAL(NET_FANOUT_OK, _submit(3, 0x3));
+    TEST_ASSERT_EQUAL(2, NetFanout_Drain(&fanout, FAST, 0));
+    TEST_ASSERT_EQUAL(0, received_count[SLOW]);
+}
+
+void test_NetFanout_SubmitVJoinsFragmentsIntoOneBuffer(void)
+{
+    uint32_t id = 42;
+    uint8_t payload[20];
+    memset(payload, 0x3C, sizeof(payload));
+    NetworkChunk chunks[] = {
+        { &id, sizeof(id) },
+        { payload, sizeof(payload) },
+    };
+    TEST_ASSERT_EQUAL(NET_FANOUT_OK, NetFanout_SubmitV(&fanout, chunks, 2, 1U << FAST));
+    TEST_ASSERT_EQUAL(1, NetFanout_Drain(&fanout, FAST, 0));
+    TEST_ASSERT_EQUAL_UINT32(42, received[FAST][0]);
+    TEST_ASSERT_EQUAL_MEMORY(payload, (const uint8_t*)last_data[FAST] + sizeof(id), sizeof(payload));
+
+    TEST_ASSERT_EQUAL(NET_FANOUT_INVALID_PARAM, NetFanout_SubmitV(&fanout, chunks, 0, 0x3));
+}
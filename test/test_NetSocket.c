@@ -0,0 +1,588 @@
+#include "unity.h"
+#include "NetSocket.h"
+#include "Network.h"
+#include "NetFanout.h"
+#include "SDStorage.h"
+#include "LatencyHist.h"
+#include "logger.h"
+#include "logger_platform.h"
+#include "StoreForward.h"
+#include "LogRemote.h"
+#include "LogFrame.h"
+#include "LogDelta.h"
+#include "Checksum.h"
+#include "time.h"
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+// 127.0.0.1의 임시 포트에 수집기(listen/UDP 소켓)를 띄우고 실제 소켓 전송을 검증
+// 단일 스레드: TCP connect는 accept 전에 커널에서 완료되므로 전송 후 accept해서 읽음
+
+static int collector_fd = -1;
+static int conn_fd = -1;
+static uint16_t collector_port;
+static uint8_t received[96 * 1024];
+static size_t received_size;
+static char spill_path[64];     // 작업 디렉토리에 SPILL.BIN을 남기지 않도록 임시 경로 사용
+
+static void _open_collector(int type)
+{
+    struct sockaddr_in addr;
+    socklen_t len = sizeof(addr);
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+
+    collector_fd = socket(AF_INET, type, 0);
+    TEST_ASSERT_TRUE(collector_fd >= 0);
+    TEST_ASSERT_EQUAL(0, bind(collector_fd, (struct sockaddr*)&addr, sizeof(addr)));
+    if (type == SOCK_STREAM) {
+        TEST_ASSERT_EQUAL(0, listen(collector_fd, 4));
+    }
+    TEST_ASSERT_EQUAL(0, getsockname(collector_fd, (struct sockaddr*)&addr, &len));
+    collector_port = ntohs(addr.sin_port);
+}
+
+// 닫았던 포트에 수집기를 다시 띄움 (수집기 재시작)
+static void _reopen_collector(uint16_t port)
+{
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+
+    collector_fd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(collector_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    TEST_ASSERT_EQUAL(0, bind(collector_fd, (struct sockaddr*)&addr, sizeof(addr)));
+    TEST_ASSERT_EQUAL(0, listen(collector_fd, 4));
+}
+
+static void _accept(void)
+{
+    struct pollfd pfd = { .fd = collector_fd, .events = POLLIN, .revents = 0 };
+    TEST_ASSERT_EQUAL(1, poll(&pfd, 1, 1000));
+    conn_fd = accept(collector_fd, NULL, NULL);
+    TEST_ASSERT_TRUE(conn_fd >= 0);
+}
+
+// fd에서 expected 바이트가 모일 때까지 수신 (UDP는 데이터그램 수 반환)
+static int _receive(int fd, size_t expected)
+{
+    int datagrams = 0;
+    while (received_size < expected) {
+        struct pollfd pfd = { .fd = fd, .events = POLLIN, .revents = 0 };
+        if (poll(&pfd, 1, 1000) != 1) {
+            break;
+        }
+        ssize_t n = recv(fd, &received[received_size], sizeof(received) - received_size, 0);
+        if (n <= 0) {
+            break;
+        }
+        received_size += (size_t)n;
+        datagrams++;
+    }
+    return datagrams;
+}
+
+static void _fill(uint8_t* data, size_t size, uint8_t seed)
+{
+    for (size_t i = 0; i < size; i++) {
+        data[i] = (uint8_t)(seed + i * 7);
+    }
+}
+
+void setUp(void)
+{
+    TIME_Mock_Reset();
+    received_size = 0;
+    snprintf(spill_path, sizeof(spill_path), "/tmp/test_NetSocket_%d.spill", (int)getpid());
+    SDStorage_SetSpillFile(spill_path);
+    NetSocket_SetBackoff(0, 0);
+    Network_SetBackend(NETWORK_BACKEND_SOCKET);
+    Network_SetTransport(NETWORK_TRANSPORT_TCP);
+}
+
+void tearDown(void)
+{
+    LogRemote_Reset();
+    Network_Disconnect();
+    SDStorage_Disconnect();
+    remove(spill_path);
+    SDStorage_SetSpillFile(NULL);
+    if (conn_fd >= 0) {
+        close(conn_fd);
+        conn_fd = -1;
+    }
+    if (collector_fd >= 0) {
+        close(collector_fd);
+        collector_fd = -1;
+    }
+    Network_SetTransport(NETWORK_TRANSPORT_TCP);
+}
+
+void test_NetSocket_TcpDeliversQueuedMessagesInOrder(void)
+{
+    uint8_t data[3][300];
+    _open_collector(SOCK_STREAM);
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Init("127.0.0.1", collector_port));
+
+    for (int i = 0; i < 3; i++) {
+        _fill(data[i], sizeof(data[i]), (uint8_t)(i * 50));
+        TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinary(data[i], sizeof(data[i])));
+    }
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Flush(1000));
+
+    _accept();
+    _receive(conn_fd, sizeof(data));
+    TEST_ASSERT_EQUAL(sizeof(data), received_size);
+    TEST_ASSERT_EQUAL_MEMORY(data, received, sizeof(data));
+
+    NetworkSocketStats stats;
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_GetSocketStats(&stats));
+    TEST_ASSERT_TRUE(stats.link_up);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(data), stats.bytes_sent);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.messages_queued);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.queue_bytes);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.connects);
+}
+
+void test_NetSocket_TcpSendsFragmentsAsOneStream(void)
+{
+    uint8_t header[8];
+    uint8_t payload[300];
+    uint8_t trailer[2];
+    uint8_t expected[sizeof(header) + sizeof(payload) + sizeof(trailer)];
+    _fill(header, sizeof(header), 1);
+    _fill(payload, sizeof(payload), 2);
+    _fill(trailer, sizeof(trailer), 3);
+    memcpy(expected, header, sizeof(header));
+    memcpy(&expected[sizeof(header)], payload, sizeof(payload));
+    memcpy(&expected[sizeof(header) + sizeof(payload)], trailer, sizeof(trailer));
+
+    _open_collector(SOCK_STREAM);
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Init("127.0.0.1", collector_port));
+
+    NetworkChunk chunks[] = {
+        { header, sizeof(header) },
+        { payload, sizeof(payload) },
+        { trailer, sizeof(trailer) },
+    };
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinaryV(chunks, 3));
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinaryV(chunks, 3));
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Flush(1000));
+
+    _accept();
+    _receive(conn_fd, 2 * sizeof(expected));
+    TEST_ASSERT_EQUAL(2 * sizeof(expected), received_size);
+    TEST_ASSERT_EQUAL_MEMORY(expected, received, sizeof(expected));
+    TEST_ASSERT_EQUAL_MEMORY(expected, &received[sizeof(expected)], sizeof(expected));
+
+    NetworkSocketStats stats;
+    Network_GetSocketStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.messages_queued);
+}
+
+void test_NetSocket_QueuesWhileConnectingAndSendsAfterward(void)
+{
+    uint8_t data[64];
+    _fill(data, sizeof(data), 3);
+
+    // 수신 측이 아직 없음 -> 연결 실패, 데이터는 큐에 남음
+    _open_collector(SOCK_STREAM);
+    uint16_t port = collector_port;
+    close(collector_fd);
+    collector_fd = -1;
+
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Init("127.0.0.1", port));
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinary(data, sizeof(data)));
+    }
+    for (int i = 0; i < 50 && NetSocket_IsLinkUp() == false; i++) {
+        NetSocket_Poll();
+        usleep(1000);
+    }
+    TEST_ASSERT_FALSE(NetSocket_IsLinkUp());
+    TEST_ASSERT_TRUE(Network_IsConnected());
+
+    NetworkSocketStats stats;
+    Network_GetSocketStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(3 * sizeof(data), stats.queue_bytes);
+    TEST_ASSERT_TRUE(stats.connect_failures >= 1);
+
+    // 같은 포트에 수집기를 다시 띄우고 백오프 시간 경과 후 재연결
+    _reopen_collector(port);
+    TIME_Mock_AdvanceTime(NET_SOCKET_BACKOFF_MAX_MS);
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Flush(1000));
+    TEST_ASSERT_TRUE(NetSocket_IsLinkUp());
+
+    _accept();
+    _receive(conn_fd, 3 * sizeof(data));
+    TEST_ASSERT_EQUAL(3 * sizeof(data), received_size);
+    TEST_ASSERT_EQUAL_MEMORY(data, &received[2 * sizeof(data)], sizeof(data));
+
+    // 밀린 메시지 3개를 sendmsg 한 번으로 전송
+    Network_GetSocketStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.send_calls);
+}
+
+void test_NetSocket_ReconnectsWithBackoffAfterPeerCloses(void)
+{
+    uint8_t data[100];
+    _fill(data, sizeof(data), 9);
+    NetSocket_SetBackoff(100, 400);
+
+    _open_collector(SOCK_STREAM);
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Init("127.0.0.1", collector_port));
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinary(data, sizeof(data)));
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Flush(1000));
+    _accept();
+    _receive(conn_fd, sizeof(data));
+
+    // 수집기가 연결을 끊음 -> 전송 오류(RST)로 끊김 감지
+    close(conn_fd);
+    conn_fd = -1;
+    for (int i = 0; i < 100 && NetSocket_IsLinkUp(); i++) {
+        Network_SendBinary(data, sizeof(data));
+        usleep(1000);
+    }
+    TEST_ASSERT_FALSE(NetSocket_IsLinkUp());
+
+    NetworkSocketStats stats;
+    Network_GetSocketStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.connect_failures);
+    TEST_ASSERT_EQUAL_UINT32(200, stats.backoff_ms);     // 다음 실패 시 대기 (100 -> 200)
+    TEST_ASSERT_TRUE(stats.queue_bytes > 0);
+    uint32_t sent_at_loss = stats.bytes_sent;
+
+    // 백오프 전에는 재연결하지 않음
+    TIME_Mock_AdvanceTime(99);
+    Network_Poll();
+    TEST_ASSERT_FALSE(NetSocket_IsLinkUp());
+
+    TIME_Mock_AdvanceTime(1);
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Flush(1000));
+    TEST_ASSERT_TRUE(NetSocket_IsLinkUp());
+
+    Network_GetSocketStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.connects);
+    TEST_ASSERT_EQUAL_UINT32(100, stats.backoff_ms);     // 연결 성공 시 최소값으로
+
+    // 새 연결로 끊긴 동안 쌓인 데이터와 이후 데이터 전달
+    uint8_t next[40];
+    _fill(next, sizeof(next), 77);
+    Network_SendBinary(next, sizeof(next));
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Flush(1000));
+    Network_GetSocketStats(&stats);
+
+    _accept();
+    received_size = 0;
+    size_t expected = stats.bytes_sent - sent_at_loss;
+    _receive(conn_fd, expected);
+    TEST_ASSERT_EQUAL(expected, received_size);
+    TEST_ASSERT_EQUAL_MEMORY(next, &received[received_size - sizeof(next)], sizeof(next));
+}
+
+void test_NetSocket_UdpSendsEachMessageAsDatagramWhenIdle(void)
+{
+    uint8_t data[3][200];
+    _open_collector(SOCK_DGRAM);
+    Network_SetTransport(NETWORK_TRANSPORT_UDP);
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Init("127.0.0.1", collector_port));
+    TEST_ASSERT_TRUE(NetSocket_IsLinkUp());
+
+    for (int i = 0; i < 3; i++) {
+        _fill(data[i], sizeof(data[i]), (uint8_t)i);
+        TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinary(data[i], sizeof(data[i])));
+    }
+
+    TEST_ASSERT_EQUAL(3, _receive(collector_fd, sizeof(data)));
+    TEST_ASSERT_EQUAL_MEMORY(data, received, sizeof(data));
+}
+
+void test_NetSocket_UdpSendsFragmentsAsOneDatagram(void)
+{
+    uint8_t header[4];
+    uint8_t payload[120];
+    _fill(header, sizeof(header), 9);
+    _fill(payload, sizeof(payload), 10);
+    _open_collector(SOCK_DGRAM);
+    Network_SetTransport(NETWORK_TRANSPORT_UDP);
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Init("127.0.0.1", collector_port));
+
+    NetworkChunk chunks[] = {
+        { header, sizeof(header) },
+        { payload, sizeof(payload) },
+    };
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinaryV(chunks, 2));
+
+    TEST_ASSERT_EQUAL(1, _receive(collector_fd, sizeof(header) + sizeof(payload)));
+    TEST_ASSERT_EQUAL_MEMORY(header, received, sizeof(header));
+    TEST_ASSERT_EQUAL_MEMORY(payload, &received[sizeof(header)], sizeof(payload));
+}
+
+void test_NetSocket_UdpCoalescesBacklogIntoDatagrams(void)
+{
+    uint8_t data[10][400];
+    for (int i = 0; i < 10; i++) {
+        _fill(data[i], sizeof(data[i]), (uint8_t)i);
+    }
+
+    // 수집기가 없는 포트 -> ICMP port unreachable로 두 번째 전송부터 ECONNREFUSED
+    _open_collector(SOCK_DGRAM);
+    uint16_t port = collector_port;
+    close(collector_fd);
+    collector_fd = -1;
+
+    Network_SetTransport(NETWORK_TRANSPORT_UDP);
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Init("127.0.0.1", port));
+    Network_SendBinary(data[0], sizeof(data[0]));
+    Network_SendBinary(data[1], sizeof(data[1]));
+    TEST_ASSERT_FALSE(NetSocket_IsLinkUp());
+
+    // 백오프 동안 쌓인 메시지
+    for (int i = 2; i < 10; i++) {
+        TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinary(data[i], sizeof(data[i])));
+    }
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+    collector_fd = socket(AF_INET, SOCK_DGRAM, 0);
+    TEST_ASSERT_EQUAL(0, bind(collector_fd, (struct sockaddr*)&addr, sizeof(addr)));
+
+    NetworkSocketStats before;
+    Network_GetSocketStats(&before);
+    TIME_Mock_AdvanceTime(NET_SOCKET_BACKOFF_MAX_MS);
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Flush(1000));
+
+    // 9개 x 400B -> 1472B 데이터그램에 3개씩 = 데이터그램 3개, 메시지 경계는 유지
+    size_t expected = 9 * sizeof(data[0]);
+    TEST_ASSERT_EQUAL(3, _receive(collector_fd, expected));
+    TEST_ASSERT_EQUAL(expected, received_size);
+    TEST_ASSERT_EQUAL_MEMORY(data[1], received, expected);
+
+    NetworkSocketStats stats;
+    Network_GetSocketStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.send_calls - before.send_calls);
+}
+
+void test_NetSocket_UdpRejectsMessageLargerThanDatagram(void)
+{
+    static uint8_t data[NET_SOCKET_UDP_MAX_PAYLOAD + 1];
+    _open_collector(SOCK_DGRAM);
+    Network_SetTransport(NETWORK_TRANSPORT_UDP);
+    Network_Init("127.0.0.1", collector_port);
+
+    TEST_ASSERT_EQUAL(NETWORK_INVALID_PARAM, Network_SendBinary(data, sizeof(data)));
+}
+
+void test_NetSocket_DropsMessagesWhenQueueIsFull(void)
+{
+    static uint8_t data[16 * 1024];
+
+    // 연결되지 않는 포트 -> 링에만 쌓임
+    _open_collector(SOCK_STREAM);
+    uint16_t port = collector_port;
+    close(collector_fd);
+    collector_fd = -1;
+    Network_Init("127.0.0.1", port);
+
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL(NETWORK_OK, NetSocket_Send(data, sizeof(data)));
+    }
+    TEST_ASSERT_EQUAL(NETWORK_QUEUE_FULL, NetSocket_Send(data, 1));
+
+    NetworkSocketStats stats;
+    NetSocket_GetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(NET_SOCKET_QUEUE_SIZE, stats.queue_bytes);
+    TEST_ASSERT_EQUAL_UINT32(NET_SOCKET_QUEUE_SIZE, stats.queue_peak_bytes);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.messages_dropped);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.messages_queued);
+}
+
+void test_NetSocket_StoresOverflowAndReplaysAfterReconnect(void)
+{
+    static uint8_t fill[16 * 1024];
+    uint8_t packet[100];
+    memset(fill, 0xEE, sizeof(fill));
+
+    _open_collector(SOCK_STREAM);
+    uint16_t port = collector_port;
+    close(collector_fd);
+    collector_fd = -1;
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());   // spill 볼륨은 소유자가 초기화
+    Network_Init("127.0.0.1", port);
+
+    // 송신 큐(64KB)가 찬 뒤의 패킷은 store-and-forward로 (RAM 16KB를 넘으면 SD spill)
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinary(fill, sizeof(fill)));
+    }
+    for (int i = 0; i < 200; i++) {
+        _fill(packet, sizeof(packet), (uint8_t)i);
+        packet[0] = (uint8_t)i;
+        TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinary(packet, sizeof(packet)));
+    }
+
+    NetworkSocketStats stats;
+    Network_GetSocketStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(200, stats.stored_packets);
+    TEST_ASSERT_TRUE(stats.spilled_packets > 0);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.dropped_packets);
+    TEST_ASSERT_EQUAL_UINT32(200 * (sizeof(packet) + STORE_FORWARD_RECORD_PREFIX), stats.backlog_bytes);
+
+    _reopen_collector(port);
+    TIME_Mock_AdvanceTime(NET_SOCKET_BACKOFF_MAX_MS);
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Flush(1000));
+    _accept();
+
+    // 재전송은 속도 제한 - Poll 한 번에 전부 나가지 않음
+    Network_Poll();
+    Network_GetSocketStats(&stats);
+    TEST_ASSERT_TRUE(stats.replayed_packets > 0 && stats.replayed_packets < 200);
+
+    for (int i = 0; i < 100 && stats.backlog_bytes > 0; i++) {
+        TIME_Mock_AdvanceTime(1000);
+        Network_Poll();
+        Network_GetSocketStats(&stats);
+    }
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Flush(1000));
+    TEST_ASSERT_EQUAL_UINT32(200, stats.replayed_packets);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.backlog_bytes);
+
+    size_t expected = 4 * sizeof(fill) + 200 * sizeof(packet);
+    _receive(conn_fd, expected);
+    TEST_ASSERT_EQUAL(expected, received_size);
+    for (int i = 0; i < 200; i++) {
+        TEST_ASSERT_EQUAL_HEX8((uint8_t)i, received[4 * sizeof(fill) + i * sizeof(packet)]);
+    }
+}
+
+// SD가 초기화되지 않았으면 spill하지 않고(카드 초기화/포맷 안 함) 오래된 보관 패킷을 버림
+void test_NetSocket_DropsOverflowWhenSDNotInitialized(void)
+{
+    static uint8_t fill[16 * 1024];
+    uint8_t packet[100];
+    memset(fill, 0xEE, sizeof(fill));
+    memset(packet, 0x5A, sizeof(packet));
+
+    _open_collector(SOCK_STREAM);
+    uint16_t port = collector_port;
+    close(collector_fd);
+    collector_fd = -1;
+    Network_Init("127.0.0.1", port);
+    NetworkSocketStats before;
+    Network_GetSocketStats(&before);
+
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinary(fill, sizeof(fill)));
+    }
+    for (int i = 0; i < 200; i++) {
+        TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinary(packet, sizeof(packet)));
+    }
+
+    NetworkSocketStats stats;
+    Network_GetSocketStats(&stats);
+    TEST_ASSERT_FALSE(SDStorage_IsReady());
+    TEST_ASSERT_EQUAL_UINT32(0, stats.spilled_packets - before.spilled_packets);
+    TEST_ASSERT_TRUE(stats.dropped_packets - before.dropped_packets > 0);
+    TEST_ASSERT_TRUE(stats.backlog_bytes <= STORE_FORWARD_RAM_SIZE);
+    TEST_ASSERT_NOT_EQUAL(0, access(spill_path, F_OK));
+
+    // 남은 RAM 보관분은 재연결 후 그대로 재전송 (다음 테스트로 넘기지 않음)
+    _reopen_collector(port);
+    TIME_Mock_AdvanceTime(NET_SOCKET_BACKOFF_MAX_MS);
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Flush(1000));
+    _accept();
+    for (int i = 0; i < 100 && stats.backlog_bytes > 0; i++) {
+        TIME_Mock_AdvanceTime(1000);
+        Network_Poll();
+        Network_GetSocketStats(&stats);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, stats.backlog_bytes);
+}
+
+// 재전송은 LogRemote_Poll(주기 호출)만으로 진행 - Network_Poll을 직접 부르지 않음
+void test_NetSocket_LogRemotePollReplaysStoredPackets(void)
+{
+    static uint8_t fill[16 * 1024];
+    uint8_t packet[100];
+    memset(fill, 0xEE, sizeof(fill));
+
+    _open_collector(SOCK_STREAM);
+    uint16_t port = collector_port;
+    close(collector_fd);
+    collector_fd = -1;
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    TEST_ASSERT_EQUAL(0, LogRemote_Init("127.0.0.1", port, 0x01));
+    NetworkSocketStats before;
+    Network_GetSocketStats(&before);
+
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinary(fill, sizeof(fill)));
+    }
+    for (int i = 0; i < 200; i++) {
+        _fill(packet, sizeof(packet), (uint8_t)i);
+        packet[0] = (uint8_t)i;
+        TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinary(packet, sizeof(packet)));
+    }
+    NetworkSocketStats stats;
+    Network_GetSocketStats(&stats);
+    TEST_ASSERT_TRUE(stats.spilled_packets > 0);
+    TEST_ASSERT_EQUAL(0, access(spill_path, F_OK));     // SetSpillFile 경로에 기록
+
+    _reopen_collector(port);
+    TIME_Mock_AdvanceTime(NET_SOCKET_BACKOFF_MAX_MS);
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Flush(1000));
+    _accept();
+
+    for (int i = 0; i < 100 && stats.backlog_bytes > 0; i++) {
+        TIME_Mock_AdvanceTime(1000);
+        LogRemote_Poll();
+        Network_GetSocketStats(&stats);
+    }
+    TEST_ASSERT_EQUAL_UINT32(200, stats.replayed_packets - before.replayed_packets);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.backlog_bytes);
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Flush(1000));
+
+    size_t expected = 4 * sizeof(fill) + 200 * sizeof(packet);
+    _receive(conn_fd, expected);
+    TEST_ASSERT_EQUAL(expected, received_size);
+    TEST_ASSERT_EQUAL_HEX8(199, received[4 * sizeof(fill) + 199 * sizeof(packet)]);
+}
+
+void test_NetSocket_ReportsBytesPerSecond(void)
+{
+    uint8_t data[500];
+    _fill(data, sizeof(data), 1);
+    _open_collector(SOCK_STREAM);
+    Network_Init("127.0.0.1", collector_port);
+
+    for (int i = 0; i < 4; i++) {
+        Network_SendBinary(data, sizeof(data));
+    }
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Flush(1000));
+
+    TIME_Mock_AdvanceTime(2000);
+    Network_Poll();
+
+    NetworkSocketStats stats;
+    Network_GetSocketStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1000, stats.bytes_per_sec);   // 2000B / 2s
+}
+
+void test_NetSocket_InitRejectsInvalidAddress(void)
+{
+    TEST_ASSERT_EQUAL(NETWORK_INVALID_PARAM, Network_Init("not-an-ip", 8080));
+    TEST_ASSERT_FALSE(Network_IsConnected());
+}
@@ -1,6 +1,17 @@
 #include "unity.h"
 #include "Network.h"
+#include "NetFanout.h"
 #include "SDStorage.h"
+#include "LatencyHist.h"
+#include "logger.h"
+#include "logger_platform.h"
+#include "NetSocket.h"
+#include "StoreForward.h"
+#include "LogRemote.h"
+#include "LogFrame.h"
+#include "LogDelta.h"
+#include "Checksum.h"
+#include "time.h"
 #include <string.h>
 
 void setUp(void)
@@ -12,6 +23,7 @@ void setUp(void)
 
 void tearDown(void)
 {
+    LogRemote_Reset();
     Network_Disconnect();
 }
 
@@ -210,6 +222,48 @@ void test_Network_SendBinary_should_fail_when_SD_not_initialized(void)
     TEST_ASSERT_EQUAL(NETWORK_NOT_CONNECTED, result);
 }
 
+// 조각 전송 (헤더 + 본문 + 꼬리)
+void test_Network_SendBinaryV_should_send_fragments(void)
+{
+    Network_SetBackend(NETWORK_BACKEND_SD_CARD);
+    Network_InitSD();
+    
+    uint8_t header[] = {0xA5, 0x01};
+    uint8_t payload[] = {0x10, 0x20, 0x30, 0x40};
+    uint8_t trailer[] = {0x5A};
+    NetworkChunk chunks[] = {
+        { header, sizeof(header) },
+        { NULL, 0 },                    // 빈 조각은 건너뜀
+        { payload, sizeof(payload) },
+        { trailer, sizeof(trailer) },
+    };
+    
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinaryV(chunks, 4));
+    TEST_ASSERT_EQUAL(sizeof(header) + sizeof(payload) + sizeof(trailer), Network_ChunksSize(chunks, 4));
+}
+
+// 잘못된 조각 목록
+void test_Network_SendBinaryV_should_reject_invalid_chunks(void)
+{
+    Network_SetBackend(NETWORK_BACKEND_SD_CARD);
+    Network_InitSD();
+    
+    uint8_t data[4] = {0};
+    NetworkChunk chunks[NETWORK_MAX_CHUNKS + 1];
+    for (int i = 0; i < NETWORK_MAX_CHUNKS + 1; i++) {
+        chunks[i].data = data;
+        chunks[i].size = sizeof(data);
+    }
+    
+    TEST_ASSERT_EQUAL(NETWORK_INVALID_PARAM, Network_SendBinaryV(NULL, 1));
+    TEST_ASSERT_EQUAL(NETWORK_INVALID_PARAM, Network_SendBinaryV(chunks, 0));
+    TEST_ASSERT_EQUAL(NETWORK_INVALID_PARAM, Network_SendBinaryV(chunks, NETWORK_MAX_CHUNKS + 1));
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinaryV(chunks, NETWORK_MAX_CHUNKS));
+    
+    chunks[1].data = NULL;
+    TEST_ASSERT_EQUAL(NETWORK_INVALID_PARAM, Network_SendBinaryV(chunks, 2));
+}
+
 // SD 백엔드 연결 상태 확인 테스트
 void test_Network_IsConnected_should_check_SD_status(void)
 {
@@ -249,4 +303,111 @@ void test_Network_should_support_backend_switching(void)
     Network_Init("192.168.1.100", 8080);
     TEST_ASSERT_TRUE(Network_IsConnected());
     TEST_ASSERT_EQUAL(NETWORK_BACKEND_SOCKET, Network_GetBackend());
-}
\ No newline at end of file
+}
+
+// ===== 여러 백엔드 동시 사용 (fan-out) =====
+
+// 소켓은 바로, SD는 Poll마다 NETWORK_FANOUT_SD_BUDGET개씩
+void test_Network_FanoutSendsToSocketImmediatelyAndSDOnPoll(void)
+{
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_EnableBackend(NETWORK_BACKEND_SD_CARD, true));
+    TEST_ASSERT_TRUE(Network_IsBackendEnabled(NETWORK_BACKEND_SOCKET));
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Init("192.168.1.100", 8080));
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_InitSD());
+
+    NetworkBackendStats before_socket;
+    NetworkBackendStats before_sd;
+    Network_GetBackendStats(NETWORK_BACKEND_SOCKET, &before_socket);
+    Network_GetBackendStats(NETWORK_BACKEND_SD_CARD, &before_sd);
+
+    uint8_t packet[64];
+    memset(packet, 0x5A, sizeof(packet));
+    for (int i = 0; i < 10; i++) {
+        TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinary(packet, sizeof(packet)));
+    }
+
+    NetworkBackendStats socket;
+    NetworkBackendStats sd;
+    Network_GetBackendStats(NETWORK_BACKEND_SOCKET, &socket);
+    Network_GetBackendStats(NETWORK_BACKEND_SD_CARD, &sd);
+    TEST_ASSERT_EQUAL_UINT32(10, socket.sent - before_socket.sent);
+    TEST_ASSERT_EQUAL_UINT32(0, socket.queued);
+    TEST_ASSERT_EQUAL_UINT32(10, sd.queued);
+
+    Network_Poll();
+    Network_GetBackendStats(NETWORK_BACKEND_SD_CARD, &sd);
+    TEST_ASSERT_EQUAL_UINT32(10 - NETWORK_FANOUT_SD_BUDGET, sd.queued);
+
+    // 소켓 송신 링은 서버가 없어 남음 (NETWORK_TIMEOUT), SD 큐는 모두 기록
+    TEST_ASSERT_EQUAL(NETWORK_TIMEOUT, Network_Flush(0));
+    Network_GetBackendStats(NETWORK_BACKEND_SD_CARD, &sd);
+    TEST_ASSERT_EQUAL_UINT32(0, sd.queued);
+    TEST_ASSERT_EQUAL_UINT32(10, sd.sent - before_sd.sent);
+}
+
+// LogRemote만 쓰는 경로 - SD 큐는 LogRemote_Poll(주기 호출)로 비워짐 (Network_Poll 직접 호출 없음)
+void test_Network_FanoutSDQueueDrainsFromLogRemotePoll(void)
+{
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_EnableBackend(NETWORK_BACKEND_SD_CARD, true));
+    TEST_ASSERT_EQUAL(0, LogRemote_Init("192.168.1.100", 8080, 0x01));
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_InitSD());
+
+    NetworkBackendStats before_sd;
+    Network_GetBackendStats(NETWORK_BACKEND_SD_CARD, &before_sd);
+
+    // 프레임 6개 (상태 변경 1건씩 바로 Flush)
+    for (int i = 0; i < 6; i++) {
+        LogRemote_SendStateChange(LORA_STATE_INIT, LORA_STATE_SEND_CMD, 0, (uint16_t)i);
+        TEST_ASSERT_EQUAL(0, LogRemote_Flush());
+    }
+    NetworkBackendStats sd;
+    Network_GetBackendStats(NETWORK_BACKEND_SD_CARD, &sd);
+    TEST_ASSERT_EQUAL_UINT32(6, sd.queued);
+
+    TEST_ASSERT_EQUAL(0, LogRemote_Poll());
+    Network_GetBackendStats(NETWORK_BACKEND_SD_CARD, &sd);
+    TEST_ASSERT_EQUAL_UINT32(6 - NETWORK_FANOUT_SD_BUDGET, sd.queued);
+
+    TEST_ASSERT_EQUAL(0, LogRemote_Poll());
+    Network_GetBackendStats(NETWORK_BACKEND_SD_CARD, &sd);
+    TEST_ASSERT_EQUAL_UINT32(0, sd.queued);
+    TEST_ASSERT_EQUAL_UINT32(6, sd.sent - before_sd.sent);
+}
+
+// 초기화하지 않은 백엔드는 건너뛰고 연결된 백엔드로만 전송
+void test_Network_FanoutSkipsBackendThatIsNotConnected(void)
+{
+    Network_EnableBackend(NETWORK_BACKEND_SD_CARD, true);
+    Network_Init("192.168.1.100", 8080);
+
+    NetworkBackendStats before;
+    Network_GetBackendStats(NETWORK_BACKEND_SD_CARD, &before);
+
+    uint8_t packet[16] = {0};
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinary(packet, sizeof(packet)));
+
+    NetworkBackendStats sd;
+    Network_GetBackendStats(NETWORK_BACKEND_SD_CARD, &sd);
+    TEST_ASSERT_EQUAL_UINT32(before.submitted, sd.submitted);
+
+    // fan-out 버퍼보다 큰 패킷은 거부
+    uint8_t large[NET_FANOUT_BUF_SIZE + 1];
+    memset(large, 0, sizeof(large));
+    TEST_ASSERT_EQUAL(NETWORK_INVALID_PARAM, Network_SendBinary(large, sizeof(large)));
+}
+
+// 백엔드를 끄면 남은 하나로 돌아감
+void test_Network_DisablingBackendReturnsToSingleBackend(void)
+{
+    Network_SetBackend(NETWORK_BACKEND_SD_CARD);
+    Network_EnableBackend(NETWORK_BACKEND_SOCKET, true);
+    Network_InitSD();
+    TEST_ASSERT_EQUAL(NETWORK_BACKEND_SD_CARD, Network_GetBackend());
+
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_EnableBackend(NETWORK_BACKEND_SD_CARD, false));
+    TEST_ASSERT_FALSE(Network_IsBackendEnabled(NETWORK_BACKEND_SD_CARD));
+    TEST_ASSERT_EQUAL(NETWORK_BACKEND_SOCKET, Network_GetBackend());
+    TEST_ASSERT_FALSE(Network_IsConnected());       // SD는 해제, 소켓은 아직 초기화 전
+
+    TEST_ASSERT_EQUAL(NETWORK_INVALID_PARAM, Network_EnableBackend(NETWORK_BACKEND_COUNT, true));
+}
@@ -0,0 +1,505 @@
+#ifdef TEST
+
+#include "unity.h"
+#include <string.h>
+#include <stdio.h>
+
+// 타겟 SD 서비스를 직접 포함 - CMSIS 메일 큐/HAL은 test/support 스텁 사용
+#include "../lora_tester_stm32/Core/Src/SDService.c"
+
+// 타겟 Network SD 백엔드 (SD 서비스 큐 경유) - SDService 뒤에 타겟 분기로 포함
+#define STM32F746xx
+#include "../lora_tester_stm32/Core/Src/NetFanout.c"
+#include "../lora_tester_stm32/Core/Src/Network.c"
+
+// ============================================================================
+// SDStorage 가짜 구현 (SD 태스크에서 실행된 동작을 순서대로 기록)
+// ============================================================================
+
+static char storage_calls[1024];        // 예: "W3 F V2 B1 " (W<n>: n줄 묶음, V<n>/B<n>: 조각 n개 한 줄/바이너리 레코드, F: flush)
+static char storage_data[2048];         // 기록된 줄 ("|"로 구분)
+static size_t storage_fail_at = (size_t)-1;  // 묶음에서 이 인덱스의 줄부터 실패
+static bool storage_ready = true;
+static uint32_t storage_backlog = 0;
+static int storage_write_batches = 0;
+
+static void _call(const char* name)
+{
+    strncat(storage_calls, name, sizeof(storage_calls) - strlen(storage_calls) - 1);
+}
+
+ResultCode SDStorage_WriteLogBatch(const SDStorageChunk* chunks, size_t count, size_t* written)
+{
+    char name[8];
+    snprintf(name, sizeof(name), "W%u ", (unsigned)count);
+    _call(name);
+    storage_write_batches++;
+
+    size_t done = 0;
+    for (; done < count && done < storage_fail_at; done++) {
+        strncat(storage_data, (const char*)chunks[done].data,
+                chunks[done].size < sizeof(storage_data) - strlen(storage_data) - 2
+                    ? chunks[done].size : 0);
+        strcat(storage_data, "|");
+    }
+    *written = done;
+    return (done == count) ? SDSTORAGE_OK : SDSTORAGE_FILE_ERROR;
+}
+
+ResultCode SDStorage_WriteLogV(const SDStorageChunk* chunks, size_t count)
+{
+    char name[8];
+    snprintf(name, sizeof(name), "V%u ", (unsigned)count);
+    _call(name);
+    storage_write_batches++;
+
+    if (storage_fail_at == 0) {
+        return SDSTORAGE_FILE_ERROR;
+    }
+    for (size_t i = 0; i < count; i++) {
+        strncat(storage_data, (const char*)chunks[i].data,
+                chunks[i].size < sizeof(storage_data) - strlen(storage_data) - 2 ? chunks[i].size : 0);
+    }
+    strcat(storage_data, "|");
+    return SDSTORAGE_OK;
+}
+
+ResultCode SDStorage_WriteBinaryV(const SDStorageChunk* chunks, size_t count)
+{
+    char name[8];
+    snprintf(name, sizeof(name), "B%u ", (unsigned)count);
+    _call(name);
+
+    size_t size = 0;
+    for (size_t i = 0; i < count; i++) {
+        size += chunks[i].size;
+    }
+    char total[16];
+    snprintf(total, sizeof(total), "<%u>|", (unsigned)size);
+    strcat(storage_data, total);
+    return SDSTORAGE_OK;
+}
+
+ResultCode SDStorage_Flush(void)
+{
+    _call("F ");
+    return SDSTORAGE_OK;
+}
+
+ResultCode SDStorage_RotateIfNeeded(void)
+{
+    return SDSTORAGE_OK;
+}
+
+ResultCode SDStorage_FlushIfDue(void)
+{
+    return SDSTORAGE_OK;
+}
+
+void SDStorage_GetStats(SDStorageStats* stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    stats->write_calls = 42;
+}
+
+void SDStorage_DumpLatency(void)
+{
+    _call("L ");
+}
+
+bool SDStorage_IsReady(void)
+{
+    return storage_ready;
+}
+
+void SDStorage_SetBacklog(uint32_t pending)
+{
+    storage_backlog = pending;
+}
+
+// ============================================================================
+// 완료 콜백
+// ============================================================================
+
+static int completion_count = 0;
+static SDServiceCompletion last_completion;
+static uint32_t last_stat_write_calls = 0;
+
+static void _on_complete(const SDServiceCompletion* completion, void* ctx)
+{
+    completion_count++;
+    last_completion = *completion;
+    if (completion->stats != NULL) {
+        last_stat_write_calls = completion->stats->write_calls;
+    }
+    if (ctx != NULL) {
+        (*(int*)ctx)++;
+    }
+}
+
+static void _append(const char* line)
+{
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS, SDService_Append(line, strlen(line)));
+}
+
+void setUp(void)
+{
+    OS_Stub_MailDelete(g_queue);
+    g_queue = NULL;
+    os_stub_fail_allocs = 0;
+    hal_stub_tick = 0;
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS, SDService_Init());
+
+    storage_calls[0] = '\0';
+    storage_data[0] = '\0';
+    storage_fail_at = (size_t)-1;
+    storage_ready = true;
+    storage_backlog = 0;
+    storage_write_batches = 0;
+    completion_count = 0;
+    memset(&last_completion, 0, sizeof(last_completion));
+    last_stat_write_calls = 0;
+}
+
+void tearDown(void)
+{
+    Network_EnableBackend(NETWORK_BACKEND_SD_CARD, false);
+    Network_Disconnect();
+}
+
+// ============================================================================
+// 요청 검사
+// ============================================================================
+
+void test_Init_twice_should_fail(void)
+{
+    TEST_ASSERT_EQUAL(RESULT_ERROR_ALREADY_INITIALIZED, SDService_Init());
+}
+
+void test_Append_should_reject_invalid_params_and_unmounted_card(void)
+{
+    char line[SD_SERVICE_LINE_MAX + 1];
+    memset(line, 'x', sizeof(line));
+
+    TEST_ASSERT_EQUAL(RESULT_ERROR_INVALID_PARAM, SDService_Append(NULL, 4));
+    TEST_ASSERT_EQUAL(RESULT_ERROR_INVALID_PARAM, SDService_Append("abc", 0));
+    TEST_ASSERT_EQUAL(RESULT_ERROR_INVALID_PARAM, SDService_Append(line, sizeof(line)));
+    TEST_ASSERT_EQUAL(RESULT_ERROR_INVALID_PARAM, SDService_Submit(SDSERVICE_REQ_APPEND, NULL, NULL));
+    TEST_ASSERT_EQUAL(RESULT_ERROR_INVALID_PARAM, SDService_Submit(SDSERVICE_REQ_APPEND_BINARY, NULL, NULL));
+    TEST_ASSERT_EQUAL(RESULT_ERROR_INVALID_PARAM, SDService_AppendBinary(line, sizeof(line)));
+
+    storage_ready = false;
+    TEST_ASSERT_EQUAL(SDSTORAGE_NOT_READY, SDService_Append("abc", 3));
+    TEST_ASSERT_FALSE(SDService_IsReady());
+}
+
+// ============================================================================
+// 묶음 기록 / 순서
+// ============================================================================
+
+void test_Process_should_batch_consecutive_appends(void)
+{
+    _append("one");
+    _append("two");
+    _append("three");
+
+    SDService_Process(0);
+
+    TEST_ASSERT_EQUAL_STRING("W3 ", storage_calls);
+    TEST_ASSERT_EQUAL_STRING("one|two|three|", storage_data);
+    TEST_ASSERT_EQUAL_UINT32(3, storage_backlog);
+
+    SDServiceStats stats;
+    SDService_GetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.batches);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.batched_appends);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.latency[SDSERVICE_REQ_APPEND].count);
+}
+
+void test_Process_should_split_batches_at_batch_max(void)
+{
+    for (int i = 0; i < SD_SERVICE_BATCH_MAX + 2; i++) {
+        _append("line");
+    }
+
+    SDService_Process(0);
+
+    char expected[16];
+    snprintf(expected, sizeof(expected), "W%d W2 ", SD_SERVICE_BATCH_MAX);
+    TEST_ASSERT_EQUAL_STRING(expected, storage_calls);
+}
+
+void test_Process_should_keep_control_requests_in_order(void)
+{
+    _append("a");
+    _append("b");
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS, SDService_Submit(SDSERVICE_REQ_FLUSH, NULL, NULL));
+    _append("c");
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS, SDService_Submit(SDSERVICE_REQ_LATENCY_DUMP, NULL, NULL));
+
+    SDService_Process(0);
+
+    TEST_ASSERT_EQUAL_STRING("W2 F W1 L ", storage_calls);
+    TEST_ASSERT_EQUAL_STRING("a|b|c|", storage_data);
+    TEST_ASSERT_EQUAL(0, OS_Stub_MailCount(g_queue));
+}
+
+void test_Process_should_handle_at_most_queue_depth_per_call(void)
+{
+    for (int i = 0; i < SD_SERVICE_QUEUE_DEPTH; i++) {
+        _append("x");
+    }
+    SDService_Process(0);
+    TEST_ASSERT_EQUAL(0, OS_Stub_MailCount(g_queue));
+
+    // 처리 중에 들어온 요청은 다음 호출로 (한 번에 깊이만큼만)
+    int batches = storage_write_batches;
+    SDService_Process(0);
+    TEST_ASSERT_EQUAL(batches, storage_write_batches);
+}
+
+// ============================================================================
+// 긴 줄 분할
+// ============================================================================
+
+void test_Append_should_write_long_line_as_one_line(void)
+{
+    char line[SD_SERVICE_APPEND_MAX * 2 + 10];
+    for (size_t i = 0; i < sizeof(line); i++) {
+        line[i] = (char)('a' + i % 26);
+    }
+    int callbacks = 0;
+
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS,
+                      SDService_AppendWithCallback(line, sizeof(line), _on_complete, &callbacks));
+    TEST_ASSERT_EQUAL(3, OS_Stub_MailCount(g_queue));
+
+    SDService_Process(0);
+
+    // 요청 3개에 나뉘어 들어가도 조각을 이어 한 번에 한 줄로 기록
+    TEST_ASSERT_EQUAL_STRING("V3 ", storage_calls);
+    TEST_ASSERT_EQUAL(sizeof(line) + 1, strlen(storage_data));
+    TEST_ASSERT_EQUAL_MEMORY(line, storage_data, sizeof(line));
+    // 완료 콜백은 마지막 조각에서 한 번
+    TEST_ASSERT_EQUAL(1, callbacks);
+}
+
+void test_Process_should_keep_long_line_between_short_lines(void)
+{
+    char line[SD_SERVICE_APPEND_MAX + 1];
+    memset(line, 'L', sizeof(line));
+
+    _append("a");
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS, SDService_Append(line, sizeof(line)));
+    _append("b");
+    _append("c");
+
+    SDService_Process(0);
+
+    TEST_ASSERT_EQUAL_STRING("W1 V2 W2 ", storage_calls);
+    char expected[sizeof(line) + 16];
+    snprintf(expected, sizeof(expected), "a|%.*s|b|c|", (int)sizeof(line), line);
+    TEST_ASSERT_EQUAL_STRING(expected, storage_data);
+
+    SDServiceStats stats;
+    SDService_GetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.batches);
+    TEST_ASSERT_EQUAL_UINT32(5, stats.batched_appends);
+}
+
+void test_Process_should_not_split_long_line_at_batch_max(void)
+{
+    char line[SD_SERVICE_APPEND_MAX * 2];
+    memset(line, 'L', sizeof(line));
+
+    for (int i = 0; i < SD_SERVICE_BATCH_MAX - 1; i++) {
+        _append("x");
+    }
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS, SDService_Append(line, sizeof(line)));
+
+    SDService_Process(0);
+
+    // 묶음 한도에 걸려도 마지막 줄의 조각은 끝까지 함께 꺼내 한 줄로 기록
+    char expected[16];
+    snprintf(expected, sizeof(expected), "W%d V2 ", SD_SERVICE_BATCH_MAX - 1);
+    TEST_ASSERT_EQUAL_STRING(expected, storage_calls);
+    TEST_ASSERT_EQUAL(0, OS_Stub_MailCount(g_queue));
+}
+
+void test_AppendBinary_should_write_one_record_between_line_batches(void)
+{
+    uint8_t record[SD_SERVICE_APPEND_MAX + 44];
+    memset(record, 0xB1, sizeof(record));
+
+    _append("a");
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS, SDService_AppendBinary(record, sizeof(record)));
+    _append("b");
+    TEST_ASSERT_EQUAL(4, OS_Stub_MailCount(g_queue));
+
+    SDService_Process(0);
+
+    // 바이너리 레코드는 줄 묶음에 섞이지 않고, 두 조각을 이어 레코드 하나로 기록
+    TEST_ASSERT_EQUAL_STRING("W1 B2 W1 ", storage_calls);
+    TEST_ASSERT_EQUAL_STRING("a|<300>|b|", storage_data);
+    TEST_ASSERT_EQUAL(0, OS_Stub_MailCount(g_queue));
+
+    SDServiceStats stats;
+    SDService_GetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.latency[SDSERVICE_REQ_APPEND_BINARY].count);
+}
+
+void test_AppendV_should_rejoin_fragments_split_across_requests(void)
+{
+    char first[200];
+    char second[100];
+    memset(first, 'A', sizeof(first));
+    memset(second, 'B', sizeof(second));
+    SDStorageChunk chunks[] = { { first, sizeof(first) }, { NULL, 0 }, { second, sizeof(second) } };
+
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS, SDService_AppendV(chunks, 3));
+    TEST_ASSERT_EQUAL(2, OS_Stub_MailCount(g_queue));
+
+    SDService_Process(0);
+
+    // 요청 2개(A 200 + B 56, B 44)를 다시 이어 A 200 + B 100 한 줄
+    TEST_ASSERT_EQUAL_STRING("V2 ", storage_calls);
+    TEST_ASSERT_EQUAL(301, strlen(storage_data));
+    TEST_ASSERT_EQUAL('A', storage_data[199]);
+    TEST_ASSERT_EQUAL('B', storage_data[200]);
+    TEST_ASSERT_EQUAL('|', storage_data[300]);
+}
+
+void test_Append_long_line_should_be_all_or_nothing_when_queue_nearly_full(void)
+{
+    for (int i = 0; i < SD_SERVICE_QUEUE_DEPTH - 1; i++) {
+        _append("x");
+    }
+    char line[SD_SERVICE_APPEND_MAX + 1];
+    memset(line, 'y', sizeof(line));
+
+    TEST_ASSERT_EQUAL(RESULT_ERROR_BUSY, SDService_Append(line, sizeof(line)));
+
+    // 일부 조각만 들어가지 않음, 남은 슬롯 1개는 그대로 사용 가능
+    TEST_ASSERT_EQUAL(SD_SERVICE_QUEUE_DEPTH - 1, OS_Stub_MailCount(g_queue));
+    _append("z");
+}
+
+// ============================================================================
+// 통계 / 완료
+// ============================================================================
+
+void test_Append_should_count_rejected_when_queue_full(void)
+{
+    for (int i = 0; i < SD_SERVICE_QUEUE_DEPTH; i++) {
+        _append("x");
+    }
+
+    TEST_ASSERT_EQUAL(RESULT_ERROR_BUSY, SDService_Append("overflow", 8));
+    TEST_ASSERT_EQUAL(RESULT_ERROR_BUSY, SDService_Submit(SDSERVICE_REQ_FLUSH, NULL, NULL));
+
+    SDServiceStats stats;
+    SDService_GetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.rejected);
+}
+
+void test_Completion_should_report_latency_and_stats(void)
+{
+    hal_stub_tick = 100;
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS, SDService_Submit(SDSERVICE_REQ_STAT, _on_complete, NULL));
+    hal_stub_tick = 130;
+
+    SDService_Process(0);
+
+    TEST_ASSERT_EQUAL(1, completion_count);
+    TEST_ASSERT_EQUAL(SDSERVICE_REQ_STAT, last_completion.type);
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS, last_completion.result);
+    TEST_ASSERT_EQUAL_UINT32(30, last_completion.latency_ms);
+    TEST_ASSERT_EQUAL_UINT32(42, last_stat_write_calls);
+
+    SDServiceStats stats;
+    SDService_GetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.latency[SDSERVICE_REQ_STAT].count);
+    TEST_ASSERT_EQUAL_UINT32(30, stats.latency[SDSERVICE_REQ_STAT].total_ms);
+    TEST_ASSERT_EQUAL_UINT32(30, stats.latency[SDSERVICE_REQ_STAT].max_ms);
+}
+
+void test_Completion_should_fail_lines_after_first_write_error(void)
+{
+    int ok_callbacks = 0;
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS, SDService_AppendWithCallback("a", 1, _on_complete, &ok_callbacks));
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS, SDService_AppendWithCallback("b", 1, _on_complete, NULL));
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS, SDService_AppendWithCallback("c", 1, _on_complete, NULL));
+    storage_fail_at = 1;
+
+    SDService_Process(0);
+
+    TEST_ASSERT_EQUAL(3, completion_count);
+    TEST_ASSERT_EQUAL(1, ok_callbacks);
+    TEST_ASSERT_EQUAL(SDSTORAGE_FILE_ERROR, last_completion.result);
+
+    SDServiceStats stats;
+    SDService_GetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.latency[SDSERVICE_REQ_APPEND].count);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.latency[SDSERVICE_REQ_APPEND].failed);
+}
+
+void test_Completion_should_fail_long_line_after_write_error(void)
+{
+    char line[SD_SERVICE_APPEND_MAX + 1];
+    memset(line, 'L', sizeof(line));
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS, SDService_AppendWithCallback("a", 1, _on_complete, NULL));
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS, SDService_AppendWithCallback(line, sizeof(line), _on_complete, NULL));
+    TEST_ASSERT_EQUAL(RESULT_SUCCESS, SDService_AppendWithCallback("b", 1, _on_complete, NULL));
+    storage_fail_at = 0;
+
+    SDService_Process(0);
+
+    // 첫 줄 실패 후 뒤의 줄(분할 줄 포함)은 기록하지 않고 실패로 완료
+    TEST_ASSERT_EQUAL_STRING("W1 ", storage_calls);
+    TEST_ASSERT_EQUAL(3, completion_count);
+    SDServiceStats stats;
+    SDService_GetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.latency[SDSERVICE_REQ_APPEND].failed);
+}
+
+// ============================================================================
+// Network fan-out SD 백엔드
+// ============================================================================
+
+void test_Network_fanout_should_retry_sd_when_queue_full(void)
+{
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_EnableBackend(NETWORK_BACKEND_SD_CARD, true));
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Init("127.0.0.1", 9000));
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_InitSD());
+    for (int i = 0; i < SD_SERVICE_QUEUE_DEPTH; i++) {
+        _append("x");
+    }
+
+    // SD 큐가 가득 차 있으면 패킷을 버리지 않고 fan-out 큐에 남겨 다음 Poll에서 재시도
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_SendBinary("packet", 6));
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Poll());
+    NetworkBackendStats stats;
+    Network_GetBackendStats(NETWORK_BACKEND_SD_CARD, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.retries);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.errors);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.dropped);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.queued);
+
+    SDService_Process(0);
+    TEST_ASSERT_EQUAL(NETWORK_OK, Network_Poll());
+    SDService_Process(0);
+    Network_GetBackendStats(NETWORK_BACKEND_SD_CARD, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.sent);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.queued);
+    TEST_ASSERT_NOT_NULL(strstr(storage_data, "packet|"));
+}
+
+void test_RequestName_should_cover_all_types(void)
+{
+    TEST_ASSERT_EQUAL_STRING("APPEND", SDService_RequestName(SDSERVICE_REQ_APPEND));
+    TEST_ASSERT_EQUAL_STRING("LATENCY_DUMP", SDService_RequestName(SDSERVICE_REQ_LATENCY_DUMP));
+    TEST_ASSERT_EQUAL_STRING("APPEND_BINARY", SDService_RequestName(SDSERVICE_REQ_APPEND_BINARY));
+    TEST_ASSERT_EQUAL_STRING("UNKNOWN", SDService_RequestName(SDSERVICE_REQ_COUNT));
+}
+
+#endif // TEST
@@ -0,0 +1,968 @@
+#include "unity.h"
+#include "SDStorage.h"
+#include "sd_diskio_image.h"
+#include "ff.h"
+#include "diskio.h"
+#include "ff_gen_drv.h"
+#include "LogJournal.h"
+#include "LogCompress.h"
+#include "LatencyHist.h"
+#include "LogTimeIndex.h"
+#include "FlushPolicy.h"
+#include "Checksum.h"
+#include "system_config.h"
+#include "logger.h"
+#include "logger_platform.h"
+#include "time.h"
+#include <string.h>
+
+// 실제 SDStorage + FatFs를 디스크 이미지 위에서 실행 (SDSTORAGE_HOST_FATFS 빌드)
+// 지연 주입은 mock 시간을 진행시키므로 동기화/회전 타이밍을 결정적으로 검증
+
+#define TEST_IMAGE_SECTORS  16384   // 8MB
+
+static RuntimeSDCardConfig g_config;
+static FATFS g_inspect_fs;
+static uint32_t g_delay_us_remainder;
+static uint32_t g_epoch_base;               // 0: 시간 동기화 전
+
+// SDStorage가 사용하는 런타임 설정 (system_config_runtime.c 대신)
+RuntimeSDCardConfig* SystemConfig_GetSDCard(void)
+{
+    return &g_config;
+}
+
+// 시간 인덱스 기록용 UTC 시각 (logger 시간 기준 대신 mock 시간 사용)
+uint32_t LOGGER_GetTimestamp(void)
+{
+    return (g_epoch_base == 0) ? 0 : g_epoch_base + TIME_GetCurrentMs() / 1000;
+}
+
+// 주입된 카드 지연을 mock 시간으로 반영
+static void _virtual_delay(uint32_t us)
+{
+    g_delay_us_remainder += us;
+    TIME_Mock_AdvanceTime(g_delay_us_remainder / 1000);
+    g_delay_us_remainder %= 1000;
+}
+
+void setUp(void)
+{
+    TIME_Mock_Reset();
+    g_delay_us_remainder = 0;
+    g_epoch_base = 0;
+
+    memset(&g_config, 0, sizeof(g_config));
+    g_config.log_file_max_size = 64 * 1024;
+    g_config.log_rotate_interval_ms = 0;
+    g_config.compression_enabled = false;
+    g_config.journal_enabled = false;
+    g_config.sync_interval_ms = 2000;
+    g_config.sync_bytes_threshold = 16384;
+
+    TEST_ASSERT_EQUAL(SD_IMAGE_OK, SDImage_Open(NULL, TEST_IMAGE_SECTORS));
+    SDImage_SetDelayFn(_virtual_delay);
+    SDStorage_ResetLatency();
+}
+
+void tearDown(void)
+{
+    SDStorage_Disconnect();
+    SDImage_Close();
+}
+
+// SDStorage 분리 후 이미지 내용 확인용 마운트
+static void _mount_for_inspection(void)
+{
+    TEST_ASSERT_EQUAL(FR_OK, f_mount(&g_inspect_fs, SDPath, 1));
+}
+
+static void _unmount_inspection(void)
+{
+    f_mount(NULL, SDPath, 0);
+}
+
+// 로그 디렉토리에서 확장자가 ext인 파일 수와 가장 큰 번호의 경로
+// (_USE_LFN 0에서는 "lora_logs"가 8.3 이름이 아니므로 f_mkdir이 실패하고 루트에 기록됨)
+static void _find_logs(const char* ext, int* count, char* last_path, size_t max_len)
+{
+    DIR dir;
+    FILINFO info;
+    char last_name[16] = {0};
+    const char* dir_path = (f_stat("lora_logs", &info) == FR_OK) ? "lora_logs" : "";
+
+    *count = 0;
+    TEST_ASSERT_EQUAL(FR_OK, f_opendir(&dir, dir_path));
+    while (f_readdir(&dir, &info) == FR_OK && info.fname[0] != '\0') {
+        if (strncmp(info.fname, "LORA", 4) == 0 && strcmp(&info.fname[9], ext) == 0) {
+            (*count)++;
+            if (strcmp(info.fname, last_name) > 0) {
+                strcpy(last_name, info.fname);
+            }
+        }
+    }
+    f_closedir(&dir);
+    snprintf(last_path, max_len, "%s%s%s", dir_path, dir_path[0] ? "/" : "", last_name);
+}
+
+static void _read_file(const char* path, char* buf, size_t max_len, UINT* bytes_read)
+{
+    FIL file;
+    TEST_ASSERT_EQUAL(FR_OK, f_open(&file, path, FA_READ));
+    TEST_ASSERT_EQUAL(FR_OK, f_read(&file, buf, (UINT)max_len, bytes_read));
+    f_close(&file);
+}
+
+static void _write_lines(int count, const char* text)
+{
+    for (int i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_WriteLog(text, strlen(text)));
+    }
+}
+
+void test_Init_FormatsBlankCard(void)
+{
+    // 빈 이미지: f_mount 재시도 실패 -> f_mkfs 후 재마운트
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    TEST_ASSERT_TRUE(SDStorage_IsReady());
+    SDStorage_Disconnect();
+
+    _mount_for_inspection();
+    FATFS* fs;
+    DWORD free_clusters = 0;
+    TEST_ASSERT_EQUAL(FR_OK, f_getfree(SDPath, &free_clusters, &fs));
+    TEST_ASSERT_GREATER_THAN(0, free_clusters);
+    _unmount_inspection();
+}
+
+void test_Init_FailsWhenCardNotReady(void)
+{
+    SDImage_SetNotReady(true);
+
+    TEST_ASSERT_NOT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    TEST_ASSERT_FALSE(SDStorage_IsReady());
+}
+
+void test_Init_RetriesMountAfterTransientReadError(void)
+{
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    SDStorage_Disconnect();
+    TIME_Mock_Reset();
+
+    // 첫 f_mount의 부트 섹터 읽기 실패 -> 재시도 대기 후 성공
+    SDImage_FailAfter(SD_IMAGE_OP_READ, 0, 1);
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+
+    SDImageStats stats;
+    SDImage_GetStats(&stats);
+    TEST_ASSERT_EQUAL(1, stats.injected_errors);
+    TEST_ASSERT_GREATER_OR_EQUAL(SD_CARD_STABILIZE_DELAY_MS + SD_MOUNT_RETRY_DELAY_MS, TIME_GetCurrentMs());
+}
+
+void test_WriteLog_PersistsLinesWithCrlfAndTrimsPreallocation(void)
+{
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_lines(1, "hello");
+    _write_lines(1, "world");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+    SDStorage_Disconnect();
+
+    _mount_for_inspection();
+    int count;
+    char path[32];
+    _find_logs("TXT", &count, path, sizeof(path));
+    TEST_ASSERT_EQUAL(1, count);
+
+    char content[64];
+    UINT bytes_read = 0;
+    _read_file(path, content, sizeof(content), &bytes_read);
+    TEST_ASSERT_EQUAL(14, bytes_read);
+    TEST_ASSERT_EQUAL_MEMORY("hello\r\nworld\r\n", content, 14);
+    _unmount_inspection();
+}
+
+void test_PowerLoss_TextFileKeepsOnlySyncedSize(void)
+{
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_lines(2, "[INFO] uplink sent");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+
+    // 전원 차단: 이후 쓰기가 모두 실패해 닫기 시 잘라내기/디렉토리 갱신이 반영되지 않음
+    SDImage_FailAfter(SD_IMAGE_OP_WRITE, 0, 1000);
+    SDStorage_Disconnect();
+    SDImage_ResetFaults();
+
+    // 디렉토리 엔트리 크기 = 사전 할당 크기 (잔여 꼬리 포함)
+    _mount_for_inspection();
+    int count;
+    char path[32];
+    _find_logs("TXT", &count, path, sizeof(path));
+    TEST_ASSERT_EQUAL(1, count);
+    FILINFO info;
+    TEST_ASSERT_EQUAL(FR_OK, f_stat(path, &info));
+    TEST_ASSERT_EQUAL(g_config.log_file_max_size + SD_LOG_PREALLOC_HEADROOM, info.fsize);
+    _unmount_inspection();
+
+    // 재마운트 시 매니페스트에 기록된 동기화 크기로 잘라냄
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    SDStorage_Disconnect();
+
+    _mount_for_inspection();
+    TEST_ASSERT_EQUAL(FR_OK, f_stat(path, &info));
+    TEST_ASSERT_EQUAL(2 * 20, info.fsize);
+    char content[64];
+    UINT bytes_read = 0;
+    _read_file(path, content, sizeof(content), &bytes_read);
+    TEST_ASSERT_EQUAL_MEMORY("[INFO] uplink sent\r\n[INFO] uplink sent\r\n", content, 40);
+    _unmount_inspection();
+}
+
+void test_PowerLoss_CompressedFileTruncatedToLastSyncOnMount(void)
+{
+    g_config.compression_enabled = true;
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_lines(2, "[INFO] uplink sent");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+
+    // 동기화 전 블록은 전원 차단으로 잃음
+    _write_lines(2, "[WARN] not synced");
+    SDImage_FailAfter(SD_IMAGE_OP_WRITE, 0, 1000);
+    SDStorage_Disconnect();
+    SDImage_ResetFaults();
+
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    SDStorage_Disconnect();
+
+    // 잘라낸 파일 끝까지 모두 유효한 압축 블록 (사전 할당 영역 잔여 없음)
+    _mount_for_inspection();
+    int count;
+    char path[32];
+    _find_logs("LZL", &count, path, sizeof(path));
+    TEST_ASSERT_EQUAL(1, count);
+    static uint8_t content[1024];
+    UINT bytes_read = 0;
+    _read_file(path, (char*)content, sizeof(content), &bytes_read);
+    TEST_ASSERT_LESS_THAN(sizeof(content), bytes_read);
+
+    static LogDecompressor decompressor;
+    char text[128];
+    size_t offset = 0;
+    size_t text_len = 0;
+    LogDecompress_Init(&decompressor);
+    while (offset < bytes_read) {
+        size_t consumed = 0;
+        size_t out_len = 0;
+        TEST_ASSERT_EQUAL(LOG_COMPRESS_OK,
+                          LogDecompress_Block(&decompressor, &content[offset], bytes_read - offset, &consumed,
+                                              (uint8_t*)&text[text_len], sizeof(text) - text_len, &out_len));
+        offset += consumed;
+        text_len += out_len;
+    }
+    TEST_ASSERT_EQUAL(2 * 20, text_len);
+    TEST_ASSERT_EQUAL_MEMORY("[INFO] uplink sent\r\n[INFO] uplink sent\r\n", text, 40);
+    _unmount_inspection();
+}
+
+void test_PowerLoss_ReopenedFileKeepsAppendsAfterCleanClose(void)
+{
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_lines(1, "[INFO] uplink sent");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+
+    // 재초기화: 사전 할당을 잘라내고 닫은 뒤 같은 파일을 일반 append로 다시 엶
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_lines(2, "[INFO] uplink sent");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+    SDImage_FailAfter(SD_IMAGE_OP_WRITE, 0, 1000);
+    SDStorage_Disconnect();
+    SDImage_ResetFaults();
+
+    // 닫을 때 매니페스트의 동기화 크기가 해제되어 이어 쓴 줄은 잘리지 않음
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    SDStorage_Disconnect();
+
+    _mount_for_inspection();
+    int count;
+    char path[32];
+    _find_logs("TXT", &count, path, sizeof(path));
+    TEST_ASSERT_EQUAL(1, count);
+    FILINFO info;
+    TEST_ASSERT_EQUAL(FR_OK, f_stat(path, &info));
+    TEST_ASSERT_EQUAL(3 * 20, info.fsize);
+    _unmount_inspection();
+}
+
+void test_WriteLogV_JoinsFragmentsIntoOneLineAndJournalRecord(void)
+{
+    const SDStorageChunk chunks[] = { { "[hdr]", 5 }, { NULL, 0 }, { "payload", 7 }, { "#", 1 } };
+
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_WriteLogV(chunks, 4));
+    TEST_ASSERT_EQUAL(SDSTORAGE_INVALID_PARAM, SDStorage_WriteLogV(chunks, 0));
+    const SDStorageChunk bad[] = { { NULL, 3 } };
+    TEST_ASSERT_EQUAL(SDSTORAGE_INVALID_PARAM, SDStorage_WriteLogV(bad, 1));
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+    SDStorage_Disconnect();
+
+    _mount_for_inspection();
+    int count;
+    char path[32];
+    char content[64];
+    UINT bytes_read = 0;
+    _find_logs("TXT", &count, path, sizeof(path));
+    _read_file(path, content, sizeof(content), &bytes_read);
+    TEST_ASSERT_EQUAL(15, bytes_read);
+    TEST_ASSERT_EQUAL_MEMORY("[hdr]payload#\r\n", content, 15);
+    _unmount_inspection();
+
+    // 저널 파일: 조각을 이은 본문으로 레코드 하나
+    g_config.journal_enabled = true;
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_WriteLogV(chunks, 4));
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+    SDStorage_Disconnect();
+
+    _mount_for_inspection();
+    uint8_t journal[256];
+    _find_logs("LJR", &count, path, sizeof(path));
+    _read_file(path, (char*)journal, sizeof(journal), &bytes_read);
+    LogJournalRecord file_header;
+    int offset = LogJournal_Decode(LogJournal_Crc32, journal, bytes_read, &file_header);
+    TEST_ASSERT_GREATER_THAN(0, offset);
+    LogJournalRecord rec;
+    TEST_ASSERT_GREATER_THAN(0, LogJournal_Decode(LogJournal_Crc32, &journal[offset], bytes_read - (UINT)offset, &rec));
+    TEST_ASSERT_EQUAL(13, rec.length);
+    TEST_ASSERT_EQUAL_MEMORY("[hdr]payload#", rec.payload, 13);
+    _unmount_inspection();
+}
+
+void test_FlushIfDue_SyncsOnlyAfterInterval(void)
+{
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_lines(1, "[INFO] join ok");
+
+    // 통계는 누적값이므로 차이로 확인
+    SDStorageStats before, stats;
+    SDStorage_GetStats(&before);
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_FlushIfDue());
+    SDStorage_GetStats(&stats);
+    TEST_ASSERT_EQUAL(before.sync_calls, stats.sync_calls);
+
+    TIME_Mock_AdvanceTime(g_config.sync_interval_ms);
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_FlushIfDue());
+    SDStorage_GetStats(&stats);
+    TEST_ASSERT_EQUAL(before.sync_calls + 1, stats.sync_calls);
+}
+
+void test_WriteLog_SyncsWhenByteThresholdReached(void)
+{
+    g_config.sync_bytes_threshold = 1024;
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+
+    SDStorageStats before;
+    SDStorage_GetStats(&before);
+    _write_lines(40, "0123456789012345678901234567890123456789");  // 42 * 40 = 1680 바이트
+
+    SDStorageStats after;
+    SDStorage_GetStats(&after);
+    TEST_ASSERT_EQUAL(before.sync_calls + 1, after.sync_calls);
+}
+
+void test_RotateIfNeeded_StartsNextFileWhenSizeExceeded(void)
+{
+    g_config.log_file_max_size = 1024;
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+
+    _write_lines(20, "0123456789012345678901234567890123456789012345678901234567");  // 60 * 20
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_RotateIfNeeded());
+    TEST_ASSERT_EQUAL(0, SDStorage_GetCurrentLogSize());
+    _write_lines(1, "next file");
+    SDStorage_Disconnect();
+
+    _mount_for_inspection();
+    int count;
+    char path[32];
+    _find_logs("TXT", &count, path, sizeof(path));
+    TEST_ASSERT_EQUAL(2, count);
+
+    char content[64];
+    UINT bytes_read = 0;
+    _read_file(path, content, sizeof(content), &bytes_read);
+    TEST_ASSERT_EQUAL(11, bytes_read);
+    TEST_ASSERT_EQUAL_MEMORY("next file\r\n", content, 11);
+    _unmount_inspection();
+}
+
+void test_RotateIfNeeded_RotatesByAge(void)
+{
+    g_config.log_rotate_interval_ms = 60000;
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_lines(1, "first");
+
+    TIME_Mock_AdvanceTime(59999);
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_RotateIfNeeded());
+    TEST_ASSERT_NOT_EQUAL(0, SDStorage_GetCurrentLogSize());
+
+    TIME_Mock_AdvanceTime(1);
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_RotateIfNeeded());
+    TEST_ASSERT_EQUAL(0, SDStorage_GetCurrentLogSize());
+}
+
+void test_WriteLog_ReportsInjectedSyncErrorAndReopensFile(void)
+{
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_lines(1, "before");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+
+    // 다음 섹터 쓰기 1회 실패 -> 동기화 실패로 파일을 닫고 다음 쓰기에서 다시 엶
+    SDImage_FailAfter(SD_IMAGE_OP_WRITE, 0, 1);
+    TIME_Mock_AdvanceTime(g_config.sync_interval_ms);
+    TEST_ASSERT_EQUAL(SDSTORAGE_FILE_ERROR, SDStorage_WriteLog("lost", 4));
+
+    _write_lines(1, "after");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+    SDStorage_Disconnect();
+
+    _mount_for_inspection();
+    int count;
+    char path[32];
+    _find_logs("TXT", &count, path, sizeof(path));
+    char content[64] = {0};
+    UINT bytes_read = 0;
+    _read_file(path, content, sizeof(content) - 1, &bytes_read);
+    TEST_ASSERT_EQUAL_MEMORY("before\r\n", content, 8);
+    TEST_ASSERT_NOT_NULL(strstr(content, "after\r\n"));
+    _unmount_inspection();
+}
+
+void test_Stats_IncludeInjectedCardLatency(void)
+{
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    SDImage_SetLatency(SD_IMAGE_OP_SYNC, 25000, 0);     // f_sync 시 카드 busy 25ms
+
+    SDStorageStats before, stats;
+    SDStorage_GetStats(&before);
+    _write_lines(1, "slow card");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+
+    SDStorage_GetStats(&stats);
+    TEST_ASSERT_GREATER_OR_EQUAL(before.busy_ms + 25, stats.busy_ms);
+}
+
+void test_Latency_RecordsMountWriteAndSyncStalls(void)
+{
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    SDImage_SetLatency(SD_IMAGE_OP_SYNC, 400000, 0);    // 400ms f_sync stall
+
+    _write_lines(1, "stall");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+
+    LatencyHist hist;
+    SDStorage_GetLatency(SDSTORAGE_LAT_MOUNT, &hist);
+    TEST_ASSERT_EQUAL_UINT32(1, hist.count);
+    SDStorage_GetLatency(SDSTORAGE_LAT_WRITE, &hist);
+    TEST_ASSERT_GREATER_OR_EQUAL(1, hist.count);
+    SDStorage_GetLatency(SDSTORAGE_LAT_SYNC, &hist);
+    TEST_ASSERT_GREATER_OR_EQUAL(1, hist.count);
+    TEST_ASSERT_GREATER_OR_EQUAL(400000, hist.max_us);
+    TEST_ASSERT_GREATER_OR_EQUAL(1, hist.buckets[LatencyHist_Bucket(400000)]);
+    SDStorage_GetLatency(SDSTORAGE_LAT_ROTATE, &hist);
+    TEST_ASSERT_EQUAL_UINT32(0, hist.count);
+}
+
+void test_Latency_RecordsRotation(void)
+{
+    g_config.log_file_max_size = 64;
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_lines(2, "0123456789012345678901234567890123456789");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_RotateIfNeeded());
+
+    LatencyHist hist;
+    SDStorage_GetLatency(SDSTORAGE_LAT_ROTATE, &hist);
+    TEST_ASSERT_EQUAL_UINT32(1, hist.count);
+    TEST_ASSERT_EQUAL_STRING("rotate", SDStorage_LatencyOpName(SDSTORAGE_LAT_ROTATE));
+}
+
+static void _enable_adaptive_sync(void)
+{
+    g_config.adaptive_sync_enabled = true;
+    g_config.sync_bytes_min = 4096;
+    g_config.sync_interval_min_ms = 500;
+}
+
+void test_AdaptiveSync_DisabledUsesFixedThresholds(void)
+{
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+
+    SDStorageStats stats;
+    SDStorage_GetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(16384, stats.sync_bytes_target);
+    TEST_ASSERT_EQUAL_UINT32(2000, stats.sync_interval_target_ms);
+}
+
+void test_AdaptiveSync_GrowsOnStallAndShrinksWhenCardIsFast(void)
+{
+    _enable_adaptive_sync();
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+
+    SDStorageStats stats;
+    SDStorage_GetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(4096, stats.sync_bytes_target);
+    TEST_ASSERT_EQUAL_UINT32(500, stats.sync_interval_target_ms);
+
+    // 느린 카드: f_sync마다 400ms -> 상한(기존 내구성 설정)까지 확대
+    SDImage_SetLatency(SD_IMAGE_OP_SYNC, 400000, 0);
+    for (int i = 0; i < 3; i++) {
+        _write_lines(1, "stall");
+        TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+    }
+    SDStorage_GetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(16384, stats.sync_bytes_target);
+    TEST_ASSERT_EQUAL_UINT32(2000, stats.sync_interval_target_ms);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.policy_grows);
+
+    // 카드가 빨라지면 평균 지연이 내려간 뒤 다시 최소값으로
+    SDImage_SetLatency(SD_IMAGE_OP_SYNC, 0, 0);
+    for (int i = 0; i < 40; i++) {
+        _write_lines(1, "fast");
+        TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+    }
+    SDStorage_GetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(4096, stats.sync_bytes_target);
+    TEST_ASSERT_EQUAL_UINT32(500, stats.sync_interval_target_ms);
+    TEST_ASSERT_GREATER_THAN(0, stats.policy_shrinks);
+}
+
+void test_AdaptiveSync_SyncsAtPolicyThreshold(void)
+{
+    _enable_adaptive_sync();
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_lines(1, "[INFO] join ok");
+
+    SDStorageStats before, after;
+    SDStorage_GetStats(&before);
+    TIME_Mock_AdvanceTime(600);     // 고정 주기(2000ms) 전이지만 정책 주기(500ms)는 경과
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_FlushIfDue());
+    SDStorage_GetStats(&after);
+    TEST_ASSERT_EQUAL(before.sync_calls + 1, after.sync_calls);
+}
+
+void test_AdaptiveSync_GrowsWhenBacklogHigh(void)
+{
+    _enable_adaptive_sync();
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+
+    SDStorage_SetBacklog(SD_ADAPTIVE_BACKLOG_HIGH);
+    _write_lines(1, "busy");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+
+    SDStorageStats stats;
+    SDStorage_GetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(8192, stats.sync_bytes_target);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.policy_grows);
+}
+
+// 10줄(500B)마다 1초 경과하며 50B 줄 기록 -> 줄 i의 시각은 base + i / 10
+static void _write_timed_lines(int count)
+{
+    char line[64];
+    for (int i = 0; i < count; i++) {
+        snprintf(line, sizeof(line), "line %04d %038d", i, 0);
+        TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_WriteLog(line, strlen(line)));
+        if (i % 10 == 9) {
+            TIME_Mock_AdvanceTime(1000);
+        }
+    }
+}
+
+static size_t _read_time_index(const char* log_path, LogTimeIndexEntry* entries, size_t max_entries)
+{
+    static uint8_t raw[4096];
+    char path[32];
+    UINT bytes_read = 0;
+    strcpy(path, log_path);
+    strcpy(&path[strlen(path) - 3], "IDX");
+    _read_file(path, (char*)raw, sizeof(raw), &bytes_read);
+    return LogTimeIndex_Parse(raw, bytes_read, entries, max_entries);
+}
+
+void test_TimeIndex_EntriesPointAtLineStartsWithTheirTime(void)
+{
+    static char content[16384];
+    g_config.index_interval_bytes = 1024;
+    g_epoch_base = 1700000000;
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_timed_lines(200);
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+    SDStorage_Disconnect();
+
+    _mount_for_inspection();
+    int count;
+    char path[32];
+    _find_logs("TXT", &count, path, sizeof(path));
+    UINT bytes_read = 0;
+    _read_file(path, content, sizeof(content), &bytes_read);
+    TEST_ASSERT_EQUAL(200 * 50, bytes_read);
+
+    LogTimeIndexEntry entries[32];
+    size_t entry_count = _read_time_index(path, entries, 32);
+    TEST_ASSERT_EQUAL(10, entry_count);     // 1024B 간격, 50B 줄 -> 21줄마다
+    TEST_ASSERT_EQUAL_UINT32(0, entries[0].offset);
+    uint32_t t0 = entries[0].epoch_sec;     // 첫 줄 시각 (마운트 재시도로 base보다 늦음)
+    TEST_ASSERT_GREATER_OR_EQUAL(g_epoch_base, t0);
+    for (size_t i = 0; i < entry_count; i++) {
+        uint32_t line = entries[i].offset / 50;
+        TEST_ASSERT_EQUAL_UINT32(line * 50, entries[i].offset);
+        TEST_ASSERT_EQUAL_MEMORY("line ", &content[entries[i].offset], 5);
+        TEST_ASSERT_EQUAL_UINT32(t0 + line / 10, entries[i].epoch_sec);
+    }
+
+    // 12초~13초 구간: 줄 120~139를 포함하는 조각만 읽으면 됨
+    uint32_t start, end;
+    LogTimeIndex_FindRange(entries, entry_count, t0 + 12, t0 + 13, &start, &end);
+    TEST_ASSERT_LESS_OR_EQUAL(120 * 50, start);
+    TEST_ASSERT_GREATER_OR_EQUAL(140 * 50, end);
+    TEST_ASSERT_LESS_THAN(200 * 50, end);
+    TEST_ASSERT_LESS_OR_EQUAL(20 * 50 + 2 * 21 * 50, end - start);   // 양 끝 최대 한 간격(21줄)씩
+    _unmount_inspection();
+}
+
+void test_TimeIndex_PointsAtJournalRecords(void)
+{
+    static uint8_t content[16384];
+    g_config.journal_enabled = true;
+    g_config.index_interval_bytes = 1024;
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_timed_lines(100);
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+    SDStorage_Disconnect();
+
+    _mount_for_inspection();
+    int count;
+    char path[32];
+    _find_logs("LJR", &count, path, sizeof(path));
+    UINT bytes_read = 0;
+    _read_file(path, (char*)content, sizeof(content), &bytes_read);
+
+    LogTimeIndexEntry entries[32];
+    size_t entry_count = _read_time_index(path, entries, 32);
+    TEST_ASSERT_GREATER_THAN(1, entry_count);
+    for (size_t i = 0; i < entry_count; i++) {
+        LogJournalRecord rec;
+        TEST_ASSERT_GREATER_THAN(0, LogJournal_Decode(LogJournal_Crc32, &content[entries[i].offset],
+                                                      bytes_read - entries[i].offset, &rec));
+        TEST_ASSERT_EQUAL(LOG_JOURNAL_TYPE_TEXT, rec.type);
+        TEST_ASSERT_EQUAL_UINT32(entries[i].uptime_ms, rec.timestamp_ms);
+        TEST_ASSERT_EQUAL_UINT32(0, entries[i].epoch_sec);    // 시간 동기화 전
+    }
+    _unmount_inspection();
+}
+
+void test_Init_TruncatesTornJournalTail(void)
+{
+    g_config.journal_enabled = true;
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_lines(3, "[INFO] uplink sent");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+    SDStorage_Disconnect();
+
+    // 전원 차단으로 레코드 일부만 기록된 상태 재현
+    _mount_for_inspection();
+    int count;
+    char path[32];
+    _find_logs("LJR", &count, path, sizeof(path));
+    TEST_ASSERT_EQUAL(1, count);
+    FIL file;
+    TEST_ASSERT_EQUAL(FR_OK, f_open(&file, path, FA_OPEN_APPEND | FA_WRITE));
+    FSIZE_t valid_size = f_size(&file);
+    const uint8_t torn[] = { LOG_JOURNAL_MAGIC, LOG_JOURNAL_TYPE_TEXT, 0x20, 0x00, 0x12, 0x34 };
+    UINT bytes_written = 0;
+    TEST_ASSERT_EQUAL(FR_OK, f_write(&file, torn, sizeof(torn), &bytes_written));
+    f_close(&file);
+    _unmount_inspection();
+
+    // 재마운트 시 마지막 저널 파일 복구
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    SDStorage_Disconnect();
+
+    _mount_for_inspection();
+    FILINFO info;
+    TEST_ASSERT_EQUAL(FR_OK, f_stat(path, &info));
+    TEST_ASSERT_EQUAL(valid_size, info.fsize);
+    TEST_ASSERT_EQUAL(4 * LOG_JOURNAL_OVERHEAD + LOG_JOURNAL_FILE_HEADER_PAYLOAD + 3 * 18, info.fsize);
+    _unmount_inspection();
+}
+
+// 저널 파일의 유효 레코드를 앞에서부터 디코딩해 TEXT 레코드 본문을 "|"로 이어 붙임
+static uint32_t _read_journal_text(const char* path, char* text, size_t max_len)
+{
+    static uint8_t content[8192];
+    UINT bytes_read = 0;
+    _read_file(path, (char*)content, sizeof(content), &bytes_read);
+
+    uint32_t records = 0;
+    size_t offset = 0;
+    text[0] = '\0';
+    LogJournalRecord rec;
+    int size;
+    while ((size = LogJournal_Decode(LogJournal_Crc32, &content[offset], bytes_read - offset, &rec)) > 0) {
+        TEST_ASSERT_EQUAL(records, rec.seq);
+        if (rec.type == LOG_JOURNAL_TYPE_TEXT) {
+            strncat(text, (const char*)rec.payload, rec.length < max_len - strlen(text) - 2 ? rec.length : 0);
+            strcat(text, "|");
+        }
+        records++;
+        offset += (size_t)size;
+    }
+    TEST_ASSERT_EQUAL(bytes_read, offset);
+    return records;
+}
+
+void test_Journal_WriteErrorKeepsLaterRecordsAcrossReboot(void)
+{
+    g_config.journal_enabled = true;
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_lines(2, "before");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+
+    // write-behind 버퍼를 내려쓰는 f_write 실패: 버퍼의 레코드(seq 이미 사용)를 잃고 파일을 다시 엶
+    SDImage_FailAfter(SD_IMAGE_OP_WRITE, 0, 1);
+    char lost[100];
+    memset(lost, 'x', sizeof(lost));
+    int writes = 0;
+    while (SDStorage_WriteLog(lost, sizeof(lost)) == SDSTORAGE_OK) {
+        TEST_ASSERT_LESS_THAN(SD_WRITE_BEHIND_SIZE / 100 + 2, ++writes);
+    }
+
+    _write_lines(2, "after");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+    SDStorage_Disconnect();
+
+    // 재부팅 복구가 "after" 레코드를 잘라내지 않아야 함
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    SDStorage_Disconnect();
+
+    _mount_for_inspection();
+    int count;
+    char path[32];
+    _find_logs("LJR", &count, path, sizeof(path));
+    TEST_ASSERT_EQUAL(1, count);
+    char text[256];
+    TEST_ASSERT_EQUAL(5, _read_journal_text(path, text, sizeof(text)));
+    TEST_ASSERT_EQUAL_STRING("before|before|after|after|", text);
+    _unmount_inspection();
+}
+
+void test_WriteBinaryV_WritesJournalBinaryRecordOnly(void)
+{
+    static const uint8_t header[4] = { 0xB1, 0x02, 0x03, 0x00 };
+    SDStorageChunk chunks[] = { { header, sizeof(header) }, { "abc", 3 } };
+
+    // 텍스트 파일에는 바이너리 레코드를 넣지 않음
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    TEST_ASSERT_EQUAL(RESULT_ERROR_NOT_SUPPORTED, SDStorage_WriteBinaryV(chunks, 2));
+    _write_lines(1, "text");
+    SDStorage_Disconnect();
+
+    g_config.journal_enabled = true;
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_lines(1, "before");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_WriteBinaryV(chunks, 2));
+    _write_lines(1, "after");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+    SDStorage_Disconnect();
+
+    _mount_for_inspection();
+    int count;
+    char path[32];
+    _find_logs("LJR", &count, path, sizeof(path));
+    char text[64];
+    TEST_ASSERT_EQUAL(4, _read_journal_text(path, text, sizeof(text)));
+    TEST_ASSERT_EQUAL_STRING("before|after|", text);
+
+    // 두 번째 레코드(헤더 다음)가 조각을 이은 BINARY 레코드
+    static uint8_t content[512];
+    UINT bytes_read = 0;
+    _read_file(path, (char*)content, sizeof(content), &bytes_read);
+    LogJournalRecord rec;
+    int offset = LogJournal_Decode(LogJournal_Crc32, content, bytes_read, &rec);
+    offset += LogJournal_Decode(LogJournal_Crc32, &content[offset], bytes_read - (UINT)offset, &rec);
+    TEST_ASSERT_GREATER_THAN(0, LogJournal_Decode(LogJournal_Crc32, &content[offset], bytes_read - (UINT)offset, &rec));
+    TEST_ASSERT_EQUAL(LOG_JOURNAL_TYPE_BINARY, rec.type);
+    TEST_ASSERT_EQUAL(7, rec.length);
+    TEST_ASSERT_EQUAL_MEMORY("\xB1\x02\x03\x00" "abc", rec.payload, 7);
+    _unmount_inspection();
+}
+
+// ----------------------------------------------------------------------------
+// 다음 파일 번호 매니페스트 (LOGINDEX.BIN: 512B 섹터마다 슬롯 1개)
+// ----------------------------------------------------------------------------
+
+// SDStorage.c의 LogIndexSlot과 같은 배치
+typedef struct {
+    uint32_t magic;
+    uint32_t sequence;
+    uint32_t next_number;
+    uint32_t next_number_inv;
+} TestIndexSlot;
+
+#define TEST_INDEX_MAGIC  0x5844494CUL  // "LIDX"
+
+// 포맷된 카드에 매니페스트 두 슬롯과 기존 로그 파일(names)을 만들어 둠
+static void _prepare_card(const TestIndexSlot* slots, const char* const* names, int name_count)
+{
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    SDStorage_Disconnect();
+
+    _mount_for_inspection();
+    FIL file;
+    UINT bytes_written = 0;
+    if (slots != NULL) {
+        TEST_ASSERT_EQUAL(FR_OK, f_open(&file, "LOGINDEX.BIN", FA_CREATE_ALWAYS | FA_WRITE));
+        for (int i = 0; i < 2; i++) {
+            TEST_ASSERT_EQUAL(FR_OK, f_lseek(&file, (FSIZE_t)i * 512));
+            TEST_ASSERT_EQUAL(FR_OK, f_write(&file, &slots[i], sizeof(slots[i]), &bytes_written));
+        }
+        f_close(&file);
+    }
+    for (int i = 0; i < name_count; i++) {
+        TEST_ASSERT_EQUAL(FR_OK, f_open(&file, names[i], FA_CREATE_ALWAYS | FA_WRITE));
+        f_close(&file);
+    }
+    _unmount_inspection();
+}
+
+// 다시 마운트해 한 줄 기록 후 생성된 파일 확인
+static void _assert_next_log_file(const char* expected)
+{
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_lines(1, "[INFO] boot");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+    SDStorage_Disconnect();
+
+    _mount_for_inspection();
+    FILINFO info;
+    TEST_ASSERT_EQUAL(FR_OK, f_stat(expected, &info));
+    TEST_ASSERT_EQUAL(13, info.fsize);
+    _unmount_inspection();
+}
+
+void test_Manifest_UsesSlotWithHighestSequence(void)
+{
+    const TestIndexSlot slots[2] = {
+        { TEST_INDEX_MAGIC, 6, 12, ~12U },
+        { TEST_INDEX_MAGIC, 5, 7, ~7U },
+    };
+    _prepare_card(slots, NULL, 0);
+
+    _assert_next_log_file("LORA0012.TXT");
+}
+
+void test_Manifest_IgnoresTornSlot(void)
+{
+    // 최신 슬롯 기록 도중 전원 차단: next_number와 반전값 불일치
+    const TestIndexSlot slots[2] = {
+        { TEST_INDEX_MAGIC, 5, 7, ~7U },
+        { TEST_INDEX_MAGIC, 6, 12, ~0U },
+    };
+    _prepare_card(slots, NULL, 0);
+
+    _assert_next_log_file("LORA0007.TXT");
+}
+
+void test_Manifest_FallsBackToScanWhenMissing(void)
+{
+    const char* const names[] = { "LORA0003.TXT", "LORA0009.LJR", "LORA0005.LZL" };
+    _prepare_card(NULL, names, 3);
+
+    _assert_next_log_file("LORA0010.TXT");
+}
+
+void test_Manifest_FallsBackToScanWhenNumberAlreadyUsed(void)
+{
+    // 파일 생성 후 매니페스트 갱신 전에 전원 차단: 매니페스트 번호의 파일이 이미 존재
+    const TestIndexSlot slots[2] = {
+        { TEST_INDEX_MAGIC, 4, 4, ~4U },
+        { TEST_INDEX_MAGIC, 3, 3, ~3U },
+    };
+    const char* const names[] = { "LORA0003.TXT", "LORA0004.LZL" };
+    _prepare_card(slots, names, 2);
+
+    _assert_next_log_file("LORA0005.TXT");
+}
+
+void test_Journal_ReopenTruncatesTornTailAndContinuesSeq(void)
+{
+    g_config.journal_enabled = true;
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    _write_lines(1, "first");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+
+    // 재초기화: 파일을 닫고 이름은 유지 -> 다음 쓰기에서 이어쓰기로 다시 엶
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+    int count;
+    char path[32];
+    _find_logs("LJR", &count, path, sizeof(path));
+    TEST_ASSERT_EQUAL(1, count);
+
+    // 그 사이 파일 끝에 찢어진 레코드가 남은 상태
+    FIL file;
+    TEST_ASSERT_EQUAL(FR_OK, f_open(&file, path, FA_OPEN_APPEND | FA_WRITE));
+    const uint8_t torn[] = { LOG_JOURNAL_MAGIC, LOG_JOURNAL_TYPE_TEXT, 0x20, 0x00 };
+    UINT bytes_written = 0;
+    TEST_ASSERT_EQUAL(FR_OK, f_write(&file, torn, sizeof(torn), &bytes_written));
+    f_close(&file);
+
+    _write_lines(1, "second");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+    SDStorage_Disconnect();
+
+    // 찢어진 꼬리를 잘라낸 뒤 같은 file_tag/seq로 이어씀 (파일 끝까지 모두 유효)
+    _mount_for_inspection();
+    char text[128];
+    TEST_ASSERT_EQUAL(3, _read_journal_text(path, text, sizeof(text)));
+    TEST_ASSERT_EQUAL_STRING("first|second|", text);
+    _unmount_inspection();
+}
+
+void test_Spill_WritesAtOffsetReadsBackAndClears(void)
+{
+    uint8_t data[600];
+    uint8_t buf[1024];
+    size_t read_len = 0;
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 3);
+    }
+
+    TEST_ASSERT_EQUAL(SDSTORAGE_NOT_READY, SDStorage_SpillWrite(0, data, sizeof(data)));
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Init());
+
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_SpillWrite(0, data, 400));
+    // 쓰기 실패 후 같은 위치를 덮어쓰는 경우 재현
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_SpillWrite(400, "junk", 4));
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_SpillWrite(400, &data[400], 200));
+
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_SpillRead(0, buf, sizeof(buf), &read_len));
+    TEST_ASSERT_EQUAL(sizeof(data), read_len);
+    TEST_ASSERT_EQUAL_MEMORY(data, buf, sizeof(data));
+
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_SpillRead(550, buf, sizeof(buf), &read_len));
+    TEST_ASSERT_EQUAL(50, read_len);
+    TEST_ASSERT_EQUAL_MEMORY(&data[550], buf, 50);
+
+    // 로그 파일과 별개
+    _write_lines(2, "[INFO] uplink sent");
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_SpillClear());
+    TEST_ASSERT_EQUAL(SDSTORAGE_FILE_ERROR, SDStorage_SpillRead(0, buf, sizeof(buf), &read_len));
+    TEST_ASSERT_EQUAL(0, read_len);
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_SpillClear());
+    TEST_ASSERT_EQUAL(SDSTORAGE_OK, SDStorage_Flush());
+    SDStorage_Disconnect();
+
+    _mount_for_inspection();
+    int count;
+    char path[32];
+    _find_logs("TXT", &count, path, sizeof(path));
+    TEST_ASSERT_EQUAL(1, count);
+    _unmount_inspection();
+}
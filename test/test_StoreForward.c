@@ -0,0 +1,241 @@
+#include "unity.h"
+#include "StoreForward.h"
+#include <string.h>
+
+static StoreForward sf;
+
+// RAM 위의 spill 파일 흉내
+static uint8_t spill_file[64 * 1024];
+static size_t spill_size;
+static int spill_write_result;
+static int spill_clears;
+
+static int _spill_write(uint32_t offset, const void* data, size_t size)
+{
+    if (spill_write_result != 0 || offset + size > sizeof(spill_file)) {
+        return -1;
+    }
+    memcpy(&spill_file[offset], data, size);
+    if (offset + size > spill_size) {
+        spill_size = offset + size;
+    }
+    return 0;
+}
+
+static int _spill_read(uint32_t offset, void* buf, size_t size, size_t* read_len)
+{
+    size_t available = (offset < spill_size) ? spill_size - offset : 0;
+    *read_len = (size < available) ? size : available;
+    memcpy(buf, &spill_file[offset], *read_len);
+    return 0;
+}
+
+static int _spill_clear(void)
+{
+    spill_size = 0;
+    spill_clears++;
+    return 0;
+}
+
+static const StoreForwardSpill spill = { _spill_write, _spill_read, _spill_clear };
+
+// 재전송받은 패킷 (첫 4바이트 = 순번)
+static uint32_t replayed_ids[2048];
+static int replayed_count;
+static int sink_result;
+
+static int _sink(const void* data, size_t size)
+{
+    if (sink_result != 0) {
+        return sink_result;
+    }
+    uint32_t id;
+    if (size < sizeof(id)) {
+        return -1;
+    }
+    memcpy(&id, data, sizeof(id));
+    replayed_ids[replayed_count++] = id;
+    return 0;
+}
+
+static void _store(uint32_t id, size_t size)
+{
+    uint8_t packet[STORE_FORWARD_MAX_PACKET];
+    memset(packet, (int)(id & 0xFF), size);
+    memcpy(packet, &id, sizeof(id));
+    TEST_ASSERT_EQUAL(STORE_FORWARD_OK, StoreForward_Store(&sf, packet, size));
+}
+
+// 속도 제한을 넘길 만큼 시간을 보내며 전부 재전송
+static void _drain_all(void)
+{
+    uint32_t now = 0;
+    for (int i = 0; i < 1000 && !StoreForward_IsEmpty(&sf); i++) {
+        StoreForward_Drain(&sf, _sink, now);
+        now += 1000;
+    }
+}
+
+void setUp(void)
+{
+    memset(spill_file, 0, sizeof(spill_file));
+    spill_size = 0;
+    spill_write_result = 0;
+    spill_clears = 0;
+    replayed_count = 0;
+    sink_result = 0;
+    StoreForward_Init(&sf, &spill, 0);
+}
+
+void tearDown(void)
+{
+}
+
+void test_StoreForward_ReplaysRamPacketsInOrder(void)
+{
+    for (uint32_t i = 0; i < 10; i++) {
+        _store(i, 50);
+    }
+    TEST_ASSERT_FALSE(StoreForward_IsEmpty(&sf));
+
+    TEST_ASSERT_EQUAL(10, StoreForward_Drain(&sf, _sink, 0));
+    TEST_ASSERT_TRUE(StoreForward_IsEmpty(&sf));
+    for (int i = 0; i < 10; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i, replayed_ids[i]);
+    }
+    TEST_ASSERT_EQUAL(0, spill_size);
+}
+
+void test_StoreForward_SpillsFullRamRingAndReplaysSpillFirst(void)
+{
+    // 500B 패킷 100개 = 50KB -> 16KB RAM 링이 여러 번 spill됨
+    for (uint32_t i = 0; i < 100; i++) {
+        _store(i, 500);
+    }
+
+    StoreForwardStats stats;
+    StoreForward_GetStats(&sf, &stats);
+    TEST_ASSERT_EQUAL_UINT32(100, stats.stored);
+    TEST_ASSERT_TRUE(stats.spilled > 0);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.dropped);
+    TEST_ASSERT_EQUAL_UINT32(100 * (500 + STORE_FORWARD_RECORD_PREFIX), stats.ram_bytes + stats.spill_bytes);
+
+    _drain_all();
+    TEST_ASSERT_EQUAL(100, replayed_count);
+    for (int i = 0; i < 100; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i, replayed_ids[i]);
+    }
+
+    // 다 보낸 spill 파일은 삭제
+    StoreForward_GetStats(&sf, &stats);
+    TEST_ASSERT_EQUAL_UINT32(100, stats.replayed);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.spill_bytes);
+    TEST_ASSERT_EQUAL(1, spill_clears);
+}
+
+void test_StoreForward_KeepsOrderWhenStoringDuringReplay(void)
+{
+    for (uint32_t i = 0; i < 40; i++) {
+        _store(i, 500);
+    }
+    StoreForward_Drain(&sf, _sink, 0);
+    TEST_ASSERT_TRUE(replayed_count > 0 && replayed_count < 40);
+
+    for (uint32_t i = 40; i < 80; i++) {
+        _store(i, 500);
+    }
+    _drain_all();
+
+    TEST_ASSERT_EQUAL(80, replayed_count);
+    for (int i = 0; i < 80; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i, replayed_ids[i]);
+    }
+}
+
+void test_StoreForward_DrainIsRateLimited(void)
+{
+    StoreForward_Init(&sf, &spill, 1000);      // 1000 B/s, burst 2KB
+    for (uint32_t i = 0; i < 30; i++) {
+        _store(i, 100);
+    }
+
+    // 처음에는 burst만큼 (2048B -> 100B 패킷 20개)
+    TEST_ASSERT_EQUAL(20, StoreForward_Drain(&sf, _sink, 0));
+    TEST_ASSERT_EQUAL(0, StoreForward_Drain(&sf, _sink, 50));
+
+    // 0.5초 -> 500B -> 5개 (잔여 48B 포함)
+    TEST_ASSERT_EQUAL(5, StoreForward_Drain(&sf, _sink, 500));
+    TEST_ASSERT_EQUAL(5, StoreForward_Drain(&sf, _sink, 1000));
+    TEST_ASSERT_TRUE(StoreForward_IsEmpty(&sf));
+}
+
+void test_StoreForward_SinkFailureKeepsPacketForNextDrain(void)
+{
+    _store(7, 40);
+    sink_result = -5;
+    TEST_ASSERT_EQUAL(0, StoreForward_Drain(&sf, _sink, 0));
+    TEST_ASSERT_FALSE(StoreForward_IsEmpty(&sf));
+
+    sink_result = 0;
+    TEST_ASSERT_EQUAL(1, StoreForward_Drain(&sf, _sink, 10));
+    TEST_ASSERT_EQUAL_UINT32(7, replayed_ids[0]);
+}
+
+void test_StoreForward_DropsOldestWhenSpillFails(void)
+{
+    spill_write_result = -1;
+    // 1000B 패킷은 prefix 포함 1002B - 16KB 링에 16개까지
+    for (uint32_t i = 0; i < 20; i++) {
+        _store(i, 1000);
+    }
+
+    StoreForwardStats stats;
+    StoreForward_GetStats(&sf, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.spilled);
+    TEST_ASSERT_TRUE(stats.spill_errors > 0);
+    TEST_ASSERT_EQUAL_UINT32(20 - stats.dropped, 16384 / 1002);
+
+    _drain_all();
+    TEST_ASSERT_EQUAL_UINT32(stats.dropped, replayed_ids[0]);      // 가장 오래된 것부터 버림
+    TEST_ASSERT_EQUAL_UINT32(19, replayed_ids[replayed_count - 1]);
+}
+
+void test_StoreForward_WithoutSpillUsesRamOnly(void)
+{
+    StoreForward_Init(&sf, NULL, 0);
+    for (uint32_t i = 0; i < 40; i++) {
+        _store(i, 1000);
+    }
+
+    StoreForwardStats stats;
+    StoreForward_GetStats(&sf, &stats);
+    TEST_ASSERT_EQUAL_UINT32(40, stats.stored);
+    TEST_ASSERT_EQUAL_UINT32(40 - 16, stats.dropped);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.spill_errors);
+}
+
+void test_StoreForward_RejectsOversizedPacket(void)
+{
+    static uint8_t packet[STORE_FORWARD_MAX_PACKET + 1];
+    TEST_ASSERT_EQUAL(STORE_FORWARD_ERROR, StoreForward_Store(&sf, packet, sizeof(packet)));
+    TEST_ASSERT_EQUAL(STORE_FORWARD_ERROR, StoreForward_Store(&sf, packet, 0));
+    TEST_ASSERT_TRUE(StoreForward_IsEmpty(&sf));
+}
+
+void test_StoreForward_CorruptSpillIsDiscarded(void)
+{
+    for (uint32_t i = 0; i < 40; i++) {
+        _store(i, 500);
+    }
+    spill_file[0] = 0xFF;       // 첫 레코드 길이 손상 (65535 > 최대 패킷)
+    spill_file[1] = 0xFF;
+
+    _drain_all();
+
+    StoreForwardStats stats;
+    StoreForward_GetStats(&sf, &stats);
+    TEST_ASSERT_EQUAL_UINT32(stats.spilled, stats.dropped);
+    TEST_ASSERT_EQUAL_UINT32(40 - stats.spilled, stats.replayed);
+    TEST_ASSERT_EQUAL_UINT32(stats.spilled, replayed_ids[0]);
+    TEST_ASSERT_TRUE(StoreForward_IsEmpty(&sf));
+}
@@ -0,0 +1,458 @@
+#ifdef TEST
+
+#include "unity.h"
+#include <string.h>
+
+// 타겟 로거(싱크 레지스트리)를 직접 포함 - 호스트 src/logger.c와 이름이 겹치므로 링크하지 않음
+#include "../lora_tester_stm32/Core/Src/logger/src/logger.c"
+#include "../src/time_common.c"
+#include "../src/time_mock.c"
+
+// ============================================================================
+// 플랫폼/SD 서비스 스텁
+// ============================================================================
+
+static char platform_last[LOGGER_MAX_MESSAGE_SIZE];
+static int platform_send_count = 0;
+
+LoggerStatus LOGGER_Platform_Send(const char* message)
+{
+    strncpy(platform_last, message, sizeof(platform_last) - 1);
+    platform_send_count++;
+    return LOGGER_STATUS_OK;
+}
+
+LoggerStatus LOGGER_Platform_Connect(const char* server_ip, int port)
+{
+    (void)server_ip; (void)port;
+    return LOGGER_STATUS_OK;
+}
+
+LoggerStatus LOGGER_Platform_Disconnect(void)
+{
+    return LOGGER_STATUS_OK;
+}
+
+static bool sd_ready = false;
+static ResultCode sd_append_result = RESULT_SUCCESS;
+static size_t sd_append_len = 0;
+
+bool SDService_IsReady(void)
+{
+    return sd_ready;
+}
+
+ResultCode SDService_Append(const void* data, size_t size)
+{
+    (void)data;
+    sd_append_len = size;
+    return sd_append_result;
+}
+
+static ResultCode sd_binary_result = RESULT_SUCCESS;
+static uint8_t sd_binary_data[LOGGER_MAX_MESSAGE_SIZE];
+static size_t sd_binary_len = 0;
+
+ResultCode SDService_AppendBinary(const void* data, size_t size)
+{
+    sd_binary_len = size;
+    if (size <= sizeof(sd_binary_data)) {
+        memcpy(sd_binary_data, data, size);
+    }
+    return sd_binary_result;
+}
+
+const char* ErrorCode_ToString(ResultCode code)
+{
+    (void)code;
+    return "stub";
+}
+
+// ============================================================================
+// 테스트용 싱크 writer
+// ============================================================================
+
+static int writer_calls = 0;
+static int writer_full_count = 0;   // 처음 N번은 BUFFER_FULL 반환 (-1이면 계속)
+static LogLevel writer_last_level = LOG_LEVEL_DEBUG;
+static char writer_last[LOGGER_MAX_MESSAGE_SIZE];
+
+static LoggerStatus _test_writer(const LogRecord* record, const uint8_t* data, size_t len)
+{
+    writer_calls++;
+    writer_last_level = record->level;
+    if (data != NULL && len < sizeof(writer_last)) {
+        memcpy(writer_last, data, len);
+        writer_last[len] = '\0';
+    }
+    if (writer_full_count < 0) {
+        return LOGGER_STATUS_BUFFER_FULL;
+    }
+    if (writer_full_count > 0) {
+        writer_full_count--;
+        return LOGGER_STATUS_BUFFER_FULL;
+    }
+    return LOGGER_STATUS_OK;
+}
+
+static void _configure_test_sink(LogSinkId id, LogEncoder encoder, LogLevel min_level,
+                                 LogBackpressure backpressure)
+{
+    LogSinkConfig config = {
+        .enabled = true,
+        .min_level = min_level,
+        .encoder = encoder,
+        .backpressure = backpressure,
+        .write = _test_writer
+    };
+    TEST_ASSERT_EQUAL(LOGGER_STATUS_OK, LOGGER_ConfigureSink(id, &config));
+}
+
+static LogSinkSlot default_sinks[LOG_SINK_COUNT];
+static bool defaults_saved = false;
+
+void setUp(void)
+{
+    // 정적 상태를 초기 설정으로 복원
+    if (!defaults_saved) {
+        memcpy(default_sinks, sinks, sizeof(sinks));
+        defaults_saved = true;
+    }
+    memcpy(sinks, default_sinks, sizeof(sinks));
+    memset(crash_ring, 0, sizeof(crash_ring));
+    crash_ring_head = 0;
+    crash_ring_wrapped = false;
+
+    LOGGER_SetFilterLevel(LOG_LEVEL_DEBUG);
+    current_config.level = LOG_LEVEL_DEBUG;
+    time_base_valid = false;
+    sd_logging_enabled = false;
+
+    platform_send_count = 0;
+    platform_last[0] = '\0';
+    sd_ready = false;
+    sd_append_result = RESULT_SUCCESS;
+    sd_append_len = 0;
+    sd_binary_result = RESULT_SUCCESS;
+    sd_binary_len = 0;
+    writer_calls = 0;
+    writer_full_count = 0;
+    writer_last[0] = '\0';
+    TIME_Mock_Reset();
+}
+
+void tearDown(void)
+{
+}
+
+// ============================================================================
+// 활성화/레벨 필터
+// ============================================================================
+
+void test_sink_should_receive_records_at_or_above_min_level(void)
+{
+    _configure_test_sink(LOG_SINK_TERMINAL, LOG_ENCODER_RECORD, LOG_LEVEL_WARN, LOG_BACKPRESSURE_DROP_NEWEST);
+
+    LOG_INFO("below");
+    TEST_ASSERT_EQUAL(0, writer_calls);
+
+    LOG_WARN("at");
+    LOG_ERROR("above");
+    TEST_ASSERT_EQUAL(2, writer_calls);
+    TEST_ASSERT_EQUAL(LOG_LEVEL_ERROR, writer_last_level);
+
+    LogSinkStats stats;
+    LOGGER_GetSinkStats(LOG_SINK_TERMINAL, &stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.written);
+}
+
+void test_disabled_sink_should_not_receive_records(void)
+{
+    _configure_test_sink(LOG_SINK_TERMINAL, LOG_ENCODER_RECORD, LOG_LEVEL_DEBUG, LOG_BACKPRESSURE_DROP_NEWEST);
+    LOGGER_EnableSink(LOG_SINK_TERMINAL, false);
+
+    LOG_ERROR("ignored");
+    TEST_ASSERT_EQUAL(0, writer_calls);
+
+    LOGGER_EnableSink(LOG_SINK_TERMINAL, true);
+    LOG_ERROR("delivered");
+    TEST_ASSERT_EQUAL(1, writer_calls);
+}
+
+void test_SetSinkLevel_should_change_filter_of_one_sink_only(void)
+{
+    LOGGER_SetSinkLevel(LOG_SINK_TERMINAL, LOG_LEVEL_ERROR);
+
+    LOG_WARN("terminal filtered");
+    TEST_ASSERT_EQUAL(0, platform_send_count);
+
+    // 크래시 링은 DEBUG 그대로
+    char dump[LOGGER_CRASH_RING_SIZE + 1];
+    LOGGER_CrashRing_Snapshot(dump, sizeof(dump));
+    TEST_ASSERT_NOT_NULL(strstr(dump, "[WARN] terminal filtered"));
+}
+
+void test_ConfigureSink_should_reject_invalid_params(void)
+{
+    LogSinkConfig config = { .enabled = true, .encoder = LOG_ENCODER_COUNT };
+    TEST_ASSERT_EQUAL(RESULT_ERROR_INVALID_PARAM, LOGGER_ConfigureSink(LOG_SINK_TERMINAL, &config));
+    TEST_ASSERT_EQUAL(RESULT_ERROR_INVALID_PARAM, LOGGER_ConfigureSink(LOG_SINK_COUNT, &config));
+    TEST_ASSERT_EQUAL(RESULT_ERROR_INVALID_PARAM, LOGGER_ConfigureSink(LOG_SINK_TERMINAL, NULL));
+}
+
+void test_text_sinks_should_share_one_encoding(void)
+{
+    _configure_test_sink(LOG_SINK_SD_BINARY, LOG_ENCODER_TEXT, LOG_LEVEL_DEBUG, LOG_BACKPRESSURE_DROP_NEWEST);
+    sd_logging_enabled = true;
+
+    LOG_INFO("value=%d", 42);
+
+    TEST_ASSERT_EQUAL_STRING("[INFO] value=42", platform_last);
+    TEST_ASSERT_EQUAL_STRING("[INFO] value=42", writer_last);
+}
+
+// ============================================================================
+// Backpressure
+// ============================================================================
+
+void test_drop_newest_should_count_dropped_without_retry(void)
+{
+    _configure_test_sink(LOG_SINK_TERMINAL, LOG_ENCODER_RECORD, LOG_LEVEL_DEBUG, LOG_BACKPRESSURE_DROP_NEWEST);
+    writer_full_count = -1;
+
+    LOG_ERROR("full");
+
+    LogSinkStats stats;
+    LOGGER_GetSinkStats(LOG_SINK_TERMINAL, &stats);
+    TEST_ASSERT_EQUAL(1, writer_calls);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.dropped);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.written);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.errors);
+}
+
+void test_block_should_retry_until_sink_accepts(void)
+{
+    _configure_test_sink(LOG_SINK_TERMINAL, LOG_ENCODER_RECORD, LOG_LEVEL_DEBUG, LOG_BACKPRESSURE_BLOCK);
+    writer_full_count = 3;
+
+    LOG_ERROR("retry");
+
+    LogSinkStats stats;
+    LOGGER_GetSinkStats(LOG_SINK_TERMINAL, &stats);
+    TEST_ASSERT_EQUAL(4, writer_calls);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.written);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.dropped);
+}
+
+void test_block_should_drop_after_timeout(void)
+{
+    _configure_test_sink(LOG_SINK_TERMINAL, LOG_ENCODER_RECORD, LOG_LEVEL_DEBUG, LOG_BACKPRESSURE_BLOCK);
+    writer_full_count = -1;
+
+    LOG_ERROR("stuck");
+
+    LogSinkStats stats;
+    LOGGER_GetSinkStats(LOG_SINK_TERMINAL, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.dropped);
+    TEST_ASSERT_TRUE(TIME_GetCurrentMs() >= LOGGER_SINK_BLOCK_TIMEOUT_MS);
+    TEST_ASSERT_TRUE(writer_calls > 1);
+}
+
+void test_sd_sink_should_be_skipped_until_sd_logging_enabled(void)
+{
+    _configure_test_sink(LOG_SINK_SD_BINARY, LOG_ENCODER_BINARY, LOG_LEVEL_DEBUG, LOG_BACKPRESSURE_DROP_NEWEST);
+
+    LOG_ERROR("before");
+    TEST_ASSERT_EQUAL(0, writer_calls);
+
+    LogSinkStats stats;
+    LOGGER_GetSinkStats(LOG_SINK_SD_BINARY, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.skipped);
+}
+
+// ============================================================================
+// SD 텍스트 싱크
+// ============================================================================
+
+static void _enable_sd_text(void)
+{
+    sd_ready = true;
+    sd_logging_enabled = true;
+    LOGGER_EnableSink(LOG_SINK_SD_TEXT, true);
+}
+
+void test_sd_text_should_pass_long_lines_whole(void)
+{
+    _enable_sd_text();
+    char body[600];
+    memset(body, 'x', sizeof(body) - 1);
+    body[sizeof(body) - 1] = '\0';
+
+    LOG_WARN("%s", body);
+
+    // 요청 슬롯보다 길어도 잘리지 않음 (SD 서비스가 나눠 넣음)
+    TEST_ASSERT_EQUAL(strlen("[WARN] ") + strlen(body), sd_append_len);
+}
+
+void test_sd_text_full_queue_should_count_dropped_without_terminal_error(void)
+{
+    _enable_sd_text();
+    sd_append_result = RESULT_ERROR_BUSY;
+
+    LOG_WARN("queue full");
+
+    LogSinkStats stats;
+    LOGGER_GetSinkStats(LOG_SINK_SD_TEXT, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.dropped);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.errors);
+    // 터미널에는 원래 로그만, "[SD_ERROR]" 없음
+    TEST_ASSERT_EQUAL(1, platform_send_count);
+    TEST_ASSERT_EQUAL_STRING("[WARN] queue full", platform_last);
+}
+
+void test_sd_text_write_error_should_be_reported_on_terminal(void)
+{
+    _enable_sd_text();
+    sd_append_result = SDSTORAGE_FILE_ERROR;
+
+    LOG_WARN("disk error");
+
+    LogSinkStats stats;
+    LOGGER_GetSinkStats(LOG_SINK_SD_TEXT, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.errors);
+    TEST_ASSERT_EQUAL(2, platform_send_count);
+    TEST_ASSERT_NOT_NULL(strstr(platform_last, "[SD_ERROR] Write failed"));
+}
+
+// ============================================================================
+// SD 바이너리 싱크 (기본 writer: SD 서비스 바이너리 레코드)
+// ============================================================================
+
+static void _enable_sd_binary(void)
+{
+    sd_ready = true;
+    sd_logging_enabled = true;
+    LOGGER_EnableSink(LOG_SINK_SD_BINARY, true);
+}
+
+void test_sd_binary_should_queue_header_and_body_as_one_record(void)
+{
+    _enable_sd_binary();
+    TIME_Mock_SetCurrentTime(1234);
+
+    LOG_WARN("bin %d", 7);
+
+    TEST_ASSERT_EQUAL(sizeof(LogBinaryHeader) + 5, sd_binary_len);
+    LogBinaryHeader header;
+    memcpy(&header, sd_binary_data, sizeof(header));
+    TEST_ASSERT_EQUAL_HEX8(LOGGER_BINARY_MAGIC, header.magic);
+    TEST_ASSERT_EQUAL(LOG_LEVEL_WARN, header.level);
+    TEST_ASSERT_EQUAL(5, header.message_len);
+    TEST_ASSERT_EQUAL_UINT32(1234, header.tick_ms);
+    TEST_ASSERT_EQUAL_MEMORY("bin 7", &sd_binary_data[sizeof(header)], 5);
+
+    LogSinkStats stats;
+    LOGGER_GetSinkStats(LOG_SINK_SD_BINARY, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.written);
+}
+
+void test_sd_binary_full_queue_should_count_dropped(void)
+{
+    _enable_sd_binary();
+    sd_binary_result = RESULT_ERROR_BUSY;
+
+    LOG_ERROR("dropped");
+
+    LogSinkStats stats;
+    LOGGER_GetSinkStats(LOG_SINK_SD_BINARY, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.dropped);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.errors);
+}
+
+void test_sd_binary_should_skip_when_card_not_mounted(void)
+{
+    _enable_sd_binary();
+    sd_ready = false;
+
+    LOG_ERROR("no card");
+
+    LogSinkStats stats;
+    LOGGER_GetSinkStats(LOG_SINK_SD_BINARY, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.skipped);
+    TEST_ASSERT_EQUAL(0, sd_binary_len);
+}
+
+// ============================================================================
+// LOGGER_Send (prefix 없는 원문)
+// ============================================================================
+
+void test_Send_should_use_same_level_for_filter_and_record(void)
+{
+    LOGGER_SetSinkWriter(LOG_SINK_TERMINAL, _test_writer);
+    LOGGER_SetSinkLevel(LOG_SINK_TERMINAL, LOG_LEVEL_ERROR);
+
+    TEST_ASSERT_EQUAL(LOGGER_STATUS_OK, LOGGER_Send("raw line"));
+
+    TEST_ASSERT_EQUAL(1, writer_calls);
+    TEST_ASSERT_EQUAL(LOG_LEVEL_ERROR, writer_last_level);
+    TEST_ASSERT_EQUAL_STRING("raw line", writer_last);
+}
+
+void test_Send_should_fail_when_only_crash_ring_receives(void)
+{
+    LOGGER_EnableSink(LOG_SINK_TERMINAL, false);
+
+    TEST_ASSERT_EQUAL(LOGGER_STATUS_ERROR, LOGGER_Send("nowhere"));
+
+    char dump[64];
+    LOGGER_CrashRing_Snapshot(dump, sizeof(dump));
+    TEST_ASSERT_EQUAL_STRING("nowhere\n", dump);
+}
+
+// ============================================================================
+// 크래시 링
+// ============================================================================
+
+void test_crash_ring_should_dump_lines_in_order(void)
+{
+    LOG_INFO("first");
+    LOG_WARN("second");
+
+    char dump[128];
+    size_t len = LOGGER_CrashRing_Snapshot(dump, sizeof(dump));
+
+    TEST_ASSERT_EQUAL_STRING("[INFO] first\n[WARN] second\n", dump);
+    TEST_ASSERT_EQUAL(strlen(dump), len);
+}
+
+void test_crash_ring_should_keep_newest_after_wrap(void)
+{
+    char line[64];
+    for (int i = 0; i < 300; i++) {
+        snprintf(line, sizeof(line), "line %03d", i);
+        LOGGER_Send(line);
+    }
+
+    char dump[LOGGER_CRASH_RING_SIZE + 1];
+    size_t len = LOGGER_CrashRing_Snapshot(dump, sizeof(dump));
+
+    TEST_ASSERT_EQUAL(LOGGER_CRASH_RING_SIZE, len);
+    TEST_ASSERT_NOT_NULL(strstr(dump, "line 299\n"));
+    TEST_ASSERT_NULL(strstr(dump, "line 000\n"));
+    // 끝은 가장 최근 줄
+    TEST_ASSERT_EQUAL_STRING("line 299\n", dump + len - 9);
+}
+
+void test_crash_ring_snapshot_should_prefer_newest_when_buffer_small(void)
+{
+    LOGGER_Send("old");
+    LOGGER_Send("new");
+
+    char dump[5];
+    size_t len = LOGGER_CrashRing_Snapshot(dump, sizeof(dump));
+
+    TEST_ASSERT_EQUAL(4, len);
+    TEST_ASSERT_EQUAL_STRING("new\n", dump);
+}
+
+#endif // TEST
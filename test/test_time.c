@@ -218,4 +218,114 @@ void test_TIME_should_handle_edge_cases(void)
     TEST_ASSERT_EQUAL(0, TIME_GetCurrentMs());  // 오버플로우
 }
 
+// ============================================================================
+// 64비트 단조 시간 / 마감 시각 테스트
+// ============================================================================
+
+void test_TIME_GetMonotonicMs_should_not_wrap_with_32bit_tick(void)
+{
+    TIME_Mock_SetCurrentTime(0xFFFFFFF0);
+    TIME_Mock_AdvanceTime(0x20);
+    
+    TEST_ASSERT_EQUAL_UINT32(0x10, TIME_GetCurrentMs());          // 32비트는 wrap
+    TEST_ASSERT_TRUE(TIME_GetMonotonicMs() == 0x100000010ULL);      // 64비트는 계속 증가
+    TEST_ASSERT_TRUE(TIME_GetMonotonicUs() == 0x100000010ULL * 1000U);
+}
+
+void test_TIME_Deadline_should_expire_across_32bit_wrap(void)
+{
+    // 49.7일 경계 1초 전에 5초 마감 설정
+    TIME_Mock_SetCurrentTime(0xFFFFFFFF - 1000);
+    TIME_Deadline deadline = TIME_DeadlineAfter(5000);
+    
+    TEST_ASSERT_FALSE(TIME_DeadlineExpired(deadline));
+    TEST_ASSERT_TRUE(TIME_DeadlineRemainingMs(deadline) == 5000);
+    
+    // 경계를 넘어 4초 경과 - 32비트 시각은 작아졌지만 아직 만료 전
+    for (int i = 0; i < 40; i++) {
+        TIME_Mock_AdvanceTime(100);
+        TEST_ASSERT_FALSE(TIME_DeadlineExpired(deadline));
+    }
+    TEST_ASSERT_TRUE(TIME_GetCurrentMs() < 0xFFFFFFFF - 1000);
+    TEST_ASSERT_TRUE(TIME_DeadlineRemainingMs(deadline) == 1000);
+    
+    TIME_Mock_AdvanceTime(1000);
+    TEST_ASSERT_TRUE(TIME_DeadlineExpired(deadline));
+    TEST_ASSERT_TRUE(TIME_DeadlineRemainingMs(deadline) == 0);
+}
+
+void test_TIME_Deadline_should_saturate_to_never(void)
+{
+    TIME_Mock_SetCurrentTime(1000);
+    
+    TIME_Deadline deadline = TIME_DeadlineAfter(TIME_DEADLINE_NEVER);
+    TEST_ASSERT_TRUE(deadline == TIME_DEADLINE_NEVER);
+    
+    TIME_Mock_AdvanceTime(0xFFFFFFFF);
+    TEST_ASSERT_FALSE(TIME_DeadlineExpired(deadline));
+    
+    // 0ms 마감은 바로 만료
+    TEST_ASSERT_TRUE(TIME_DeadlineExpired(TIME_DeadlineAfter(0)));
+}
+
+// ============================================================================
+// 달력 변환 함수 테스트
+// ============================================================================
+
+void test_TIME_DateTimeToEpoch_should_return_zero_for_unix_epoch(void)
+{
+    TIME_DateTime dt = {1970, 1, 1, 0, 0, 0};
+    TEST_ASSERT_EQUAL_UINT32(0, TIME_DateTimeToEpoch(&dt));
+}
+
+void test_TIME_DateTimeToEpoch_should_convert_known_date(void)
+{
+    // 2024-02-29 12:34:56 UTC (윤일)
+    TIME_DateTime dt = {2024, 2, 29, 12, 34, 56};
+    TEST_ASSERT_EQUAL_UINT32(1709210096UL, TIME_DateTimeToEpoch(&dt));
+}
+
+void test_TIME_EpochToDateTime_should_convert_known_epoch(void)
+{
+    TIME_DateTime dt;
+    TIME_EpochToDateTime(1709210096UL, &dt);
+
+    TEST_ASSERT_EQUAL(2024, dt.year);
+    TEST_ASSERT_EQUAL(2, dt.month);
+    TEST_ASSERT_EQUAL(29, dt.day);
+    TEST_ASSERT_EQUAL(12, dt.hour);
+    TEST_ASSERT_EQUAL(34, dt.minute);
+    TEST_ASSERT_EQUAL(56, dt.second);
+}
+
+void test_TIME_EpochToDateTime_should_handle_year_rollover(void)
+{
+    // 2019-12-31 23:59:59 + 1초 -> 2020-01-01 00:00:00
+    TIME_DateTime dt = {2019, 12, 31, 23, 59, 59};
+    uint32_t epoch = TIME_DateTimeToEpoch(&dt);
+
+    TIME_EpochToDateTime(epoch + 1, &dt);
+    TEST_ASSERT_EQUAL(2020, dt.year);
+    TEST_ASSERT_EQUAL(1, dt.month);
+    TEST_ASSERT_EQUAL(1, dt.day);
+    TEST_ASSERT_EQUAL(0, dt.hour);
+    TEST_ASSERT_EQUAL(0, dt.minute);
+    TEST_ASSERT_EQUAL(0, dt.second);
+}
+
+void test_TIME_DateTime_should_round_trip_across_years(void)
+{
+    // 하루 + 1초 간격으로 1970~2100 구간 왕복 변환 확인
+    for (uint32_t epoch = 0; epoch < 4102444800UL; epoch += 86401UL * 37) {
+        TIME_DateTime dt;
+        TIME_EpochToDateTime(epoch, &dt);
+        TEST_ASSERT_EQUAL_UINT32(epoch, TIME_DateTimeToEpoch(&dt));
+    }
+}
+
+void test_TIME_DateTimeToEpoch_should_return_zero_for_null(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(0, TIME_DateTimeToEpoch(NULL));
+}
+
 #endif // TEST 
\ No newline at end of file
@@ -0,0 +1,85 @@
+// ============================================================================
+// SD 저널 로그(.LJR) 출력 도구
+//   ljr_dump LORA0001.LJR > LORA0001.TXT
+// 레코드마다 "[timestamp_ms] 텍스트" 한 줄 출력 (바이너리 레코드는 16진수)
+// 유효 구간이 파일 끝보다 짧으면(찢어진 꼬리/잔여 데이터) 경고 출력 후 종료 코드 1
+// ============================================================================
+
+#include "LogJournal.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static size_t read_file(void* ctx, uint32_t offset, uint8_t* buf, size_t len)
+{
+    FILE* in = (FILE*)ctx;
+    if (fseek(in, (long)offset, SEEK_SET) != 0) {
+        return 0;
+    }
+    return fread(buf, 1, len, in);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <file.LJR> [output]\n", argv[0]);
+        return 2;
+    }
+
+    FILE* in = fopen(argv[1], "rb");
+    if (in == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+    FILE* out = (argc > 2) ? fopen(argv[2], "w") : stdout;
+    if (out == NULL) {
+        perror(argv[2]);
+        fclose(in);
+        return 1;
+    }
+
+    static uint8_t buffer[LOG_JOURNAL_MAX_RECORD * 4];
+
+    // 1) 유효 구간 탐색 (타겟의 마운트 복구와 같은 규칙)
+    LogJournalScanResult scan;
+    LogJournal_Scan(NULL, read_file, in, buffer, sizeof(buffer), &scan);
+    fseek(in, 0, SEEK_END);
+    long file_size = ftell(in);
+
+    // 2) 유효 구간의 레코드 출력
+    uint32_t offset = 0;
+    while (offset < scan.valid_end) {
+        size_t got = read_file(in, offset, buffer, LOG_JOURNAL_MAX_RECORD);
+        LogJournalRecord rec;
+        int size = LogJournal_Decode(NULL, buffer, got, &rec);
+        if (size < 0) {
+            break;
+        }
+        if (rec.type == LOG_JOURNAL_TYPE_FILE_HEADER) {
+            fprintf(out, "# LORA%04u.LJR tag %04X opened at %lu ms\n", (unsigned)scan.file_number,
+                    (unsigned)rec.file_tag, (unsigned long)rec.timestamp_ms);
+        } else if (rec.type == LOG_JOURNAL_TYPE_TEXT) {
+            fprintf(out, "[%lu] %.*s\n", (unsigned long)rec.timestamp_ms, (int)rec.length,
+                    (const char*)rec.payload);
+        } else {
+            fprintf(out, "[%lu] type %u:", (unsigned long)rec.timestamp_ms, (unsigned)rec.type);
+            for (uint16_t i = 0; i < rec.length; i++) {
+                fprintf(out, " %02X", rec.payload[i]);
+            }
+            fputc('\n', out);
+        }
+        offset += (uint32_t)size;
+    }
+
+    int status = 0;
+    if ((long)scan.valid_end < file_size) {
+        fprintf(stderr, "ljr_dump: %lu records valid, %ld trailing bytes ignored (torn tail or stale data)\n",
+                (unsigned long)scan.records, file_size - (long)scan.valid_end);
+        status = 1;
+    }
+
+    if (out != stdout) {
+        fclose(out);
+    }
+    fclose(in);
+    return status;
+}
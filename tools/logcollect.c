@@ -0,0 +1,928 @@
+// ============================================================================
+// 원격 로그(LogRemote) 수집/디코딩 도구
+//   logcollect [-j 스레드] [-f csv|json] [-r] 파일...      : 캡처/SD 덤프 파일 (mmap, 병렬)
+//   logcollect -l 9000 [-w raw.bin] [-f json]             : TCP/UDP 수신 (Ctrl+C로 종료 후 출력)
+//   nc rig01 9000 | logcollect -                           : stdin
+// 입력은 LogFrame 프레임이 이어진 바이트열 (v1 StateChangePacket / v2 LogDelta 레코드)
+// 0x5A를 찾아 프레임 CRC가 맞는 곳에서 다시 동기화하므로 SPILL.BIN(레코드 길이 prefix),
+// 중간이 깨진 캡처, SD 이미지 통째로도 읽을 수 있음 (건너뛴 바이트는 skipped_bytes로 보고)
+//
+// 기본 출력은 장치별 통계 한 줄씩:
+//   JOIN 시간   - WAIT_JOIN_OK 체류 시간 (JOIN 요청 후 수락까지)
+//   송신 지연   - WAIT_SEND_RESPONSE 체류 시간
+//   에러 burst - JOIN_RETRY/ERROR로의 전이가 BURST_MIN번 이상 연달아 일어난 구간
+//   heartbeat  - 개수, 최장 간격(생존 신호 공백), 최소 free heap, 최대 송신 큐, 마지막 RSSI
+//   에러 패킷  - 개수, 마지막 ResultCode/모듈
+// 시간 백분위는 LatencyHist log2 버킷 근사 (ms 단위 값을 그대로 기록)
+// -r이면 통계 대신 레코드마다 한 줄 출력
+//
+// 큰 파일은 CHUNK_BYTES 단위로 나눠 스레드가 나눠 디코딩하고, 조각별 결과를 파일 순서대로 합침
+// (조각은 경계 안에서 시작하는 프레임만 처리, 에러 burst는 조각 앞/뒤 연속 구간을 이어 붙임)
+// ============================================================================
+
+#include "LogFrame.h"
+#include "LogDelta.h"
+#include "LogRemote.h"
+#include "LatencyHist.h"
+#include "Checksum.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MAX_DEVICES         256
+#define MAX_THREADS         64
+#define CHUNK_BYTES         (8U * 1024U * 1024U)
+#define BURST_MIN           3
+#define MAX_CLIENTS         64
+#define STREAM_BUFFER       (64U * 1024U)
+
+static const char* const STATE_NAMES[] = {
+    "INIT", "SEND_CMD", "WAIT_OK", "SEND_JOIN", "WAIT_JOIN_OK", "SEND_TIMEREQ", "WAIT_TIMEREQ_OK",
+    "SEND_LTIME", "WAIT_LTIME_RESPONSE", "SEND_PERIODIC", "WAIT_SEND_RESPONSE", "WAIT_SEND_INTERVAL",
+    "JOIN_RETRY", "DONE", "ERROR",
+};
+
+typedef enum { OUTPUT_CSV, OUTPUT_JSON } OutputFormat;
+
+// 연속 에러 전이 구간 (조각끼리 순서대로 합칠 수 있는 형태)
+typedef struct {
+    uint32_t lead;              // 처음부터 이어진 에러 전이 수
+    uint32_t trail;             // 끝에서 이어진 에러 전이 수
+    bool all_error;             // 지금까지 전부 에러 전이 (전이 0개 포함)
+    uint32_t bursts;            // lead/trail을 뺀, 닫힌 burst 수
+    uint32_t max_run;           // 닫힌 구간 중 최장
+} ErrorRuns;
+
+typedef struct {
+    uint32_t transitions;
+    uint32_t bad_records;       // v1 패킷 CRC 불일치, v2 레코드 손상
+    uint32_t join_retries;
+    uint32_t errors;            // JOIN_RETRY/ERROR로의 전이
+    uint16_t max_send_count;
+    uint16_t max_error_count;
+    LatencyHist join_ms;
+    LatencyHist send_ms;
+    ErrorRuns runs;
+    uint32_t heartbeats;
+    uint32_t first_heartbeat_ms;
+    uint32_t last_heartbeat_ms;
+    uint32_t max_heartbeat_gap_ms;  // 연속 heartbeat 사이 최장 간격 (생존 신호 공백)
+    uint32_t min_free_heap;
+    uint32_t max_net_queue_bytes;
+    int8_t last_rssi;
+    uint32_t error_packets;
+    int32_t last_result_code;
+    uint8_t last_error_module;
+} DeviceStats;
+
+typedef struct {
+    uint64_t frames;
+    uint64_t bad_frames;        // 헤더는 맞는데 CRC가 틀린 프레임
+    uint64_t records;
+    uint64_t other_records;     // 상태 변경이 아닌 레코드
+    uint64_t skipped_bytes;     // 프레임 사이 해석 못 한 바이트
+    DeviceStats* devices;       // MAX_DEVICES개 (처음 쓸 때 할당)
+} Totals;
+
+// 파일 조각 하나 = 스레드 작업 하나
+typedef struct {
+    const uint8_t* data;        // 파일 전체 (mmap)
+    size_t size;
+    size_t start;
+    size_t end;                 // [start, end)에서 시작하는 프레임만 처리
+    size_t first_frame;         // 처음 찾은 프레임 위치 (없으면 end)
+    size_t last_end;            // 마지막 프레임 끝 (없으면 start)
+    Totals totals;
+    char* out;                  // -r 출력 (open_memstream)
+    size_t out_len;
+    bool done;
+} Job;
+
+static OutputFormat g_format = OUTPUT_CSV;
+static bool g_records = false;
+static Job* g_jobs;
+static size_t g_job_count;
+static size_t g_next_job;
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_done = PTHREAD_COND_INITIALIZER;
+static volatile sig_atomic_t g_stop;
+
+static const char* _state_name(uint8_t state)
+{
+    return (state < sizeof(STATE_NAMES) / sizeof(STATE_NAMES[0])) ? STATE_NAMES[state] : "?";
+}
+
+static void _runs_init(ErrorRuns* runs)
+{
+    memset(runs, 0, sizeof(*runs));
+    runs->all_error = true;
+}
+
+static void _runs_close(ErrorRuns* runs, uint32_t run)
+{
+    if (run >= BURST_MIN) {
+        runs->bursts++;
+    }
+    if (run > runs->max_run) {
+        runs->max_run = run;
+    }
+}
+
+static void _runs_append(ErrorRuns* runs, bool is_error)
+{
+    if (is_error) {
+        if (runs->all_error) {
+            runs->lead++;
+        }
+        runs->trail++;
+    } else if (runs->all_error) {
+        runs->all_error = false;        // lead는 그대로 남고 끝 구간은 새로 시작
+        runs->trail = 0;
+    } else {
+        _runs_close(runs, runs->trail);
+        runs->trail = 0;
+    }
+}
+
+// a 뒤에 b를 이어 붙임 (b가 나중 구간)
+static void _runs_merge(ErrorRuns* a, const ErrorRuns* b)
+{
+    if (b->all_error && b->trail == 0) {
+        return;                         // b에 전이 없음
+    }
+    if (a->all_error && a->trail == 0) {
+        *a = *b;
+        return;
+    }
+    ErrorRuns merged = *a;
+    merged.bursts += b->bursts;
+    if (b->max_run > merged.max_run) {
+        merged.max_run = b->max_run;
+    }
+    if (a->all_error) {
+        merged.lead = a->lead + b->lead;
+    }
+    if (b->all_error) {
+        merged.trail = a->trail + b->trail;
+    } else {
+        if (!a->all_error) {
+            _runs_close(&merged, a->trail + b->lead);   // 경계를 가로지르는 구간이 닫힘
+        }
+        merged.trail = b->trail;
+    }
+    merged.all_error = a->all_error && b->all_error;
+    *a = merged;
+}
+
+// 최종 burst 수/최장 구간 (처음/끝 구간 포함)
+static void _runs_finish(const ErrorRuns* runs, uint32_t* bursts, uint32_t* max_run)
+{
+    ErrorRuns r = *runs;
+    if (r.all_error) {
+        _runs_close(&r, r.trail);
+    } else {
+        _runs_close(&r, r.lead);
+        _runs_close(&r, r.trail);
+    }
+    *bursts = r.bursts;
+    *max_run = r.max_run;
+}
+
+static DeviceStats* _device(Totals* totals, uint8_t device_id)
+{
+    if (totals->devices == NULL) {
+        totals->devices = calloc(MAX_DEVICES, sizeof(DeviceStats));
+        if (totals->devices == NULL) {
+            perror("calloc");
+            exit(1);
+        }
+        for (int i = 0; i < MAX_DEVICES; i++) {
+            _runs_init(&totals->devices[i].runs);
+        }
+    }
+    return &totals->devices[device_id];
+}
+
+static void _merge_totals(Totals* dst, const Totals* src)
+{
+    dst->frames += src->frames;
+    dst->bad_frames += src->bad_frames;
+    dst->records += src->records;
+    dst->other_records += src->other_records;
+    dst->skipped_bytes += src->skipped_bytes;
+    if (src->devices == NULL) {
+        return;
+    }
+    for (int i = 0; i < MAX_DEVICES; i++) {
+        const DeviceStats* s = &src->devices[i];
+        if (s->transitions == 0 && s->bad_records == 0 && s->heartbeats == 0 && s->error_packets == 0) {
+            continue;
+        }
+        DeviceStats* d = _device(dst, (uint8_t)i);
+        if (s->heartbeats > 0) {
+            if (d->heartbeats == 0) {
+                d->first_heartbeat_ms = s->first_heartbeat_ms;
+                d->min_free_heap = s->min_free_heap;
+            } else if (s->first_heartbeat_ms - d->last_heartbeat_ms > d->max_heartbeat_gap_ms) {
+                d->max_heartbeat_gap_ms = s->first_heartbeat_ms - d->last_heartbeat_ms;   // 조각 경계
+            }
+            if (s->max_heartbeat_gap_ms > d->max_heartbeat_gap_ms) {
+                d->max_heartbeat_gap_ms = s->max_heartbeat_gap_ms;
+            }
+            if (s->min_free_heap < d->min_free_heap) {
+                d->min_free_heap = s->min_free_heap;
+            }
+            if (s->max_net_queue_bytes > d->max_net_queue_bytes) {
+                d->max_net_queue_bytes = s->max_net_queue_bytes;
+            }
+            d->heartbeats += s->heartbeats;
+            d->last_heartbeat_ms = s->last_heartbeat_ms;
+            d->last_rssi = s->last_rssi;
+        }
+        if (s->error_packets > 0) {
+            d->error_packets += s->error_packets;
+            d->last_result_code = s->last_result_code;
+            d->last_error_module = s->last_error_module;
+        }
+        d->transitions += s->transitions;
+        d->bad_records += s->bad_records;
+        d->join_retries += s->join_retries;
+        d->errors += s->errors;
+        if (s->max_send_count > d->max_send_count) {
+            d->max_send_count = s->max_send_count;
+        }
+        if (s->max_error_count > d->max_error_count) {
+            d->max_error_count = s->max_error_count;
+        }
+        LatencyHist_Merge(&d->join_ms, &s->join_ms);
+        LatencyHist_Merge(&d->send_ms, &s->send_ms);
+        _runs_merge(&d->runs, &s->runs);
+    }
+}
+
+static void _print_record(FILE* out, const LogDeltaRecord* r, uint16_t seq)
+{
+    if (g_format == OUTPUT_JSON) {
+        fprintf(out, "{\"device\":%u,\"timestamp_ms\":%lu,\"old_state\":\"%s\",\"new_state\":\"%s\","
+                     "\"duration_ms\":%lu,\"error_count\":%u,\"send_count\":%u,\"error_code\":%u,\"seq\":%u}\n",
+                r->device_id, (unsigned long)r->timestamp_ms, _state_name(r->old_state),
+                _state_name(r->new_state), (unsigned long)r->state_duration, r->error_count,
+                r->send_count, r->error_code, seq);
+    } else {
+        fprintf(out, "%u,%lu,%s,%s,%lu,%u,%u,%u,%u\n", r->device_id, (unsigned long)r->timestamp_ms,
+                _state_name(r->old_state), _state_name(r->new_state), (unsigned long)r->state_duration,
+                r->error_count, r->send_count, r->error_code, seq);
+    }
+}
+
+static void _account(Totals* totals, const LogDeltaRecord* r, uint16_t seq, FILE* out)
+{
+    totals->records++;
+    if (out != NULL) {
+        _print_record(out, r, seq);
+        return;
+    }
+
+    DeviceStats* d = _device(totals, r->device_id);
+    d->transitions++;
+    if (r->old_state == LORA_STATE_WAIT_JOIN_OK) {
+        LatencyHist_Record(&d->join_ms, r->state_duration);
+    } else if (r->old_state == LORA_STATE_WAIT_SEND_RESPONSE) {
+        LatencyHist_Record(&d->send_ms, r->state_duration);
+    }
+    bool is_error = (r->new_state == LORA_STATE_JOIN_RETRY || r->new_state == LORA_STATE_ERROR);
+    if (r->new_state == LORA_STATE_JOIN_RETRY) {
+        d->join_retries++;
+    }
+    if (is_error) {
+        d->errors++;
+    }
+    _runs_append(&d->runs, is_error);
+    if (r->send_count > d->max_send_count) {
+        d->max_send_count = r->send_count;
+    }
+    if (r->error_count > d->max_error_count) {
+        d->max_error_count = r->error_count;
+    }
+}
+
+// -r (레코드 출력)은 상태 변경만 출력, heartbeat/에러 패킷은 개수만 셈
+static void _account_heartbeat(Totals* totals, const HeartbeatPacket* p, FILE* out)
+{
+    totals->records++;
+    if (out != NULL) {
+        return;
+    }
+    DeviceStats* d = _device(totals, p->device_id);
+    if (d->heartbeats == 0) {
+        d->first_heartbeat_ms = p->timestamp;
+        d->min_free_heap = p->free_heap;
+    } else if (p->timestamp - d->last_heartbeat_ms > d->max_heartbeat_gap_ms) {
+        d->max_heartbeat_gap_ms = p->timestamp - d->last_heartbeat_ms;
+    }
+    d->heartbeats++;
+    d->last_heartbeat_ms = p->timestamp;
+    if (p->free_heap < d->min_free_heap) {
+        d->min_free_heap = p->free_heap;
+    }
+    if (p->net_queue_bytes > d->max_net_queue_bytes) {
+        d->max_net_queue_bytes = p->net_queue_bytes;
+    }
+    d->last_rssi = p->last_rssi;
+}
+
+static void _account_error(Totals* totals, const ErrorLogPacket* p, FILE* out)
+{
+    totals->records++;
+    if (out != NULL) {
+        return;
+    }
+    DeviceStats* d = _device(totals, p->device_id);
+    d->error_packets++;
+    d->last_result_code = p->result_code;
+    d->last_error_module = p->module_id;
+}
+
+// v1 패킷 하나 (v1 프레임 레코드 또는 v2 프레임에 그대로 담긴 레코드)
+static void _process_packet(Totals* totals, const uint8_t* rec, size_t len, uint16_t seq, FILE* out)
+{
+    if (rec[0] == PACKET_TYPE_STATE_CHANGE && len == sizeof(StateChangePacket)) {
+        StateChangePacket p;
+        memcpy(&p, rec, sizeof(p));
+        if (Checksum_Crc16(&p, offsetof(StateChangePacket, checksum)) != p.checksum) {
+            _device(totals, p.device_id)->bad_records++;
+            return;
+        }
+        LogDeltaRecord r = {
+            .timestamp_ms = p.timestamp,
+            .device_id = p.device_id,
+            .old_state = p.old_state,
+            .new_state = p.new_state,
+            .state_duration = p.state_duration,
+            .error_count = p.error_count,
+            .send_count = p.send_count,
+            .error_code = p.error_code,
+        };
+        _account(totals, &r, seq, out);
+    } else if (rec[0] == PACKET_TYPE_HEARTBEAT && len == sizeof(HeartbeatPacket)) {
+        HeartbeatPacket p;
+        memcpy(&p, rec, sizeof(p));
+        if (Checksum_Crc16(&p, offsetof(HeartbeatPacket, checksum)) != p.checksum) {
+            _device(totals, p.device_id)->bad_records++;
+        } else {
+            _account_heartbeat(totals, &p, out);
+        }
+    } else if (rec[0] == PACKET_TYPE_ERROR_LOG && len == sizeof(ErrorLogPacket)) {
+        ErrorLogPacket p;
+        memcpy(&p, rec, sizeof(p));
+        if (Checksum_Crc16(&p, offsetof(ErrorLogPacket, checksum)) != p.checksum) {
+            _device(totals, p.device_id)->bad_records++;
+        } else {
+            _account_error(totals, &p, out);
+        }
+    } else {
+        totals->other_records++;
+    }
+}
+
+static void _process_frame(Totals* totals, const LogFrameHeader* header, FILE* out)
+{
+    totals->frames++;
+    size_t offset = 0;
+
+    if (header->version == LOG_FRAME_VERSION_DELTA) {
+        LogDeltaCodec codec;
+        LogDeltaRecord r;
+        uint16_t n = 0;
+        while (LogDelta_NextRecord(header, &codec, &offset, &r)) {
+            if (r.raw != NULL) {
+                _process_packet(totals, r.raw, r.raw_len, header->seq, out);
+            } else {
+                _account(totals, &r, header->seq, out);
+            }
+            n++;
+        }
+        if (offset < header->payload_length || n != header->record_count) {
+            _device(totals, codec.prev.device_id)->bad_records += header->record_count - n;
+        }
+        return;
+    }
+
+    const uint8_t* rec;
+    size_t len;
+    while (LogFrame_NextRecord(header, &offset, &rec, &len)) {
+        _process_packet(totals, rec, len, header->seq, out);
+    }
+}
+
+// data[start, end)에서 시작하는 프레임을 처리 (프레임 끝은 end를 넘어도 됨)
+// 반환: 마지막으로 처리한 프레임의 끝 (없으면 start), *first_frame: 첫 프레임 위치 (없으면 end)
+// stop이 있으면 멈춘 위치 (끝에서 잘린 프레임의 시작, 없으면 end)
+static size_t _scan(Totals* totals, const uint8_t* data, size_t size, size_t start, size_t end,
+                    size_t* first_frame, size_t* stop, FILE* out)
+{
+    size_t pos = start;
+    size_t last_end = start;
+    *first_frame = end;
+
+    while (pos < end) {
+        const uint8_t* magic = memchr(&data[pos], LOG_FRAME_MAGIC, end - pos);
+        if (magic == NULL) {
+            pos = end;
+            break;
+        }
+        pos = (size_t)(magic - data);
+
+        LogFrameHeader header;
+        int frame_size = LogFrame_Decode(&data[pos], size - pos, &header);
+        if (frame_size == LOG_FRAME_TRUNCATED) {
+            break;                      // 끝에서 잘린 프레임 (스트림이면 다음 수신 때 이어서)
+        }
+        if (frame_size <= 0) {
+            if (frame_size == LOG_FRAME_CORRUPT && size - pos >= LOG_FRAME_HEADER_SIZE &&
+                (data[pos + 1] == LOG_FRAME_VERSION || data[pos + 1] == LOG_FRAME_VERSION_DELTA) &&
+                LOG_FRAME_OVERHEAD + (size_t)(data[pos + 6] | (data[pos + 7] << 8)) <= LOG_FRAME_MAX_SIZE) {
+                totals->bad_frames++;   // 헤더는 그럴듯한데 CRC 불일치
+            }
+            pos++;
+            continue;
+        }
+
+        if (*first_frame == end) {
+            *first_frame = pos;
+        } else if (pos > last_end) {
+            totals->skipped_bytes += pos - last_end;
+        }
+        _process_frame(totals, &header, out);
+        pos += (size_t)frame_size;
+        last_end = pos;
+    }
+    if (stop != NULL) {
+        *stop = (pos < end) ? pos : end;
+    }
+    return last_end;
+}
+
+static void* _worker(void* arg)
+{
+    (void)arg;
+    for (;;) {
+        pthread_mutex_lock(&g_lock);
+        size_t index = g_next_job++;
+        pthread_mutex_unlock(&g_lock);
+        if (index >= g_job_count) {
+            return NULL;
+        }
+
+        Job* job = &g_jobs[index];
+        FILE* out = g_records ? open_memstream(&job->out, &job->out_len) : NULL;
+        job->last_end = _scan(&job->totals, job->data, job->size, job->start, job->end, &job->first_frame,
+                              NULL, out);
+        if (out != NULL) {
+            fclose(out);
+        }
+
+        pthread_mutex_lock(&g_lock);
+        job->done = true;
+        pthread_cond_broadcast(&g_done);
+        pthread_mutex_unlock(&g_lock);
+    }
+}
+
+// 파일들을 mmap해 조각으로 나누고 병렬 디코딩, 결과를 파일/조각 순서대로 합침
+static int _run_files(char** paths, int count, int threads, Totals* totals, uint64_t* input_bytes)
+{
+    const uint8_t** maps = calloc((size_t)count, sizeof(*maps));
+    size_t* sizes = calloc((size_t)count, sizeof(*sizes));
+    size_t capacity = 0;
+    int status = 0;
+
+    for (int i = 0; i < count; i++) {
+        int fd = open(paths[i], O_RDONLY);
+        struct stat st;
+        if (fd < 0 || fstat(fd, &st) != 0) {
+            perror(paths[i]);
+            status = 1;
+            if (fd >= 0) {
+                close(fd);
+            }
+            continue;
+        }
+        sizes[i] = (size_t)st.st_size;
+        if (sizes[i] > 0) {
+            void* map = mmap(NULL, sizes[i], PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map == MAP_FAILED) {
+                perror(paths[i]);
+                status = 1;
+                sizes[i] = 0;
+            } else {
+                madvise(map, sizes[i], MADV_SEQUENTIAL);
+                maps[i] = map;
+            }
+        }
+        close(fd);
+        *input_bytes += sizes[i];
+        capacity += sizes[i] / CHUNK_BYTES + 1;
+    }
+
+    g_jobs = calloc(capacity, sizeof(Job));
+    g_job_count = 0;
+    for (int i = 0; i < count; i++) {
+        for (size_t start = 0; start < sizes[i]; start += CHUNK_BYTES) {
+            Job* job = &g_jobs[g_job_count++];
+            job->data = maps[i];
+            job->size = sizes[i];
+            job->start = start;
+            job->end = (sizes[i] - start > CHUNK_BYTES) ? start + CHUNK_BYTES : sizes[i];
+        }
+    }
+
+    pthread_t tids[MAX_THREADS];
+    int started = 0;
+    for (int t = 0; t < threads && (size_t)t < g_job_count; t++) {
+        if (pthread_create(&tids[started], NULL, _worker, NULL) == 0) {
+            started++;
+        }
+    }
+    if (started == 0) {
+        _worker(NULL);
+    }
+
+    // 조각 순서대로 결과 합치기 (-r 출력도 순서대로)
+    const uint8_t* data = NULL;
+    size_t cursor = 0;
+    for (size_t j = 0; j < g_job_count; j++) {
+        Job* job = &g_jobs[j];
+        pthread_mutex_lock(&g_lock);
+        while (!job->done) {
+            pthread_cond_wait(&g_done, &g_lock);
+        }
+        pthread_mutex_unlock(&g_lock);
+
+        if (job->data != data) {
+            data = job->data;
+            cursor = 0;
+        }
+        if (job->first_frame < job->end) {
+            if (job->first_frame > cursor) {
+                totals->skipped_bytes += job->first_frame - cursor;
+            }
+            if (job->last_end > cursor) {
+                cursor = job->last_end;
+            }
+        }
+        if (job->end == job->size && job->size > cursor) {
+            totals->skipped_bytes += job->size - cursor;        // 파일 끝의 잘린 프레임/잔여
+        }
+        _merge_totals(totals, &job->totals);
+        free(job->totals.devices);
+        if (job->out != NULL) {
+            fwrite(job->out, 1, job->out_len, stdout);
+            free(job->out);
+        }
+    }
+    for (int t = 0; t < started; t++) {
+        pthread_join(tids[t], NULL);
+    }
+
+    for (int i = 0; i < count; i++) {
+        if (maps[i] != NULL) {
+            munmap((void*)maps[i], sizes[i]);
+        }
+    }
+    free(g_jobs);
+    free(maps);
+    free(sizes);
+    return status;
+}
+
+// 스트림 입력 (TCP 연결/stdin) - 잘린 프레임은 다음 수신 때 이어서
+typedef struct {
+    int fd;
+    uint8_t buffer[STREAM_BUFFER];
+    size_t len;
+} Stream;
+
+static void _stream_consume(Stream* s, Totals* totals)
+{
+    size_t first_frame;
+    size_t next;
+    size_t last_end = _scan(totals, s->buffer, s->len, 0, s->len, &first_frame, &next,
+                            g_records ? stdout : NULL);
+
+    // 끝에서 잘린 프레임부터 보관 (그 앞의 해석 못 한 바이트는 버림)
+    totals->skipped_bytes += (first_frame < s->len) ? first_frame + (next - last_end) : next;
+    if (s->len - next == sizeof(s->buffer)) {
+        next++;                         // 버퍼 가득 - 동기화 안 되는 0x5A 하나 버림
+        totals->skipped_bytes++;
+    }
+    memmove(s->buffer, &s->buffer[next], s->len - next);
+    s->len -= next;
+}
+
+static void _on_signal(int sig)
+{
+    (void)sig;
+    g_stop = 1;
+}
+
+static int _listen(int type, uint16_t port)
+{
+    int fd = socket(AF_INET, type, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 ||
+        (type == SOCK_STREAM && listen(fd, MAX_CLIENTS) != 0)) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// stdin 또는 TCP/UDP 수신. stdin만 쓰면 EOF에서, 소켓이면 SIGINT/SIGTERM에서 종료
+static int _run_streams(bool use_stdin, uint16_t port, FILE* raw, Totals* totals, uint64_t* input_bytes)
+{
+    static Stream streams[MAX_CLIENTS];
+    static uint8_t datagram[65536];
+    struct pollfd fds[MAX_CLIENTS + 2];
+    int tcp = -1;
+    int udp = -1;
+
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+        streams[i].fd = -1;
+    }
+    if (use_stdin) {
+        streams[0].fd = STDIN_FILENO;
+    }
+    if (port != 0) {
+        tcp = _listen(SOCK_STREAM, port);
+        udp = _listen(SOCK_DGRAM, port);
+        if (tcp < 0 || udp < 0) {
+            fprintf(stderr, "logcollect: cannot listen on port %u: %s\n", port, strerror(errno));
+            return 1;
+        }
+        fprintf(stderr, "logcollect: listening on TCP/UDP %u\n", port);
+    }
+
+    signal(SIGINT, _on_signal);
+    signal(SIGTERM, _on_signal);
+    signal(SIGPIPE, SIG_IGN);
+
+    while (!g_stop) {
+        int n = 0;
+        int open_streams = 0;
+        for (int i = 0; i < MAX_CLIENTS; i++) {
+            if (streams[i].fd >= 0) {
+                fds[n++] = (struct pollfd){ streams[i].fd, POLLIN, 0 };
+                open_streams++;
+            }
+        }
+        if (tcp >= 0) {
+            fds[n++] = (struct pollfd){ tcp, POLLIN, 0 };
+            fds[n++] = (struct pollfd){ udp, POLLIN, 0 };
+        } else if (open_streams == 0) {
+            break;                      // stdin EOF
+        }
+        if (poll(fds, (nfds_t)n, 1000) <= 0) {
+            continue;
+        }
+
+        for (int k = 0; k < n; k++) {
+            if (fds[k].revents == 0) {
+                continue;
+            }
+            if (fds[k].fd == tcp) {
+                int client = accept(tcp, NULL, NULL);
+                int slot = 0;
+                while (slot < MAX_CLIENTS && streams[slot].fd >= 0) {
+                    slot++;
+                }
+                if (client >= 0 && slot < MAX_CLIENTS) {
+                    streams[slot].fd = client;
+                    streams[slot].len = 0;
+                } else if (client >= 0) {
+                    close(client);
+                }
+            } else if (fds[k].fd == udp) {
+                ssize_t got = recv(udp, datagram, sizeof(datagram), 0);
+                if (got > 0) {
+                    *input_bytes += (uint64_t)got;
+                    if (raw != NULL) {
+                        fwrite(datagram, 1, (size_t)got, raw);
+                    }
+                    size_t first_frame;
+                    size_t last_end = _scan(totals, datagram, (size_t)got, 0, (size_t)got, &first_frame,
+                                            NULL, g_records ? stdout : NULL);
+                    totals->skipped_bytes += (first_frame < (size_t)got) ? first_frame + (size_t)got - last_end
+                                                                          : (size_t)got;
+                }
+            } else {
+                Stream* s = NULL;
+                for (int i = 0; i < MAX_CLIENTS; i++) {
+                    if (streams[i].fd == fds[k].fd) {
+                        s = &streams[i];
+                    }
+                }
+                ssize_t got = read(s->fd, &s->buffer[s->len], sizeof(s->buffer) - s->len);
+                if (got <= 0) {
+                    totals->skipped_bytes += s->len;
+                    if (s->fd != STDIN_FILENO) {
+                        close(s->fd);
+                    }
+                    s->fd = -1;
+                    s->len = 0;
+                    continue;
+                }
+                *input_bytes += (uint64_t)got;
+                if (raw != NULL) {
+                    fwrite(&s->buffer[s->len], 1, (size_t)got, raw);
+                }
+                s->len += (size_t)got;
+                _stream_consume(s, totals);
+            }
+        }
+    }
+
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+        if (streams[i].fd > STDIN_FILENO) {
+            close(streams[i].fd);
+        }
+    }
+    if (tcp >= 0) {
+        close(tcp);
+        close(udp);
+    }
+    return 0;
+}
+
+static void _print_stats(const Totals* totals)
+{
+    if (g_format == OUTPUT_CSV) {
+        printf("device,transitions,bad_records,join_n,join_avg_ms,join_p50_ms,join_p99_ms,join_max_ms,"
+               "send_n,send_avg_ms,send_p50_ms,send_p99_ms,send_max_ms,join_retries,errors,"
+               "error_bursts,max_error_run,max_send_count,max_error_count,heartbeats,max_heartbeat_gap_ms,"
+               "min_free_heap,max_net_queue_bytes,last_rssi,error_packets,last_result_code,last_error_module\n");
+    } else {
+        printf("[");
+    }
+
+    bool first = true;
+    for (int i = 0; totals->devices != NULL && i < MAX_DEVICES; i++) {
+        const DeviceStats* d = &totals->devices[i];
+        if (d->transitions == 0 && d->bad_records == 0 && d->heartbeats == 0 && d->error_packets == 0) {
+            continue;
+        }
+        uint32_t bursts;
+        uint32_t max_run;
+        _runs_finish(&d->runs, &bursts, &max_run);
+        const LatencyHist* j = &d->join_ms;
+        const LatencyHist* s = &d->send_ms;
+
+        if (g_format == OUTPUT_CSV) {
+            printf("%d,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%d,%u,%d,%u\n", i,
+                   d->transitions, d->bad_records, j->count, LatencyHist_AverageUs(j),
+                   LatencyHist_Percentile(j, 500), LatencyHist_Percentile(j, 990), j->max_us, s->count,
+                   LatencyHist_AverageUs(s), LatencyHist_Percentile(s, 500), LatencyHist_Percentile(s, 990),
+                   s->max_us, d->join_retries, d->errors, bursts, max_run, d->max_send_count,
+                   d->max_error_count, d->heartbeats, d->max_heartbeat_gap_ms, d->min_free_heap,
+                   d->max_net_queue_bytes, d->last_rssi, d->error_packets, d->last_result_code,
+                   d->last_error_module);
+        } else {
+            printf("%s\n {\"device\":%d,\"transitions\":%u,\"bad_records\":%u,"
+                   "\"join\":{\"n\":%u,\"avg_ms\":%u,\"p50_ms\":%u,\"p99_ms\":%u,\"max_ms\":%u},"
+                   "\"send\":{\"n\":%u,\"avg_ms\":%u,\"p50_ms\":%u,\"p99_ms\":%u,\"max_ms\":%u},"
+                   "\"join_retries\":%u,\"errors\":%u,\"error_bursts\":%u,\"max_error_run\":%u,"
+                   "\"max_send_count\":%u,\"max_error_count\":%u,"
+                   "\"heartbeat\":{\"n\":%u,\"max_gap_ms\":%u,\"min_free_heap\":%u,\"max_net_queue_bytes\":%u,"
+                   "\"last_rssi\":%d},\"error_packets\":%u,\"last_result_code\":%d,\"last_error_module\":%u}",
+                   first ? "" : ",", i, d->transitions, d->bad_records, j->count, LatencyHist_AverageUs(j),
+                   LatencyHist_Percentile(j, 500), LatencyHist_Percentile(j, 990), j->max_us, s->count,
+                   LatencyHist_AverageUs(s), LatencyHist_Percentile(s, 500), LatencyHist_Percentile(s, 990),
+                   s->max_us, d->join_retries, d->errors, bursts, max_run, d->max_send_count,
+                   d->max_error_count, d->heartbeats, d->max_heartbeat_gap_ms, d->min_free_heap,
+                   d->max_net_queue_bytes, d->last_rssi, d->error_packets, d->last_result_code,
+                   d->last_error_module);
+        }
+        first = false;
+    }
+    if (g_format == OUTPUT_JSON) {
+        printf("\n]\n");
+    }
+}
+
+static void _usage(const char* name)
+{
+    fprintf(stderr, "usage: %s [-j threads] [-f csv|json] [-r] [-l port] [-w raw.bin] [file...|-]\n"
+                    "  file  LogRemote capture / SPILL.BIN / SD image (mmap, parallel)\n"
+                    "  -     read stdin, -l port: receive TCP/UDP until Ctrl+C\n"
+                    "  -r    print decoded records instead of per-device stats\n"
+                    "  -w    append received stream bytes to a file (stdin/socket)\n", name);
+}
+
+int main(int argc, char** argv)
+{
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    uint16_t port = 0;
+    const char* raw_path = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "j:f:rl:w:h")) != -1) {
+        switch (opt) {
+        case 'j':
+            threads = atoi(optarg);
+            break;
+        case 'f':
+            if (strcmp(optarg, "json") == 0) {
+                g_format = OUTPUT_JSON;
+            } else if (strcmp(optarg, "csv") != 0) {
+                _usage(argv[0]);
+                return 2;
+            }
+            break;
+        case 'r':
+            g_records = true;
+            break;
+        case 'l':
+            port = (uint16_t)atoi(optarg);
+            break;
+        case 'w':
+            raw_path = optarg;
+            break;
+        default:
+            _usage(argv[0]);
+            return 2;
+        }
+    }
+    if (threads < 1) {
+        threads = 1;
+    } else if (threads > MAX_THREADS) {
+        threads = MAX_THREADS;
+    }
+
+    bool use_stdin = (optind == argc && port == 0) ||
+                     (optind + 1 == argc && strcmp(argv[optind], "-") == 0);
+    if (port == 0 && !use_stdin && optind == argc) {
+        _usage(argv[0]);
+        return 2;
+    }
+
+    Checksum_Init();
+    if (g_records && g_format == OUTPUT_CSV) {
+        printf("device,timestamp_ms,old_state,new_state,duration_ms,error_count,send_count,error_code,seq\n");
+    }
+
+    Totals totals;
+    memset(&totals, 0, sizeof(totals));
+    uint64_t input_bytes = 0;
+    struct timespec t0;
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    int status;
+    if (use_stdin || port != 0) {
+        FILE* raw = (raw_path != NULL) ? fopen(raw_path, "ab") : NULL;
+        if (raw_path != NULL && raw == NULL) {
+            perror(raw_path);
+            return 1;
+        }
+        status = _run_streams(use_stdin, port, raw, &totals, &input_bytes);
+        if (raw != NULL) {
+            fclose(raw);
+        }
+    } else {
+        status = _run_files(&argv[optind], argc - optind, threads, &totals, &input_bytes);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double seconds = (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) / 1e9;
+    if (!g_records) {
+        _print_stats(&totals);
+    }
+    fprintf(stderr, "logcollect: %llu bytes, %llu frames (%llu bad), %llu records (%llu other), "
+                    "%llu skipped bytes, %.3f s (%.1f MB/s)\n",
+            (unsigned long long)input_bytes, (unsigned long long)totals.frames,
+            (unsigned long long)totals.bad_frames, (unsigned long long)totals.records,
+            (unsigned long long)totals.other_records, (unsigned long long)totals.skipped_bytes, seconds,
+            seconds > 0.0 ? (double)input_bytes / seconds / 1e6 : 0.0);
+    free(totals.devices);
+    return status;
+}
@@ -0,0 +1,174 @@
+// ============================================================================
+// SD 로그 시간 구간 추출 도구 (시간 인덱스 .IDX 사용)
+//   logslice LORA0012.TXT "2025-08-09 03:12:00" "2025-08-09 03:20:00"
+//   logslice LORA0012.LJR 1754709120 1754709600
+// 시각은 UTC (epoch 초 또는 "YYYY-MM-DD HH:MM:SS"), to를 생략하면 from 이후 전부.
+// 인덱스를 이진 탐색해 구간을 포함하는 조각만 읽음 (파일 전체를 읽지 않음).
+//   .TXT: 조각을 그대로 출력 (양 끝에 인덱스 간격만큼 여유 포함)
+//   .LJR: 레코드 tick을 인덱스 기준점으로 epoch 환산해 구간 안의 레코드만 출력
+// 인덱스가 없거나 비어 있으면 파일 전체를 대상으로 함.
+// ============================================================================
+
+#include "LogTimeIndex.h"
+#include "LogJournal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_ENTRIES     (1024 * 1024)
+
+static bool parse_time(const char* text, uint32_t* epoch)
+{
+    struct tm tm;
+    memset(&tm, 0, sizeof(tm));
+    if (sscanf(text, "%d-%d-%d%*[ T]%d:%d:%d", &tm.tm_year, &tm.tm_mon, &tm.tm_mday,
+               &tm.tm_hour, &tm.tm_min, &tm.tm_sec) == 6) {
+        tm.tm_year -= 1900;
+        tm.tm_mon -= 1;
+        *epoch = (uint32_t)timegm(&tm);
+        return true;
+    }
+    char* end = NULL;
+    unsigned long value = strtoul(text, &end, 10);
+    if (end != text && *end == '\0') {
+        *epoch = (uint32_t)value;
+        return true;
+    }
+    return false;
+}
+
+static void format_time(uint32_t epoch, char* buf, size_t size)
+{
+    time_t t = (time_t)epoch;
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    strftime(buf, size, "%Y-%m-%d %H:%M:%S", &tm);
+}
+
+// LORA0012.TXT -> LORA0012.IDX
+static size_t load_index(const char* log_path, LogTimeIndexEntry* entries, size_t max_entries)
+{
+    char path[1024];
+    const char* dot = strrchr(log_path, '.');
+    if (dot == NULL || (size_t)(dot - log_path) + 5 > sizeof(path)) {
+        return 0;
+    }
+    snprintf(path, sizeof(path), "%.*s.IDX", (int)(dot - log_path), log_path);
+
+    FILE* in = fopen(path, "rb");
+    if (in == NULL) {
+        return 0;
+    }
+    fseek(in, 0, SEEK_END);
+    long size = ftell(in);
+    fseek(in, 0, SEEK_SET);
+    uint8_t* raw = malloc(size > 0 ? (size_t)size : 1);
+    size_t got = (raw != NULL) ? fread(raw, 1, (size_t)size, in) : 0;
+    fclose(in);
+
+    size_t count = LogTimeIndex_Parse(raw, got, entries, max_entries);
+    if (count * LOG_TIME_INDEX_ENTRY_SIZE < got) {
+        fprintf(stderr, "logslice: %s: %zu entries valid, %zu trailing bytes ignored\n", path, count,
+                got - count * LOG_TIME_INDEX_ENTRY_SIZE);
+    }
+    free(raw);
+    return count;
+}
+
+static void copy_text(FILE* in, uint32_t start, uint32_t end, FILE* out)
+{
+    static char buffer[64 * 1024];
+    fseek(in, (long)start, SEEK_SET);
+    uint32_t remaining = end - start;
+    while (remaining > 0) {
+        size_t chunk = remaining < sizeof(buffer) ? remaining : sizeof(buffer);
+        size_t got = fread(buffer, 1, chunk, in);
+        if (got == 0) {
+            break;
+        }
+        fwrite(buffer, 1, got, out);
+        remaining -= (uint32_t)got;
+    }
+}
+
+static void print_journal(FILE* in, uint32_t start, uint32_t end, uint32_t from, uint32_t to,
+                          const LogTimeIndexEntry* entries, size_t count, FILE* out)
+{
+    static uint8_t buffer[LOG_JOURNAL_MAX_RECORD];
+    uint32_t offset = start;
+    while (offset < end) {
+        fseek(in, (long)offset, SEEK_SET);
+        size_t got = fread(buffer, 1, sizeof(buffer), in);
+        LogJournalRecord rec;
+        int size = LogJournal_Decode(NULL, buffer, got, &rec);
+        if (size < 0) {
+            break;  // 찢어진 꼬리 / 사전 할당 잔여 영역
+        }
+
+        // 레코드 tick을 직전 인덱스 항목의 (epoch, tick)으로 환산 (동기화 전이면 tick만 출력)
+        const LogTimeIndexEntry* anchor = LogTimeIndex_Anchor(entries, count, offset);
+        if (anchor != NULL && anchor->epoch_sec != 0) {
+            int32_t delta_ms = (int32_t)(rec.timestamp_ms - anchor->uptime_ms);
+            uint32_t epoch = anchor->epoch_sec + (uint32_t)(delta_ms / 1000);
+            if (rec.type == LOG_JOURNAL_TYPE_TEXT && epoch >= from && epoch <= to) {
+                char when[32];
+                format_time(epoch, when, sizeof(when));
+                fprintf(out, "[%s] %.*s\n", when, (int)rec.length, (const char*)rec.payload);
+            }
+        } else if (rec.type == LOG_JOURNAL_TYPE_TEXT) {
+            fprintf(out, "[%lu ms] %.*s\n", (unsigned long)rec.timestamp_ms, (int)rec.length,
+                    (const char*)rec.payload);
+        }
+        offset += (uint32_t)size;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t from = 0;
+    uint32_t to = UINT32_MAX;
+    if (argc < 3 || !parse_time(argv[2], &from) || (argc > 3 && !parse_time(argv[3], &to))) {
+        fprintf(stderr, "usage: %s <LORA####.TXT|LJR> <from> [to]\n"
+                        "  time: UTC epoch seconds or \"YYYY-MM-DD HH:MM:SS\"\n", argv[0]);
+        return 2;
+    }
+
+    FILE* in = fopen(argv[1], "rb");
+    if (in == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+    fseek(in, 0, SEEK_END);
+    uint32_t file_size = (uint32_t)ftell(in);
+
+    static LogTimeIndexEntry entries[MAX_ENTRIES];
+    size_t count = load_index(argv[1], entries, MAX_ENTRIES);
+    uint32_t start = 0;
+    uint32_t end = file_size;
+    if (count == 0) {
+        fprintf(stderr, "logslice: no time index for %s, reading whole file\n", argv[1]);
+    } else {
+        LogTimeIndex_FindRange(entries, count, from, to, &start, &end);
+        if (end > file_size) {
+            end = file_size;
+        }
+        if (start > end) {
+            start = end;
+        }
+    }
+
+    const char* dot = strrchr(argv[1], '.');
+    bool journal = dot != NULL && (strcmp(dot, ".LJR") == 0 || strcmp(dot, ".ljr") == 0);
+    if (journal) {
+        print_journal(in, start, end, from, to, entries, count, stdout);
+    } else {
+        copy_text(in, start, end, stdout);
+    }
+
+    fprintf(stderr, "logslice: read %lu of %lu bytes (offset %lu..%lu, %zu index entries)\n",
+            (unsigned long)(end - start), (unsigned long)file_size, (unsigned long)start,
+            (unsigned long)end, count);
+    fclose(in);
+    return 0;
+}
@@ -0,0 +1,81 @@
+// ============================================================================
+// SD 압축 로그(.LZL) 복원 도구
+//   lzl_decode LORA0001.LZL > LORA0001.TXT
+// 마지막 블록이 잘린 경우(전원 차단) 그 이전까지 복원하고 경고 출력
+// ============================================================================
+
+#include "LogCompress.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <file.LZL> [output]\n", argv[0]);
+        return 2;
+    }
+
+    FILE* in = fopen(argv[1], "rb");
+    if (in == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+    FILE* out = (argc > 2) ? fopen(argv[2], "wb") : stdout;
+    if (out == NULL) {
+        perror(argv[2]);
+        fclose(in);
+        return 1;
+    }
+
+    static LogDecompressor decompressor;
+    static uint8_t block[LOG_COMPRESS_BLOCK_SIZE];
+    static uint8_t text[0x10000];
+    LogDecompress_Init(&decompressor);
+
+    int status = 0;
+    unsigned long block_count = 0;
+    unsigned long long offset = 0;
+
+    for (;;) {
+        size_t header_len = fread(block, 1, LOG_COMPRESS_HEADER_SIZE, in);
+        if (header_len == 0) {
+            break;  // 정상 종료
+        }
+
+        size_t payload_len = 0;
+        if (header_len == LOG_COMPRESS_HEADER_SIZE) {
+            payload_len = (size_t)block[2] | ((size_t)block[3] << 8);
+        }
+        if (LOG_COMPRESS_HEADER_SIZE + payload_len > sizeof(block)) {
+            fprintf(stderr, "lzl_decode: corrupt block header at offset %llu\n", offset);
+            status = 1;
+            break;
+        }
+        size_t got = header_len + fread(&block[header_len], 1, payload_len, in);
+
+        size_t consumed = 0;
+        size_t text_len = 0;
+        int result = LogDecompress_Block(&decompressor, block, got, &consumed, text, sizeof(text), &text_len);
+        if (result == LOG_COMPRESS_TRUNCATED) {
+            fprintf(stderr, "lzl_decode: truncated block at offset %llu (%lu blocks recovered)\n",
+                    offset, block_count);
+            status = 1;
+            break;
+        }
+        if (result != LOG_COMPRESS_OK) {
+            fprintf(stderr, "lzl_decode: corrupt block at offset %llu (error %d)\n", offset, result);
+            status = 1;
+            break;
+        }
+
+        fwrite(text, 1, text_len, out);
+        offset += consumed;
+        block_count++;
+    }
+
+    if (out != stdout) {
+        fclose(out);
+    }
+    fclose(in);
+    return status;
+}